@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -470,6 +470,97 @@ compute_depthwise_convolution_shape(const ITensorInfo &input, const ITensorInfo
     return output_shape;
 }
 
+/** Calculate the output shape of an inverted residual block
+ *
+ * @param[in] input        Input tensor info
+ * @param[in] dw_weights   Depthwise weights tensor info
+ * @param[in] proj_weights Projection weights tensor info
+ * @param[in] dw_info      Depthwise stage padding and stride information
+ *
+ * @return the calculated shape
+ */
+inline TensorShape compute_inverted_residual_shape(const ITensorInfo   &input,
+                                                   const ITensorInfo   &dw_weights,
+                                                   const ITensorInfo   &proj_weights,
+                                                   const PadStrideInfo &dw_info)
+{
+    const TensorShape input_shape{input.tensor_shape()};
+
+    const DataLayout data_layout = input.data_layout();
+    const int        width_idx   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const int        height_idx  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const int        channel_idx = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+
+    const DataLayout weights_data_layout = dw_weights.data_layout();
+    const int weights_width_idx  = get_data_layout_dimension_index(weights_data_layout, DataLayoutDimension::WIDTH);
+    const int weights_height_idx = get_data_layout_dimension_index(weights_data_layout, DataLayoutDimension::HEIGHT);
+    const int weights_batch_idx =
+        get_data_layout_dimension_index(proj_weights.data_layout(), DataLayoutDimension::BATCHES);
+
+    unsigned int output_width  = 0;
+    unsigned int output_height = 0;
+    std::tie(output_width, output_height) =
+        scaled_dimensions(input_shape[width_idx], input_shape[height_idx], dw_weights.dimension(weights_width_idx),
+                          dw_weights.dimension(weights_height_idx), dw_info);
+
+    TensorShape output_shape{input_shape};
+    output_shape.set(width_idx, output_width);
+    output_shape.set(height_idx, output_height);
+    output_shape.set(channel_idx, proj_weights.dimension(weights_batch_idx));
+
+    return output_shape;
+}
+
+/** Calculate the output shape of a global average pooling followed by a fully connected layer
+ *
+ * @param[in] input             Input tensor info
+ * @param[in] weights           Fully connected weights tensor info
+ * @param[in] transpose_weights True if the weights are stored as [IFM, OFM], false if [OFM, IFM]
+ *
+ * @return the calculated shape
+ */
+inline TensorShape compute_global_pooling_fully_connected_shape(const ITensorInfo &input,
+                                                                const ITensorInfo &weights,
+                                                                bool               transpose_weights)
+{
+    const int batch_idx = get_data_layout_dimension_index(input.data_layout(), DataLayoutDimension::BATCHES);
+
+    return TensorShape(weights.dimension(transpose_weights ? 1 : 0), input.dimension(batch_idx));
+}
+
+/** Calculate the output shape of a matrix multiplication with packed signed 4-bit weights
+ *
+ * @param[in] a Input tensor info with dimensions [K, M, batches]
+ * @param[in] b Packed weights tensor info with dimensions [ceil(K / 2), N]
+ *
+ * @return the calculated shape
+ */
+inline TensorShape compute_gemm_int4_shape(const ITensorInfo &a, const ITensorInfo &b)
+{
+    TensorShape output_shape{a.tensor_shape()};
+    output_shape.set(0, b.dimension(1));
+
+    return output_shape;
+}
+
+/** Calculate the output shape of an embedding bag
+ *
+ * @param[in] table   Embedding table tensor info with dimensions [width, num_rows]. A U8 table packs two 4-bit
+ *                    channels per byte.
+ * @param[in] indices Indices tensor info with dimensions [num_indices]
+ * @param[in] offsets Offsets of the bags tensor info with dimensions [num_bags], or nullptr for one row per index
+ *
+ * @return the calculated shape
+ */
+inline TensorShape
+compute_embedding_bag_shape(const ITensorInfo &table, const ITensorInfo &indices, const ITensorInfo *offsets)
+{
+    const size_t embedding_dim = table.data_type() == DataType::U8 ? 2 * table.dimension(0) : table.dimension(0);
+    const size_t num_outputs   = offsets != nullptr ? offsets->dimension(0) : indices.dimension(0);
+
+    return TensorShape(embedding_dim, num_outputs);
+}
+
 /** Calculate padding required for deconvolution
  *
  * @param[in] input    Input tensor info
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_FUNCTION_INFO_ELEMENTWISEEXPRESSIONINFO_H
+#define ACL_ARM_COMPUTE_FUNCTION_INFO_ELEMENTWISEEXPRESSIONINFO_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+/** Maximum number of inputs of an elementwise expression */
+constexpr unsigned int elementwise_expression_max_inputs = 8;
+/** Maximum number of nodes of an elementwise expression */
+constexpr unsigned int elementwise_expression_max_nodes = 32;
+
+/** Operations of an elementwise expression */
+enum class ElementwiseExpressionOp
+{
+    ADD,          /**< lhs + rhs */
+    SUB,          /**< lhs - rhs */
+    MUL,          /**< lhs * rhs */
+    DIV,          /**< lhs / rhs */
+    MAX,          /**< max(lhs, rhs) */
+    MIN,          /**< min(lhs, rhs) */
+    SQUARED_DIFF, /**< (lhs - rhs)^2 */
+    POWER,        /**< lhs^rhs */
+    NEG,          /**< -src */
+    ABS,          /**< |src| */
+    EXP,          /**< exp(src) */
+    LOG,          /**< log(src) */
+    RSQRT,        /**< 1 / sqrt(src) */
+    SIN,          /**< sin(src) */
+    ACTIVATION    /**< Activation function of src */
+};
+
+/** Check if an elementwise expression operation takes two operands
+ *
+ * @param[in] op Operation to check.
+ *
+ * @return True if @p op is a binary operation
+ */
+inline bool is_binary_elementwise_expression_op(ElementwiseExpressionOp op)
+{
+    return op <= ElementwiseExpressionOp::POWER;
+}
+
+/** Node of an elementwise expression */
+struct ElementwiseExpressionNode
+{
+    ElementwiseExpressionOp op{ElementwiseExpressionOp::ADD}; /**< Operation */
+    unsigned int            lhs{0};                           /**< Value of the first operand */
+    unsigned int            rhs{0};                           /**< Value of the second operand, unused if unary */
+    ActivationLayerInfo     act_info{};                       /**< Activation function of an ACTIVATION node */
+};
+
+/** Elementwise expression information
+ *
+ * The expression is a DAG of elementwise operations. Values 0 to num_inputs() - 1 are the inputs of the expression
+ * and each node adds a value computed from previous ones, the last of which is the result of the expression.
+ * Operands broadcast as in the elementwise arithmetic functions.
+ */
+class ElementwiseExpressionInfo
+{
+public:
+    /** Identifier of an input or a node result */
+    using Value = unsigned int;
+
+    /** Constructor
+     *
+     * @param[in] num_inputs (Optional) Number of inputs of the expression.
+     */
+    explicit ElementwiseExpressionInfo(unsigned int num_inputs = 0) : _num_inputs(num_inputs), _nodes()
+    {
+    }
+    /** Value of an input
+     *
+     * @param[in] idx Index of the input.
+     *
+     * @return The value of the input
+     */
+    Value input(unsigned int idx) const
+    {
+        return idx;
+    }
+    /** Add a binary operation
+     *
+     * @param[in] op  Binary operation.
+     * @param[in] lhs First operand.
+     * @param[in] rhs Second operand.
+     *
+     * @return The value of the result
+     */
+    Value binary(ElementwiseExpressionOp op, Value lhs, Value rhs)
+    {
+        _nodes.push_back(ElementwiseExpressionNode{op, lhs, rhs, ActivationLayerInfo()});
+        return static_cast<Value>(_num_inputs + _nodes.size() - 1);
+    }
+    /** Add a unary operation
+     *
+     * @param[in] op  Unary operation.
+     * @param[in] src Operand.
+     *
+     * @return The value of the result
+     */
+    Value unary(ElementwiseExpressionOp op, Value src)
+    {
+        _nodes.push_back(ElementwiseExpressionNode{op, src, src, ActivationLayerInfo()});
+        return static_cast<Value>(_num_inputs + _nodes.size() - 1);
+    }
+    /** Add an activation function
+     *
+     * @param[in] src      Operand.
+     * @param[in] act_info Activation function.
+     *
+     * @return The value of the result
+     */
+    Value activation(Value src, const ActivationLayerInfo &act_info)
+    {
+        _nodes.push_back(ElementwiseExpressionNode{ElementwiseExpressionOp::ACTIVATION, src, src, act_info});
+        return static_cast<Value>(_num_inputs + _nodes.size() - 1);
+    }
+    /** Number of inputs of the expression */
+    unsigned int num_inputs() const
+    {
+        return _num_inputs;
+    }
+    /** Nodes of the expression in evaluation order */
+    const std::vector<ElementwiseExpressionNode> &nodes() const
+    {
+        return _nodes;
+    }
+
+private:
+    unsigned int                           _num_inputs;
+    std::vector<ElementwiseExpressionNode> _nodes;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_FUNCTION_INFO_ELEMENTWISEEXPRESSIONINFO_H
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_FUNCTION_INFO_EMBEDDINGBAGINFO_H
+#define ACL_ARM_COMPUTE_FUNCTION_INFO_EMBEDDINGBAGINFO_H
+
+/** @file
+ * @publicapi
+ */
+
+namespace arm_compute
+{
+/** Pooling of the rows gathered for a bag */
+enum class EmbeddingBagMode
+{
+    NONE, /**< No pooling: every index produces its own output row */
+    SUM,  /**< Sum of the rows of the bag */
+    MEAN  /**< Mean of the rows of the bag */
+};
+
+/** Embedding bag information */
+struct EmbeddingBagInfo
+{
+    /** Default constructor */
+    EmbeddingBagInfo() = default;
+    /** Constructor
+     *
+     * @param[in] mode              Pooling of the rows of a bag.
+     * @param[in] prefetch_distance (Optional) Number of indices ahead of the current one whose rows are prefetched.
+     *                              0 to disable software prefetching.
+     */
+    EmbeddingBagInfo(EmbeddingBagMode mode, unsigned int prefetch_distance = 8)
+        : mode(mode), prefetch_distance(prefetch_distance)
+    {
+    }
+    EmbeddingBagMode mode{EmbeddingBagMode::NONE}; /**< Pooling of the rows of a bag */
+    unsigned int     prefetch_distance{8};         /**< Indices prefetched ahead, 0 for none */
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_FUNCTION_INFO_EMBEDDINGBAGINFO_H
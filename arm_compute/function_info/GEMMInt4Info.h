@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_FUNCTION_INFO_GEMMINT4INFO_H
+#define ACL_ARM_COMPUTE_FUNCTION_INFO_GEMMINT4INFO_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+namespace arm_compute
+{
+/** Information of a matrix multiplication with signed 4-bit weights
+ *
+ * The weights are symmetric signed 4-bit values in [-8, 7], stored two per byte in a U8 tensor of shape
+ * [ceil(K / 2), N]: byte j of row n holds the weight k = 2j of output channel n in its low nibble and the weight
+ * k = 2j + 1 in its high nibble. The scales are stored in a F32 tensor of shape [num_groups, N], where every
+ * group covers @p group_size consecutive weights along K:
+ *
+ *      weight(k, n) = int4(k, n) * scale(k / group_size, n)
+ */
+struct GEMMInt4Info
+{
+    /** Default constructor */
+    GEMMInt4Info() = default;
+    /** Constructor
+     *
+     * @param[in] group_size      Number of consecutive weights along K sharing a scale. Must be a multiple of 32.
+     *                            Use 0 for one scale per output channel.
+     * @param[in] activation_info (Optional) Activation applied to the result.
+     */
+    GEMMInt4Info(unsigned int group_size, const ActivationLayerInfo &activation_info = ActivationLayerInfo())
+        : group_size(group_size), activation_info(activation_info)
+    {
+    }
+    unsigned int        group_size{0};     /**< Weights sharing a scale along K, 0 for per-channel scales */
+    ActivationLayerInfo activation_info{}; /**< Fused activation */
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_FUNCTION_INFO_GEMMINT4INFO_H
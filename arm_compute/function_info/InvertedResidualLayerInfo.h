@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_FUNCTION_INFO_INVERTEDRESIDUALLAYERINFO_H
+#define ACL_ARM_COMPUTE_FUNCTION_INFO_INVERTEDRESIDUALLAYERINFO_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/CoreTypes.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+namespace arm_compute
+{
+/** Inverted residual block information
+ *
+ * Describes a MobileNetV2-style block made of a 1x1 expansion convolution, a depthwise convolution
+ * and a 1x1 linear projection, optionally followed by an addition of the block input.
+ */
+struct InvertedResidualLayerInfo
+{
+    /** Default constructor */
+    InvertedResidualLayerInfo() = default;
+    /** Constructor
+     *
+     * @param[in] depthwise_info Padding and stride information of the depthwise stage.
+     * @param[in] expand_act     Activation fused to the expansion stage.
+     * @param[in] depthwise_act  Activation fused to the depthwise stage.
+     * @param[in] project_act    (Optional) Activation fused to the projection stage.
+     * @param[in] residual       (Optional) True if the block input is added to the projection output.
+     */
+    InvertedResidualLayerInfo(const PadStrideInfo       &depthwise_info,
+                              const ActivationLayerInfo &expand_act,
+                              const ActivationLayerInfo &depthwise_act,
+                              const ActivationLayerInfo &project_act = ActivationLayerInfo(),
+                              bool                       residual    = false)
+        : depthwise_info(depthwise_info),
+          expand_act(expand_act),
+          depthwise_act(depthwise_act),
+          project_act(project_act),
+          residual(residual)
+    {
+    }
+    PadStrideInfo       depthwise_info{}; /**< Padding and stride information of the depthwise stage */
+    ActivationLayerInfo expand_act{};     /**< Activation fused to the expansion stage */
+    ActivationLayerInfo depthwise_act{};  /**< Activation fused to the depthwise stage */
+    ActivationLayerInfo project_act{};    /**< Activation fused to the projection stage */
+    bool                residual{false};  /**< Add the block input to the projection output */
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_FUNCTION_INFO_INVERTEDRESIDUALLAYERINFO_H
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_FUNCTION_INFO_RESIZENORMALIZEINFO_H
+#define ACL_ARM_COMPUTE_FUNCTION_INFO_RESIZENORMALIZEINFO_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+
+#include <array>
+
+namespace arm_compute
+{
+/** Resize and normalize preprocessing information
+ *
+ * Describes how interleaved 3-channel U8 images are resized, reordered and normalized:
+ *
+ *      dst[c] = (resize(src)[swap_channels ? 2 - c : c] - mean[c]) * scale[c]
+ *
+ * @note @p mean and @p scale are given in destination channel order.
+ */
+struct ResizeNormalizeInfo
+{
+    /** Default constructor */
+    ResizeNormalizeInfo() = default;
+    /** Constructor
+     *
+     * @param[in] interpolation_policy Interpolation type to use. Supported: NEAREST_NEIGHBOR, BILINEAR, AREA.
+     * @param[in] mean                 Per-channel mean subtracted after resizing.
+     * @param[in] scale                Per-channel scale applied after subtracting the mean.
+     * @param[in] swap_channels        (Optional) True to reverse the channel order (RGB <-> BGR).
+     * @param[in] sampling_policy      (Optional) Sampling policy used by the interpolation.
+     * @param[in] align_corners        (Optional) Align corners of input and output, only affecting bilinear policy
+     *                                 with TOP_LEFT sampling policy.
+     */
+    ResizeNormalizeInfo(InterpolationPolicy         interpolation_policy,
+                        const std::array<float, 3> &mean,
+                        const std::array<float, 3> &scale,
+                        bool                        swap_channels   = false,
+                        SamplingPolicy              sampling_policy = SamplingPolicy::CENTER,
+                        bool                        align_corners   = false)
+        : interpolation_policy(interpolation_policy),
+          sampling_policy(sampling_policy),
+          align_corners(align_corners),
+          swap_channels(swap_channels),
+          mean(mean),
+          scale(scale)
+    {
+    }
+    InterpolationPolicy  interpolation_policy{InterpolationPolicy::BILINEAR}; /**< Interpolation type to use */
+    SamplingPolicy       sampling_policy{SamplingPolicy::CENTER};             /**< Sampling policy used by the interpolation */
+    bool                 align_corners{false};                                /**< Align corners of input and output */
+    bool                 swap_channels{false};                                /**< Reverse the channel order */
+    std::array<float, 3> mean{{0.f, 0.f, 0.f}};                               /**< Per-channel mean */
+    std::array<float, 3> scale{{1.f, 1.f, 1.f}};                              /**< Per-channel scale */
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_FUNCTION_INFO_RESIZENORMALIZEINFO_H
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_FUNCTION_INFO_ROPEINFO_H
+#define ACL_ARM_COMPUTE_FUNCTION_INFO_ROPEINFO_H
+
+/** @file
+ * @publicapi
+ */
+
+namespace arm_compute
+{
+/** Layouts of the channel pairs rotated by a rotary position embedding */
+enum class RoPEMode
+{
+    NEOX, /**< Channel i is paired with channel i + rotary_dim / 2 (GPT-NeoX, LLaMA) */
+    GPTJ  /**< Channel 2i is paired with channel 2i + 1 (GPT-J) */
+};
+
+/** Rotary position embedding information
+ *
+ * The channel pair i of the token at position p is rotated by the angle p * theta_base^(-2i / rotary_dim).
+ */
+struct RoPEInfo
+{
+    /** Default constructor */
+    RoPEInfo() = default;
+    /** Constructor
+     *
+     * @param[in] mode            Layout of the rotated channel pairs.
+     * @param[in] theta_base      (Optional) Base of the rotation frequencies.
+     * @param[in] rotary_dim      (Optional) Number of leading channels of every head that are rotated, the others
+     *                            are copied. 0 to rotate the whole head.
+     * @param[in] position_offset (Optional) Position of the first token, e.g. the number of tokens already processed
+     *                            when decoding incrementally.
+     * @param[in] max_positions   (Optional) Number of positions whose sines and cosines are precomputed once.
+     *                            0 to compute them on the fly, which is also done for positions outside the table.
+     */
+    RoPEInfo(RoPEMode     mode,
+             float        theta_base      = 10000.f,
+             unsigned int rotary_dim      = 0,
+             int          position_offset = 0,
+             unsigned int max_positions   = 0)
+        : mode(mode),
+          theta_base(theta_base),
+          rotary_dim(rotary_dim),
+          position_offset(position_offset),
+          max_positions(max_positions)
+    {
+    }
+    RoPEMode     mode{RoPEMode::NEOX}; /**< Layout of the rotated channel pairs */
+    float        theta_base{10000.f};  /**< Base of the rotation frequencies */
+    unsigned int rotary_dim{0};        /**< Number of rotated channels of every head, 0 for the whole head */
+    int          position_offset{0};   /**< Position of the first token */
+    unsigned int max_positions{0};     /**< Number of positions of the precomputed table, 0 for none */
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_FUNCTION_INFO_ROPEINFO_H
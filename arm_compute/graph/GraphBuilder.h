@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,7 @@
  * @publicapi
  */
 
+#include "arm_compute/function_info/RoPEInfo.h"
 #include "arm_compute/graph/ITensorAccessor.h"
 #include "arm_compute/graph/LayerDescriptors.h"
 #include "arm_compute/graph/Types.h"
@@ -593,6 +594,19 @@ public:
      */
     static NodeID
     add_roi_align_node(Graph &g, NodeParams params, NodeIdxPair input, NodeIdxPair rois, ROIPoolingLayerInfo pool_info);
+    /** Adds a rotary position embedding layer node to the graph
+     *
+     * The node has two outputs: the rotated queries (index 0) and the rotated keys (index 1).
+     *
+     * @param[in] g      Graph to add the node to
+     * @param[in] params Common node parameters
+     * @param[in] q      Queries input to the node as a NodeID-Index pair
+     * @param[in] k      Keys input to the node as a NodeID-Index pair
+     * @param[in] info   Rotary position embedding information
+     *
+     * @return Node ID of the created node, EmptyNodeID in case of error
+     */
+    static NodeID add_rope_node(Graph &g, NodeParams params, NodeIdxPair q, NodeIdxPair k, const RoPEInfo &info);
     /** Adds a scale layer node to the graph
      * This layer computes a product of the input with a scale (read from mul_accessor) and it applies an offset (read from add_accessor).
      * output = input * mul_w + add_w
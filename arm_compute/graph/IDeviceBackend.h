@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -94,6 +94,17 @@ public:
      */
     virtual std::unique_ptr<ITensorHandle>
     create_subtensor(ITensorHandle *parent, TensorShape shape, Coordinates coords, bool extend_parent) = 0;
+    /** Create a backend tensor alias
+     *
+     * @note An alias views all the elements of its parent in the same order with a different shape, without copying.
+     *       The parent must not have any padding.
+     *
+     * @param[in] parent Parent tensor handle
+     * @param[in] shape  Shape of the alias. Must have the same number of elements as the parent.
+     *
+     * @return Backend tensor alias handle, or nullptr if aliasing is not supported by the backend
+     */
+    virtual std::unique_ptr<ITensorHandle> create_tensor_alias(ITensorHandle *parent, TensorShape shape) = 0;
     /** Configure a backend Node
      *
      * @note This creates an appropriate configured backend function for the given node
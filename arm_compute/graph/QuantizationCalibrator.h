@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_QUANTIZATIONCALIBRATOR_H
+#define ACL_ARM_COMPUTE_GRAPH_QUANTIZATIONCALIBRATOR_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/graph/Types.h"
+
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+class Graph;
+class INode;
+class Tensor;
+
+/** Methods to derive the quantization range of a tensor from the observed values */
+enum class CalibrationMethod
+{
+    MIN_MAX,   /**< Full range of the observed values */
+    PERCENTILE /**< Range clipped to a percentile of the observed values, to ignore outliers */
+};
+
+/** Calibration configuration */
+struct CalibrationInfo
+{
+    CalibrationMethod method{CalibrationMethod::MIN_MAX}; /**< Method used to derive the range of activations */
+    float             percentile{99.99f};                 /**< Percentile of the values kept by PERCENTILE */
+    unsigned int      num_bins{2048};                     /**< Number of histogram bins. Must be a multiple of 4 */
+};
+
+/** Range of values of a tensor */
+using TensorRange = std::pair<float, float>;
+
+/** Records the ranges of the tensors of an FP32 graph to quantize it after training
+ *
+ * The calibrator is enabled by setting @ref GraphConfig::calibrator. The graph is then run in FP32 over a
+ * representative set of inputs, typically provided by an input accessor that returns false once the set is
+ * exhausted, and the calibrator records:
+ * - The per-tensor minimum, maximum and a histogram of every FP32 tensor written by a node of the graph.
+ * - The per-channel ranges of the weights of convolution and depthwise convolution layers, and the per-tensor range
+ *   of the other constants, when the constants are loaded.
+ *
+ * Building the same graph again with @ref GraphConfig::use_calibrated_quantization converts it to QASYMM8_SIGNED
+ * using the recorded ranges, see @ref CalibratedQuantizationMutator.
+ *
+ * @note Tensors are matched by ID, so both graphs must be built and configured identically.
+ */
+class QuantizationCalibrator final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] info (Optional) Calibration configuration
+     */
+    explicit QuantizationCalibrator(const CalibrationInfo &info = CalibrationInfo());
+    /** Calibration configuration accessor
+     *
+     * @return The calibration configuration
+     */
+    const CalibrationInfo &info() const;
+    /** Record the current values of an FP32 tensor whose backend tensor is allocated
+     *
+     * @param[in] tensor Tensor to observe
+     */
+    void observe(Tensor &tensor);
+    /** Record the ranges of the loaded FP32 constants of a graph
+     *
+     * @param[in] g Graph whose constants have been loaded
+     */
+    void observe_constants(Graph &g);
+    /** Checks if the range of a tensor has been recorded
+     *
+     * @param[in] tid   ID of the tensor
+     * @param[in] shape Expected shape of the tensor
+     *
+     * @return True if the tensor has been observed with the given shape
+     */
+    bool has_range(TensorID tid, const TensorShape &shape) const;
+    /** Quantization range of a tensor
+     *
+     * @note The range always contains zero
+     *
+     * @param[in] tid ID of an observed tensor
+     *
+     * @return The range derived from the observed values with the configured method
+     */
+    TensorRange range(TensorID tid) const;
+    /** Per-channel ranges of a constant
+     *
+     * @param[in] tid ID of an observed constant
+     *
+     * @return The ranges of every channel, or an empty vector if the constant has no per-channel ranges
+     */
+    std::vector<TensorRange> channel_ranges(TensorID tid) const;
+    /** Dimension holding the output channels of the weights consumed by a node
+     *
+     * @param[in] node Node consuming the weights at input 1
+     *
+     * @return The dimension index, or -1 if the weights of the node are quantized per-tensor
+     */
+    static int weights_channel_dimension(const INode &node);
+
+private:
+    /** Statistics of an observed tensor */
+    struct TensorStatistics
+    {
+        TensorShape              shape{};          /**< Shape of the tensor */
+        float                    min{0.f};         /**< Minimum observed value */
+        float                    max{0.f};         /**< Maximum observed value */
+        float                    bound{0.f};       /**< The histogram covers [-bound, bound] */
+        std::vector<uint64_t>    histogram{};      /**< Histogram of the observed values */
+        std::vector<TensorRange> channel_ranges{}; /**< Per-channel ranges of constants */
+    };
+
+    void record(TensorStatistics &stats, const std::vector<float> &values);
+
+    CalibrationInfo                      _info;
+    std::map<TensorID, TensorStatistics> _statistics;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_QUANTIZATIONCALIBRATOR_H
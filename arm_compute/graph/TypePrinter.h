@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -108,6 +108,9 @@ inline ::std::ostream &operator<<(::std::ostream &os, const NodeType &node_type)
         case NodeType::EltwiseLayer:
             os << "EltwiseLayer";
             break;
+        case NodeType::ElementwiseExpressionLayer:
+            os << "ElementwiseExpressionLayer";
+            break;
         case NodeType::UnaryEltwiseLayer:
             os << "UnaryEltwiseLayer";
             break;
@@ -126,6 +129,12 @@ inline ::std::ostream &operator<<(::std::ostream &os, const NodeType &node_type)
         case NodeType::GenerateProposalsLayer:
             os << "GenerateProposalsLayer";
             break;
+        case NodeType::GlobalPoolingFullyConnectedLayer:
+            os << "GlobalPoolingFullyConnectedLayer";
+            break;
+        case NodeType::InvertedResidualLayer:
+            os << "InvertedResidualLayer";
+            break;
         case NodeType::L2NormalizeLayer:
             os << "L2NormalizeLayer";
             break;
@@ -171,6 +180,9 @@ inline ::std::ostream &operator<<(::std::ostream &os, const NodeType &node_type)
         case NodeType::ROIAlignLayer:
             os << "ROIAlignLayer";
             break;
+        case NodeType::RoPELayer:
+            os << "RoPELayer";
+            break;
         case NodeType::SoftmaxLayer:
             os << "SoftmaxLayer";
             break;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,6 +37,8 @@
 #include "arm_compute/function_info/GEMMInfo.h"
 #include "arm_compute/runtime/CL/CLTunerTypes.h"
 #include "arm_compute/runtime/CL/CLTypes.h"
+#include "arm_compute/runtime/IAllocator.h"
+#include "arm_compute/runtime/IRuntimeContext.h"
 
 #include <limits>
 #include <string>
@@ -86,6 +88,7 @@ constexpr EdgeID EmptyEdgeID = std::numeric_limits<EdgeID>::max();
 
 // Forward declarations
 struct TensorDescriptor;
+class QuantizationCalibrator;
 
 /** Graph configuration structure */
 struct GraphConfig
@@ -99,9 +102,17 @@ struct GraphConfig
     CLTunerMode tuner_mode{CLTunerMode::EXHAUSTIVE}; /**< Tuner mode to be used by the CL tuner */
     int         num_threads{
         -1}; /**< Number of threads to use (thread capable backends), if 0 the backend will auto-initialize, if -1 the backend will stay as it is. */
-    std::string   tuner_file{"acl_tuner.csv"};         /**< File to load/store tuning values from */
-    std::string   mlgo_file{"heuristics.mlgo"};        /**< Filename to load MLGO heuristics from */
-    CLBackendType backend_type{CLBackendType::Native}; /**< CL backend type to use */
+    std::string      tuner_file{"acl_tuner.csv"};         /**< File to load/store tuning values from */
+    std::string      mlgo_file{"heuristics.mlgo"};        /**< Filename to load MLGO heuristics from */
+    CLBackendType    backend_type{CLBackendType::Native}; /**< CL backend type to use */
+    IRuntimeContext *runtime_ctx{
+        nullptr}; /**< Runtime context whose scheduler configures and runs the CPU functions, if nullptr the process-wide scheduler is used */
+    IAllocator *allocator{
+        nullptr}; /**< Allocator of the CPU tensors and memory pools (e.g. a HugePageAllocator), if nullptr the backend allocator is used */
+    QuantizationCalibrator *calibrator{
+        nullptr}; /**< Calibrator recording the tensor ranges of every run of a FP32 graph, if nullptr nothing is recorded */
+    bool use_calibrated_quantization{
+        false}; /**< Quantize the graph to QASYMM8_SIGNED with the ranges of @ref calibrator instead of recording them */
 };
 
 /**< Device target types */
@@ -171,11 +182,14 @@ enum class NodeType
     DetectionOutputLayer,
     DetectionPostProcessLayer,
     EltwiseLayer,
+    ElementwiseExpressionLayer,
     FlattenLayer,
     FullyConnectedLayer,
     FusedConvolutionBatchNormalizationLayer,
     FusedDepthwiseConvolutionBatchNormalizationLayer,
     GenerateProposalsLayer,
+    GlobalPoolingFullyConnectedLayer,
+    InvertedResidualLayer,
     L2NormalizeLayer,
     NormalizationLayer,
     NormalizePlanarYUVLayer,
@@ -191,6 +205,7 @@ enum class NodeType
     ReshapeLayer,
     ResizeLayer,
     ROIAlignLayer,
+    RoPELayer,
     SoftmaxLayer,
     SliceLayer,
     SplitLayer,
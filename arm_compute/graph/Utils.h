@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,7 @@
  * @publicapi
  */
 
+#include "arm_compute/core/ITensorInfo.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/PassManager.h"
 
@@ -148,6 +149,13 @@ std::vector<NodeIdxPair> get_driver_nodes(const INode &node);
  * @param[in, out] tensor Tensor to configure
  */
 void configure_tensor(Tensor *tensor);
+/** Checks if the elements of a tensor are packed in memory
+ *
+ * @param[in] info Backend tensor info to check
+ *
+ * @return True if the tensor has no padding and its strides are the ones of a packed tensor of the same shape
+ */
+bool is_contiguous(const ITensorInfo &info);
 } // namespace graph
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_GRAPH_UTILS_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,7 @@
 #include "arm_compute/core/ITensorInfo.h"
 #include "arm_compute/graph/backends/FusedConvolutionBatchNormalizationFunction.h"
 #include "arm_compute/graph/backends/FusedDepthwiseConvolutionBatchNormalizationFunction.h"
+#include "arm_compute/graph/backends/FusedInvertedResidualFunction.h"
 #include "arm_compute/graph/backends/Utils.h"
 #include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/nodes/Nodes.h"
@@ -303,6 +304,110 @@ create_fused_depthwise_convolution_batch_normalization_layer(FusedDepthwiseConvo
     return func;
 }
 
+/** Create a backend global pooling fully connected layer function
+ *
+ * @tparam GlobalPoolingFullyConnectedLayerFunction Backend global pooling fully connected function
+ * @tparam TargetInfo                               Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend global pooling fully connected layer function
+ */
+template <typename GlobalPoolingFullyConnectedLayerFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_global_pooling_fully_connected_layer(GlobalPoolingFullyConnectedLayerNode &node,
+                                                                       GraphContext                         &ctx)
+{
+    validate_node<TargetInfo>(node, 3 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input   = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *weights = get_backing_tensor<TargetInfo>(node.input(1));
+    typename TargetInfo::TensorType *biases  = get_backing_tensor<TargetInfo>(node.input(2));
+    typename TargetInfo::TensorType *output  = get_backing_tensor<TargetInfo>(node.output(0));
+    const FullyConnectedLayerInfo    fc_info = node.info();
+
+    ARM_COMPUTE_ERROR_ON(input == nullptr);
+    ARM_COMPUTE_ERROR_ON(weights == nullptr);
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    // Create and configure function
+    auto mm   = get_memory_manager(ctx, TargetInfo::TargetType);
+    auto func = std::make_unique<GlobalPoolingFullyConnectedLayerFunction>(mm);
+    func->configure(input, weights, biases, output, fc_info);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated " << node.name() << " Type: " << node.type() << " Target: "
+                                               << TargetInfo::TargetType << " Data Type: " << input->info()->data_type()
+                                               << " Input shape: " << input->info()->tensor_shape()
+                                               << " Weights shape: " << weights->info()->tensor_shape()
+                                               << " Output shape: " << output->info()->tensor_shape() << std::endl);
+
+    return func;
+}
+
+/** Create a backend inverted residual block function
+ *
+ * @tparam FusedLayerTypes Fused layer types
+ * @tparam TargetInfo      Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend inverted residual block function
+ */
+template <typename FusedLayerTypes, typename TargetInfo>
+std::unique_ptr<IFunction> create_inverted_residual_layer(InvertedResidualLayerNode &node, GraphContext &ctx)
+{
+    validate_node<TargetInfo>(node,
+                              1 + InvertedResidualLayerNode::num_stages *
+                                      InvertedResidualLayerNode::num_stage_inputs /* expected inputs */,
+                              1 /* expected outputs */);
+
+    using FType      = FusedInvertedResidualFunction<TargetInfo, FusedLayerTypes>;
+    using Stage      = InvertedResidualLayerNode::Stage;
+    using StageInput = InvertedResidualLayerNode::StageInput;
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input  = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
+    const InvertedResidualLayerInfo  info   = node.info();
+
+    const auto extract_stage = [&node](Stage stage)
+    {
+        typename FType::Stage tensors;
+        tensors.weights = get_backing_tensor<TargetInfo>(node.input(node.input_idx(stage, StageInput::Weights)));
+        tensors.bias    = get_backing_tensor<TargetInfo>(node.input(node.input_idx(stage, StageInput::Bias)));
+        tensors.mean    = get_backing_tensor<TargetInfo>(node.input(node.input_idx(stage, StageInput::Mean)));
+        tensors.var     = get_backing_tensor<TargetInfo>(node.input(node.input_idx(stage, StageInput::Var)));
+        tensors.beta    = get_backing_tensor<TargetInfo>(node.input(node.input_idx(stage, StageInput::Beta)));
+        tensors.gamma   = get_backing_tensor<TargetInfo>(node.input(node.input_idx(stage, StageInput::Gamma)));
+        tensors.epsilon = node.epsilon(stage);
+        return tensors;
+    };
+    const typename FType::Stage expand    = extract_stage(Stage::Expand);
+    const typename FType::Stage depthwise = extract_stage(Stage::Depthwise);
+    const typename FType::Stage project   = extract_stage(Stage::Project);
+
+    // Create and configure function (we assume that functions have been validated before creation)
+    std::shared_ptr<IMemoryManager> mm = get_memory_manager(ctx, TargetInfo::TargetType);
+    std::unique_ptr<IFunction>      func;
+    std::string                     func_name;
+
+    std::tie(func, func_name) = create_named_memory_managed_function<FType>(
+        std::string("InvertedResidualLayer"), mm, input, expand, depthwise, project, output, info);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name() << " Type: " << node.type() << " Target: " << TargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type() << " Input shape: "
+                               << input->info()->tensor_shape() << " Expanded channels: "
+                               << expand.weights->info()->tensor_shape()[3]
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << " Residual: " << info.residual << std::endl);
+    return func;
+}
+
 /** Create a backend bounding box transform layer function
  *
  * @tparam BoundingBoxTransformLayerFunction    Backend bounding box transform function
@@ -763,6 +868,46 @@ std::unique_ptr<IFunction> create_detection_post_process_layer(DetectionPostProc
     return func;
 }
 
+/** Create a backend fused element-wise expression layer function
+ *
+ * @tparam ElementwiseExpressionFunction Backend fused element-wise expression function
+ * @tparam TargetInfo                    Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ *
+ * @return Backend fused element-wise expression layer function
+ */
+template <typename ElementwiseExpressionFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_elementwise_expression_layer(ElementwiseExpressionLayerNode &node)
+{
+    validate_node<TargetInfo>(node, node.info().num_inputs() /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    std::vector<const typename TargetInfo::TensorType *> inputs;
+    for (unsigned int i = 0; i < node.num_inputs(); ++i)
+    {
+        typename TargetInfo::TensorType *input = get_backing_tensor<TargetInfo>(node.input(i));
+        ARM_COMPUTE_ERROR_ON(input == nullptr);
+        inputs.push_back(input);
+    }
+    typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    // Create and configure function
+    auto func = std::make_unique<ElementwiseExpressionFunction>();
+    func->configure(inputs, output, node.info());
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated " << node.name() << " Type: " << node.type()
+                                               << " Target: " << TargetInfo::TargetType
+                                               << " Data Type: " << output->info()->data_type()
+                                               << " Inputs: " << inputs.size()
+                                               << " Nodes: " << node.info().nodes().size()
+                                               << " Shape: " << output->info()->tensor_shape() << std::endl);
+
+    return func;
+}
+
 /** Create a backend element-wise operation layer function
  *
  * @tparam EltwiseFunctions Backend element-wise function
@@ -887,6 +1032,12 @@ std::unique_ptr<IFunction> create_flatten_layer(FlattenLayerNode &node)
 {
     validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
 
+    // Return nullptr if the output is an alias of the input
+    if (!node.is_enabled())
+    {
+        return nullptr;
+    }
+
     // Extract IO and info
     typename TargetInfo::TensorType *input  = get_backing_tensor<TargetInfo>(node.input(0));
     typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
@@ -1440,6 +1591,12 @@ std::unique_ptr<IFunction> create_reshape_layer(ReshapeLayerNode &node)
 {
     validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
 
+    // Return nullptr if the output is an alias of the input
+    if (!node.is_enabled())
+    {
+        return nullptr;
+    }
+
     // Extract IO and info
     typename TargetInfo::TensorType *input  = get_backing_tensor<TargetInfo>(node.input(0));
     typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
@@ -1536,6 +1693,47 @@ std::unique_ptr<IFunction> create_roi_align_layer(ROIAlignLayerNode &node)
     return std::move(func);
 }
 
+/** Create a backend rotary position embedding layer function
+ *
+ * @tparam RoPELayerFunction Backend rotary position embedding function
+ * @tparam TargetInfo        Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend rotary position embedding layer function
+ */
+template <typename RoPELayerFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_rope_layer(RoPELayerNode &node, GraphContext &ctx)
+{
+    validate_node<TargetInfo>(node, 3 /* expected inputs */, 2 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *q         = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *k         = get_backing_tensor<TargetInfo>(node.input(1));
+    typename TargetInfo::TensorType *positions = get_backing_tensor<TargetInfo>(node.input(2));
+    typename TargetInfo::TensorType *q_dst     = get_backing_tensor<TargetInfo>(node.output(0));
+    typename TargetInfo::TensorType *k_dst     = get_backing_tensor<TargetInfo>(node.output(1));
+    const RoPEInfo                   info      = node.info();
+
+    ARM_COMPUTE_ERROR_ON(q == nullptr);
+    ARM_COMPUTE_ERROR_ON(k == nullptr);
+    ARM_COMPUTE_ERROR_ON(q_dst == nullptr);
+    ARM_COMPUTE_ERROR_ON(k_dst == nullptr);
+
+    // Create and configure function
+    auto func = std::make_unique<RoPELayerFunction>(get_memory_manager(ctx, TargetInfo::TargetType));
+    func->configure(q, k, positions, q_dst, k_dst, info);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated " << node.name() << " Type: " << node.type() << " Target: "
+                                               << TargetInfo::TargetType << " Data Type: " << q->info()->data_type()
+                                               << " Queries shape: " << q->info()->tensor_shape()
+                                               << " Keys shape: " << k->info()->tensor_shape() << std::endl);
+
+    return func;
+}
+
 /** Create a backend slice layer function
  *
  * @tparam SliceLayerFunction Backend slice function
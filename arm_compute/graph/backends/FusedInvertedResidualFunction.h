@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_BACKENDS_FUSEDINVERTEDRESIDUALFUNCTION_H
+#define ACL_ARM_COMPUTE_GRAPH_BACKENDS_FUSEDINVERTEDRESIDUALFUNCTION_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/InvertedResidualLayerInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <array>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace backends
+{
+/** Wrapper function to first fold the batch normalization of each stage into its weights and then run the fused inverted residual block */
+template <typename TargetInfo, typename FusedLayerTypes>
+class FusedInvertedResidualFunction : public IFunction
+{
+public:
+    using TensorType         = typename TargetInfo::TensorType;
+    using TensorConcreteType = typename TargetInfo::TensorConcreteType;
+
+    /** Tensors of a single stage of the block */
+    struct Stage
+    {
+        TensorType       *weights{nullptr}; /**< Stage weights, modified in place when a batch normalization is folded */
+        TensorType       *bias{nullptr};    /**< Stage bias. Can be nullptr */
+        const TensorType *mean{nullptr};    /**< Batch normalization mean. nullptr if the stage has no batch normalization */
+        const TensorType *var{nullptr};     /**< Batch normalization variance */
+        const TensorType *beta{nullptr};    /**< Batch normalization beta. Can be nullptr */
+        const TensorType *gamma{nullptr};   /**< Batch normalization gamma. Can be nullptr */
+        float             epsilon{0.001f};  /**< Batch normalization epsilon */
+    };
+
+    FusedInvertedResidualFunction(std::shared_ptr<IMemoryManager> memory_manager = nullptr)
+        : _block(memory_manager), _fused_batch_norm_layers(), _fused_biases(), _has_batch_norm(), _is_prepared(false)
+    {
+    }
+
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input     Source tensor. Data types supported: F16/F32.
+     * @param[in]  expand    1x1 expansion stage tensors.
+     * @param[in]  depthwise Depthwise stage tensors.
+     * @param[in]  project   1x1 projection stage tensors.
+     * @param[out] output    Destination tensor. Data types supported: Same as @p input.
+     * @param[in]  info      Inverted residual block information.
+     */
+    void configure(TensorType                      *input,
+                   const Stage                     &expand,
+                   const Stage                     &depthwise,
+                   const Stage                     &project,
+                   TensorType                      *output,
+                   const InvertedResidualLayerInfo &info)
+    {
+        // We don't run any validate, as we assume that the layers have been already validated
+        const TensorType *expand_bias    = configure_batch_norm(0, expand, FuseBatchNormalizationType::CONVOLUTION);
+        const TensorType *depthwise_bias =
+            configure_batch_norm(1, depthwise, FuseBatchNormalizationType::DEPTHWISECONVOLUTION);
+        const TensorType *project_bias = configure_batch_norm(2, project, FuseBatchNormalizationType::CONVOLUTION);
+
+        _block.configure(input, expand.weights, expand_bias, depthwise.weights, depthwise_bias, project.weights,
+                         project_bias, output, info);
+
+        for (size_t i = 0; i < _fused_biases.size(); ++i)
+        {
+            if (_fused_biases[i].info()->total_size() != 0)
+            {
+                _fused_biases[i].allocator()->allocate();
+            }
+        }
+    }
+
+    // Inherited methods overridden:
+    void run()
+    {
+        prepare();
+        _block.run();
+    }
+
+    void prepare()
+    {
+        if (!_is_prepared)
+        {
+            for (size_t i = 0; i < _fused_batch_norm_layers.size(); ++i)
+            {
+                if (_has_batch_norm[i])
+                {
+                    _fused_batch_norm_layers[i].run();
+                }
+            }
+            _block.prepare();
+            _is_prepared = true;
+        }
+    }
+
+private:
+    const TensorType *configure_batch_norm(size_t idx, const Stage &stage, FuseBatchNormalizationType fbn_type)
+    {
+        if (stage.mean == nullptr)
+        {
+            return stage.bias;
+        }
+
+        _has_batch_norm[idx] = true;
+
+        // We check if the stage has a bias. If yes, use it in-place. If not, we need to create one
+        // as batch normalization might end up with a bias != 0
+        if (stage.bias != nullptr)
+        {
+            _fused_batch_norm_layers[idx].configure(stage.weights, stage.mean, stage.var, nullptr, nullptr, stage.bias,
+                                                    stage.beta, stage.gamma, stage.epsilon, fbn_type);
+            return stage.bias;
+        }
+        _fused_batch_norm_layers[idx].configure(stage.weights, stage.mean, stage.var, nullptr, &_fused_biases[idx],
+                                                nullptr, stage.beta, stage.gamma, stage.epsilon, fbn_type);
+        return &_fused_biases[idx];
+    }
+
+    typename FusedLayerTypes::InvertedResidualLayer                 _block;
+    std::array<typename FusedLayerTypes::FuseBatchNormalization, 3> _fused_batch_norm_layers;
+    std::array<TensorConcreteType, 3>                               _fused_biases;
+    std::array<bool, 3>                                             _has_batch_norm;
+    bool                                                            _is_prepared;
+};
+} // namespace backends
+} // namespace graph
+} // namespace arm_compute
+
+#endif // ACL_ARM_COMPUTE_GRAPH_BACKENDS_FUSEDINVERTEDRESIDUALFUNCTION_H
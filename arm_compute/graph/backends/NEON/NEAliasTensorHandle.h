@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_BACKENDS_NEON_NEALIASTENSORHANDLE_H
+#define ACL_ARM_COMPUTE_GRAPH_BACKENDS_NEON_NEALIASTENSORHANDLE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/graph/ITensorHandle.h"
+#include "arm_compute/runtime/TensorAlias.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace backends
+{
+/** CPU Tensor alias handle interface object
+ *
+ * Views the memory of a contiguous parent handle with a different shape. Like sub-tensors, the alias does not own
+ * any memory, so the lifetime of its backing memory is the one of its parent.
+ **/
+class NEAliasTensorHandle final : public ITensorHandle
+{
+public:
+    /** Default constructor
+     *
+     * @param[in] parent_handle Parent tensor handle
+     * @param[in] shape         Alias shape. Must have the same number of elements as the parent.
+     */
+    NEAliasTensorHandle(ITensorHandle *parent_handle, const TensorShape &shape);
+    /** Destructor */
+    ~NEAliasTensorHandle() = default;
+    /** Allow instances of this class to be move constructed */
+    NEAliasTensorHandle(NEAliasTensorHandle &&) = default;
+    /** Allow instances of this class to be moved */
+    NEAliasTensorHandle &operator=(NEAliasTensorHandle &&) = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEAliasTensorHandle(const NEAliasTensorHandle &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEAliasTensorHandle &operator=(const NEAliasTensorHandle &) = delete;
+
+    // Inherited overridden methods
+    void                        allocate() override;
+    void                        free() override;
+    void                        manage(IMemoryGroup *mg) override;
+    void                        map(bool blocking) override;
+    void                        unmap() override;
+    void                        release_if_unused() override;
+    arm_compute::ITensor       &tensor() override;
+    const arm_compute::ITensor &tensor() const override;
+    ITensorHandle              *parent_handle() override;
+    bool                        is_subtensor() const override;
+    Target                      target() const override;
+
+private:
+    arm_compute::TensorAlias _alias;         /**< Backend tensor alias */
+    ITensorHandle           *_parent_handle; /**< Parent handle */
+};
+} // namespace backends
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_BACKENDS_NEON_NEALIASTENSORHANDLE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -52,6 +52,7 @@ public:
     std::unique_ptr<ITensorHandle> create_tensor(const Tensor &tensor) override;
     std::unique_ptr<ITensorHandle>
     create_subtensor(ITensorHandle *parent, TensorShape shape, Coordinates coords, bool extend_parent) override;
+    std::unique_ptr<ITensorHandle> create_tensor_alias(ITensorHandle *parent, TensorShape shape) override;
     std::unique_ptr<arm_compute::IFunction>       configure_node(INode &node, GraphContext &ctx) override;
     Status                                        validate_node(INode &node) override;
     std::shared_ptr<arm_compute::IMemoryManager>  create_memory_manager(MemoryManagerAffinity affinity) override;
@@ -59,7 +60,8 @@ public:
     void                                          sync() override;
 
 private:
-    Allocator _allocator; /**< Backend allocator */
+    Allocator   _allocator;        /**< Backend allocator */
+    IAllocator *_config_allocator; /**< Allocator of the last context set up, nullptr if none or once it is released */
 };
 } // namespace backends
 } // namespace graph
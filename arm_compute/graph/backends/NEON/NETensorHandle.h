@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -43,9 +43,11 @@ class NETensorHandle final : public ITensorHandle
 public:
     /** Default Constructor
      *
-     * @param[in] info Tensor metadata
+     * @param[in] info      Tensor metadata
+     * @param[in] allocator (Optional) Allocator of the tensor memory when not memory managed.
+     *                      If nullptr the default heap allocation is used.
      */
-    NETensorHandle(const ITensorInfo &info);
+    NETensorHandle(const ITensorInfo &info, IAllocator *allocator = nullptr);
     /** Destructor: free the tensor's memory */
     ~NETensorHandle() = default;
     /** Allow instances of this class to be move constructed */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -360,6 +360,71 @@ Status validate_generate_proposals_layer(GenerateProposalsLayerNode &node)
     return GenerateProposalsLayer::validate(scores, deltas, anchors, proposals, scores_out, num_valid_proposals, info);
 }
 
+/** Validates a global pooling fully connected layer node
+ *
+ * @tparam GlobalPoolingFullyConnectedLayer Global pooling fully connected layer type
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename GlobalPoolingFullyConnectedLayer>
+Status validate_global_pooling_fully_connected_layer(GlobalPoolingFullyConnectedLayerNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating GlobalPoolingFullyConnectedLayer node with ID : "
+                                  << node.id() << " and Name: " << node.name() << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *input   = get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *weights = get_backing_tensor_info(node.input(1));
+    arm_compute::ITensorInfo *biases  = get_backing_tensor_info(node.input(2));
+    arm_compute::ITensorInfo *output  = get_backing_tensor_info(node.output(0));
+
+    return GlobalPoolingFullyConnectedLayer::validate(input, weights, biases, output, node.info());
+}
+
+/** Validates an inverted residual block node
+ *
+ * @tparam InvertedResidualLayer Inverted residual block layer type
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename InvertedResidualLayer>
+Status validate_inverted_residual_layer(InvertedResidualLayerNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating InvertedResidualLayer node with ID : " << node.id() << " and Name: "
+                                                                                      << node.name() << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() !=
+                                1 + InvertedResidualLayerNode::num_stages * InvertedResidualLayerNode::num_stage_inputs);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    using Stage      = InvertedResidualLayerNode::Stage;
+    using StageInput = InvertedResidualLayerNode::StageInput;
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *input = get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *expand_weights =
+        get_backing_tensor_info(node.input(node.input_idx(Stage::Expand, StageInput::Weights)));
+    arm_compute::ITensorInfo *expand_bias =
+        get_backing_tensor_info(node.input(node.input_idx(Stage::Expand, StageInput::Bias)));
+    arm_compute::ITensorInfo *dw_weights =
+        get_backing_tensor_info(node.input(node.input_idx(Stage::Depthwise, StageInput::Weights)));
+    arm_compute::ITensorInfo *dw_bias =
+        get_backing_tensor_info(node.input(node.input_idx(Stage::Depthwise, StageInput::Bias)));
+    arm_compute::ITensorInfo *proj_weights =
+        get_backing_tensor_info(node.input(node.input_idx(Stage::Project, StageInput::Weights)));
+    arm_compute::ITensorInfo *proj_bias =
+        get_backing_tensor_info(node.input(node.input_idx(Stage::Project, StageInput::Bias)));
+    arm_compute::ITensorInfo *output = get_backing_tensor_info(node.output(0));
+
+    return InvertedResidualLayer::validate(input, expand_weights, expand_bias, dw_weights, dw_bias, proj_weights,
+                                           proj_bias, output, node.info());
+}
+
 /** Validates a L2Normalization layer node
  *
  * @tparam L2Normalization layer type
@@ -632,6 +697,32 @@ Status validate_roi_align_layer(ROIAlignLayerNode &node)
     return ROIAlignLayer::validate(input, rois, output, pool_info);
 }
 
+/** Validates a rotary position embedding layer node
+ *
+ * @tparam RoPELayer Rotary position embedding layer type
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename RoPELayer>
+Status validate_rope_layer(RoPELayerNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating RoPELayer node with ID : " << node.id() << " and Name: " << node.name()
+                                                                         << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 2);
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *q         = get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *k         = get_backing_tensor_info(node.input(1));
+    arm_compute::ITensorInfo *positions = get_backing_tensor_info(node.input(2));
+    arm_compute::ITensorInfo *q_dst     = get_backing_tensor_info(node.output(0));
+    arm_compute::ITensorInfo *k_dst     = get_backing_tensor_info(node.output(1));
+
+    return RoPELayer::validate(q, k, positions, q_dst, k_dst, node.info());
+}
+
 /** Validates a Slice layer node
  *
  * @tparam SliceLayer Slice layer function type
@@ -685,6 +776,33 @@ Status validate_strided_slice_layer(StridedSliceLayerNode &node)
                                        info.shrink_axis_mask());
 }
 
+/** Validates a fused element-wise expression layer node
+ *
+ * @tparam ElementwiseExpressionLayer Fused element-wise expression layer type
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename ElementwiseExpressionLayer>
+Status validate_elementwise_expression_layer(ElementwiseExpressionLayerNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating ElementwiseExpressionLayer node with ID : " << node.id() << " and Name: "
+                                                                                         << node.name() << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != node.info().num_inputs());
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    std::vector<const arm_compute::ITensorInfo *> inputs;
+    for (unsigned int i = 0; i < node.num_inputs(); ++i)
+    {
+        inputs.push_back(get_backing_tensor_info(node.input(i)));
+    }
+    arm_compute::ITensorInfo *output = get_backing_tensor_info(node.output(0));
+
+    return ElementwiseExpressionLayer::validate(inputs, output, node.info());
+}
+
 /** Validates a element-wise layer node
  *
  * @param[in] node Node to validate
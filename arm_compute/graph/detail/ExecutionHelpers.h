@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -73,6 +73,15 @@ void allocate_const_tensors(Graph &g);
  * @param[in] g Graph to allocate the tensors
  */
 void allocate_all_tensors(Graph &g);
+/** Updates the output alias of a reshape or flatten node disabled by the @ref ReshapeAliasMutator
+ *
+ * Configuring the nodes executed before may pad the input or replace its handle, so the alias is created again from
+ * the current input handle. If the input is no longer contiguous, the output gets its own backend tensor and the node
+ * is enabled again to copy its input.
+ *
+ * @param[in, out] node Node to update, must not be configured yet
+ */
+void update_tensor_alias(INode &node);
 /** Configures all nodes of graph
  *
  * @param[in, out] g          Graph to configure the nodes
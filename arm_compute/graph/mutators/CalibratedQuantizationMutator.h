@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_MUTATORS_CALIBRATEDQUANTIZATIONMUTATOR_H
+#define ACL_ARM_COMPUTE_GRAPH_MUTATORS_CALIBRATEDQUANTIZATIONMUTATOR_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/graph/IGraphMutator.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+class QuantizationCalibrator;
+
+/** Mutation pass to quantize a FP32 graph to QASYMM8_SIGNED with the ranges recorded by a @ref QuantizationCalibrator
+ *
+ * - Convolution and depthwise convolution weights are quantized per output channel (QSYMM8_PER_CHANNEL), fully
+ *   connected weights per tensor with a symmetric range, and biases to S32 with the scale of the input times the
+ *   scale of the weights.
+ * - Activations are quantized with the recorded ranges, except for the layers with a fixed output range (softmax,
+ *   logistic, tanh) and the layers that only move data (pooling, reshape, permute, split...), which keep the
+ *   quantization of their input.
+ * - Layers that cannot run quantized or miss a recorded range stay in FP32, with quantization and dequantization
+ *   layers inserted at the boundaries.
+ *
+ * @note The graph must be built and mutated the same way as the calibrated graph so that tensors IDs match.
+ */
+class CalibratedQuantizationMutator final : public IGraphMutator
+{
+public:
+    /** Constructor
+     *
+     * @param[in] calibrator Calibrator holding the ranges recorded on the FP32 graph.
+     */
+    explicit CalibratedQuantizationMutator(const QuantizationCalibrator &calibrator);
+
+    // Inherited methods overridden
+    virtual void mutate(Graph &g) override;
+    MutationType type() const override;
+    const char  *name() override;
+
+    /** Number of nodes quantized by the last call to @ref mutate
+     *
+     * @return The number of quantized nodes
+     */
+    unsigned int num_quantized_nodes() const;
+
+private:
+    const QuantizationCalibrator &_calibrator;
+    unsigned int                  _num_quantized_nodes{0};
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_MUTATORS_CALIBRATEDQUANTIZATIONMUTATOR_H
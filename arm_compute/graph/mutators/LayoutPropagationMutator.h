@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_MUTATORS_LAYOUTPROPAGATIONMUTATOR_H
+#define ACL_ARM_COMPUTE_GRAPH_MUTATORS_LAYOUTPROPAGATIONMUTATOR_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/graph/IGraphMutator.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Mutation pass to remove the redundant permutations of graphs imported from frameworks using another layout
+ *
+ * - A permutation followed by its inverse is removed, also when only layout-agnostic nodes (activations, unary
+ *   element-wise operations, quantization and dequantization) sit in between: these nodes then run in the layout of
+ *   the permutation input.
+ * - Two consecutive permutations are merged into one.
+ * - A permutation of a constant tensor is folded into the constant, whose data is permuted once when it is loaded.
+ *
+ * Only the permutations at the boundaries of the graph, e.g. converting the input of the network, are left.
+ */
+class LayoutPropagationMutator final : public IGraphMutator
+{
+public:
+    // Inherited methods overridden
+    virtual void mutate(Graph &g) override;
+    MutationType type() const override;
+    const char  *name() override;
+
+    /** Number of permutation nodes removed by the last call to @ref mutate
+     *
+     * @return The number of removed permutations
+     */
+    unsigned int num_removed_permutes() const;
+
+private:
+    unsigned int _num_removed_permutes{0};
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_MUTATORS_LAYOUTPROPAGATIONMUTATOR_H
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_NODES_GLOBALPOOLINGFULLYCONNECTEDLAYERNODE_H
+#define ACL_ARM_COMPUTE_GRAPH_NODES_GLOBALPOOLINGFULLYCONNECTEDLAYERNODE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/function_info/FullyConnectedLayerInfo.h"
+#include "arm_compute/graph/INode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Global average pooling followed by a fully connected layer node
+ *
+ * Inputs are the pooled tensor, the fully connected weights and the (optional) bias.
+ */
+class GlobalPoolingFullyConnectedLayerNode final : public INode
+{
+public:
+    /** Constructor
+     *
+     * @param[in] num_outputs Number of neurons in the fully connected layer
+     * @param[in] fc_info     (Optional) Fully connected layer information
+     */
+    GlobalPoolingFullyConnectedLayerNode(unsigned int            num_outputs,
+                                         FullyConnectedLayerInfo fc_info = FullyConnectedLayerInfo());
+    /** Fully connected layer information accessor
+     *
+     * @return Fully connected layer information
+     */
+    FullyConnectedLayerInfo info() const;
+    /** Computes the output descriptor
+     *
+     * @param[in] input_descriptor Input descriptor
+     * @param[in] num_outputs      Number of neurons in the fully connected layer
+     *
+     * @return Output descriptor
+     */
+    static TensorDescriptor compute_output_descriptor(const TensorDescriptor &input_descriptor,
+                                                      unsigned int            num_outputs);
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void             accept(INodeVisitor &v) override;
+
+public:
+    static constexpr NodeType node_type = NodeType::GlobalPoolingFullyConnectedLayer;
+
+private:
+    unsigned int            _num_outputs;
+    FullyConnectedLayerInfo _info;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_NODES_GLOBALPOOLINGFULLYCONNECTEDLAYERNODE_H
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_NODES_INVERTEDRESIDUALLAYERNODE_H
+#define ACL_ARM_COMPUTE_GRAPH_NODES_INVERTEDRESIDUALLAYERNODE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/function_info/InvertedResidualLayerInfo.h"
+#include "arm_compute/graph/INode.h"
+
+#include <array>
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Inverted residual block node
+ *
+ * Fused 1x1 expansion, depthwise and 1x1 projection convolutions, each optionally followed by a batch normalization
+ * that is folded into the stage weights. Input 0 is the block input; every stage then owns
+ * @ref InvertedResidualLayerNode::num_stage_inputs consecutive inputs: weights, bias, mean, variance, beta and gamma.
+ * Bias and batch normalization inputs can be left unconnected.
+ */
+class InvertedResidualLayerNode final : public INode
+{
+public:
+    /** Stages of the block */
+    enum class Stage
+    {
+        Expand,    /**< 1x1 expansion convolution */
+        Depthwise, /**< Depthwise convolution */
+        Project    /**< 1x1 projection convolution */
+    };
+    /** Inputs of a single stage */
+    enum class StageInput
+    {
+        Weights,
+        Bias,
+        Mean,
+        Var,
+        Beta,
+        Gamma
+    };
+
+    static constexpr size_t num_stage_inputs = 6; /**< Number of inputs per stage */
+    static constexpr size_t num_stages       = 3; /**< Number of stages */
+
+    /** Constructor
+     *
+     * @param[in] info     Inverted residual block information.
+     * @param[in] epsilons (Optional) Batch normalization epsilon of each stage.
+     */
+    InvertedResidualLayerNode(InvertedResidualLayerInfo    info,
+                              std::array<float, num_stages> epsilons = {{0.001f, 0.001f, 0.001f}});
+    /** Inverted residual block information accessor
+     *
+     * @return Block information
+     */
+    InvertedResidualLayerInfo info() const;
+    /** Batch normalization epsilon accessor
+     *
+     * @param[in] stage Stage to query
+     *
+     * @return Epsilon of the batch normalization fused to @p stage
+     */
+    float epsilon(Stage stage) const;
+    /** Returns the node input index of a stage input
+     *
+     * @param[in] stage Stage
+     * @param[in] input Stage input
+     *
+     * @return Input index
+     */
+    static size_t input_idx(Stage stage, StageInput input);
+    /** Computes the output descriptor
+     *
+     * @param[in] input_descriptor        Input descriptor
+     * @param[in] dw_weights_descriptor   Depthwise weights descriptor
+     * @param[in] proj_weights_descriptor Projection weights descriptor
+     * @param[in] info                    Depthwise stage padding and stride information
+     *
+     * @return Output descriptor
+     */
+    static TensorDescriptor compute_output_descriptor(const TensorDescriptor &input_descriptor,
+                                                      const TensorDescriptor &dw_weights_descriptor,
+                                                      const TensorDescriptor &proj_weights_descriptor,
+                                                      const PadStrideInfo    &info);
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void             accept(INodeVisitor &v) override;
+
+public:
+    static constexpr NodeType node_type = NodeType::InvertedResidualLayer;
+
+private:
+    InvertedResidualLayerInfo     _info;
+    std::array<float, num_stages> _epsilons;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_NODES_INVERTEDRESIDUALLAYERNODE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -49,13 +49,16 @@ class DequantizationLayerNode;
 class DetectionOutputLayerNode;
 class DetectionPostProcessLayerNode;
 class DummyNode;
+class ElementwiseExpressionLayerNode;
 class EltwiseLayerNode;
 class FlattenLayerNode;
 class FullyConnectedLayerNode;
 class FusedConvolutionBatchNormalizationNode;
 class FusedDepthwiseConvolutionBatchNormalizationNode;
 class GenerateProposalsLayerNode;
+class GlobalPoolingFullyConnectedLayerNode;
 class InputNode;
+class InvertedResidualLayerNode;
 class L2NormalizeLayerNode;
 class NormalizationLayerNode;
 class NormalizePlanarYUVLayerNode;
@@ -72,6 +75,7 @@ class ReorgLayerNode;
 class ReshapeLayerNode;
 class ResizeLayerNode;
 class ROIAlignLayerNode;
+class RoPELayerNode;
 class SoftmaxLayerNode;
 class SliceLayerNode;
 class SplitLayerNode;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -63,6 +63,8 @@ public:
     TensorDescriptor configure_output(size_t idx) const override;
     void             accept(INodeVisitor &v) override;
 
+    static constexpr NodeType node_type = NodeType::PoolingLayer;
+
 private:
     PoolingLayerInfo _info;
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -44,6 +44,21 @@ public:
      */
     ReshapeLayerNode(TensorShape shape);
 
+    /** Disables or not the node
+     *
+     * @warning This is used when the output is an alias of the input, where this node is used as a placeholder.
+     *
+     * @param[in] is_enabled If true a backend function is created to perform the reshape (involves copying),
+     *                       while if false, no function is created and we assume that the output aliases the input
+     *                       to simulate a zero copy operation.
+     */
+    void set_enabled(bool is_enabled);
+    /** Enabled parameter accessor
+     *
+     * @return True if a backend function is to be created else false
+     */
+    bool is_enabled() const;
+
     // Inherited overridden methods:
     NodeType         type() const override;
     bool             forward_descriptors() override;
@@ -52,6 +67,7 @@ public:
 
 private:
     TensorShape _shape;
+    bool        _is_enabled;
 };
 } // namespace graph
 } // namespace arm_compute
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_HUGEPAGEALLOCATOR_H
+#define ACL_ARM_COMPUTE_RUNTIME_HUGEPAGEALLOCATOR_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/runtime/IAllocator.h"
+#include "arm_compute/runtime/IMemoryRegion.h"
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace arm_compute
+{
+class IScheduler;
+
+/** Huge page policies */
+enum class HugePagePolicy
+{
+    NONE,        /**< Regular pages only */
+    TRANSPARENT, /**< Align mappings to huge pages and advise the kernel to back them with transparent huge pages */
+    EXPLICIT     /**< Use pre-reserved huge pages, falling back to transparent huge pages if none are left */
+};
+
+/** Configuration of a @ref HugePageAllocator */
+struct HugePageAllocatorInfo
+{
+    HugePagePolicy huge_pages{HugePagePolicy::TRANSPARENT}; /**< Huge page policy */
+    size_t         huge_page_size{2 * 1024 * 1024};         /**< Size in bytes of a huge page */
+    int            numa_node{-1};                           /**< NUMA node to bind the memory to, -1 for no binding */
+    bool           first_touch{false};                      /**< Fault pages in from the scheduler worker threads */
+    IScheduler    *scheduler{nullptr};                      /**< Scheduler used for the first touch, or nullptr */
+};
+
+/** Allocator backed by anonymous memory mappings
+ *
+ * Unlike @ref Allocator and @ref MemoryRegion, the memory is not zero-initialized by the library, so pages are only
+ * faulted in when first used, and mappings honour the requested alignment. Large allocations can be backed by huge
+ * pages to reduce TLB pressure, bound to a NUMA node and pre-faulted by the threads that will compute on them.
+ *
+ * It can back unmanaged tensors (@ref TensorAllocator::set_backing_allocator), memory pools
+ * (@ref BlobMemoryPool, @ref OffsetMemoryPool through @ref IMemoryManager::populate) and graphs
+ * (@ref graph::GraphConfig::allocator).
+ *
+ * @note Huge pages and NUMA binding are only applied on Linux and are best-effort: if the system refuses them the
+ *       memory is still returned, backed by regular pages and the default memory policy.
+ * @note Regions created by @ref make_region own their mapping and can outlive the allocator.
+ * @note Like the default @ref Allocator, @ref allocate and @ref make_region throw std::bad_alloc when the memory can
+ *       not be mapped.
+ */
+class HugePageAllocator final : public IAllocator
+{
+public:
+    /** Constructor
+     *
+     * @param[in] info (Optional) Allocator configuration.
+     */
+    explicit HugePageAllocator(const HugePageAllocatorInfo &info = HugePageAllocatorInfo());
+    /** Destructor. Releases the memory returned by @ref allocate that has not been freed */
+    ~HugePageAllocator();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    HugePageAllocator(const HugePageAllocator &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    HugePageAllocator &operator=(const HugePageAllocator &) = delete;
+
+    /** Allocator configuration
+     *
+     * @return The configuration
+     */
+    const HugePageAllocatorInfo &info() const;
+
+    // Inherited methods overridden:
+    void                          *allocate(size_t size, size_t alignment) override;
+    void                           free(void *ptr) override;
+    std::unique_ptr<IMemoryRegion> make_region(size_t size, size_t alignment) override;
+
+private:
+    HugePageAllocatorInfo                       _info;
+    std::map<void *, std::pair<void *, size_t>> _allocations; /**< Mapping (start, length) of allocate() results */
+    std::mutex                                  _mtx;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_HUGEPAGEALLOCATOR_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2021, 2025 Arm Limited.
+ * Copyright (c) 2019, 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,8 +33,15 @@ namespace arm_compute
 // Forward declarations
 class IScheduler;
 class IAssetManager;
+class WorkspaceArena;
 
-/** Context interface */
+/** Context interface
+ *
+ * On the CPU, the scheduler of the context is bound to the calling thread (see @ref SchedulerScope) while a function
+ * created with the context runs. The CPU functions that take a context are @ref NEActivationLayer, @ref NEBitwiseAnd,
+ * @ref NEBitwiseNot, @ref NEBitwiseOr, @ref NEBitwiseXor and the operators built on @ref experimental::INEOperator.
+ * Other CPU functions run on the scheduler returned by Scheduler::get().
+ */
 class IRuntimeContext
 {
 public:
@@ -54,6 +61,17 @@ public:
      * @return The asset manager registered to the context
      */
     virtual IAssetManager *asset_manager() = 0;
+    /** Workspace arena accessor
+     *
+     * @note The workspace arena serves the auxiliary tensors of the CPU operators run without workspace
+     *       (see @ref WorkspaceArenaScope)
+     *
+     * @return The workspace arena registered to the context, nullptr if none
+     */
+    virtual WorkspaceArena *workspace_arena()
+    {
+        return nullptr;
+    }
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_IRUNTIMECONTEXT_H
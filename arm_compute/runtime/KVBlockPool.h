@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_KVBLOCKPOOL_H
+#define ACL_ARM_COMPUTE_RUNTIME_KVBLOCKPOOL_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "support/Mutex.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Configuration of a @ref KVBlockPool */
+struct KVBlockPoolInfo
+{
+    /** Default constructor */
+    KVBlockPoolInfo() = default;
+    /** Constructor
+     *
+     * @param[in] head_dim   Number of channels of every head.
+     * @param[in] block_size Number of sequence positions of a block.
+     * @param[in] num_heads  Number of key/value heads.
+     * @param[in] num_blocks Number of blocks of the pool.
+     * @param[in] data_type  (Optional) Storage data type. Data types supported: F16/F32.
+     */
+    KVBlockPoolInfo(
+        size_t head_dim, size_t block_size, size_t num_heads, size_t num_blocks, DataType data_type = DataType::F32)
+        : head_dim(head_dim), block_size(block_size), num_heads(num_heads), num_blocks(num_blocks), data_type(data_type)
+    {
+    }
+
+    size_t   head_dim{0};              /**< Number of channels of every head */
+    size_t   block_size{16};           /**< Number of sequence positions of a block */
+    size_t   num_heads{1};             /**< Number of key/value heads */
+    size_t   num_blocks{0};            /**< Number of blocks of the pool */
+    DataType data_type{DataType::F32}; /**< Storage data type */
+};
+
+/** Pool of fixed-size key and value blocks shared by many sequences
+ *
+ * Keys and values are stored in two tensors of shape [head_dim, block_size, num_heads, num_blocks]. Like the pools of
+ * a @ref PoolManager, blocks are moved between a free list and the sequences that occupy them, so the memory of a
+ * sequence grows one block at a time instead of being reserved for its maximum length, and is recycled as soon as the
+ * sequence is removed.
+ *
+ * The sequence position p of a sequence is stored at row p % block_size of its block p / block_size, and the index of
+ * that row in the whole pool (its slot) is block * block_size + p % block_size. @ref NEPagedKVCacheAppend writes new
+ * keys and values to slots and @ref NEPagedAttention reads them back through the block tables of the sequences.
+ *
+ * @note Bookkeeping is thread-safe. The storage must be allocated before running functions on it.
+ * @note Passing the identifier of a sequence that was never added, or was removed, is an error in every build.
+ */
+class KVBlockPool
+{
+public:
+    /** Default constructor */
+    KVBlockPool();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    KVBlockPool(const KVBlockPool &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    KVBlockPool &operator=(const KVBlockPool &) = delete;
+    /** Default destructor */
+    ~KVBlockPool();
+
+    /** Initialise the pool storage. All the blocks are free
+     *
+     * @param[in] info Pool configuration.
+     */
+    void init(const KVBlockPoolInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref KVBlockPool
+     *
+     * @param[in] info Pool configuration.
+     *
+     * @return a status
+     */
+    static Status validate(const KVBlockPoolInfo &info);
+    /** Pool configuration
+     *
+     * @return The configuration
+     */
+    const KVBlockPoolInfo &info() const;
+    /** Allocate the key and value storage */
+    void allocate();
+    /** Key storage, of shape [head_dim, block_size, num_heads, num_blocks]
+     *
+     * @return The key tensor
+     */
+    ITensor *keys();
+    /** Value storage, of shape [head_dim, block_size, num_heads, num_blocks]
+     *
+     * @return The value tensor
+     */
+    ITensor *values();
+
+    /** Register a new empty sequence
+     *
+     * @return The identifier of the sequence
+     */
+    int add_sequence();
+    /** Remove a sequence and return its blocks to the free list
+     *
+     * @param[in] seq Sequence identifier.
+     */
+    void remove_sequence(int seq);
+    /** Grow a sequence by @p num_tokens positions, taking new blocks from the free list if needed
+     *
+     * @param[in]  seq        Sequence identifier.
+     * @param[in]  num_tokens Number of new positions.
+     * @param[out] slots      (Optional) Slots of the new positions, to be written with @ref NEPagedKVCacheAppend.
+     *                        Must hold at least @p num_tokens elements.
+     *
+     * @return False, leaving the sequence unchanged, if there are not enough free blocks
+     */
+    bool append(int seq, size_t num_tokens, int32_t *slots = nullptr);
+    /** Number of positions of a sequence
+     *
+     * @param[in] seq Sequence identifier.
+     *
+     * @return The length of the sequence
+     */
+    size_t length(int seq) const;
+    /** Blocks occupied by a sequence, in sequence order
+     *
+     * @param[in] seq Sequence identifier.
+     *
+     * @return The block table of the sequence
+     */
+    std::vector<int32_t> block_table(int seq) const;
+    /** Number of blocks in the free list
+     *
+     * @return The number of free blocks
+     */
+    size_t num_free_blocks() const;
+    /** Write the block tables and lengths of a batch of sequences, e.g. before running @ref NEPagedAttention
+     *
+     * @param[in]  seqs         Sequences of the batch.
+     * @param[out] block_tables S32 tensor of shape [max_blocks_per_seq, seqs.size()]. Unused entries are set to 0.
+     * @param[out] seq_lens     S32 tensor of shape [seqs.size()].
+     */
+    void fill_block_tables(const std::vector<int> &seqs, ITensor *block_tables, ITensor *seq_lens) const;
+
+private:
+    struct Sequence
+    {
+        std::vector<int32_t> blocks{};
+        size_t               length{0};
+    };
+
+    KVBlockPoolInfo            _info;
+    Tensor                     _keys;
+    Tensor                     _values;
+    std::vector<int32_t>       _free_blocks; /**< Stack of free blocks */
+    std::map<int, Sequence>    _sequences;   /**< Live sequences */
+    int                        _next_seq;
+    mutable arm_compute::Mutex _mtx;         /**< Mutex to control access to the block lists */
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_KVBLOCKPOOL_H
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_KVCACHE_H
+#define ACL_ARM_COMPUTE_RUNTIME_KVCACHE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/QuantizationInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/SubTensor.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+/** Configuration of a @ref KVCache */
+struct KVCacheInfo
+{
+    /** Default constructor */
+    KVCacheInfo() = default;
+    /** Constructor
+     *
+     * @param[in] head_dim    Number of channels of every head.
+     * @param[in] capacity    Maximum number of sequence positions the cache can hold.
+     * @param[in] num_heads   Number of heads.
+     * @param[in] batches     (Optional) Number of sequences.
+     * @param[in] data_type   (Optional) Storage data type. Data types supported: F16/F32/QSYMM8_PER_CHANNEL.
+     * @param[in] head_scales (Optional) Scale of every head, only used when @p data_type is QSYMM8_PER_CHANNEL.
+     */
+    KVCacheInfo(size_t             head_dim,
+                size_t             capacity,
+                size_t             num_heads,
+                size_t             batches     = 1,
+                DataType           data_type   = DataType::F32,
+                std::vector<float> head_scales = {})
+        : head_dim(head_dim),
+          capacity(capacity),
+          num_heads(num_heads),
+          batches(batches),
+          data_type(data_type),
+          head_scales(std::move(head_scales))
+    {
+    }
+
+    size_t             head_dim{0};              /**< Number of channels of every head */
+    size_t             capacity{0};              /**< Maximum number of sequence positions */
+    size_t             num_heads{1};             /**< Number of heads */
+    size_t             batches{1};               /**< Number of sequences */
+    DataType           data_type{DataType::F32}; /**< Storage data type */
+    std::vector<float> head_scales{};            /**< Per-head scales of the int8 storage */
+};
+
+/** Pre-reserved key or value cache of an attention layer
+ *
+ * The cache is a single allocation of shape [head_dim, capacity, num_heads, batches] of which only the first
+ * @ref length() sequence positions hold data. New positions are written in place by @ref NEKVCacheAppend, so
+ * generating a token costs the size of its keys and values instead of the size of the whole cache.
+ *
+ * Functions consume the valid part of the cache through @ref view(), a sub-tensor sharing the cache memory and
+ * strides: a function configured on the view of a given length can be run again whenever the cache holds at least
+ * that many positions, e.g. one configuration per bucket of sequence lengths, without copying the cache.
+ *
+ * When the storage is QSYMM8_PER_CHANNEL, every head is quantized with its own scale and the views carry the
+ * per-head quantization information (see @ref head_quantization_info).
+ */
+class KVCache
+{
+public:
+    /** Default constructor */
+    KVCache();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    KVCache(const KVCache &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    KVCache &operator=(const KVCache &) = delete;
+    /** Default destructor */
+    ~KVCache();
+
+    /** Initialise the cache storage. The memory is allocated by @ref allocator()
+     *
+     * @param[in] info Cache configuration.
+     */
+    void init(const KVCacheInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref KVCache
+     *
+     * @param[in] info Cache configuration.
+     *
+     * @return a status
+     */
+    static Status validate(const KVCacheInfo &info);
+    /** Cache configuration
+     *
+     * @return The configuration
+     */
+    const KVCacheInfo &info() const;
+    /** Allocator of the cache storage, e.g. to allocate it or to import external memory
+     *
+     * @return The allocator of the storage tensor
+     */
+    TensorAllocator *allocator();
+    /** Tensor holding the whole storage, of shape [head_dim, capacity, num_heads, batches]
+     *
+     * @return The storage tensor
+     */
+    ITensor *tensor();
+    /** Number of valid sequence positions
+     *
+     * @return The valid length
+     */
+    size_t length() const;
+    /** Maximum number of sequence positions
+     *
+     * @return The capacity
+     */
+    size_t capacity() const;
+    /** Set the number of valid sequence positions, e.g. to roll back rejected speculative tokens
+     *
+     * @param[in] length New valid length. Must not exceed the capacity.
+     */
+    void set_length(size_t length);
+    /** Mark the cache as empty. The memory is kept */
+    void reset();
+    /** View of the first @p length sequence positions of the cache
+     *
+     * Views are created on demand and live as long as the cache, so functions can be configured on them.
+     *
+     * @param[in] length Number of sequence positions of the view. Must be in [1, capacity].
+     *
+     * @return A sub-tensor of shape [head_dim, length, num_heads, batches]
+     */
+    ITensor *view(size_t length);
+    /** View of the valid sequence positions of the cache
+     *
+     * @return A sub-tensor of shape [head_dim, length(), num_heads, batches]
+     */
+    ITensor *view();
+    /** Quantization information of a head of a quantized cache
+     *
+     * @param[in] head Index of the head.
+     *
+     * @return The uniform quantization of @p head, or an empty quantization if the storage is not quantized
+     */
+    QuantizationInfo head_quantization_info(size_t head) const;
+
+private:
+    KVCacheInfo                                  _info;
+    Tensor                                       _storage;
+    std::map<size_t, std::unique_ptr<SubTensor>> _views;
+    size_t                                       _length;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_KVCACHE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2016-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,8 +38,11 @@ class ITensor;
 class NEBitwiseAnd : public INESimpleFunctionNoBorder
 {
 public:
-    /** Constructor */
-    NEBitwiseAnd() = default;
+    /** Constructor
+     *
+     * @param[in] ctx (Optional) Runtime context to be used by the function
+     */
+    NEBitwiseAnd(IRuntimeContext *ctx = nullptr);
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     NEBitwiseAnd(const NEBitwiseAnd &) = delete;
     /** Prevent instances of this class from being copied (As this class contains pointers) */
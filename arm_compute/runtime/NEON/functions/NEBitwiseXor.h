@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,6 +38,11 @@ class ITensor;
 class NEBitwiseXor : public INESimpleFunctionNoBorder
 {
 public:
+    /** Constructor
+     *
+     * @param[in] ctx (Optional) Runtime context to be used by the function
+     */
+    NEBitwiseXor(IRuntimeContext *ctx = nullptr);
     /** Initialise the kernel's inputs and output
      *
      * Valid data layouts:
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,9 +37,13 @@ namespace arm_compute
 // Forward Declarations
 class Tensor;
 class ITensor;
-class NECropKernel;
+class NECropResizeKernel;
 
-/** Function to perform cropping and resizing */
+/** Function to perform cropping and resizing
+ *
+ * All the boxes are cropped and resized by a single @ref NECropResizeKernel, which interpolates every output pixel
+ * directly from the input and is parallelised across boxes, or across output rows when there are few boxes.
+ */
 class NECropResize : public IFunction
 {
 public:
@@ -115,15 +119,9 @@ public:
 
     void run() override;
 
-    ITensor            *_output;
-    size_t              _num_boxes;
-    InterpolationPolicy _method;
-    float               _extrapolation_value;
-
-    std::vector<std::unique_ptr<NECropKernel>> _crop;
-    std::vector<std::unique_ptr<NEScale>>      _scale;
-    std::vector<std::unique_ptr<Tensor>>       _crop_results;
-    std::vector<std::unique_ptr<Tensor>>       _scaled_results;
+    ITensor                            *_output;
+    size_t                              _num_boxes;
+    std::unique_ptr<NECropResizeKernel> _crop_resize;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NECROPRESIZE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,12 +33,16 @@
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/functions/NEBatchToSpaceLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEDirectConvolutionLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEReverse.h"
+#include "arm_compute/runtime/NEON/functions/NEStridedSlice.h"
+#include "arm_compute/runtime/SubTensor.h"
 #include "arm_compute/runtime/Tensor.h"
 
 #include <memory>
+#include <vector>
 
 namespace arm_compute
 {
@@ -67,11 +71,18 @@ namespace arm_compute
  * The weights used by Deconvolution are supposed to be the same as the ones used for Convolution. Therefore, it will be necessary to use the weights in the
  * reverse order to perform an actual convolution. This is achieved by using @ref NEReverse.
  *
+ * When a stride is greater than 1, most of the upsampled input is zeros. If the kernel is at least as large as the stride, the deconvolution is instead
+ * decomposed in stride_x * stride_y phases: every phase is a stride 1 convolution of the original input with the taps of the flipped kernel that share
+ * the same offset modulo the stride, and the phase outputs are interleaved into the output with @ref NEBatchToSpaceLayer. No zero is multiplied and no
+ * upsampled tensor is allocated.
+ *
  * This function calls the following kernels/functions:
  *
- * -# @ref CPPUpsample
+ * -# @ref CPPUpsample (if the deconvolution is not decomposed in phases)
  * -# @ref NEConvolutionLayer
  * -# @ref NEReverse
+ * -# @ref NEStridedSlice (if the deconvolution is decomposed in phases)
+ * -# @ref NEBatchToSpaceLayer (if the deconvolution is decomposed in phases)
  *
  */
 class NEDeconvolutionLayer : public IFunction
@@ -156,18 +167,26 @@ public:
     void prepare() override;
 
 private:
-    MemoryGroup        _memory_group;
-    NEConvolutionLayer _conv_f;
-    CPPUpsample        _upsample_f;
-    NEReverse          _flip_weights;
-    Tensor             _scaled_output;
-    Tensor             _weights_flipped;
-    Tensor             _flip_axis;
-    const ITensor     *_original_weights;
-    ITensor           *_input;
-    PadStrideInfo      _info;
-    bool               _is_prepared;
-    bool               _do_upsampling;
+    std::shared_ptr<IMemoryManager>                  _memory_manager;
+    MemoryGroup                                      _memory_group;
+    NEConvolutionLayer                               _conv_f;
+    CPPUpsample                                      _upsample_f;
+    NEReverse                                        _flip_weights;
+    std::vector<std::unique_ptr<NEStridedSlice>>     _phase_weights_f;
+    std::vector<std::unique_ptr<NEConvolutionLayer>> _phase_conv_f;
+    std::unique_ptr<NEBatchToSpaceLayer>             _interleave_f;
+    Tensor                                           _scaled_output;
+    Tensor                                           _weights_flipped;
+    Tensor                                           _flip_axis;
+    std::vector<std::unique_ptr<Tensor>>             _phase_weights;
+    std::vector<std::unique_ptr<SubTensor>>          _phase_outputs;
+    Tensor                                           _phases;
+    const ITensor                                   *_original_weights;
+    ITensor                                         *_input;
+    PadStrideInfo                                    _info;
+    bool                                             _is_prepared;
+    bool                                             _do_upsampling;
+    bool                                             _do_phase_decomposition;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEDECONVOLUTIONLAYER_H
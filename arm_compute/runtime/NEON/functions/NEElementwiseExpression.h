@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEELEMENTWISEEXPRESSION_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEELEMENTWISEEXPRESSION_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/ElementwiseExpressionInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+class ITensor;
+class ITensorInfo;
+
+/** Function to evaluate a fused expression of elementwise operations
+ *
+ * The whole expression is computed in a single pass over the output: every thread evaluates it on small blocks of
+ * elements that stay in the L1 cache, so the intermediate results of a chain of elementwise operations are never
+ * written to memory.
+ */
+class NEElementwiseExpression : public IFunction
+{
+public:
+    /** Constructor */
+    NEElementwiseExpression();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEElementwiseExpression(const NEElementwiseExpression &) = delete;
+    /** Default move constructor */
+    NEElementwiseExpression(NEElementwiseExpression &&);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEElementwiseExpression &operator=(const NEElementwiseExpression &) = delete;
+    /** Default move assignment operator */
+    NEElementwiseExpression &operator=(NEElementwiseExpression &&);
+    /** Destructor */
+    ~NEElementwiseExpression();
+    /** Initialize the function's inputs and output.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |inputs         |output         |
+     * |:--------------|:--------------|
+     * |F16            |F16            |
+     * |F16            |F32            |
+     * |F32            |F16            |
+     * |F32            |F32            |
+     *
+     * The inputs are broadcast against each other and the result of the last node of @p info is written, converted
+     * to the data type of @p output.
+     *
+     * @param[in]  inputs Inputs of the expression, at most 8. Data types supported: F16/F32.
+     *                    All the inputs must have the same data type.
+     * @param[out] output Output tensor with the broadcast shape of the inputs. Data types supported: F16/F32.
+     * @param[in]  info   Expression to evaluate, with @p inputs.size() inputs and at most 32 nodes.
+     */
+    void configure(const std::vector<const ITensor *> &inputs, ITensor *output, const ElementwiseExpressionInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEElementwiseExpression
+     *
+     * Similar to @ref NEElementwiseExpression::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const std::vector<const ITensorInfo *> &inputs,
+                           const ITensorInfo                      *output,
+                           const ElementwiseExpressionInfo        &info);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEELEMENTWISEEXPRESSION_H
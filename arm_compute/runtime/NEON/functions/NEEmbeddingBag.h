@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEEMBEDDINGBAG_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEEMBEDDINGBAG_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/EmbeddingBagInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+class ITensorInfo;
+
+/** Function to look up rows of an embedding table and optionally pool them per bag
+ *
+ * Unlike @ref NEGather, the lookup is parallelised over the indices (or the bags), prefetches the rows of upcoming
+ * indices to hide the latency of the random accesses to large tables, dequantizes rows quantized per row to 8 or
+ * 4 bits on the fly and sums or averages the rows of every bag without materializing them.
+ */
+class NEEmbeddingBag : public IFunction
+{
+public:
+    /** Constructor */
+    NEEmbeddingBag(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEEmbeddingBag(const NEEmbeddingBag &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEEmbeddingBag(NEEmbeddingBag &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEEmbeddingBag &operator=(const NEEmbeddingBag &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEEmbeddingBag &operator=(NEEmbeddingBag &&) = delete;
+    /** Destructor */
+    ~NEEmbeddingBag();
+    /** Initialize the function's inputs and outputs.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |table          |row_params     |indices        |offsets        |dst            |
+     * |:--------------|:--------------|:--------------|:--------------|:--------------|
+     * |F16            |-              |S32            |S32            |F16            |
+     * |F32            |-              |S32            |S32            |F32            |
+     * |S8             |F32            |S32            |S32            |F32            |
+     * |U8             |F32            |S32            |S32            |F32            |
+     *
+     * A U8 table holds signed 4-bit values packed two per byte, the low nibble of byte j holding channel 2j and the
+     * high nibble channel 2j + 1. Row r of a S8 or U8 table dequantizes to q * row_params(0, r) + row_params(1, r).
+     *
+     * Without pooling, output row i is the table row indices(i). When pooling, bag b gathers the rows of the indices
+     * in [offsets(b), offsets(b + 1)), the last bag ending at the last index, and output row b is their sum or mean.
+     * Out-of-range indices are skipped: they produce a row of zeros and do not count in the mean of a bag.
+     *
+     * @param[in]  table      Embedding table with dimensions [embedding_dim, num_rows], or [embedding_dim / 2,
+     *                        num_rows] for a U8 table. Data types supported: F16/F32/S8/U8.
+     * @param[in]  row_params Scale and bias of every row of a quantized table with dimensions [2, num_rows].
+     *                        Must be nullptr for a F16/F32 table. Data type supported: F32.
+     * @param[in]  indices    Rows to look up with dimensions [num_indices]. Data type supported: S32.
+     * @param[in]  offsets    Index of the first index of every bag with dimensions [num_bags]. Required when
+     *                        @p info.mode pools the bags, nullptr otherwise. Data type supported: S32.
+     * @param[out] dst        Destination with dimensions [embedding_dim, num_bags], or [embedding_dim, num_indices]
+     *                        without pooling. Data type supported: Same as @p table, F32 for a S8/U8 table.
+     * @param[in]  info       Embedding bag information.
+     */
+    void configure(const ITensor          *table,
+                   const ITensor          *row_params,
+                   const ITensor          *indices,
+                   const ITensor          *offsets,
+                   ITensor                *dst,
+                   const EmbeddingBagInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEEmbeddingBag
+     *
+     * Similar to @ref NEEmbeddingBag::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo      *table,
+                           const ITensorInfo      *row_params,
+                           const ITensorInfo      *indices,
+                           const ITensorInfo      *offsets,
+                           const ITensorInfo      *dst,
+                           const EmbeddingBagInfo &info);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEEMBEDDINGBAG_H
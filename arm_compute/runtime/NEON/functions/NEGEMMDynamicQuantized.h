@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEGEMMDYNAMICQUANTIZED_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEGEMMDYNAMICQUANTIZED_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+class ITensorInfo;
+
+/** Function to multiply a floating-point matrix by int8 weights with dynamic quantization of the matrix
+ *
+ * This replaces the sequence @ref NEQuantizationLayer, @ref NEGEMMLowpMatrixMultiplyCore and
+ * @ref NEDequantizationLayer in a single pass: every row (token) of the input is quantized to int8 on the fly with
+ * its own symmetric scale, multiplied by the weights with int8 dot products, and the int32 result is dequantized with
+ * the row and weights scales before the bias and the activation are applied.
+ *
+ * Using a scale per row instead of a single scale computed from the whole input preserves the accuracy of rows with
+ * small magnitudes, and the quantized input is never written to memory.
+ */
+class NEGEMMDynamicQuantized : public IFunction
+{
+public:
+    /** Constructor */
+    NEGEMMDynamicQuantized(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMDynamicQuantized(const NEGEMMDynamicQuantized &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEGEMMDynamicQuantized(NEGEMMDynamicQuantized &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMDynamicQuantized &operator=(const NEGEMMDynamicQuantized &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEGEMMDynamicQuantized &operator=(NEGEMMDynamicQuantized &&) = delete;
+    /** Destructor */
+    ~NEGEMMDynamicQuantized();
+    /** Initialize the function's inputs and output.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |a              |weights            |bias           |dst            |
+     * |:--------------|:------------------|:--------------|:--------------|
+     * |F16            |QASYMM8_SIGNED     |F16            |F16            |
+     * |F16            |QSYMM8_PER_CHANNEL |F16            |F16            |
+     * |F32            |QASYMM8_SIGNED     |F32            |F32            |
+     * |F32            |QSYMM8_PER_CHANNEL |F32            |F32            |
+     *
+     * This is what this function does:
+     *      dst(n, m) <- act(sum_k(quantize_m(a(k, m)) * (weights(n, k) - offset(n))) * scale_m * scale(n) + bias(n))
+     *
+     * where scale_m = max_k(|a(k, m)|) / 127 and quantize_m(x) = round(x / scale_m).
+     *
+     * @note Supported activations are RELU, BOUNDED_RELU, LU_BOUNDED_RELU and IDENTITY.
+     *
+     * @param[in]  a        Input tensor with dimensions [K, M, batches]. Data types supported: F16/F32.
+     * @param[in]  weights  Weights tensor with dimensions [N, K], with per-tensor or per-channel quantization.
+     *                      Data types supported: QASYMM8_SIGNED/QSYMM8_PER_CHANNEL.
+     * @param[in]  bias     Bias tensor with dimensions [N]. Can be nullptr. Data type supported: Same as @p a.
+     * @param[out] dst      Destination tensor with dimensions [N, M, batches]. Data type supported: Same as @p a.
+     * @param[in]  act_info (Optional) Activation applied to the result.
+     */
+    void configure(const ITensor             *a,
+                   const ITensor             *weights,
+                   const ITensor             *bias,
+                   ITensor                   *dst,
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref NEGEMMDynamicQuantized
+     *
+     * Similar to @ref NEGEMMDynamicQuantized::configure() except the arguments are @ref ITensorInfo * instead of
+     * @ref ITensor *
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo         *a,
+                           const ITensorInfo         *weights,
+                           const ITensorInfo         *bias,
+                           const ITensorInfo         *dst,
+                           const ActivationLayerInfo &act_info = ActivationLayerInfo());
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEGEMMDYNAMICQUANTIZED_H
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEGEMMINT4_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEGEMMINT4_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/GEMMInt4Info.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+class ITensorInfo;
+
+/** Function to multiply a matrix by weight-only quantized signed 4-bit weights
+ *
+ * The weights stay 4-bit in memory: they are re-packed once into interleaved blocks of output channels and unpacked
+ * on the fly, halving the weight bandwidth of the 8-bit paths. This targets the matrix-vector products of LLM decoder
+ * layers, which are bound by the weight bandwidth.
+ */
+class NEGEMMInt4 : public IFunction
+{
+public:
+    /** Constructor */
+    NEGEMMInt4(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMInt4(const NEGEMMInt4 &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEGEMMInt4(NEGEMMInt4 &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMInt4 &operator=(const NEGEMMInt4 &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEGEMMInt4 &operator=(NEGEMMInt4 &&) = delete;
+    /** Destructor */
+    ~NEGEMMInt4();
+    /** Initialize the function's inputs and output.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |a              |weights        |scales         |bias           |dst            |
+     * |:--------------|:--------------|:--------------|:--------------|:--------------|
+     * |QASYMM8_SIGNED |U8             |F32            |F32            |F32            |
+     * |F16            |U8             |F32            |F16            |F16            |
+     * |F32            |U8             |F32            |F32            |F32            |
+     *
+     * This is what this function does:
+     *      dst(n, m) <- act(sum_k(a(k, m) * int4(k, n) * scale(k / group_size, n)) + bias(n))
+     *
+     * See @ref GEMMInt4Info for the layout of the weights and scales.
+     *
+     * @note Supported activations are RELU, BOUNDED_RELU, LU_BOUNDED_RELU and IDENTITY.
+     *
+     * @param[in]  a       Input tensor with dimensions [K, M, batches]. Data types supported: QASYMM8_SIGNED/F16/F32.
+     * @param[in]  weights Signed 4-bit weights packed two per byte, with dimensions [ceil(K / 2), N].
+     *                     Data type supported: U8.
+     * @param[in]  scales  Weights scales with dimensions [num_groups, N]. Data type supported: F32.
+     * @param[in]  bias    Bias tensor with dimensions [N]. Can be nullptr. Data type supported: Same as @p dst.
+     * @param[out] dst     Destination tensor with dimensions [N, M, batches].
+     *                     Data type supported: F32 for QASYMM8_SIGNED @p a, otherwise same as @p a.
+     * @param[in]  info    (Optional) Group size of the scales and fused activation.
+     */
+    void configure(const ITensor      *a,
+                   const ITensor      *weights,
+                   const ITensor      *scales,
+                   const ITensor      *bias,
+                   ITensor            *dst,
+                   const GEMMInt4Info &info = GEMMInt4Info());
+    /** Static function to check if given info will lead to a valid configuration of @ref NEGEMMInt4
+     *
+     * Similar to @ref NEGEMMInt4::configure() except the arguments are @ref ITensorInfo * instead of @ref ITensor *
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo  *a,
+                           const ITensorInfo  *weights,
+                           const ITensorInfo  *scales,
+                           const ITensorInfo  *bias,
+                           const ITensorInfo  *dst,
+                           const GEMMInt4Info &info = GEMMInt4Info());
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEGEMMINT4_H
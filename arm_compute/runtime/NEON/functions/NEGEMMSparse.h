@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEGEMMSPARSE_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEGEMMSPARSE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+class ITensorInfo;
+
+/** Function to multiply a matrix by weights pruned to 2:4 structured sparsity
+ *
+ * In every group of 4 consecutive weights along K of an output channel at most 2 weights are non-zero. The dense
+ * weights are packed at preparation time into their kept values, each paired with the gather index of the input
+ * element it multiplies, so that half of the multiply-accumulates are computed. The packed weights take as many
+ * bytes as the dense weights; the saving is in arithmetic, with weight reads shared by a tile of input rows.
+ *
+ * Sparsity depends on the values of the weights, which are only known at preparation time: use
+ * @ref NEGEMMSparse::is_2_4_sparse to select this function over @ref NEGEMM or @ref NEGEMMLowpMatrixMultiplyCore.
+ * Preparing the function with weights that are not 2:4 sparse is an error.
+ */
+class NEGEMMSparse : public IFunction
+{
+public:
+    /** Constructor */
+    NEGEMMSparse(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMSparse(const NEGEMMSparse &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEGEMMSparse(NEGEMMSparse &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMSparse &operator=(const NEGEMMSparse &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEGEMMSparse &operator=(NEGEMMSparse &&) = delete;
+    /** Destructor */
+    ~NEGEMMSparse();
+    /** Initialize the function's inputs and output.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |a              |weights            |bias           |dst            |
+     * |:--------------|:------------------|:--------------|:--------------|
+     * |F16            |F16                |F16            |F16            |
+     * |F32            |F32                |F32            |F32            |
+     * |QASYMM8_SIGNED |QASYMM8_SIGNED     |S32            |S32            |
+     * |QASYMM8_SIGNED |QSYMM8_PER_CHANNEL |S32            |S32            |
+     *
+     * This is what this function does:
+     *      dst(n, m) <- act(sum_k((a(k, m) - a_offset) * weights(n, k)) + bias(n))
+     *
+     * @note Supported activations are RELU, BOUNDED_RELU, LU_BOUNDED_RELU and IDENTITY, for F16/F32 @p a only.
+     * @note Quantized weights must be symmetric (zero offset), so that pruned weights are quantized to zero.
+     *
+     * @param[in]  a        Input tensor with dimensions [K, M, batches]. Data types supported: QASYMM8_SIGNED/F16/F32.
+     * @param[in]  weights  Constant weights tensor with dimensions [N, K] and 2:4 structured sparsity along K.
+     *                      Data types supported: QASYMM8_SIGNED/QSYMM8_PER_CHANNEL for QASYMM8_SIGNED @p a,
+     *                      otherwise same as @p a.
+     * @param[in]  bias     Bias tensor with dimensions [N]. Can be nullptr. Data type supported: Same as @p dst.
+     * @param[out] dst      Destination tensor with dimensions [N, M, batches].
+     *                      Data type supported: S32 for QASYMM8_SIGNED @p a, otherwise same as @p a.
+     * @param[in]  act_info (Optional) Activation applied to the result.
+     */
+    void configure(const ITensor             *a,
+                   const ITensor             *weights,
+                   const ITensor             *bias,
+                   ITensor                   *dst,
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref NEGEMMSparse
+     *
+     * Similar to @ref NEGEMMSparse::configure() except the arguments are @ref ITensorInfo * instead of @ref ITensor *
+     *
+     * @note The sparsity of the weights is not checked, see @ref NEGEMMSparse::is_2_4_sparse
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo         *a,
+                           const ITensorInfo         *weights,
+                           const ITensorInfo         *bias,
+                           const ITensorInfo         *dst,
+                           const ActivationLayerInfo &act_info = ActivationLayerInfo());
+    /** Check whether at most 2 weights are non-zero in every group of 4 consecutive weights along K
+     *
+     * @param[in] weights Allocated weights tensor with dimensions [N, K].
+     *
+     * @return True if the weights can be used by @ref NEGEMMSparse
+     */
+    static bool is_2_4_sparse(const ITensor *weights);
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEGEMMSPARSE_H
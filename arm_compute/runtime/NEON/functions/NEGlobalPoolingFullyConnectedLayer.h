@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEGLOBALPOOLINGFULLYCONNECTEDLAYER_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEGLOBALPOOLINGFULLYCONNECTEDLAYER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/FullyConnectedLayerInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+class ITensorInfo;
+
+/** Function to compute a fused global average pooling and fully connected classifier head
+ *
+ * The spatial dimensions are reduced on the fly by every thread and the pooled vector is multiplied straight away by
+ * the pre-packed weights, so the pooled tensor is never written to memory and the work is spread over output channels.
+ */
+class NEGlobalPoolingFullyConnectedLayer : public IFunction
+{
+public:
+    /** Constructor */
+    NEGlobalPoolingFullyConnectedLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGlobalPoolingFullyConnectedLayer(const NEGlobalPoolingFullyConnectedLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEGlobalPoolingFullyConnectedLayer(NEGlobalPoolingFullyConnectedLayer &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGlobalPoolingFullyConnectedLayer &operator=(const NEGlobalPoolingFullyConnectedLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEGlobalPoolingFullyConnectedLayer &operator=(NEGlobalPoolingFullyConnectedLayer &&) = delete;
+    /** Destructor */
+    ~NEGlobalPoolingFullyConnectedLayer();
+    /** Initialize the function's inputs and output.
+     *
+     * Valid data layouts:
+     * - NHWC
+     *
+     * Valid data type configurations:
+     * |src            |weights        |biases         |dst            |
+     * |:--------------|:--------------|:--------------|:--------------|
+     * |F16            |F16            |F16            |F16            |
+     * |F32            |F32            |F32            |F32            |
+     *
+     * This is what this composite function does:
+     *      pooled <- global_average_pooling(input)
+     *      output <- act(fully_connected(pooled, weights) + biases)
+     *
+     * @note Supported activations are RELU, BOUNDED_RELU, LU_BOUNDED_RELU and IDENTITY.
+     *
+     * @param[in]  input   Source tensor. 3 lower dimensions represent a single input [IFM, width, height],
+     *                     while the fourth dimension represents a batch of inputs. Data types supported: F16/F32.
+     * @param[in]  weights Weights tensor with dimensions [IFM, OFM], or [OFM, IFM] if @p fc_info.transpose_weights is false.
+     *                     Data type supported: Same as @p input.
+     * @param[in]  biases  Bias tensor with dimensions [OFM]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output  Destination tensor with dimensions [OFM, batches]. Data type supported: Same as @p input.
+     * @param[in]  fc_info (Optional) Fully connected layer information.
+     */
+    void configure(const ITensor                 *input,
+                   const ITensor                 *weights,
+                   const ITensor                 *biases,
+                   ITensor                       *output,
+                   const FullyConnectedLayerInfo &fc_info = FullyConnectedLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref NEGlobalPoolingFullyConnectedLayer
+     *
+     * Similar to @ref NEGlobalPoolingFullyConnectedLayer::configure() except the arguments are @ref ITensorInfo * instead of @ref ITensor *
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo             *input,
+                           const ITensorInfo             *weights,
+                           const ITensorInfo             *biases,
+                           const ITensorInfo             *output,
+                           const FullyConnectedLayerInfo &fc_info = FullyConnectedLayerInfo());
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEGLOBALPOOLINGFULLYCONNECTEDLAYER_H
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEINVERTEDRESIDUALLAYER_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEINVERTEDRESIDUALLAYER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/InvertedResidualLayerInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+class ITensorInfo;
+
+/** Function to compute a fused MobileNetV2-style inverted residual block
+ *
+ * The block is executed depth-first: output rows are computed band by band and the expanded
+ * activations only live in a small per-thread working buffer instead of a full intermediate tensor.
+ */
+class NEInvertedResidualLayer : public IFunction
+{
+public:
+    /** Constructor */
+    NEInvertedResidualLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEInvertedResidualLayer(const NEInvertedResidualLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEInvertedResidualLayer(NEInvertedResidualLayer &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEInvertedResidualLayer &operator=(const NEInvertedResidualLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEInvertedResidualLayer &operator=(NEInvertedResidualLayer &&) = delete;
+    /** Destructor */
+    ~NEInvertedResidualLayer();
+    /** Initialize the function's inputs and output.
+     *
+     * Valid data layouts:
+     * - NHWC
+     *
+     * Valid data type configurations:
+     * |src            |weights        |biases         |dst            |
+     * |:--------------|:--------------|:--------------|:--------------|
+     * |F16            |F16            |F16            |F16            |
+     * |F32            |F32            |F32            |F32            |
+     *
+     * This is what this composite function does:
+     *      expanded <- expand_act(conv1x1(input, expand_weights) + expand_bias)
+     *      filtered <- depthwise_act(depthwise(expanded, dw_weights) + dw_bias)
+     *      output   <- project_act(conv1x1(filtered, proj_weights) + proj_bias) [+ input]
+     *
+     * @note Only depth multiplier 1 and no dilation are supported for the depthwise stage.
+     * @note Supported activations are RELU, BOUNDED_RELU, LU_BOUNDED_RELU and IDENTITY.
+     *
+     * @param[in]  input          Source tensor. 3 lower dimensions represent a single input [IFM, width, height],
+     *                            while every optional dimension from 4 and above represent a batch of inputs.
+     *                            Data types supported: F16/F32.
+     * @param[in]  expand_weights Expansion weights tensor with dimensions [IFM, 1, 1, EFM]. Data type supported: Same as @p input.
+     * @param[in]  expand_bias    Expansion bias tensor with dimensions [EFM]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[in]  dw_weights     Depthwise weights tensor with dimensions [EFM, kernel_x, kernel_y]. Data type supported: Same as @p input.
+     * @param[in]  dw_bias        Depthwise bias tensor with dimensions [EFM]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[in]  proj_weights   Projection weights tensor with dimensions [EFM, 1, 1, OFM]. Data type supported: Same as @p input.
+     * @param[in]  proj_bias      Projection bias tensor with dimensions [OFM]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output         Destination tensor. Data type supported: Same as @p input.
+     * @param[in]  info           Inverted residual block information.
+     */
+    void configure(const ITensor                   *input,
+                   const ITensor                   *expand_weights,
+                   const ITensor                   *expand_bias,
+                   const ITensor                   *dw_weights,
+                   const ITensor                   *dw_bias,
+                   const ITensor                   *proj_weights,
+                   const ITensor                   *proj_bias,
+                   ITensor                         *output,
+                   const InvertedResidualLayerInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEInvertedResidualLayer
+     *
+     * Similar to @ref NEInvertedResidualLayer::configure() except the arguments are @ref ITensorInfo * instead of @ref ITensor *
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo               *input,
+                           const ITensorInfo               *expand_weights,
+                           const ITensorInfo               *expand_bias,
+                           const ITensorInfo               *dw_weights,
+                           const ITensorInfo               *dw_bias,
+                           const ITensorInfo               *proj_weights,
+                           const ITensorInfo               *proj_bias,
+                           const ITensorInfo               *output,
+                           const InvertedResidualLayerInfo &info);
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEINVERTEDRESIDUALLAYER_H
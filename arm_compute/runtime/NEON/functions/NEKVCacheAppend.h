@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEKVCACHEAPPEND_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEKVCACHEAPPEND_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+class ITensorInfo;
+class KVCache;
+
+/** Function to append the keys or values of new tokens to a @ref KVCache
+ *
+ * The new sequence positions are written in place after the valid part of the cache, which then grows by the number
+ * of tokens. Unlike re-concatenating the cache with @ref NEConcatenateLayer at every step, the cost of a step does not
+ * depend on the length of the sequence.
+ */
+class NEKVCacheAppend : public IFunction
+{
+public:
+    /** Constructor */
+    NEKVCacheAppend();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEKVCacheAppend(const NEKVCacheAppend &) = delete;
+    /** Default move constructor */
+    NEKVCacheAppend(NEKVCacheAppend &&) = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEKVCacheAppend &operator=(const NEKVCacheAppend &) = delete;
+    /** Default move assignment operator */
+    NEKVCacheAppend &operator=(NEKVCacheAppend &&) = default;
+    /** Destructor */
+    ~NEKVCacheAppend();
+    /** Initialize the function's input and cache.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |src            |cache              |
+     * |:--------------|:------------------|
+     * |F16            |F16                |
+     * |F16            |QSYMM8_PER_CHANNEL |
+     * |F32            |F32                |
+     * |F32            |QSYMM8_PER_CHANNEL |
+     *
+     * When the cache is QSYMM8_PER_CHANNEL, the values of head h are quantized with the scale h of the cache.
+     *
+     * @param[in]     src   Keys or values of the new tokens, with dimensions [head_dim, tokens, num_heads, batches].
+     *                      Data types supported: F16/F32.
+     * @param[in,out] cache Cache to append to. Must outlive the function. Running the function fails if the cache
+     *                      does not have room for the new tokens.
+     */
+    void configure(const ITensor *src, KVCache *cache);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEKVCacheAppend
+     *
+     * @param[in] src   Source tensor info. Data types supported: F16/F32.
+     * @param[in] cache Info of the cache storage (@ref KVCache::tensor).
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *cache);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEKVCACHEAPPEND_H
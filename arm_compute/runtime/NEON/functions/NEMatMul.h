@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2025 Arm Limited.
+ * Copyright (c) 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -109,6 +109,9 @@ public:
      *
      * @param[in]  lhs      Left-hand side tensor info. Data types supported: F16/F32/QASYMM8_SIGNED/QASYMM8.
      * @param[in]  rhs      Right-hand side tensor info. Data types supported: same as @p lhs.
+     *                      Its batch dimensions must be equal to the ones of @p lhs, or divide the innermost non-unit
+     *                      batch dimension of @p lhs, in which case each rhs matrix is shared by a group of consecutive
+     *                      lhs matrices without being replicated (e.g. key/value heads in grouped-query attention).
      * @param[out] dst      Output tensor to store the result of the batched matrix multiplication. Data types supported: same as @p lhs / @p rhs.
      * @param[in]  info     Contains MatMul operation information described in @ref MatMulInfo.
      * @param[in]  settings Contains flags for function level settings i.e fast math
@@ -124,6 +127,7 @@ public:
      *
      * @param[in]  lhs      Left-hand side tensor info. Data types supported: F16/F32/QASYMM8_SIGNED/QASYMM8.
      * @param[in]  rhs      Right-hand side tensor info. Data types supported: same as @p lhs.
+     *                      Its batch dimensions must be equal to or divide the ones of @p lhs, see configure().
      * @param[out] dst      Output tensor info to store the result of the batched matrix multiplication. Data types supported: same as @p lhs / @p rhs.
      * @param[in]  info     Contains MatMul operation information described in @ref MatMulInfo.
      * @param[in]  settings Contains flags for function level settings i.e fast math
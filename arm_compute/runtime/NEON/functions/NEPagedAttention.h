@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEPAGEDATTENTION_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEPAGEDATTENTION_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+class ITensorInfo;
+
+/** Function to compute the decoding attention of a batch of sequences whose keys and values live in a @ref KVBlockPool
+ *
+ * Every sequence attends with one query per head to its own number of positions, read through its block table, so
+ * sequences of different lengths are decoded in a single call without padding them to the longest one.
+ */
+class NEPagedAttention : public IFunction
+{
+public:
+    /** Constructor */
+    NEPagedAttention(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEPagedAttention(const NEPagedAttention &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEPagedAttention(NEPagedAttention &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEPagedAttention &operator=(const NEPagedAttention &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEPagedAttention &operator=(NEPagedAttention &&) = delete;
+    /** Destructor */
+    ~NEPagedAttention();
+    /** Initialize the function's inputs and output.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |q              |k              |v              |block_tables   |seq_lens       |dst            |
+     * |:--------------|:--------------|:--------------|:--------------|:--------------|:--------------|
+     * |F16            |F16            |F16            |S32            |S32            |F16            |
+     * |F32            |F32            |F32            |S32            |S32            |F32            |
+     *
+     * This is what this function does for the head h of the sequence s, of length L = seq_lens(s):
+     *      dst(:, h, s) <- sum_p softmax_p(scale * q(:, h, s) . K(:, p)) * V(:, p), for p in [0, L)
+     *
+     * where K(:, p) = k(:, p % block_size, h / G, block_tables(p / block_size, s)), V likewise, and
+     * G = num_heads / num_kv_heads. Sequences of length 0 produce zeros.
+     *
+     * @param[in]  q            Queries with dimensions [head_dim, num_heads, num_seqs]. Data types supported: F16/F32.
+     * @param[in]  k            Key blocks with dimensions [head_dim, block_size, num_kv_heads, num_blocks], e.g.
+     *                          @ref KVBlockPool::keys. num_heads must be a multiple of num_kv_heads.
+     *                          Data type supported: Same as @p q.
+     * @param[in]  v            Value blocks, e.g. @ref KVBlockPool::values. Shape and data type supported: Same as @p k.
+     * @param[in]  block_tables Blocks of every sequence with dimensions [max_blocks_per_seq, num_seqs], see
+     *                          @ref KVBlockPool::fill_block_tables. Data type supported: S32.
+     * @param[in]  seq_lens     Length of every sequence with dimensions [num_seqs], at most
+     *                          max_blocks_per_seq * block_size, running fails otherwise. Data type supported: S32.
+     * @param[out] dst          Destination tensor. Shape and data type supported: Same as @p q.
+     * @param[in]  scale        Scale applied to the scores before the softmax, usually 1 / sqrt(head_dim).
+     */
+    void configure(const ITensor *q,
+                   const ITensor *k,
+                   const ITensor *v,
+                   const ITensor *block_tables,
+                   const ITensor *seq_lens,
+                   ITensor       *dst,
+                   float          scale);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEPagedAttention
+     *
+     * Similar to @ref NEPagedAttention::configure() except the arguments are @ref ITensorInfo * instead of
+     * @ref ITensor *
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *q,
+                           const ITensorInfo *k,
+                           const ITensorInfo *v,
+                           const ITensorInfo *block_tables,
+                           const ITensorInfo *seq_lens,
+                           const ITensorInfo *dst,
+                           float              scale);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEPAGEDATTENTION_H
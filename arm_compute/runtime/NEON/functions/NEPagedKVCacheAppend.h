@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEPAGEDKVCACHEAPPEND_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEPAGEDKVCACHEAPPEND_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+class ITensorInfo;
+
+/** Function to write the keys or values of new tokens to the blocks of a @ref KVBlockPool
+ *
+ * Tokens of different sequences are written in a single call, every token to the slot returned by
+ * @ref KVBlockPool::append for its position.
+ */
+class NEPagedKVCacheAppend : public IFunction
+{
+public:
+    /** Constructor */
+    NEPagedKVCacheAppend();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEPagedKVCacheAppend(const NEPagedKVCacheAppend &) = delete;
+    /** Default move constructor */
+    NEPagedKVCacheAppend(NEPagedKVCacheAppend &&) = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEPagedKVCacheAppend &operator=(const NEPagedKVCacheAppend &) = delete;
+    /** Default move assignment operator */
+    NEPagedKVCacheAppend &operator=(NEPagedKVCacheAppend &&) = default;
+    /** Destructor */
+    ~NEPagedKVCacheAppend();
+    /** Initialize the function's inputs and output.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |src            |slots          |pool           |
+     * |:--------------|:--------------|:--------------|
+     * |F16            |S32            |F16            |
+     * |F32            |S32            |F32            |
+     *
+     * @param[in]     src   Keys or values of the new tokens with dimensions [head_dim, num_heads, tokens].
+     *                      Data types supported: F16/F32.
+     * @param[in]     slots Slot of every token with dimensions [tokens]. Tokens with a negative slot are skipped.
+     *                      Data type supported: S32.
+     * @param[in,out] pool  Blocks with dimensions [head_dim, block_size, num_heads, num_blocks], e.g.
+     *                      @ref KVBlockPool::keys. Data type supported: Same as @p src.
+     */
+    void configure(const ITensor *src, const ITensor *slots, ITensor *pool);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEPagedKVCacheAppend
+     *
+     * Similar to @ref NEPagedKVCacheAppend::configure() except the arguments are @ref ITensorInfo * instead of
+     * @ref ITensor *
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *slots, const ITensorInfo *pool);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEPAGEDKVCACHEAPPEND_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -66,7 +66,7 @@ public:
      * |:------|:------|
      * |All    |All    |
      *
-     * @note Arbitrary permutation vectors are supported with rank not greater than 4
+     * @note Arbitrary permutation vectors are supported with rank not greater than 6
      *
      * @param[in]  input  The input tensor to permute. Data types supported: All
      * @param[out] output The output tensor. Data types supported: Same as @p input
@@ -75,7 +75,7 @@ public:
     void configure(const ITensor *input, ITensor *output, const PermutationVector &perm);
     /** Static function to check if given info will lead to a valid configuration of @ref NEPermute
      *
-     * @note Arbitrary permutation vectors are supported with rank not greater than 4
+     * @note Arbitrary permutation vectors are supported with rank not greater than 6
      *
      * @param[in] input  The input tensor to permute. Data types supported: All
      * @param[in] output The output tensor. Data types supported: Same as @p input
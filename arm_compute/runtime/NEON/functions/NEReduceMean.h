@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2018-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,14 +30,19 @@
 
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
-#include "arm_compute/runtime/MemoryGroup.h"
-#include "arm_compute/runtime/NEON/functions/NEReductionOperation.h"
-#include "arm_compute/runtime/NEON/functions/NEReshapeLayer.h"
-#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <memory>
 
 namespace arm_compute
 {
-/** Basic function to perform reduce operation */
+class ITensor;
+
+/** Basic function to perform reduce operation
+ *
+ * All the axes are reduced in a single pass over the source by cpu::kernels::CpuMultiAxisReductionKernel, and the
+ * result is written directly with or without the reduced dimensions.
+ */
 class NEReduceMean : public IFunction
 {
 public:
@@ -91,12 +96,8 @@ public:
     void run() override;
 
 private:
-    MemoryGroup                       _memory_group;
-    std::vector<NEReductionOperation> _reduction_kernels;
-    std::vector<Tensor>               _reduced_outs;
-    NEReshapeLayer                    _reshape;
-    int                               _reduction_ops;
-    bool                              _keep_dims;
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEREDUCEMEAN_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,8 +41,9 @@ class NEReductionOperationKernel;
 
 /** Basic function to simulate a reduction operation. This function calls the following kernels:
  *
- * -# @ref NEReshapeLayer
- * -# NEReductionOperationKernel
+ * -# cpu::kernels::CpuMultiAxisReductionKernel for SUM, MEAN_SUM, PROD, MAX and MIN on tensors of up to 4 dimensions
+ *    (PROD on floating-point types only)
+ * -# NEReductionOperationKernel and @ref NEReshapeLayer otherwise
  *
  */
 class NEReductionOperation : public IFunction
@@ -53,11 +54,11 @@ public:
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     NEReductionOperation(const NEReductionOperation &) = delete;
     /** Default move constructor */
-    NEReductionOperation(NEReductionOperation &&) = default;
+    NEReductionOperation(NEReductionOperation &&);
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     NEReductionOperation &operator=(const NEReductionOperation &) = delete;
     /** Default move assignment operator */
-    NEReductionOperation &operator=(NEReductionOperation &&) = default;
+    NEReductionOperation &operator=(NEReductionOperation &&);
     /** Default destructor */
     ~NEReductionOperation();
     /** Set the input and output tensors.
@@ -102,6 +103,8 @@ public:
     void run() override;
 
 private:
+    struct Impl;
+    std::unique_ptr<Impl>                       _impl;
     MemoryGroup                                 _memory_group;
     std::unique_ptr<NEReductionOperationKernel> _reduction_kernel;
     NEReshapeLayer                              _reshape;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -64,6 +64,9 @@ public:
      * |:------|:------|
      * |All    |All    |
      *
+     * @note If @p input and @p output have no padding and share their memory, e.g. @p output is a @ref TensorAlias of
+     *       @p input, no data is copied.
+     *
      * @param[in]  input  Input tensor. Data type supported: All
      * @param[out] output Output tensor. Data type supported: Same as @p input
      */
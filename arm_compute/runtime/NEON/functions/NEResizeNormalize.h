@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NERESIZENORMALIZE_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NERESIZENORMALIZE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/ResizeNormalizeInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+class ITensorInfo;
+
+/** Function to prepare a batch of interleaved U8 images as network input
+ *
+ * Resizing, channel reordering, mean/scale normalization and the conversion to the network data type are done in a
+ * single pass over the output rows, replacing a chain of @ref NEScale, @ref NECast and pixel-wise arithmetic.
+ */
+class NEResizeNormalize : public IFunction
+{
+public:
+    /** Constructor */
+    NEResizeNormalize(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEResizeNormalize(const NEResizeNormalize &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEResizeNormalize(NEResizeNormalize &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEResizeNormalize &operator=(const NEResizeNormalize &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEResizeNormalize &operator=(NEResizeNormalize &&) = delete;
+    /** Destructor */
+    ~NEResizeNormalize();
+    /** Initialize the function's input and output.
+     *
+     * Valid data layouts:
+     * - NHWC
+     *
+     * Valid data type configurations:
+     * |src            |dst            |
+     * |:--------------|:--------------|
+     * |U8             |F16            |
+     * |U8             |F32            |
+     * |U8             |QASYMM8        |
+     *
+     * This is what this function does for every output channel c:
+     *      output[c] <- (resize(input)[swap_channels ? 2 - c : c] - mean[c]) * scale[c]
+     *
+     * @note The output shape defines the resized width and height and must be initialized.
+     * @note Supported interpolation policies are NEAREST_NEIGHBOR, BILINEAR and AREA. Borders are replicated.
+     *
+     * @param[in]  input  Source tensor with dimensions [3, width, height, batches]. Data type supported: U8.
+     * @param[out] output Destination tensor with dimensions [3, resized width, resized height, batches].
+     *                    Data types supported: F16/F32/QASYMM8.
+     * @param[in]  info   Resize and normalization information.
+     */
+    void configure(const ITensor *input, ITensor *output, const ResizeNormalizeInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEResizeNormalize
+     *
+     * Similar to @ref NEResizeNormalize::configure() except the arguments are @ref ITensorInfo * instead of @ref ITensor *
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const ResizeNormalizeInfo &info);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NERESIZENORMALIZE_H
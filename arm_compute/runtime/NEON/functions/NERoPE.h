@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEROPE_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEROPE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/RoPEInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+class ITensorInfo;
+class KVCache;
+
+/** Function to apply a rotary position embedding (RoPE) to queries and keys
+ *
+ * Queries and keys are rotated in a single pass, with the sines and cosines of a token computed once for all the
+ * heads, instead of slicing, multiplying, negating and concatenating both tensors. The rotated keys can be written
+ * straight into a @ref KVCache.
+ */
+class NERoPE : public IFunction
+{
+public:
+    /** Constructor */
+    NERoPE(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NERoPE(const NERoPE &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NERoPE(NERoPE &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NERoPE &operator=(const NERoPE &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NERoPE &operator=(NERoPE &&) = delete;
+    /** Destructor */
+    ~NERoPE();
+    /** Initialize the function's inputs and outputs.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |q              |k              |positions      |q_dst          |k_dst          |
+     * |:--------------|:--------------|:--------------|:--------------|:--------------|
+     * |F16            |F16            |S32            |F16            |F16            |
+     * |F32            |F32            |S32            |F32            |F32            |
+     *
+     * The token t is at position p = info.position_offset + positions(t), or info.position_offset + t without
+     * positions. With the channel pairs (x0, x1) selected by info.mode and the angle a_i = p * theta_base^(-2i / d):
+     *      (x0, x1) <- (x0 * cos(a_i) - x1 * sin(a_i), x1 * cos(a_i) + x0 * sin(a_i)), for i in [0, d / 2)
+     * where d is info.rotary_dim. The channels past d are copied.
+     *
+     * @param[in]  q         Queries with dimensions [head_dim, tokens, num_heads, batches].
+     *                       Data types supported: F16/F32.
+     * @param[in]  k         Keys with dimensions [head_dim, tokens, num_kv_heads, batches].
+     *                       Data type supported: Same as @p q.
+     * @param[in]  positions (Optional) Positions of the tokens with dimensions [tokens]. Can be nullptr.
+     *                       Data type supported: S32.
+     * @param[out] q_dst     Rotated queries. Can be @p q for an in-place computation.
+     *                       Shape and data type supported: Same as @p q.
+     * @param[out] k_dst     Rotated keys. Can be @p k for an in-place computation.
+     *                       Shape and data type supported: Same as @p k.
+     * @param[in]  info      Rotary position embedding information.
+     */
+    void configure(const ITensor  *q,
+                   const ITensor  *k,
+                   const ITensor  *positions,
+                   ITensor        *q_dst,
+                   ITensor        *k_dst,
+                   const RoPEInfo &info);
+    /** Initialize the function to append the rotated keys to a key cache.
+     *
+     * Every run writes the rotated keys in place after the valid part of @p k_cache and grows it by the number of
+     * tokens. The token t is at position info.position_offset + length + t, where length is the cache length when
+     * the function runs.
+     *
+     * @param[in]     q       Queries with dimensions [head_dim, tokens, num_heads, batches].
+     *                        Data types supported: F16/F32.
+     * @param[in]     k       Keys with dimensions [head_dim, tokens, num_kv_heads, batches].
+     *                        Data type supported: Same as @p q.
+     * @param[out]    q_dst   Rotated queries. Can be @p q. Shape and data type supported: Same as @p q.
+     * @param[in,out] k_cache Key cache to append to. Must outlive the function. Running the function fails if the
+     *                        cache does not have room for the new tokens. Data type supported: Same as @p q.
+     * @param[in]     info    Rotary position embedding information.
+     */
+    void configure(const ITensor *q, const ITensor *k, ITensor *q_dst, KVCache *k_cache, const RoPEInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NERoPE
+     *
+     * Similar to @ref NERoPE::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *q,
+                           const ITensorInfo *k,
+                           const ITensorInfo *positions,
+                           const ITensorInfo *q_dst,
+                           const ITensorInfo *k_dst,
+                           const RoPEInfo    &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NERoPE appending to a cache
+     *
+     * @param[in] q       Queries tensor info. Data types supported: F16/F32.
+     * @param[in] k       Keys tensor info. Data type supported: Same as @p q.
+     * @param[in] q_dst   Rotated queries tensor info. Data type supported: Same as @p q.
+     * @param[in] k_cache Info of the key cache storage (@ref KVCache::tensor).
+     * @param[in] info    Rotary position embedding information.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *q,
+                           const ITensorInfo *k,
+                           const ITensorInfo *q_dst,
+                           const ITensorInfo *k_cache,
+                           const RoPEInfo    &info);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEROPE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2021, 2025 Arm Limited.
+ * Copyright (c) 2019, 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -52,14 +52,21 @@ public:
     RuntimeContext &operator=(RuntimeContext &&) = default;
     /** CPU Scheduler setter */
     void set_scheduler(IScheduler *scheduler);
+    /** Workspace arena setter
+     *
+     * @param[in] arena Workspace arena to use, nullptr to allocate the workspace on every run.
+     */
+    void set_workspace_arena(WorkspaceArena *arena);
 
     // Inherited overridden methods
-    IScheduler    *scheduler() override;
-    IAssetManager *asset_manager() override;
+    IScheduler     *scheduler() override;
+    IAssetManager  *asset_manager() override;
+    WorkspaceArena *workspace_arena() override;
 
 private:
     std::unique_ptr<IScheduler> _owned_scheduler{nullptr};
     IScheduler                 *_scheduler{nullptr};
+    WorkspaceArena             *_workspace_arena{nullptr};
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_RUNTIMECONTEXT_H
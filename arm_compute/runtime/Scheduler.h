@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019, 2023-2025 Arm Limited.
+ * Copyright (c) 2017-2019, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,7 @@
  * @publicapi
  */
 
+#include "arm_compute/runtime/IRuntimeContext.h"
 #include "arm_compute/runtime/IScheduler.h"
 
 #include <map>
@@ -76,6 +77,22 @@ public:
      * @return true if the given scheduler type is supported. False otherwise.
      */
     static bool is_available(Type t);
+    /** Binds a scheduler to the calling thread.
+     *
+     * While a scheduler is bound, @ref Scheduler::get() called from this thread returns it instead of the
+     * process-wide scheduler. This allows independent workloads running on different application threads
+     * to use disjoint thread pools (see @ref SchedulerPartitions).
+     *
+     * @note The scheduler is not owned and must outlive the binding.
+     *
+     * @param[in] scheduler Scheduler to bind to the calling thread. Pass nullptr to remove the binding.
+     */
+    static void set_thread_scheduler(IScheduler *scheduler);
+    /** Returns the scheduler bound to the calling thread.
+     *
+     * @return The scheduler bound to the calling thread if any, else nullptr.
+     */
+    static IScheduler *get_thread_scheduler();
 
 private:
     static Type _scheduler_type;
@@ -85,8 +102,39 @@ private:
     static std::shared_ptr<IScheduler> thread_local _custom_scheduler;
 #endif // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
     static std::map<Type, std::unique_ptr<IScheduler>> _schedulers;
+    static thread_local IScheduler                    *_thread_scheduler;
 
     Scheduler();
 };
+
+/** RAII helper that binds a scheduler to the calling thread for the lifetime of the object.
+ *
+ * The previous binding of the thread is restored on destruction, so scopes can be nested.
+ * A null scheduler (or a context without scheduler) leaves the current binding untouched.
+ */
+class SchedulerScope final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] scheduler Scheduler to bind to the calling thread. Can be nullptr.
+     */
+    explicit SchedulerScope(IScheduler *scheduler);
+    /** Constructor
+     *
+     * @param[in] ctx Runtime context whose scheduler is bound to the calling thread. Can be nullptr.
+     */
+    explicit SchedulerScope(IRuntimeContext *ctx);
+    /** Restores the previous binding */
+    ~SchedulerScope();
+    /** Prevent instances of this class from being copied */
+    SchedulerScope(const SchedulerScope &) = delete;
+    /** Prevent instances of this class from being copied */
+    SchedulerScope &operator=(const SchedulerScope &) = delete;
+
+private:
+    IScheduler *_previous;
+    bool        _active;
+};
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_SCHEDULER_H
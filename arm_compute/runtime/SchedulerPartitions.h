@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_SCHEDULERPARTITIONS_H
+#define ACL_ARM_COMPUTE_RUNTIME_SCHEDULERPARTITIONS_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/runtime/IScheduler.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+/** Set of independent schedulers, each one owning a thread pool bound to a disjoint set of logical cores.
+ *
+ * Partitions allow several models to run concurrently in the same process without serializing on the
+ * process-wide scheduler or oversubscribing the cores. A partition can be selected:
+ *  - per application thread, through @ref SchedulerPartitions::bind_current_thread or @ref SchedulerScope
+ *  - per runtime context, through @ref RuntimeContext::set_scheduler
+ *
+ * @note Thread pinning is only available when the library is built with the C++11 threads scheduler.
+ *       With other schedulers every partition only gets the number of threads of its core set.
+ */
+class SchedulerPartitions final
+{
+public:
+    /** Logical core ids of a partition. The first core is the one the calling thread is expected to run on */
+    using CoreSet = std::vector<int>;
+
+    /** Constructor
+     *
+     * @param[in] core_sets Disjoint sets of logical cores, one per partition. Each set must not be empty.
+     */
+    explicit SchedulerPartitions(const std::vector<CoreSet> &core_sets);
+    /** Constructor
+     *
+     * Splits the available cores into contiguous blocks of (almost) equal size.
+     *
+     * @param[in] num_partitions Number of partitions to create.
+     * @param[in] num_cores      (Optional) Number of logical cores to distribute. If 0, all the cores of the system are used.
+     */
+    explicit SchedulerPartitions(unsigned int num_partitions, unsigned int num_cores = 0);
+    /** Destructor */
+    ~SchedulerPartitions();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    SchedulerPartitions(const SchedulerPartitions &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    SchedulerPartitions &operator=(const SchedulerPartitions &) = delete;
+    /** Default move constructor */
+    SchedulerPartitions(SchedulerPartitions &&) = default;
+    /** Default move assignment operator */
+    SchedulerPartitions &operator=(SchedulerPartitions &&) = default;
+
+    /** Split a number of logical cores into contiguous blocks
+     *
+     * @param[in] num_partitions Number of blocks to create.
+     * @param[in] num_cores      Number of logical cores to distribute. Must be greater or equal than @p num_partitions.
+     *
+     * @return The core set of each block
+     */
+    static std::vector<CoreSet> split_cores(unsigned int num_partitions, unsigned int num_cores);
+    /** Number of partitions
+     *
+     * @return The number of partitions
+     */
+    size_t num_partitions() const;
+    /** Scheduler accessor
+     *
+     * @param[in] idx Partition index.
+     *
+     * @return The scheduler of the given partition
+     */
+    IScheduler &scheduler(size_t idx);
+    /** Core set accessor
+     *
+     * @param[in] idx Partition index.
+     *
+     * @return The logical cores of the given partition
+     */
+    const CoreSet &cores(size_t idx) const;
+    /** Bind a partition to the calling thread
+     *
+     * After this call @ref Scheduler::get() returns the partition's scheduler on the calling thread.
+     * As the calling thread runs the first workload of each kernel it can also be pinned to the first
+     * core of the partition.
+     *
+     * @param[in] idx Partition index.
+     * @param[in] pin (Optional) Pin the calling thread to the first core of the partition. Defaults to true.
+     */
+    void bind_current_thread(size_t idx, bool pin = true);
+
+private:
+    std::vector<CoreSet>                     _core_sets;
+    std::vector<std::unique_ptr<IScheduler>> _schedulers;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_SCHEDULERPARTITIONS_H
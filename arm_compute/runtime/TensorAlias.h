@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_TENSORALIAS_H
+#define ACL_ARM_COMPUTE_RUNTIME_TENSORALIAS_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+
+#include <cstdint>
+
+namespace arm_compute
+{
+/** Tensor that views the memory of a contiguous parent tensor with a different shape
+ *
+ * The alias owns no memory: it describes the parent's elements, in the same order, with a packed layout of the
+ * requested shape. This makes a reshape, flatten or squeeze of an unpadded tensor free.
+ *
+ * @note The parent must not have any padding for as long as the alias is in use.
+ */
+class TensorAlias : public ITensor
+{
+public:
+    /** Default Constructor */
+    TensorAlias();
+    /** Constructor
+     *
+     * @param[in] parent       Parent tensor. Must not have any padding.
+     * @param[in] tensor_shape Shape of the alias. Must have the same number of elements as @p parent.
+     */
+    TensorAlias(ITensor *parent, const TensorShape &tensor_shape);
+    /** Destructor */
+    ~TensorAlias() = default;
+    /** Restrict instances of this class to be copy constructed */
+    TensorAlias(const TensorAlias &) = delete;
+    /** Restrict instances of this class to be copied */
+    TensorAlias &operator=(const TensorAlias &) = delete;
+    /** Allow instances of this class to be move constructed */
+    TensorAlias(TensorAlias &&) = default;
+    /** Allow instances of this class to be moved */
+    TensorAlias &operator=(TensorAlias &&) = default;
+    /** Return the parent tensor of the alias
+     *
+     * @return Parent tensor
+     */
+    ITensor *parent();
+
+    // Inherited methods overridden:
+    ITensorInfo *info() const override;
+    ITensorInfo *info() override;
+    uint8_t     *buffer() const override;
+
+private:
+    ITensor           *_parent;
+    mutable TensorInfo _info;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_TENSORALIAS_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2019, 2024-2025 Arm Limited.
+ * Copyright (c) 2016-2019, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -40,6 +40,7 @@ namespace arm_compute
 {
 // Forward declaration
 class Coordinates;
+class IAllocator;
 class TensorInfo;
 
 /** Basic implementation of a CPU memory tensor allocator. */
@@ -116,6 +117,14 @@ public:
      * @param[in] associated_memory_group Memory group to associate the tensor with
      */
     void set_associated_memory_group(IMemoryGroup *associated_memory_group);
+    /** Sets the allocator used to create the backing memory of the tensor when it is not memory managed
+     *
+     * @note The tensor must not already be allocated when calling this function.
+     *
+     * @param[in] allocator Allocator to use, or nullptr to use the default heap allocation.
+     *                      The allocator must outlive any allocation of the tensor.
+     */
+    void set_backing_allocator(IAllocator *allocator);
 
 protected:
     /** No-op for CPU memory
@@ -130,6 +139,7 @@ protected:
 private:
     IMemoryManageable *_owner;                   /**< Memory manageable object that owns the allocator */
     IMemoryGroup      *_associated_memory_group; /**< Registered memory manager */
+    IAllocator        *_backing_allocator;       /**< Allocator of the backing memory, nullptr for the default */
     Memory             _memory;                  /**< CPU memory */
 };
 } // namespace arm_compute
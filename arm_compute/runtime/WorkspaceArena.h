@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_WORKSPACEARENA_H
+#define ACL_ARM_COMPUTE_RUNTIME_WORKSPACEARENA_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/runtime/IMemoryRegion.h"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class IAllocator;
+class IRuntimeContext;
+
+/** Thread-safe bump allocator serving the auxiliary workspace of the CPU operators
+ *
+ * When an operator is run without its workspace tensors in the tensor pack, the auxiliary tensors it needs are
+ * carved out of the arena bound to the calling thread (see @ref WorkspaceArenaScope) instead of being allocated and
+ * freed on every run.
+ *
+ * Allocations are bumped out of a single block. Requests that do not fit are served by overflow blocks, which are
+ * merged into a larger block the next time the arena becomes empty, so after the first run the arena settles to one
+ * block reused by all the following runs.
+ */
+class WorkspaceArena final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] allocator (Optional) Allocator of the backing memory. If nullptr the default heap allocator is used.
+     *                      It must outlive the arena.
+     */
+    explicit WorkspaceArena(IAllocator *allocator = nullptr);
+    /** Destructor */
+    ~WorkspaceArena();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    WorkspaceArena(const WorkspaceArena &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    WorkspaceArena &operator=(const WorkspaceArena &) = delete;
+
+    /** Grow the arena to at least a given capacity
+     *
+     * @note The arena is only resized if it is currently empty, otherwise the request is deferred to the moment
+     *       it becomes empty.
+     *
+     * @param[in] size Capacity in bytes.
+     */
+    void reserve(size_t size);
+    /** Grow the arena to fit the temporary and auxiliary workspace of an operator
+     *
+     * @param[in] requirements Memory requirements returned by the workspace() method of an operator.
+     */
+    void reserve(const experimental::MemoryRequirements &requirements);
+    /** Carve a buffer out of the arena
+     *
+     * @param[in] size      Size in bytes. Must be greater than zero.
+     * @param[in] alignment Alignment in bytes of the buffer. Must be a power of two.
+     *
+     * @return A pointer to the buffer, valid until @ref release is called on it
+     */
+    void *allocate(size_t size, size_t alignment);
+    /** Give a buffer returned by @ref allocate back to the arena
+     *
+     * The memory is recycled once every buffer of the arena has been released.
+     *
+     * @param[in] ptr Buffer to release.
+     */
+    void release(void *ptr);
+    /** Bytes of the main block of the arena
+     *
+     * @return The capacity in bytes
+     */
+    size_t capacity() const;
+    /** Bytes currently carved out of the arena, including alignment padding
+     *
+     * @return The usage in bytes
+     */
+    size_t usage() const;
+    /** Largest usage reached since construction or the last call to @ref reset_peak_usage
+     *
+     * Reserving this amount up front guarantees that the same workloads never need overflow blocks.
+     *
+     * @return The peak usage in bytes
+     */
+    size_t peak_usage() const;
+    /** Reset the peak usage to the current usage */
+    void reset_peak_usage();
+
+    /** Arena bound to the calling thread
+     *
+     * @return The arena, or nullptr if none is bound
+     */
+    static WorkspaceArena *get_thread_arena();
+    /** Bind an arena to the calling thread
+     *
+     * @param[in] arena Arena to bind. Pass nullptr to unbind.
+     */
+    static void set_thread_arena(WorkspaceArena *arena);
+
+private:
+    /** Replace the main block by a block of at least @p size bytes if the arena is empty */
+    void try_grow(size_t size);
+
+    IAllocator                                 *_allocator;
+    std::unique_ptr<IAllocator>                 _default_allocator;
+    std::unique_ptr<IMemoryRegion>              _block;     /**< Main block */
+    std::vector<std::unique_ptr<IMemoryRegion>> _overflow;  /**< Blocks of the requests not fitting in _block */
+    size_t                                      _offset;    /**< Bump offset in the main block */
+    size_t                                      _usage;     /**< Bytes carved out since the arena was empty */
+    size_t                                      _peak;      /**< Peak usage */
+    size_t                                      _requested; /**< Capacity requested by reserve() */
+    size_t                                      _live;      /**< Number of buffers not released yet */
+    mutable std::mutex                          _mtx;
+
+    static thread_local WorkspaceArena *_thread_arena;
+};
+
+/** RAII helper that binds a workspace arena to the calling thread for the lifetime of the object.
+ *
+ * The previous binding of the thread is restored on destruction, so scopes can be nested.
+ * A null arena (or a context without arena) leaves the current binding untouched.
+ */
+class WorkspaceArenaScope final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] arena Arena to bind to the calling thread. Can be nullptr.
+     */
+    explicit WorkspaceArenaScope(WorkspaceArena *arena);
+    /** Constructor
+     *
+     * @param[in] ctx Runtime context whose workspace arena is bound to the calling thread. Can be nullptr.
+     */
+    explicit WorkspaceArenaScope(IRuntimeContext *ctx);
+    /** Restores the previous binding */
+    ~WorkspaceArenaScope();
+    /** Prevent instances of this class from being copied */
+    WorkspaceArenaScope(const WorkspaceArenaScope &) = delete;
+    /** Prevent instances of this class from being copied */
+    WorkspaceArenaScope &operator=(const WorkspaceArenaScope &) = delete;
+
+private:
+    WorkspaceArena *_previous;
+    bool            _active;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_WORKSPACEARENA_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022, 2024 Arm Limited.
+ * Copyright (c) 2019-2022, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -152,11 +152,11 @@ void NEROIAlignLayerKernel::configure(const ITensor             *input,
                        input->info()->quantization_info());
     output->info()->set_data_layout(input->info()->data_layout());
 
-    // Configure kernel window
+    // Configure kernel window: the ROIs are along the Y dimension, which is the one the function splits across threads
     const unsigned int num_rois = rois->info()->dimension(1);
     Window             window;
-    window.set(Window::DimX, Window::Dimension(0, num_rois));
-    window.set(Window::DimY, Window::Dimension(0, 1));
+    window.set(Window::DimX, Window::Dimension(0, 1));
+    window.set(Window::DimY, Window::Dimension(0, num_rois));
 
     // Set instance variables
     _input     = input;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -56,6 +56,9 @@
 #include "kernels/a64_fp16_nhwc_3x3_s1_output2x2_mla_depthfirst.hpp"
 #include "kernels/a64_fp16_nhwc_3x3_s2_output2x2_mla_depthfirst.hpp"
 #include "kernels/a64_fp16_nhwc_5x5_s1_output2x2_mla_depthfirst.hpp"
+#include "kernels/a64_fp16_nhwc_7x7_s1_output2x2_mla_depthfirst.hpp"
+#include "kernels/a64_fp16_nhwc_7x7_s2_output2x2_mla_depthfirst.hpp"
+#include "kernels/a64_fp16_nhwc_9x9_s1_output2x2_mla_depthfirst.hpp"
 #include "kernels/a64_fp16_nhwc_generic_output9_mla_depthfirst.hpp"
 #include "kernels/a64_fp16_packed_to_nhwc_generic_with_multiplier_output2x8_mla_depthfirst.hpp"
 #endif  // defined(ENABLE_FP16_KERNELS) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
@@ -314,6 +317,39 @@ static const DepthwiseImplementation<__fp16, __fp16> depthwise_fp16_methods[] =
       return new DepthwiseDepthfirst<__fp16>(strat, args);
     },
   },
+  {
+    DepthwiseMethod::DEPTHFIRST,
+    "a64_fp16_nhwc_7x7_s1_output2x2_mla_depthfirst",
+    constraint(is_supported<a64_fp16_nhwc_7x7_s1_output2x2_mla_depthfirst>,
+               cpu_has_fp16),
+    cycle_estimate<a64_fp16_nhwc_7x7_s1_output2x2_mla_depthfirst>,
+    [] (const DepthwiseArgs &args, const Nothing &) -> DepthwiseCommon<__fp16, __fp16, __fp16> * {
+      auto strat = new a64_fp16_nhwc_7x7_s1_output2x2_mla_depthfirst(args.cpu_info);
+      return new DepthwiseDepthfirst<__fp16>(strat, args);
+    },
+  },
+  {
+    DepthwiseMethod::DEPTHFIRST,
+    "a64_fp16_nhwc_7x7_s2_output2x2_mla_depthfirst",
+    constraint(is_supported<a64_fp16_nhwc_7x7_s2_output2x2_mla_depthfirst>,
+               cpu_has_fp16),
+    cycle_estimate<a64_fp16_nhwc_7x7_s2_output2x2_mla_depthfirst>,
+    [] (const DepthwiseArgs &args, const Nothing &) -> DepthwiseCommon<__fp16, __fp16, __fp16> * {
+      auto strat = new a64_fp16_nhwc_7x7_s2_output2x2_mla_depthfirst(args.cpu_info);
+      return new DepthwiseDepthfirst<__fp16>(strat, args);
+    },
+  },
+  {
+    DepthwiseMethod::DEPTHFIRST,
+    "a64_fp16_nhwc_9x9_s1_output2x2_mla_depthfirst",
+    constraint(is_supported<a64_fp16_nhwc_9x9_s1_output2x2_mla_depthfirst>,
+               cpu_has_fp16),
+    cycle_estimate<a64_fp16_nhwc_9x9_s1_output2x2_mla_depthfirst>,
+    [] (const DepthwiseArgs &args, const Nothing &) -> DepthwiseCommon<__fp16, __fp16, __fp16> * {
+      auto strat = new a64_fp16_nhwc_9x9_s1_output2x2_mla_depthfirst(args.cpu_info);
+      return new DepthwiseDepthfirst<__fp16>(strat, args);
+    },
+  },
   {
     DepthwiseMethod::DEPTHFIRST,
     "a64_fp16_nhwc_generic_output3x3_mla_depthfirst",
@@ -0,0 +1,417 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Intrinsic implementations of fixed-size NHWC depthfirst tiles.
+ *
+ * These back the large-kernel strategies (7x7 and 9x9) for which there are
+ * no hand-scheduled assembly kernels. A tile computes OutputRows x OutputCols
+ * output points from the (OutputRows - 1) * StrideRows + KernelRows by
+ * (OutputCols - 1) * StrideCols + KernelCols input points provided in
+ * row-major order. One kernel row of weights and one input row are held in
+ * registers at a time so the accumulators stay resident for the whole tile.
+ */
+
+#pragma once
+
+#if defined(__aarch64__)
+
+#include "arm_gemm.hpp"
+
+#include <arm_neon.h>
+#include <cstdint>
+#include <cstring>
+
+namespace arm_conv {
+namespace depthwise {
+namespace a64_nhwc_mla_depthfirst_tile {
+
+template <typename T>
+struct FloatVector;
+
+template <>
+struct FloatVector<float>
+{
+  using type = float32x4_t;
+  constexpr static unsigned int lanes = 4;
+
+  static inline type load(const float *ptr) { return vld1q_f32(ptr); }
+  static inline void store(float *ptr, type v) { vst1q_f32(ptr, v); }
+  static inline type dup(float v) { return vdupq_n_f32(v); }
+  static inline type mla(type acc, type a, type b) { return vfmaq_f32(acc, a, b); }
+  static inline type clamp(type v, type vmin, type vmax) { return vminq_f32(vmaxq_f32(v, vmin), vmax); }
+};
+
+#if defined(__ARM_FP16_ARGS) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+template <>
+struct FloatVector<__fp16>
+{
+  using type = float16x8_t;
+  constexpr static unsigned int lanes = 8;
+
+  static inline type load(const __fp16 *ptr) { return vld1q_f16(ptr); }
+  static inline void store(__fp16 *ptr, type v) { vst1q_f16(ptr, v); }
+  static inline type dup(__fp16 v) { return vdupq_n_f16(v); }
+  static inline type mla(type acc, type a, type b) { return vfmaq_f16(acc, a, b); }
+  static inline type clamp(type v, type vmin, type vmax) { return vminq_f16(vmaxq_f16(v, vmin), vmax); }
+};
+#endif  // defined(__ARM_FP16_ARGS) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+
+template <unsigned int KernelRows, unsigned int KernelCols,
+          unsigned int StrideRows, unsigned int StrideCols,
+          unsigned int OutputRows, unsigned int OutputCols>
+struct TileShape
+{
+  constexpr static unsigned int input_rows = (OutputRows - 1) * StrideRows + KernelRows;
+  constexpr static unsigned int input_cols = (OutputCols - 1) * StrideCols + KernelCols;
+  constexpr static unsigned int input_points = input_rows * input_cols;
+  constexpr static unsigned int output_points = OutputRows * OutputCols;
+};
+
+/* Compute one vector of channels of a floating point tile.
+ *
+ * `params` points at the packed bias followed by one vector of weights per
+ * kernel point, and is advanced past them.
+ */
+template <typename T, unsigned int KernelRows, unsigned int KernelCols,
+          unsigned int StrideRows, unsigned int StrideCols,
+          unsigned int OutputRows, unsigned int OutputCols>
+inline void float_tile_vector(
+  const T *const *inptrs, T *const *outptrs, unsigned int channel,
+  const T *&params, typename FloatVector<T>::type vmin, typename FloatVector<T>::type vmax
+)
+{
+  using V = FloatVector<T>;
+  using Shape = TileShape<KernelRows, KernelCols, StrideRows, StrideCols, OutputRows, OutputCols>;
+
+  typename V::type acc[OutputRows][OutputCols];
+  const auto bias = V::load(params);
+  params += V::lanes;
+  for (unsigned int oy = 0; oy < OutputRows; oy++)
+  {
+    for (unsigned int ox = 0; ox < OutputCols; ox++)
+    {
+      acc[oy][ox] = bias;
+    }
+  }
+
+  for (unsigned int ky = 0; ky < KernelRows; ky++)
+  {
+    typename V::type weights[KernelCols];
+    for (unsigned int kx = 0; kx < KernelCols; kx++)
+    {
+      weights[kx] = V::load(params + kx * V::lanes);
+    }
+    params += KernelCols * V::lanes;
+
+    for (unsigned int oy = 0; oy < OutputRows; oy++)
+    {
+      const T *const *row = inptrs + (oy * StrideRows + ky) * Shape::input_cols;
+
+      typename V::type inputs[Shape::input_cols];
+      for (unsigned int ix = 0; ix < Shape::input_cols; ix++)
+      {
+        inputs[ix] = V::load(row[ix] + channel);
+      }
+
+      for (unsigned int ox = 0; ox < OutputCols; ox++)
+      {
+        for (unsigned int kx = 0; kx < KernelCols; kx++)
+        {
+          acc[oy][ox] = V::mla(acc[oy][ox], inputs[ox * StrideCols + kx], weights[kx]);
+        }
+      }
+    }
+  }
+
+  for (unsigned int oy = 0; oy < OutputRows; oy++)
+  {
+    for (unsigned int ox = 0; ox < OutputCols; ox++)
+    {
+      V::store(outptrs[oy * OutputCols + ox] + channel, V::clamp(acc[oy][ox], vmin, vmax));
+    }
+  }
+}
+
+template <typename T, unsigned int KernelRows, unsigned int KernelCols,
+          unsigned int StrideRows, unsigned int StrideCols,
+          unsigned int OutputRows, unsigned int OutputCols>
+void float_indirect(
+  const T *const *const input_ptrs, T *const *const outptrs, const void *params_raw,
+  unsigned int n_channels, const T activation_min, const T activation_max
+)
+{
+  using V = FloatVector<T>;
+  using Shape = TileShape<KernelRows, KernelCols, StrideRows, StrideCols, OutputRows, OutputCols>;
+
+  const auto vmin = V::dup(activation_min);
+  const auto vmax = V::dup(activation_max);
+  auto params = static_cast<const T *>(params_raw);
+
+  unsigned int channel = 0;
+  for (; channel + V::lanes <= n_channels; channel += V::lanes)
+  {
+    float_tile_vector<T, KernelRows, KernelCols, StrideRows, StrideCols, OutputRows, OutputCols>(
+      input_ptrs, outptrs, channel, params, vmin, vmax);
+  }
+
+  if (channel < n_channels)
+  {
+    // Stage the channel tail through full vectors; the packed parameters are
+    // already padded to a whole vector.
+    const unsigned int tail = n_channels - channel;
+    T inputs[Shape::input_points][V::lanes] = {};
+    T outputs[Shape::output_points][V::lanes];
+    const T *tail_inptrs[Shape::input_points];
+    T *tail_outptrs[Shape::output_points];
+
+    for (unsigned int i = 0; i < Shape::input_points; i++)
+    {
+      memcpy(inputs[i], input_ptrs[i] + channel, tail * sizeof(T));
+      tail_inptrs[i] = inputs[i];
+    }
+    for (unsigned int i = 0; i < Shape::output_points; i++)
+    {
+      tail_outptrs[i] = outputs[i];
+    }
+
+    float_tile_vector<T, KernelRows, KernelCols, StrideRows, StrideCols, OutputRows, OutputCols>(
+      tail_inptrs, tail_outptrs, 0, params, vmin, vmax);
+
+    for (unsigned int i = 0; i < Shape::output_points; i++)
+    {
+      memcpy(outptrs[i] + channel, outputs[i], tail * sizeof(T));
+    }
+  }
+}
+
+template <typename T, unsigned int KernelRows, unsigned int KernelCols,
+          unsigned int StrideRows, unsigned int StrideCols,
+          unsigned int OutputRows, unsigned int OutputCols>
+void float_direct(
+  const unsigned int n_tile_rows, const unsigned int n_tile_cols,
+  const T *inptr, int64_t ld_input_row, int64_t ld_input_col,
+  T *outptr, int64_t ld_output_row, int64_t ld_output_col,
+  const void *params, unsigned int n_channels,
+  const T activation_min, const T activation_max
+)
+{
+  using Shape = TileShape<KernelRows, KernelCols, StrideRows, StrideCols, OutputRows, OutputCols>;
+
+  const T *inptrs[Shape::input_points];
+  T *outptrs[Shape::output_points];
+
+  for (unsigned int tile_i = 0; tile_i < n_tile_rows; tile_i++)
+  {
+    for (unsigned int tile_j = 0; tile_j < n_tile_cols; tile_j++)
+    {
+      const T *tile_in = inptr + tile_i * OutputRows * StrideRows * ld_input_row +
+                         tile_j * OutputCols * StrideCols * ld_input_col;
+      T *tile_out = outptr + tile_i * OutputRows * ld_output_row + tile_j * OutputCols * ld_output_col;
+
+      for (unsigned int i = 0; i < Shape::input_rows; i++)
+      {
+        for (unsigned int j = 0; j < Shape::input_cols; j++)
+        {
+          inptrs[i * Shape::input_cols + j] = tile_in + i * ld_input_row + j * ld_input_col;
+        }
+      }
+      for (unsigned int i = 0; i < OutputRows; i++)
+      {
+        for (unsigned int j = 0; j < OutputCols; j++)
+        {
+          outptrs[i * OutputCols + j] = tile_out + i * ld_output_row + j * ld_output_col;
+        }
+      }
+
+      float_indirect<T, KernelRows, KernelCols, StrideRows, StrideCols, OutputRows, OutputCols>(
+        inptrs, outptrs, params, n_channels, activation_min, activation_max);
+    }
+  }
+}
+
+inline int16x8_t widen(const int8_t *ptr) { return vmovl_s8(vld1_s8(ptr)); }
+inline int16x8_t widen(const uint8_t *ptr) { return vreinterpretq_s16_u16(vmovl_u8(vld1_u8(ptr))); }
+
+inline void narrow_store(int8_t *ptr, int16x8_t v) { vst1_s8(ptr, vqmovn_s16(v)); }
+inline void narrow_store(uint8_t *ptr, int16x8_t v) { vst1_u8(ptr, vqmovun_s16(v)); }
+
+/* Requantize four accumulators with a rounding-to-nearest, ties away from
+ * zero, right shift (shifts are non-positive).
+ */
+inline int32x4_t requantize(int32x4_t acc, int32x4_t mul, int32x4_t shift, int32x4_t c_offset, int32x4_t vmin, int32x4_t vmax)
+{
+  acc = vqrdmulhq_s32(acc, mul);
+  const int32x4_t fixup = vshrq_n_s32(vandq_s32(acc, shift), 31);
+  acc = vrshlq_s32(vqaddq_s32(acc, fixup), shift);
+  acc = vaddq_s32(acc, c_offset);
+  return vminq_s32(vmaxq_s32(acc, vmin), vmax);
+}
+
+/* Compute eight channels of a quantized tile.
+ *
+ * `weights` points at one group of eight weights per kernel point and is
+ * advanced past them.
+ */
+template <typename TInput, typename TWeight, typename TOutput,
+          unsigned int KernelRows, unsigned int KernelCols,
+          unsigned int StrideRows, unsigned int StrideCols,
+          unsigned int OutputRows, unsigned int OutputCols>
+inline void quantized_tile_vector(
+  const TInput *const *inptrs, TOutput *const *outptrs, unsigned int channel,
+  const TWeight *&weights, const int32_t *bias, const arm_gemm::Requantize32 &qp,
+  const int32_t *requant_muls, const int32_t *requant_shifts
+)
+{
+  using Shape = TileShape<KernelRows, KernelCols, StrideRows, StrideCols, OutputRows, OutputCols>;
+
+  const int16x8_t a_offset = vdupq_n_s16(static_cast<int16_t>(qp.a_offset));
+  const int16x8_t b_offset = vdupq_n_s16(static_cast<int16_t>(qp.b_offset));
+
+  int32x4_t acc_lo[OutputRows][OutputCols];
+  int32x4_t acc_hi[OutputRows][OutputCols];
+  const int32x4_t bias_lo = vld1q_s32(bias + channel);
+  const int32x4_t bias_hi = vld1q_s32(bias + channel + 4);
+  for (unsigned int oy = 0; oy < OutputRows; oy++)
+  {
+    for (unsigned int ox = 0; ox < OutputCols; ox++)
+    {
+      acc_lo[oy][ox] = bias_lo;
+      acc_hi[oy][ox] = bias_hi;
+    }
+  }
+
+  for (unsigned int ky = 0; ky < KernelRows; ky++)
+  {
+    int16x8_t w[KernelCols];
+    for (unsigned int kx = 0; kx < KernelCols; kx++)
+    {
+      w[kx] = vsubq_s16(widen(weights + kx * 8), b_offset);
+    }
+    weights += KernelCols * 8;
+
+    for (unsigned int oy = 0; oy < OutputRows; oy++)
+    {
+      const TInput *const *row = inptrs + (oy * StrideRows + ky) * Shape::input_cols;
+
+      int16x8_t inputs[Shape::input_cols];
+      for (unsigned int ix = 0; ix < Shape::input_cols; ix++)
+      {
+        inputs[ix] = vsubq_s16(widen(row[ix] + channel), a_offset);
+      }
+
+      for (unsigned int ox = 0; ox < OutputCols; ox++)
+      {
+        for (unsigned int kx = 0; kx < KernelCols; kx++)
+        {
+          const int16x8_t in = inputs[ox * StrideCols + kx];
+          acc_lo[oy][ox] = vmlal_s16(acc_lo[oy][ox], vget_low_s16(in), vget_low_s16(w[kx]));
+          acc_hi[oy][ox] = vmlal_high_s16(acc_hi[oy][ox], in, w[kx]);
+        }
+      }
+    }
+  }
+
+  const int32x4_t c_offset = vdupq_n_s32(qp.c_offset);
+  const int32x4_t vmin = vdupq_n_s32(qp.minval);
+  const int32x4_t vmax = vdupq_n_s32(qp.maxval);
+  const int32x4_t mul_lo = vld1q_s32(requant_muls + channel);
+  const int32x4_t mul_hi = vld1q_s32(requant_muls + channel + 4);
+  const int32x4_t shift_lo = vld1q_s32(requant_shifts + channel);
+  const int32x4_t shift_hi = vld1q_s32(requant_shifts + channel + 4);
+
+  for (unsigned int oy = 0; oy < OutputRows; oy++)
+  {
+    for (unsigned int ox = 0; ox < OutputCols; ox++)
+    {
+      const int32x4_t lo = requantize(acc_lo[oy][ox], mul_lo, shift_lo, c_offset, vmin, vmax);
+      const int32x4_t hi = requantize(acc_hi[oy][ox], mul_hi, shift_hi, c_offset, vmin, vmax);
+      narrow_store(outptrs[oy * OutputCols + ox] + channel, vcombine_s16(vmovn_s32(lo), vmovn_s32(hi)));
+    }
+  }
+}
+
+template <typename TInput, typename TWeight, typename TOutput,
+          unsigned int KernelRows, unsigned int KernelCols,
+          unsigned int StrideRows, unsigned int StrideCols,
+          unsigned int OutputRows, unsigned int OutputCols>
+void quantized_indirect(
+  const unsigned int n_channels, const TInput *const *const inptrs, const TWeight *const params,
+  const int32_t *const bias, const arm_gemm::Requantize32 &qp,
+  const int32_t *const requant_muls, const int32_t *const requant_shifts,
+  TOutput *const *const outptrs
+)
+{
+  using Shape = TileShape<KernelRows, KernelCols, StrideRows, StrideCols, OutputRows, OutputCols>;
+
+  const TWeight *weights = params;
+
+  unsigned int channel = 0;
+  for (; channel + 8 <= n_channels; channel += 8)
+  {
+    quantized_tile_vector<TInput, TWeight, TOutput, KernelRows, KernelCols, StrideRows, StrideCols, OutputRows, OutputCols>(
+      inptrs, outptrs, channel, weights, bias, qp, requant_muls, requant_shifts);
+  }
+
+  if (channel < n_channels)
+  {
+    // Stage the channel tail through full vectors; lanes past the tail are
+    // computed but never written back.
+    const unsigned int tail = n_channels - channel;
+    TInput inputs[Shape::input_points][8] = {};
+    TOutput outputs[Shape::output_points][8];
+    const TInput *tail_inptrs[Shape::input_points];
+    TOutput *tail_outptrs[Shape::output_points];
+    int32_t tail_bias[8] = {};
+    int32_t tail_muls[8] = {};
+    int32_t tail_shifts[8] = {};
+
+    for (unsigned int i = 0; i < Shape::input_points; i++)
+    {
+      memcpy(inputs[i], inptrs[i] + channel, tail * sizeof(TInput));
+      tail_inptrs[i] = inputs[i];
+    }
+    for (unsigned int i = 0; i < Shape::output_points; i++)
+    {
+      tail_outptrs[i] = outputs[i];
+    }
+    memcpy(tail_bias, bias + channel, tail * sizeof(int32_t));
+    memcpy(tail_muls, requant_muls + channel, tail * sizeof(int32_t));
+    memcpy(tail_shifts, requant_shifts + channel, tail * sizeof(int32_t));
+
+    quantized_tile_vector<TInput, TWeight, TOutput, KernelRows, KernelCols, StrideRows, StrideCols, OutputRows, OutputCols>(
+      tail_inptrs, tail_outptrs, 0, weights, tail_bias, qp, tail_muls, tail_shifts);
+
+    for (unsigned int i = 0; i < Shape::output_points; i++)
+    {
+      memcpy(outptrs[i] + channel, outputs[i], tail * sizeof(TOutput));
+    }
+  }
+}
+
+}  // namespace a64_nhwc_mla_depthfirst_tile
+}  // namespace depthwise
+}  // namespace arm_conv
+
+#endif  // defined(__aarch64__)
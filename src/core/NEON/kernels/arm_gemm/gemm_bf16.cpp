@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020, 2022-2024 Arm Limited.
+ * Copyright (c) 2017-2020, 2022-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,7 @@
 #include "gemm_interleaved.hpp"
 #include "gemv_batched.hpp"
 #include "gemv_pretransposed.hpp"
+#include "gemv_skinny.hpp"
 
 #include "kernels/a32_sgemm_8x6.hpp"
 
@@ -43,6 +44,7 @@
 #include "kernels/a64_interleaved_bf16fp32_dot_8x12.hpp"
 #include "kernels/a64_interleaved_bf16fp32_mmla_8x12.hpp"
 #include "kernels/a64_sgemm_8x12.hpp"
+#include "kernels/a64_skinny_bf16fp32_mla_8x8.hpp"
 
 #ifdef ARM_COMPUTE_ENABLE_FIXED_FORMAT_KERNELS
 #include "kernels/sve_ffhybrid_bf16fp32_mmla_6x4VL.hpp"
@@ -162,6 +164,14 @@ GemmImplementation<bfloat16, bfloat16, float>::with_estimate(
 ),
 #endif // ARM_COMPUTE_ENABLE_FIXED_FORMAT_KERNELS
 #endif // ARM_COMPUTE_ENABLE_SVE
+// Skinny GEMMs with large weights, e.g. decoding projections
+{
+    GemmMethod::GEMV_SKINNY,
+    "a64_skinny_bf16fp32_mla_8x8",
+    [](const GemmArgs &args) { return gemv_skinny_is_supported(args, cls_a64_skinny_bf16fp32_mla_8x8::out_height()); },
+    nullptr,
+    [](const GemmArgs &args) { return new GemvSkinny<cls_a64_skinny_bf16fp32_mla_8x8, bfloat16, float>(args); }
+},
 GemmImplementation<bfloat16, bfloat16, float>::with_estimate(
     GemmMethod::GEMM_HYBRID,
     "a64_hybrid_bf16fp32_mmla_6x16",
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020, 2022-2025 Arm Limited.
+ * Copyright (c) 2017-2020, 2022-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,7 @@
 #include "gemm_implementation.hpp"
 #include "gemm_interleaved.hpp"
 #include "gemv_pretransposed.hpp"
+#include "gemv_skinny.hpp"
 
 #include "kernels/a32_sgemm_8x6.hpp"
 #ifdef ARM_COMPUTE_ENABLE_FIXED_FORMAT_KERNELS
@@ -44,6 +45,7 @@
 #include "kernels/a64_hybrid_fp16_mla_6x32.hpp"
 #include "kernels/a64_hybrid_fp16fp32fp16_mla_6x16.hpp"
 #include "kernels/a64_sgemm_8x12.hpp"
+#include "kernels/a64_skinny_fp16fp32fp16_mla_8x8.hpp"
 #include "kernels/sme2_gemv_fp16fp32fp16_dot_16VL.hpp"
 #include "kernels/sme2_interleaved_nomerge_fp16fp32fp16_mopa_1VLx4VL.hpp"
 #include "kernels/sme2_interleaved_nomerge_fp16fp32fp16_mopa_2VLx2VL.hpp"
@@ -142,6 +144,14 @@ GemmImplementation<__fp16, __fp16, __fp16>::with_estimate(
 #endif // ARM_COMPUTE_ENABLE_FIXED_FORMAT_KERNELS
 #endif // ARM_COMPUTE_ENABLE_SVE
 #if defined(__aarch64__)
+// Skinny GEMMs with large weights, e.g. decoding projections
+{
+    GemmMethod::GEMV_SKINNY,
+    "a64_skinny_fp16fp32fp16_mla_8x8",
+    [](const GemmArgs &args) { return gemv_skinny_is_supported(args, cls_a64_skinny_fp16fp32fp16_mla_8x8::out_height()); },
+    nullptr,
+    [](const GemmArgs &args) { return new GemvSkinny<cls_a64_skinny_fp16fp32fp16_mla_8x8, __fp16, __fp16>(args); }
+},
 GemmImplementation<__fp16, __fp16, __fp16>::with_estimate(
     GemmMethod::GEMM_HYBRID,
     "a64_hybrid_fp16_mla_6x32",
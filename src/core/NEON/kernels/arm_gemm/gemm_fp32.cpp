@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024 Arm Limited.
+ * Copyright (c) 2017-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,7 @@
 #include "gemm_interleaved.hpp"
 #include "gemv_batched.hpp"
 #include "gemv_pretransposed.hpp"
+#include "gemv_skinny.hpp"
 
 #include "kernels/a32_sgemm_8x6.hpp"
 #ifdef ARM_COMPUTE_ENABLE_FIXED_FORMAT_KERNELS
@@ -46,6 +47,7 @@
 #include "kernels/a64_interleaved_bf16fp32_mmla_8x12.hpp"
 #include "kernels/a64_sgemm_8x12.hpp"
 #include "kernels/a64_sgemm_8x6.hpp"
+#include "kernels/a64_skinny_fp32_mla_8x8.hpp"
 #include "kernels/a64_smallK_hybrid_fp32_mla_6x4.hpp"
 #include "kernels/a64_smallK_hybrid_fp32_mla_8x4.hpp"
 
@@ -281,6 +283,14 @@ GemmImplementation<float, float, float>::with_estimate(
 ),
 #endif // ARM_COMPUTE_ENABLE_FIXED_FORMAT_KERNELS
 #endif // ARM_COMPUTE_ENABLE_SVE
+// Skinny GEMMs with large weights, e.g. decoding projections
+{
+    GemmMethod::GEMV_SKINNY,
+    "a64_skinny_fp32_mla_8x8",
+    [](const GemmArgs &args) { return !args._fast_mode && gemv_skinny_is_supported(args, cls_a64_skinny_fp32_mla_8x8::out_height()); },
+    nullptr,
+    [](const GemmArgs &args) { return new GemvSkinny<cls_a64_skinny_fp32_mla_8x8, float, float>(args); }
+},
 // Cortex-A35 specific kernel - use for any problem on A35, and never in any other cases.
 {
     GemmMethod::GEMM_INTERLEAVED,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020, 2022-2024 Arm Limited.
+ * Copyright (c) 2017-2020, 2022-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,7 @@
 #include "gemm_hybrid_indirect.hpp"
 #include "gemm_implementation.hpp"
 #include "gemm_interleaved.hpp"
+#include "gemv_skinny.hpp"
 
 #include "kernels/a64_gemm_s16_8x12.hpp"
 #include "kernels/a64_gemm_s8_8x12.hpp"
@@ -36,6 +37,7 @@
 #include "kernels/a64_hybrid_s8s32_dot_6x16.hpp"
 #include "kernels/a64_hybrid_s8s32_mmla_6x16.hpp"
 #include "kernels/a64_interleaved_s8s32_mmla_8x12.hpp"
+#include "kernels/a64_skinny_s8s32_dot_8x8.hpp"
 #include "kernels/a64_smallK_hybrid_s8s32_dot_6x4.hpp"
 #include "kernels/a64_smallK_hybrid_s8s32_dot_8x4.hpp"
 
@@ -111,6 +113,14 @@ GemmImplementation<int8_t, int8_t, int32_t>::with_estimate(
     [](const GemmArgs &args) { return new GemmInterleaved<cls_sve_interleaved_s8s32_dot_8x3VL, int8_t, int8_t, int32_t>(args); }
 ),
 #endif // ARM_COMPUTE_ENABLE_SVE
+// Skinny GEMMs with large weights, e.g. decoding projections
+{
+    GemmMethod::GEMV_SKINNY,
+    "a64_skinny_s8s32_dot_8x8",
+    [](const GemmArgs &args) { return gemv_skinny_is_supported(args, cls_a64_skinny_s8s32_dot_8x8::out_height()); },
+    nullptr,
+    [](const GemmArgs &args) { return new GemvSkinny<cls_a64_skinny_s8s32_dot_8x8, int8_t, int32_t>(args); }
+},
 GemmImplementation<int8_t, int8_t, int32_t>::with_estimate(
     GemmMethod::GEMM_INTERLEAVED,
     "a64_interleaved_s8s32_mmla_8x12",
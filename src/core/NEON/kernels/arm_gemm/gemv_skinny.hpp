@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "arm_gemm.hpp"
+#include "utils.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <new>
+
+#ifdef CYCLE_PROFILING
+#include "profiler.hpp"
+#endif
+
+namespace arm_gemm {
+
+/* Skinny GEMMs (M <= strategy::out_height(), typically the projections of
+ * autoregressive decoding) are limited by the bandwidth of the weights, so
+ * they are worth treating separately only when the weights are large. */
+inline bool gemv_skinny_is_supported(const GemmArgs &args, unsigned int max_rows) {
+    return args._Msize <= max_rows && args._nbatches == 1 && args._Ksections == 1 && !args._indirect_input &&
+           (static_cast<uint64_t>(args._Nsize) * args._Ksize) >= (64 * 1024);
+}
+
+// Implementation of the GemmCommon abstract class.
+//
+// This implementation is for skinny GEMMs: the weights are pretransposed
+// into panels of out_width() columns, and every unit of work streams one
+// panel over a slice of K for all the rows at once.  When there are not
+// enough panels to keep all the threads busy, K is split as well: every
+// split writes its partial accumulators to the working space, and the last
+// split to finish a panel reduces them and writes the output.
+template<typename strategy, typename To, typename Tr>
+class GemvSkinny : public GemmCommon<To, To, Tr> {
+    typedef typename strategy::operand_type Toi;
+    typedef typename strategy::accumulator_type Tacc;
+
+    /* Minimum length of a slice of K, so that the reduction is amortized. */
+    static constexpr unsigned int min_k_split = 256;
+
+    const GemmArgs     _args;
+
+    const unsigned int _n_panels;
+    const unsigned int _k_padded;
+    const unsigned int _buffer_per_multi;
+
+    unsigned int _k_split_size = 0;
+    unsigned int _k_splits = 1;
+
+    const Toi *_B_pretransposed = nullptr;
+
+    size_t get_counters_size() const {
+        return roundup<size_t>(_args._nmulti * _n_panels * sizeof(std::atomic<unsigned int>), 64);
+    }
+
+    size_t get_partials_size() const {
+        return static_cast<size_t>(_args._nmulti) * _n_panels * _k_splits * _args._Msize * strategy::out_width() * sizeof(Tacc);
+    }
+
+    static Tacc activate(Tacc v, const Activation &act) {
+        switch (act.type) {
+            case Activation::Type::BoundedReLU:
+                v = std::min(v, static_cast<Tacc>(act.param1));
+                /* fall through */
+            case Activation::Type::ReLU:
+                v = std::max(v, static_cast<Tacc>(0));
+                break;
+            default:
+                break;
+        }
+
+        return v;
+    }
+
+    // Add bias, previous output and activation to the accumulators of a panel, and write them out.
+    void write_panel(const Tacc *acc, unsigned int multi, unsigned int n0, const GemmArrays<To, To, Tr> &g_arrays) const {
+        const unsigned int n_len = std::min(strategy::out_width(), _args._Nsize - n0);
+        const Tr *bias = g_arrays._bias ? g_arrays._bias + (multi * g_arrays._bias_multi_stride) + n0 : nullptr;
+
+        for (unsigned int m=0; m<_args._Msize; m++) {
+            Tr *out = g_arrays._Cptr + (multi * g_arrays._C_multi_stride) + (m * g_arrays._ldc) + n0;
+            const Tacc *in = acc + (m * strategy::out_width());
+
+            for (unsigned int i=0; i<n_len; i++) {
+                Tacc v = in[i];
+
+                if (bias) {
+                    v += static_cast<Tacc>(bias[i]);
+                }
+                if (_args._accumulate) {
+                    v += static_cast<Tacc>(out[i]);
+                }
+
+                out[i] = static_cast<Tr>(activate(v, _args._act));
+            }
+        }
+    }
+
+public:
+    GemvSkinny(GemvSkinny &) = delete;
+    GemvSkinny & operator= (GemvSkinny &) = delete;
+
+    GemvSkinny(const GemmArgs &args)
+              : _args(args),
+                _n_panels(iceildiv(args._Nsize, strategy::out_width())),
+                _k_padded(roundup(args._Ksize, strategy::k_unroll())),
+                _buffer_per_multi(_n_panels * strategy::out_width() * _k_padded) {
+        unsigned int splits = 1;
+
+        /* Split K if there are not enough panels to give every thread a few of them. */
+        const unsigned int panels = _n_panels * args._nmulti;
+        const unsigned int target = static_cast<unsigned int>(std::max(args._maxthreads, 1)) * 4;
+
+        if (args._maxthreads > 1 && panels < target) {
+            const unsigned int max_splits = std::max(1u, args._Ksize / min_k_split);
+
+            splits = std::min(iceildiv(target, panels), max_splits);
+        }
+
+        _k_split_size = roundup(iceildiv(args._Ksize, splits), strategy::k_unroll());
+        _k_splits     = iceildiv(args._Ksize, _k_split_size);
+    }
+
+    // Window is number of panels, times number of K splits, times number of multis.
+    ndrange_t get_window_size() const override {
+        return { _n_panels * _k_splits * _args._nmulti };
+    }
+
+    // Common execution logic.
+    void execute_common(const ndcoord_t &work_range, GemmArrays<To, To, Tr> &g_arrays, bool split_k) {
+#ifdef CYCLE_PROFILING
+        profiler prof;
+#endif
+        strategy strat(_args._ci);
+
+        static_assert(sizeof(Tacc) <= 4, "GemvSkinny: accumulators must fit the local buffer alignment");
+
+        alignas(16) Tacc acc[strategy::out_height() * strategy::out_width()];
+
+        std::atomic<unsigned int> *counters = reinterpret_cast<std::atomic<unsigned int> *>(g_arrays._workspace);
+        Tacc *partials = reinterpret_cast<Tacc *>(reinterpret_cast<uintptr_t>(g_arrays._workspace) + get_counters_size());
+        const size_t partial_size = _args._Msize * strategy::out_width();
+
+        const auto start = work_range.get_position(0);
+        const auto end   = work_range.get_position_end(0);
+
+        for (unsigned int unit=start; unit<end; unit++) {
+            const unsigned int split = unit % _k_splits;
+            const unsigned int panel = (unit / _k_splits) % _n_panels;
+            const unsigned int multi = unit / (_k_splits * _n_panels);
+
+            const To  *A_ptr = g_arrays._Aptr + (multi * g_arrays._A_multi_stride);
+            const Toi *B_ptr = _B_pretransposed + (multi * _buffer_per_multi) + (panel * strategy::out_width() * _k_padded);
+
+            if (_k_splits == 1 || !split_k) {
+                /* Without a working space to reduce into, the first split computes the whole of K. */
+                if (split != 0) {
+                    continue;
+                }
+#ifdef CYCLE_PROFILING
+                auto p = prof.ScopedProfiler(PROFILE_KERNEL, (unsigned long)_args._Msize * strategy::out_width() * _args._Ksize);
+#endif
+                strat.kernel(A_ptr, g_arrays._lda, _args._Msize, B_ptr, _args._Ksize, acc);
+                write_panel(acc, multi, panel * strategy::out_width(), g_arrays);
+                continue;
+            }
+
+            const unsigned int k0 = split * _k_split_size;
+            const unsigned int k_len = std::min(_k_split_size, _args._Ksize - k0);
+            const unsigned int panel_id = (multi * _n_panels) + panel;
+            Tacc *panel_partials = partials + (static_cast<size_t>(panel_id) * _k_splits * partial_size);
+
+            {
+#ifdef CYCLE_PROFILING
+                auto p = prof.ScopedProfiler(PROFILE_KERNEL, (unsigned long)_args._Msize * strategy::out_width() * k_len);
+#endif
+                strat.kernel(A_ptr + k0, g_arrays._lda, _args._Msize, B_ptr + (k0 * strategy::out_width()), k_len,
+                             panel_partials + (split * partial_size));
+            }
+
+            /* The last split to finish this panel sees the partials of all the others. */
+            if (counters[panel_id].fetch_add(1, std::memory_order_acq_rel) + 1 == _k_splits) {
+                for (unsigned int s=1; s<_k_splits; s++) {
+                    const Tacc *in = panel_partials + (s * partial_size);
+                    for (size_t i=0; i<partial_size; i++) {
+                        panel_partials[i] += in[i];
+                    }
+                }
+
+                write_panel(panel_partials, multi, panel * strategy::out_width(), g_arrays);
+            }
+        }
+    }
+
+    // Stateless execute: the reduction counters are only reset by set_working_space(), so K is not split.
+    void execute_stateless(const ndcoord_t &work_range, const ndcoord_t &, int, GemmArrays<To, To, Tr> &g_arrays) override {
+        return execute_common(work_range, g_arrays, false);
+    }
+
+    // Actually execute the GEMM.
+    void execute(const ndcoord_t &work_range, const ndcoord_t &, int) override {
+        execute_common(work_range, this->_gemm_arrays, true);
+    }
+
+    /* Working space: the reduction counters, followed by the partial accumulators of every split. */
+    size_t get_working_size() const override {
+        if (_k_splits == 1) {
+            return 0;
+        }
+
+        return get_counters_size() + get_partials_size();
+    }
+
+    /* Called before every run: reset the reduction counters. */
+    void set_working_space(void *working_space) override {
+        this->_gemm_arrays.set_working_space(working_space);
+
+        if (_k_splits > 1 && working_space != nullptr) {
+            auto *counters = reinterpret_cast<std::atomic<unsigned int> *>(working_space);
+            for (unsigned int i=0; i<_args._nmulti * _n_panels; i++) {
+                new (counters + i) std::atomic<unsigned int>(0);
+            }
+        }
+    }
+
+    /* Pretransposed interface implementation */
+    bool B_is_pretransposed() const override {
+        return true;
+    }
+
+    bool B_pretranspose_required() const override {
+        /* Transpose is required if _B_pretransposed is still nullptr */
+        return (_B_pretransposed == nullptr);
+    }
+
+    size_t get_B_pretransposed_array_size() const override {
+        return _buffer_per_multi * _args._nmulti * sizeof(Toi);
+    }
+
+    // Panels of out_width() columns, holding blocks of k_unroll() consecutive values of K for every column.
+    void pretranspose_B_array(void *buffer, const To *B, const int ldb, const int B_multi_stride, bool transposed) override {
+        assert(!transposed);
+
+        Toi *out = reinterpret_cast<Toi *>(buffer);
+
+        for (unsigned int multi=0; multi<_args._nmulti; multi++) {
+            const To *B_multi = B + (multi * B_multi_stride);
+
+            for (unsigned int panel=0; panel<_n_panels; panel++) {
+                for (unsigned int kb=0; kb<_k_padded; kb+=strategy::k_unroll()) {
+                    for (unsigned int col=0; col<strategy::out_width(); col++) {
+                        const unsigned int n = (panel * strategy::out_width()) + col;
+
+                        for (unsigned int ku=0; ku<strategy::k_unroll(); ku++) {
+                            const unsigned int k = kb + ku;
+
+                            *out++ = (n < _args._Nsize && k < _args._Ksize) ? static_cast<Toi>(B_multi[(k * ldb) + n]) : static_cast<Toi>(0);
+                        }
+                    }
+                }
+            }
+        }
+
+        _B_pretransposed = reinterpret_cast<Toi *>(buffer);
+    }
+
+    void set_pretransposed_B_data(void *buffer) override {
+        _B_pretransposed = reinterpret_cast<Toi *>(buffer);
+    }
+
+    GemmConfig get_config() override {
+        GemmConfig c;
+
+        c.method = GemmMethod::GEMV_SKINNY;
+        c.inner_block_size = _k_split_size;
+        c.outer_block_size = strategy::out_width();
+        c.filter = get_type_name<strategy>();
+
+        return c;
+    }
+};
+
+} // namespace arm_gemm
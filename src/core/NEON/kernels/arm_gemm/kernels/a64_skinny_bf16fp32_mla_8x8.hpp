@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+#ifdef __aarch64__
+
+#include "../bfloat.hpp"
+
+#include <cstddef>
+
+namespace arm_gemm
+{
+// Actual kernel implementations
+void a64_skinny_bf16fp32_mla_8x8(const bfloat16 *, size_t, unsigned int, const bfloat16 *, size_t, float *);
+
+// Skinny GEMM strategy: up to 8 rows against panels of 8 BF16 columns, widened to FP32.
+class cls_a64_skinny_bf16fp32_mla_8x8
+{
+public:
+    typedef bfloat16 operand_type;
+    typedef float accumulator_type;
+
+    typedef void (*kern_type)(const bfloat16 *, size_t, unsigned int, const bfloat16 *, size_t, float *);
+
+    /* Kernel blocking parameters */
+    static constexpr unsigned int out_height()
+    {
+        return 8;
+    }
+
+    static constexpr unsigned int out_width()
+    {
+        return 8;
+    }
+
+    static constexpr unsigned int k_unroll()
+    {
+        return 1;
+    }
+
+    kern_type kernel=a64_skinny_bf16fp32_mla_8x8;
+
+    cls_a64_skinny_bf16fp32_mla_8x8(const CPUInfo *)
+    {
+    }
+};
+
+} // namespace arm_gemm
+
+#endif // __aarch64__
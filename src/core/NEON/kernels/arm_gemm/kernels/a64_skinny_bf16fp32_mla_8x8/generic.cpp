@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifdef __aarch64__
+
+#include "arm_gemm.hpp"
+#include "../../bfloat.hpp"
+
+#include <arm_neon.h>
+#include <cstddef>
+
+namespace arm_gemm {
+
+namespace {
+
+/* Distance, in elements of B, of the software prefetches ahead of the panel being streamed. */
+constexpr size_t prefetch_distance = 512;
+
+/* BF16 is the upper half of FP32, so widening is a shift. */
+inline void load_b(const bfloat16 *B, float32x4_t &b0, float32x4_t &b1) {
+    const uint16x8_t b = vld1q_u16(reinterpret_cast<const uint16_t *>(B));
+    b0 = vreinterpretq_f32_u32(vshll_n_u16(vget_low_u16(b), 16));
+    b1 = vreinterpretq_f32_u32(vshll_high_n_u16(b, 16));
+}
+
+inline float32x4_t load_a4(const bfloat16 *A) {
+    return vreinterpretq_f32_u32(vshll_n_u16(vld1_u16(reinterpret_cast<const uint16_t *>(A)), 16));
+}
+
+inline float load_a1(const bfloat16 *A) {
+    return static_cast<float>(*A);
+}
+
+template<unsigned int M>
+void skinny_rows(const bfloat16 *A, size_t lda, const bfloat16 *B, size_t K, float *acc) {
+    float32x4_t c[M][2];
+
+    for (unsigned int m=0; m<M; m++) {
+        c[m][0] = vdupq_n_f32(0.0f);
+        c[m][1] = vdupq_n_f32(0.0f);
+    }
+
+    size_t k=0;
+
+    for (; k + 4 <= K; k += 4) {
+        __builtin_prefetch(B + prefetch_distance);
+        __builtin_prefetch(B + prefetch_distance + (64 / sizeof(bfloat16)));
+
+        float32x4_t b[4][2];
+        for (unsigned int i=0; i<4; i++) {
+            load_b(B + (i * 8), b[i][0], b[i][1]);
+        }
+
+        for (unsigned int m=0; m<M; m++) {
+            const float32x4_t a = load_a4(A + (m * lda) + k);
+
+            c[m][0] = vfmaq_laneq_f32(c[m][0], b[0][0], a, 0);
+            c[m][1] = vfmaq_laneq_f32(c[m][1], b[0][1], a, 0);
+            c[m][0] = vfmaq_laneq_f32(c[m][0], b[1][0], a, 1);
+            c[m][1] = vfmaq_laneq_f32(c[m][1], b[1][1], a, 1);
+            c[m][0] = vfmaq_laneq_f32(c[m][0], b[2][0], a, 2);
+            c[m][1] = vfmaq_laneq_f32(c[m][1], b[2][1], a, 2);
+            c[m][0] = vfmaq_laneq_f32(c[m][0], b[3][0], a, 3);
+            c[m][1] = vfmaq_laneq_f32(c[m][1], b[3][1], a, 3);
+        }
+
+        B += 32;
+    }
+
+    for (; k < K; k++) {
+        float32x4_t b0, b1;
+        load_b(B, b0, b1);
+
+        for (unsigned int m=0; m<M; m++) {
+            const float a = load_a1(A + (m * lda) + k);
+
+            c[m][0] = vfmaq_n_f32(c[m][0], b0, a);
+            c[m][1] = vfmaq_n_f32(c[m][1], b1, a);
+        }
+
+        B += 8;
+    }
+
+    for (unsigned int m=0; m<M; m++) {
+        vst1q_f32(acc + (m * 8), c[m][0]);
+        vst1q_f32(acc + (m * 8) + 4, c[m][1]);
+    }
+}
+
+} // anonymous namespace
+
+void a64_skinny_bf16fp32_mla_8x8(const bfloat16 *A, size_t lda, unsigned int M, const bfloat16 *B, size_t K, float *acc) {
+    switch (M) {
+        case 1:
+            skinny_rows<1>(A, lda, B, K, acc);
+            break;
+        case 2:
+            skinny_rows<2>(A, lda, B, K, acc);
+            break;
+        case 3:
+            skinny_rows<3>(A, lda, B, K, acc);
+            break;
+        case 4:
+            skinny_rows<4>(A, lda, B, K, acc);
+            break;
+        case 5:
+            skinny_rows<5>(A, lda, B, K, acc);
+            break;
+        case 6:
+            skinny_rows<6>(A, lda, B, K, acc);
+            break;
+        case 7:
+            skinny_rows<7>(A, lda, B, K, acc);
+            break;
+        default:
+            skinny_rows<8>(A, lda, B, K, acc);
+            break;
+    }
+}
+
+} // namespace arm_gemm
+
+#endif // __aarch64__
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifdef __aarch64__
+
+#include "arm_gemm.hpp"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace arm_gemm {
+
+namespace {
+
+/* Distance, in bytes of B, of the software prefetches ahead of the panel being streamed. */
+constexpr size_t prefetch_distance = 1024;
+
+/* Add to every lane of acc the dot product of the 4 values of a column of b with the 4 values of lane 'lane' of a. */
+template<int lane>
+inline int32x4_t dot4(int32x4_t acc, int8x16_t b, int8x16_t a) {
+#ifdef __ARM_FEATURE_DOTPROD
+    return vdotq_laneq_s32(acc, b, a, lane);
+#else  // __ARM_FEATURE_DOTPROD
+    const int8x16_t a4 = vreinterpretq_s8_s32(vdupq_laneq_s32(vreinterpretq_s32_s8(a), lane));
+    const int16x8_t lo = vmull_s8(vget_low_s8(b), vget_low_s8(a4));
+    const int16x8_t hi = vmull_high_s8(b, a4);
+    return vaddq_s32(acc, vpaddq_s32(vpaddlq_s16(lo), vpaddlq_s16(hi)));
+#endif // __ARM_FEATURE_DOTPROD
+}
+
+template<unsigned int M>
+void skinny_rows(const int8_t *A, size_t lda, const int8_t *B, size_t K, int32_t *acc) {
+    int32x4_t c[M][2];
+
+    for (unsigned int m=0; m<M; m++) {
+        c[m][0] = vdupq_n_s32(0);
+        c[m][1] = vdupq_n_s32(0);
+    }
+
+    size_t k=0;
+
+    for (; k + 16 <= K; k += 16) {
+        __builtin_prefetch(B + prefetch_distance);
+        __builtin_prefetch(B + prefetch_distance + 64);
+
+        int8x16_t b[4][2];
+        for (unsigned int i=0; i<4; i++) {
+            b[i][0] = vld1q_s8(B + (i * 32));
+            b[i][1] = vld1q_s8(B + (i * 32) + 16);
+        }
+
+        for (unsigned int m=0; m<M; m++) {
+            const int8x16_t a = vld1q_s8(A + (m * lda) + k);
+
+            c[m][0] = dot4<0>(c[m][0], b[0][0], a);
+            c[m][1] = dot4<0>(c[m][1], b[0][1], a);
+            c[m][0] = dot4<1>(c[m][0], b[1][0], a);
+            c[m][1] = dot4<1>(c[m][1], b[1][1], a);
+            c[m][0] = dot4<2>(c[m][0], b[2][0], a);
+            c[m][1] = dot4<2>(c[m][1], b[2][1], a);
+            c[m][0] = dot4<3>(c[m][0], b[3][0], a);
+            c[m][1] = dot4<3>(c[m][1], b[3][1], a);
+        }
+
+        B += 128;
+    }
+
+    /* Remaining blocks of 4 values of K, the last one zero-padded: B is already padded by the pretranspose. */
+    for (; k < K; k += 4) {
+        const int8x16_t b0 = vld1q_s8(B);
+        const int8x16_t b1 = vld1q_s8(B + 16);
+
+        for (unsigned int m=0; m<M; m++) {
+            int32_t a4 = 0;
+            memcpy(&a4, A + (m * lda) + k, std::min<size_t>(4, K - k));
+
+            const int8x16_t a = vreinterpretq_s8_s32(vdupq_n_s32(a4));
+
+            c[m][0] = dot4<0>(c[m][0], b0, a);
+            c[m][1] = dot4<0>(c[m][1], b1, a);
+        }
+
+        B += 32;
+    }
+
+    for (unsigned int m=0; m<M; m++) {
+        vst1q_s32(acc + (m * 8), c[m][0]);
+        vst1q_s32(acc + (m * 8) + 4, c[m][1]);
+    }
+}
+
+} // anonymous namespace
+
+void a64_skinny_s8s32_dot_8x8(const int8_t *A, size_t lda, unsigned int M, const int8_t *B, size_t K, int32_t *acc) {
+    switch (M) {
+        case 1:
+            skinny_rows<1>(A, lda, B, K, acc);
+            break;
+        case 2:
+            skinny_rows<2>(A, lda, B, K, acc);
+            break;
+        case 3:
+            skinny_rows<3>(A, lda, B, K, acc);
+            break;
+        case 4:
+            skinny_rows<4>(A, lda, B, K, acc);
+            break;
+        case 5:
+            skinny_rows<5>(A, lda, B, K, acc);
+            break;
+        case 6:
+            skinny_rows<6>(A, lda, B, K, acc);
+            break;
+        case 7:
+            skinny_rows<7>(A, lda, B, K, acc);
+            break;
+        default:
+            skinny_rows<8>(A, lda, B, K, acc);
+            break;
+    }
+}
+
+} // namespace arm_gemm
+
+#endif // __aarch64__
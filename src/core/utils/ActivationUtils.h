@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CORE_UTILS_ACTIVATIONUTILS_H
+#define ACL_SRC_CORE_UTILS_ACTIVATIONUTILS_H
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include <limits>
+
+namespace arm_compute
+{
+namespace activation_utils
+{
+/** Returns if the activation is disabled or of the RELU family, i.e. a clamp of its input
+ *
+ * @param[in] act_info Activation to check
+ *
+ * @return True for no activation, RELU, BOUNDED_RELU, LU_BOUNDED_RELU or IDENTITY
+ */
+inline bool is_relu_family(const ActivationLayerInfo &act_info)
+{
+    using ActFunction = ActivationLayerInfo::ActivationFunction;
+    if (!act_info.enabled())
+    {
+        return true;
+    }
+    const ActFunction act_func = act_info.activation();
+    return act_func == ActFunction::RELU || act_func == ActFunction::BOUNDED_RELU ||
+           act_func == ActFunction::LU_BOUNDED_RELU || act_func == ActFunction::IDENTITY;
+}
+
+/** Validates that a kernel applying the activation as a clamp supports it
+ *
+ * @param[in] act_info Activation to check
+ *
+ * @return a status
+ */
+inline Status validate_relu_family(const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_relu_family(act_info),
+                                    "Only RELU Family activations, or no activation, is supported");
+    return Status{};
+}
+
+/** Returns the clamping bounds of a RELU family activation
+ *
+ * @param[in]  act_info Activation, disabled or of the RELU family
+ * @param[out] lower    Lowest output value
+ * @param[out] upper    Highest output value
+ */
+inline void relu_family_bounds(const ActivationLayerInfo &act_info, float &lower, float &upper)
+{
+    using ActFunction = ActivationLayerInfo::ActivationFunction;
+    lower             = std::numeric_limits<float>::lowest();
+    upper             = std::numeric_limits<float>::max();
+    if (!act_info.enabled())
+    {
+        return;
+    }
+    switch (act_info.activation())
+    {
+        case ActFunction::RELU:
+            lower = 0.f;
+            break;
+        case ActFunction::BOUNDED_RELU:
+            lower = 0.f;
+            upper = act_info.a();
+            break;
+        case ActFunction::LU_BOUNDED_RELU:
+            lower = act_info.b();
+            upper = act_info.a();
+            break;
+        default:
+            break;
+    }
+}
+} // namespace activation_utils
+} // namespace arm_compute
+#endif // ACL_SRC_CORE_UTILS_ACTIVATIONUTILS_H
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuElementwiseExpressionKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/elementwise_expression/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuElementwiseExpressionKernel::ElementwiseExpressionKernel> available_kernels = {
+#ifdef __aarch64__
+    {"neon_fp32_elementwise_expression", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_elementwise_expression)},
+    {"neon_fp16_elementwise_expression",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16 && data.isa.fp16); },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_elementwise_expression)},
+#endif // __aarch64__
+};
+
+bool is_supported_activation(const ActivationLayerInfo &act_info)
+{
+    using ActFunction = ActivationLayerInfo::ActivationFunction;
+    if (!act_info.enabled())
+    {
+        return true;
+    }
+    switch (act_info.activation())
+    {
+        case ActFunction::IDENTITY:
+        case ActFunction::RELU:
+        case ActFunction::BOUNDED_RELU:
+        case ActFunction::LU_BOUNDED_RELU:
+        case ActFunction::LEAKY_RELU:
+        case ActFunction::LOGISTIC:
+        case ActFunction::TANH:
+        case ActFunction::LINEAR:
+        case ActFunction::ABS:
+        case ActFunction::SQUARE:
+        case ActFunction::SQRT:
+        case ActFunction::SOFT_RELU:
+        case ActFunction::ELU:
+        case ActFunction::HARD_SWISH:
+        case ActFunction::SWISH:
+        case ActFunction::GELU:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// F16 micro-kernels also convert from or to F32 when the expression ends with a cast
+DataType get_selector_data_type(const ITensorInfo *src, const ITensorInfo *dst)
+{
+    return (src->data_type() == DataType::F16 || dst->data_type() == DataType::F16) ? DataType::F16 : DataType::F32;
+}
+
+TensorShape compute_output_shape(const std::vector<const ITensorInfo *> &srcs)
+{
+    TensorShape out_shape{};
+    for (const auto *src : srcs)
+    {
+        out_shape = TensorShape::broadcast_shape(out_shape, src->tensor_shape());
+    }
+    return out_shape;
+}
+
+Status validate_arguments(const std::vector<const ITensorInfo *> &srcs,
+                          const ITensorInfo                      *dst,
+                          const ElementwiseExpressionInfo        &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(srcs.empty() || srcs.size() != info.num_inputs(),
+                                    "The number of inputs must match the one of the expression");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(srcs.size() > elementwise_expression_max_inputs, "Too many inputs");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.nodes().empty() || info.nodes().size() > elementwise_expression_max_nodes,
+                                    "The expression must have between 1 and 32 nodes");
+
+    for (const auto *src : srcs)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src);
+        ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(srcs[0], src);
+    }
+
+    const TensorShape out_shape = compute_output_shape(srcs);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(out_shape.total_size() == 0, "Inputs are not broadcast compatible");
+
+    // Nodes can only read the inputs and the results of the previous nodes
+    unsigned int num_values = info.num_inputs();
+    for (const auto &node : info.nodes())
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(node.lhs >= num_values ||
+                                            (is_binary_elementwise_expression_op(node.op) && node.rhs >= num_values),
+                                        "Operands must be inputs or results of previous nodes");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(node.op == ElementwiseExpressionOp::ACTIVATION &&
+                                            !is_supported_activation(node.act_info),
+                                        "Unsupported activation function");
+        ++num_values;
+    }
+
+    // Validate in case output has been initialized
+    if (dst->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::F16, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(detail::have_different_dimensions(out_shape, dst->tensor_shape(), 0),
+                                        "Wrong shape for output");
+    }
+
+    const auto uk = CpuElementwiseExpressionKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{get_selector_data_type(srcs[0], dst), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+void CpuElementwiseExpressionKernel::configure(const std::vector<const ITensorInfo *> &srcs,
+                                               ITensorInfo                            *dst,
+                                               const ElementwiseExpressionInfo        &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(srcs, dst, info));
+
+    // Auto initialize output if not initialized
+    const TensorShape out_shape = compute_output_shape(srcs);
+    set_shape_if_empty(*dst, out_shape);
+    set_data_type_if_unknown(*dst, srcs[0]->data_type());
+
+    const auto uk = CpuElementwiseExpressionKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{get_selector_data_type(srcs[0], dst), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _info       = info;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuElementwiseExpressionKernel/").append(uk->name);
+
+    // Rows can be split along any dimension, the micro-kernel walks them in blocks
+    Window win = calculate_max_window(out_shape, Steps());
+    ICpuKernel::configure(win);
+}
+
+Status CpuElementwiseExpressionKernel::validate(const std::vector<const ITensorInfo *> &srcs,
+                                                const ITensorInfo                      *dst,
+                                                const ElementwiseExpressionInfo        &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(srcs, dst, info));
+    return Status{};
+}
+
+void CpuElementwiseExpressionKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(tensors.empty());
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    std::vector<const ITensor *> srcs(_info.num_inputs());
+    for (unsigned int i = 0; i < _info.num_inputs(); ++i)
+    {
+        srcs[i] = tensors.get_const_tensor(TensorType::ACL_SRC_VEC + i);
+    }
+    ITensor *dst = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(srcs, dst, _info, window);
+}
+
+const char *CpuElementwiseExpressionKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuElementwiseExpressionKernel::ElementwiseExpressionKernel> &
+CpuElementwiseExpressionKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
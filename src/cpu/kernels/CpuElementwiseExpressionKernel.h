@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUELEMENTWISEEXPRESSIONKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUELEMENTWISEEXPRESSIONKERNEL_H
+
+#include "arm_compute/function_info/ElementwiseExpressionInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to evaluate an expression of elementwise operations in a single pass
+ *
+ * Rows of the destination are evaluated in blocks small enough for all the intermediate values of the expression to
+ * stay in the L1 cache, instead of writing every intermediate tensor to memory and reading it back.
+ */
+class CpuElementwiseExpressionKernel : public ICpuKernel<CpuElementwiseExpressionKernel>
+{
+private:
+    using ElementwiseExpressionKernelPtr = std::add_pointer<void(
+        const std::vector<const ITensor *> &, ITensor *, const ElementwiseExpressionInfo &, const Window &)>::type;
+
+public:
+    struct ElementwiseExpressionKernel
+    {
+        const char                    *name;
+        const DataTypeISASelectorPtr   is_selected;
+        ElementwiseExpressionKernelPtr ukernel;
+    };
+
+    CpuElementwiseExpressionKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuElementwiseExpressionKernel);
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  srcs Input tensor infos, one per input of @p info. Their shapes must be broadcast compatible.
+     *                  Data types supported: F16/F32, all the same.
+     * @param[out] dst  Destination tensor info with the broadcast shape of @p srcs. Data types supported: F16/F32.
+     *                  If different from @p srcs, the result is converted when stored.
+     * @param[in]  info Elementwise expression information.
+     */
+    void configure(const std::vector<const ITensorInfo *> &srcs,
+                   ITensorInfo                            *dst,
+                   const ElementwiseExpressionInfo        &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuElementwiseExpressionKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const std::vector<const ITensorInfo *> &srcs,
+                           const ITensorInfo                      *dst,
+                           const ElementwiseExpressionInfo        &info);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<ElementwiseExpressionKernel> &get_available_kernels();
+
+private:
+    ElementwiseExpressionInfo      _info{};
+    ElementwiseExpressionKernelPtr _run_method{nullptr};
+    std::string                    _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUELEMENTWISEEXPRESSIONKERNEL_H
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuEmbeddingBagKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/embedding_bag/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuEmbeddingBagKernel::EmbeddingBagKernel> available_kernels = {
+    {"neon_fp32_embedding_bag", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_embedding_bag)},
+    {"neon_fp16_embedding_bag",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16 && data.isa.fp16); },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_embedding_bag)},
+    {"neon_s8_embedding_bag", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::S8); },
+     REGISTER_INTEGER_NEON(arm_compute::cpu::neon_s8_embedding_bag)},
+    {"neon_s4_embedding_bag", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::U8); },
+     REGISTER_INTEGER_NEON(arm_compute::cpu::neon_s4_embedding_bag)},
+};
+
+Status validate_arguments(const ITensorInfo      *table,
+                          const ITensorInfo      *row_params,
+                          const ITensorInfo      *indices,
+                          const ITensorInfo      *offsets,
+                          const ITensorInfo      *dst,
+                          const EmbeddingBagInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(table, indices, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(table);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(table, 1, DataType::F16, DataType::F32, DataType::S8,
+                                                         DataType::U8);
+    ARM_COMPUTE_RETURN_ERROR_ON(table->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(indices, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON(indices->num_dimensions() > 1);
+
+    const bool is_quantized = table->data_type() == DataType::S8 || table->data_type() == DataType::U8;
+    if (is_quantized)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(row_params == nullptr, "Quantized tables need the parameters of their rows");
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(row_params, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(row_params->num_dimensions() > 2 || row_params->dimension(0) != 2 ||
+                                            row_params->dimension(1) != table->dimension(1),
+                                        "Row parameters must hold a scale and a bias per row of the table");
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(row_params != nullptr, "Floating-point tables have no row parameters");
+    }
+
+    if (info.mode == EmbeddingBagMode::NONE)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(offsets != nullptr, "Offsets are only used when pooling");
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(offsets == nullptr, "Pooling needs the offsets of the bags");
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(offsets, 1, DataType::S32);
+        ARM_COMPUTE_RETURN_ERROR_ON(offsets->num_dimensions() > 1);
+    }
+
+    // Validate in case the output has been initialized
+    if (dst->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->data_type() != (is_quantized ? DataType::F32 : table->data_type()));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(
+            dst->tensor_shape(), misc::shape_calculator::compute_embedding_bag_shape(*table, *indices, offsets));
+    }
+
+    const auto uk = CpuEmbeddingBagKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{table->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+void CpuEmbeddingBagKernel::configure(const ITensorInfo      *table,
+                                      const ITensorInfo      *row_params,
+                                      const ITensorInfo      *indices,
+                                      const ITensorInfo      *offsets,
+                                      ITensorInfo            *dst,
+                                      const EmbeddingBagInfo &info)
+{
+    ARM_COMPUTE_UNUSED(row_params);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(table, indices, dst);
+
+    // Auto initialize output if not initialized
+    const bool     is_quantized  = table->data_type() == DataType::S8 || table->data_type() == DataType::U8;
+    const DataType dst_data_type = is_quantized ? DataType::F32 : table->data_type();
+    auto_init_if_empty(*dst, misc::shape_calculator::compute_embedding_bag_shape(*table, *indices, offsets), 1,
+                       dst_data_type);
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(table, row_params, indices, offsets, dst, info));
+
+    const auto uk = CpuEmbeddingBagKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{table->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _info       = info;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuEmbeddingBagKernel/").append(uk->name);
+
+    // Only half-precision bags need an accumulator of their own
+    const bool is_pooling = info.mode != EmbeddingBagMode::NONE;
+    _working_size = is_pooling && dst_data_type == DataType::F16 ? dst->dimension(0) * sizeof(float) : 0;
+
+    // Every window step computes an output row
+    Window win;
+    win.use_tensor_dimensions(TensorShape(1U, dst->dimension(1)));
+    ICpuKernel::configure(win);
+}
+
+Status CpuEmbeddingBagKernel::validate(const ITensorInfo      *table,
+                                       const ITensorInfo      *row_params,
+                                       const ITensorInfo      *indices,
+                                       const ITensorInfo      *offsets,
+                                       const ITensorInfo      *dst,
+                                       const EmbeddingBagInfo &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(table, row_params, indices, offsets, dst, info));
+    return Status{};
+}
+
+size_t CpuEmbeddingBagKernel::working_size() const
+{
+    return _working_size;
+}
+
+void CpuEmbeddingBagKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(tensors.empty());
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *table      = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *row_params = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *indices    = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *offsets    = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    ITensor       *working    = tensors.get_tensor(TensorType::ACL_INT_0);
+    ITensor       *dst        = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(table, row_params, indices, offsets, working, dst, _info, window, info);
+}
+
+const char *CpuEmbeddingBagKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuEmbeddingBagKernel::EmbeddingBagKernel> &CpuEmbeddingBagKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
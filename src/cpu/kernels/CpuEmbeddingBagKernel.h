@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUEMBEDDINGBAGKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUEMBEDDINGBAGKERNEL_H
+
+#include "arm_compute/function_info/EmbeddingBagInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to gather rows of an embedding table and optionally pool them per bag
+ *
+ * Every window step along Y computes an output row, so the work is parallelised over the indices, or over the bags
+ * when pooling. Quantized rows are dequantized on the fly and the rows of upcoming indices are prefetched.
+ */
+class CpuEmbeddingBagKernel : public ICpuKernel<CpuEmbeddingBagKernel>
+{
+private:
+    using EmbeddingBagKernelPtr = std::add_pointer<void(const ITensor *,
+                                                        const ITensor *,
+                                                        const ITensor *,
+                                                        const ITensor *,
+                                                        ITensor *,
+                                                        ITensor *,
+                                                        const EmbeddingBagInfo &,
+                                                        const Window &,
+                                                        const ThreadInfo &)>::type;
+
+public:
+    struct EmbeddingBagKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        EmbeddingBagKernelPtr        ukernel;
+    };
+
+    CpuEmbeddingBagKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuEmbeddingBagKernel);
+    /** Initialise the kernel's inputs and outputs
+     *
+     * @param[in]  table      Embedding table tensor info with dimensions [embedding_dim, num_rows].
+     *                        Data types supported: F16/F32/S8, or U8 for signed 4-bit values packed two per byte with
+     *                        dimensions [embedding_dim / 2, num_rows].
+     * @param[in]  row_params Quantization parameters tensor info of the rows with dimensions [2, num_rows], holding
+     *                        the scale and bias of every row of a S8 or U8 table, nullptr otherwise.
+     *                        Data type supported: F32.
+     * @param[in]  indices    Indices tensor info with dimensions [num_indices]. Data type supported: S32.
+     * @param[in]  offsets    Offsets of the first index of every bag tensor info with dimensions [num_bags].
+     *                        Required when pooling, nullptr otherwise. Data type supported: S32.
+     * @param[out] dst        Destination tensor info with dimensions [embedding_dim, num_bags], or
+     *                        [embedding_dim, num_indices] without pooling.
+     *                        Data type supported: Same as @p table, F32 for quantized tables.
+     * @param[in]  info       Embedding bag information.
+     */
+    void configure(const ITensorInfo      *table,
+                   const ITensorInfo      *row_params,
+                   const ITensorInfo      *indices,
+                   const ITensorInfo      *offsets,
+                   ITensorInfo            *dst,
+                   const EmbeddingBagInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuEmbeddingBagKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo      *table,
+                           const ITensorInfo      *row_params,
+                           const ITensorInfo      *indices,
+                           const ITensorInfo      *offsets,
+                           const ITensorInfo      *dst,
+                           const EmbeddingBagInfo &info);
+
+    /** Size in bytes of the F32 accumulator of a thread, or 0 if bags are accumulated in the destination */
+    size_t working_size() const;
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<EmbeddingBagKernel> &get_available_kernels();
+
+private:
+    EmbeddingBagInfo      _info{};
+    size_t                _working_size{0};
+    EmbeddingBagKernelPtr _run_method{nullptr};
+    std::string           _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUEMBEDDINGBAGKERNEL_H
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuGemmDynamicQuantizedKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/utils/ActivationUtils.h"
+#include "src/cpu/kernels/gemmdynamicquantized/list.h"
+
+#include <cstring>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuGemmDynamicQuantizedKernel::GemmDynamicQuantizedKernel> available_kernels = {
+    {"neon_fp32_gemm_dynamic_quantized", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_gemm_dynamic_quantized)},
+    {"neon_fp16_gemm_dynamic_quantized",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16 && data.isa.fp16); },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_gemm_dynamic_quantized)},
+};
+
+TensorShape compute_output_shape(const ITensorInfo &src, const ITensorInfo &weights)
+{
+    TensorShape out_shape = src.tensor_shape();
+    out_shape.set(0, weights.dimension(0));
+    return out_shape;
+}
+
+Status validate_arguments(const ITensorInfo         *src,
+                          const ITensorInfo         *weights,
+                          const ITensorInfo         *bias,
+                          const ITensorInfo         *dst,
+                          const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::QASYMM8_SIGNED,
+                                                         DataType::QSYMM8_PER_CHANNEL);
+    ARM_COMPUTE_RETURN_ERROR_ON(src->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->dimension(1) != src->dimension(0),
+                                    "Weights do not match the number of input channels");
+
+    const size_t n         = weights->dimension(0);
+    const size_t n_scales  = weights->quantization_info().scale().size();
+    const size_t n_offsets = weights->quantization_info().offset().size();
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(n_scales != 1 && n_scales != n, "Weights scales must be per-tensor or per-channel");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(n_offsets > 1 && n_offsets != n,
+                                    "Weights offsets must be per-tensor or per-channel");
+
+    if (bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, bias);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != n);
+    }
+
+    ARM_COMPUTE_RETURN_ON_ERROR(activation_utils::validate_relu_family(act_info));
+
+    // Validate in case output has been initialized
+    if (dst->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), compute_output_shape(*src, *weights));
+    }
+
+    const auto uk = CpuGemmDynamicQuantizedKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+void CpuGemmDynamicQuantizedKernel::configure(const ITensorInfo         *src,
+                                              const ITensorInfo         *weights,
+                                              const ITensorInfo         *bias,
+                                              ITensorInfo               *dst,
+                                              const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_UNUSED(bias);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, weights, bias, dst, act_info));
+
+    const auto uk = CpuGemmDynamicQuantizedKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _act_info   = act_info;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuGemmDynamicQuantizedKernel/").append(uk->name);
+
+    // Auto initialize output if not initialized
+    const TensorShape out_shape = compute_output_shape(*src, *weights);
+    auto_init_if_empty(*dst, src->clone()->set_tensor_shape(out_shape));
+
+    // Each window step along X computes a whole block of output channels, along Y a row of all the batches
+    const unsigned int num_blocks = DIV_CEIL(out_shape[0], block_size);
+    const unsigned int num_rows   = src->dimension(1) * src->dimension(2);
+
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, num_blocks, 1));
+    win.set(Window::DimY, Window::Dimension(0, num_rows, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuGemmDynamicQuantizedKernel::validate(const ITensorInfo         *src,
+                                               const ITensorInfo         *weights,
+                                               const ITensorInfo         *bias,
+                                               const ITensorInfo         *dst,
+                                               const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, weights, bias, dst, act_info));
+    return Status{};
+}
+
+size_t CpuGemmDynamicQuantizedKernel::working_size(unsigned int k)
+{
+    return row_tile * (sizeof(float) + sizeof(int32_t) + ceil_to_multiple(k, chunk_size));
+}
+
+size_t CpuGemmDynamicQuantizedKernel::packed_size(unsigned int k, unsigned int n)
+{
+    const size_t block_bytes = block_header_size + static_cast<size_t>(ceil_to_multiple(k, chunk_size)) * block_size;
+    return static_cast<size_t>(DIV_CEIL(n, block_size)) * block_bytes;
+}
+
+void CpuGemmDynamicQuantizedKernel::pack_weights(const ITensor *weights, ITensor *packed)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(weights, packed);
+
+    const ITensorInfo      *info        = weights->info();
+    const QuantizationInfo &qinfo       = info->quantization_info();
+    const unsigned int      n           = info->dimension(0);
+    const unsigned int      k           = info->dimension(1);
+    const unsigned int      num_chunks  = DIV_CEIL(k, chunk_size);
+    const unsigned int      num_blocks  = DIV_CEIL(n, block_size);
+    const size_t            block_bytes = block_header_size + static_cast<size_t>(num_chunks) * chunk_size * block_size;
+
+    uint8_t *dst = packed->buffer() + packed->info()->offset_first_element_in_bytes();
+    std::memset(dst, 0, packed_size(k, n));
+
+    for (unsigned int b = 0; b < num_blocks; ++b)
+    {
+        uint8_t *block_dst   = dst + b * block_bytes;
+        float   *scales_dst  = reinterpret_cast<float *>(block_dst);
+        int32_t *offsets_dst = reinterpret_cast<int32_t *>(scales_dst + block_size);
+        int8_t  *chunks_dst  = reinterpret_cast<int8_t *>(block_dst + block_header_size);
+
+        for (unsigned int ch = 0; ch < block_size && b * block_size + ch < n; ++ch)
+        {
+            const unsigned int oc = b * block_size + ch;
+
+            scales_dst[ch] = qinfo.scale().size() == 1 ? qinfo.scale()[0] : qinfo.scale()[oc];
+            if (!qinfo.offset().empty())
+            {
+                offsets_dst[ch] = qinfo.offset().size() == 1 ? qinfo.offset()[0] : qinfo.offset()[oc];
+            }
+
+            // Chunks of the block are interleaved channel by channel
+            for (unsigned int kk = 0; kk < k; ++kk)
+            {
+                const unsigned int c = kk / chunk_size;
+                chunks_dst[(c * block_size + ch) * chunk_size + kk % chunk_size] =
+                    *reinterpret_cast<const int8_t *>(weights->ptr_to_element(Coordinates(oc, kk)));
+            }
+        }
+    }
+}
+
+void CpuGemmDynamicQuantizedKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(tensors.empty());
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src     = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *bias    = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *packed  = tensors.get_const_tensor(TensorType::ACL_INT_0);
+    ITensor       *working = tensors.get_tensor(TensorType::ACL_INT_1);
+    ITensor       *dst     = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(src, packed, bias, working, dst, _act_info, window, info);
+}
+
+const char *CpuGemmDynamicQuantizedKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuGemmDynamicQuantizedKernel::GemmDynamicQuantizedKernel> &
+CpuGemmDynamicQuantizedKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUGEMMDYNAMICQUANTIZEDKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUGEMMDYNAMICQUANTIZEDKERNEL_H
+
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to multiply a floating-point matrix by int8 weights, quantizing the matrix on the fly
+ *
+ * Every thread quantizes a tile of @ref row_tile rows of the input into its slice of the working buffer, computing
+ * a symmetric scale per row from its largest magnitude, and multiplies the tile with int8 dot products by the
+ * weights. The weights are first packed by @ref pack_weights into blocks of @ref block_size output channels holding
+ * the scales and offsets of their channels, followed by chunks of @ref chunk_size weights per output channel.
+ *
+ * The int32 accumulators are dequantized by the row and channel scales in the output stage, where the bias and the
+ * activation are applied, so neither the quantized input nor the int32 result is ever written to memory.
+ */
+class CpuGemmDynamicQuantizedKernel : public ICpuKernel<CpuGemmDynamicQuantizedKernel>
+{
+private:
+    using GemmDynamicQuantizedKernelPtr = std::add_pointer<void(const ITensor *,
+                                                                const ITensor *,
+                                                                const ITensor *,
+                                                                ITensor *,
+                                                                ITensor *,
+                                                                const ActivationLayerInfo &,
+                                                                const Window &,
+                                                                const ThreadInfo &)>::type;
+
+public:
+    struct GemmDynamicQuantizedKernel
+    {
+        const char                   *name;
+        const DataTypeISASelectorPtr  is_selected;
+        GemmDynamicQuantizedKernelPtr ukernel;
+    };
+
+    /** Number of output channels of a packed block */
+    static constexpr unsigned int block_size = 4;
+    /** Number of weights along K of a packed chunk */
+    static constexpr unsigned int chunk_size = 16;
+    /** Number of rows quantized together, which share the weights loaded by a block */
+    static constexpr unsigned int row_tile = 4;
+    /** Size in bytes of the header of a block: the scales (float) and offsets (int32) of its channels */
+    static constexpr size_t block_header_size = block_size * (sizeof(float) + sizeof(int32_t));
+
+    CpuGemmDynamicQuantizedKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGemmDynamicQuantizedKernel);
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  src      Input tensor info with dimensions [K, M, batches]. Data types supported: F16/F32.
+     * @param[in]  weights  Weights tensor info with dimensions [N, K].
+     *                      Data types supported: QASYMM8_SIGNED/QSYMM8_PER_CHANNEL.
+     * @param[in]  bias     Bias tensor info with dimensions [N]. Can be nullptr. Data type supported: Same as @p src.
+     * @param[out] dst      Destination tensor info with dimensions [N, M, batches].
+     *                      Data type supported: Same as @p src.
+     * @param[in]  act_info Activation applied to the result.
+     */
+    void configure(const ITensorInfo         *src,
+                   const ITensorInfo         *weights,
+                   const ITensorInfo         *bias,
+                   ITensorInfo               *dst,
+                   const ActivationLayerInfo &act_info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuGemmDynamicQuantizedKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo         *src,
+                           const ITensorInfo         *weights,
+                           const ITensorInfo         *bias,
+                           const ITensorInfo         *dst,
+                           const ActivationLayerInfo &act_info);
+
+    /** Size in bytes of the working buffer of a thread
+     *
+     * @param[in] k Number of input channels.
+     *
+     * @return The size in bytes
+     */
+    static size_t working_size(unsigned int k);
+    /** Size in bytes of the packed weights buffer
+     *
+     * @param[in] k Number of input channels.
+     * @param[in] n Number of output channels.
+     *
+     * @return The size in bytes
+     */
+    static size_t packed_size(unsigned int k, unsigned int n);
+    /** Pack the weights and their quantization information block by block
+     *
+     * @param[in]  weights Weights with dimensions [N, K].
+     * @param[out] packed  Destination buffer of at least packed_size() bytes.
+     */
+    static void pack_weights(const ITensor *weights, ITensor *packed);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<GemmDynamicQuantizedKernel> &get_available_kernels();
+
+private:
+    ActivationLayerInfo           _act_info{};
+    GemmDynamicQuantizedKernelPtr _run_method{nullptr};
+    std::string                   _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUGEMMDYNAMICQUANTIZEDKERNEL_H
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuGemmInt4Kernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/utils/ActivationUtils.h"
+#include "src/cpu/kernels/gemmint4/list.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuGemmInt4Kernel::GemmInt4Kernel> available_kernels = {
+    {"neon_qs8_gemm_int4", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8_SIGNED); },
+     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_qasymm8_signed_gemm_int4)},
+    {"neon_fp32_gemm_int4", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_gemm_int4)},
+    {"neon_fp16_gemm_int4",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16 && data.isa.fp16); },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_gemm_int4)},
+};
+
+DataType output_data_type(DataType src_data_type)
+{
+    return is_data_type_quantized(src_data_type) ? DataType::F32 : src_data_type;
+}
+
+Status validate_arguments(const ITensorInfo  *src,
+                          const ITensorInfo  *weights,
+                          const ITensorInfo  *scales,
+                          const ITensorInfo  *bias,
+                          const ITensorInfo  *dst,
+                          const GEMMInt4Info &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, scales, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8_SIGNED, DataType::F16,
+                                                         DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::U8);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(scales, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(src->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(scales->num_dimensions() > 2);
+
+    const unsigned int k = src->dimension(0);
+    const unsigned int n = weights->dimension(1);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->dimension(0) != DIV_CEIL(k, 2U),
+                                    "Packed weights do not match the number of input channels");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.group_size % CpuGemmInt4Kernel::chunk_size != 0,
+                                    "Group size must be a multiple of 32");
+
+    const unsigned int group = CpuGemmInt4Kernel::effective_group_size(k, info.group_size);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(scales->dimension(0) != DIV_CEIL(k, group) || scales->dimension(1) != n,
+                                    "Scales do not match the number of groups and output channels");
+
+    const DataType dst_data_type = output_data_type(src->data_type());
+    if (bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->data_type() != dst_data_type);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != n);
+    }
+
+    ARM_COMPUTE_RETURN_ON_ERROR(activation_utils::validate_relu_family(info.activation_info));
+
+    // Validate in case output has been initialized
+    if (dst->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->data_type() != dst_data_type);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(
+            dst->tensor_shape(), misc::shape_calculator::compute_gemm_int4_shape(*src, *weights));
+    }
+
+    const auto uk = CpuGemmInt4Kernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+
+// Sign-extended 4-bit weight k of row n of the user weights
+int8_t get_weight(const ITensor *weights, unsigned int k, unsigned int n)
+{
+    const uint8_t byte   = *weights->ptr_to_element(Coordinates(k / 2, n));
+    const uint8_t nibble = (k % 2 == 0) ? (byte & 0xF) : (byte >> 4);
+    return static_cast<int8_t>(nibble << 4) >> 4;
+}
+} // namespace
+
+void CpuGemmInt4Kernel::configure(const ITensorInfo  *src,
+                                  const ITensorInfo  *weights,
+                                  const ITensorInfo  *scales,
+                                  const ITensorInfo  *bias,
+                                  ITensorInfo        *dst,
+                                  const GEMMInt4Info &info)
+{
+    ARM_COMPUTE_UNUSED(scales, bias);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, scales, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, weights, scales, bias, dst, info));
+
+    const auto uk = CpuGemmInt4Kernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _act_info   = info.activation_info;
+    _group_size = info.group_size;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuGemmInt4Kernel/").append(uk->name);
+
+    // Auto initialize output if not initialized
+    const TensorShape out_shape = misc::shape_calculator::compute_gemm_int4_shape(*src, *weights);
+    auto_init_if_empty(*dst, src->clone()
+                                 ->set_tensor_shape(out_shape)
+                                 .set_data_type(output_data_type(src->data_type()))
+                                 .set_quantization_info(QuantizationInfo()));
+
+    // Each window step along X computes a whole block of output channels, along Y a row of all the batches
+    const unsigned int num_blocks = DIV_CEIL(out_shape[0], block_size);
+    const unsigned int num_rows   = src->dimension(1) * src->dimension(2);
+
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, num_blocks, 1));
+    win.set(Window::DimY, Window::Dimension(0, num_rows, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuGemmInt4Kernel::validate(const ITensorInfo  *src,
+                                   const ITensorInfo  *weights,
+                                   const ITensorInfo  *scales,
+                                   const ITensorInfo  *bias,
+                                   const ITensorInfo  *dst,
+                                   const GEMMInt4Info &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, weights, scales, bias, dst, info));
+    return Status{};
+}
+
+unsigned int CpuGemmInt4Kernel::effective_group_size(unsigned int k, unsigned int group_size)
+{
+    return (group_size != 0) ? group_size : DIV_CEIL(k, chunk_size) * chunk_size;
+}
+
+size_t CpuGemmInt4Kernel::packed_size(unsigned int k, unsigned int n, unsigned int group_size)
+{
+    const unsigned int group       = effective_group_size(k, group_size);
+    const unsigned int num_groups  = DIV_CEIL(k, group);
+    const size_t       group_bytes = group_header_size + (group / chunk_size) * block_size * 16;
+    return static_cast<size_t>(DIV_CEIL(n, block_size)) * num_groups * group_bytes;
+}
+
+void CpuGemmInt4Kernel::pack_weights(
+    const ITensor *weights, const ITensor *scales, unsigned int k, unsigned int group_size, ITensor *packed)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(weights, scales, packed);
+
+    const unsigned int n           = weights->info()->dimension(1);
+    const unsigned int group       = effective_group_size(k, group_size);
+    const unsigned int num_groups  = DIV_CEIL(k, group);
+    const unsigned int num_blocks  = DIV_CEIL(n, block_size);
+    const size_t       group_bytes = group_header_size + (group / chunk_size) * block_size * 16;
+
+    uint8_t *dst = packed->buffer() + packed->info()->offset_first_element_in_bytes();
+    std::memset(dst, 0, packed_size(k, n, group_size));
+
+    for (unsigned int b = 0; b < num_blocks; ++b)
+    {
+        for (unsigned int g = 0; g < num_groups; ++g)
+        {
+            uint8_t *group_dst  = dst + (static_cast<size_t>(b) * num_groups + g) * group_bytes;
+            float   *scales_dst = reinterpret_cast<float *>(group_dst);
+            int32_t *wsums_dst  = reinterpret_cast<int32_t *>(scales_dst + block_size);
+            uint8_t *chunks_dst = group_dst + group_header_size;
+
+            const unsigned int k_start = g * group;
+            const unsigned int k_end   = std::min(k_start + group, k);
+
+            for (unsigned int ch = 0; ch < block_size && b * block_size + ch < n; ++ch)
+            {
+                const unsigned int oc = b * block_size + ch;
+
+                scales_dst[ch] = *reinterpret_cast<const float *>(scales->ptr_to_element(Coordinates(g, oc)));
+
+                int32_t wsum = 0;
+                for (unsigned int k0 = k_start; k0 < k_end; k0 += chunk_size)
+                {
+                    // Chunks of the block are interleaved channel by channel
+                    uint8_t *chunk_dst = chunks_dst + ((k0 - k_start) / chunk_size * block_size + ch) * 16;
+                    for (unsigned int i = 0; i < chunk_size; ++i)
+                    {
+                        const unsigned int kk = k0 + i;
+                        const int8_t       w  = (kk < k_end) ? get_weight(weights, kk, oc) : 0;
+                        wsum += w;
+
+                        // Byte i holds weight i in its low nibble and weight i + 16 in its high nibble
+                        const unsigned int byte = i % 16;
+                        const unsigned int half = i / 16;
+                        chunk_dst[byte] |= static_cast<uint8_t>((w & 0xF) << (4 * half));
+                    }
+                }
+                wsums_dst[ch] = wsum;
+            }
+        }
+    }
+}
+
+void CpuGemmInt4Kernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(tensors.empty());
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src    = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *bias   = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *packed = tensors.get_const_tensor(TensorType::ACL_INT_0);
+    ITensor       *dst    = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(src, packed, bias, dst, _group_size, _act_info, window);
+}
+
+const char *CpuGemmInt4Kernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuGemmInt4Kernel::GemmInt4Kernel> &CpuGemmInt4Kernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
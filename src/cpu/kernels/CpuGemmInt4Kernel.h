@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUGEMMINT4KERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUGEMMINT4KERNEL_H
+
+#include "arm_compute/function_info/GEMMInt4Info.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to multiply a matrix by packed signed 4-bit weights
+ *
+ * The weights are first packed by @ref pack_weights into blocks of @ref block_size output channels. For every
+ * group of a block the packed buffer holds the scales and the sums of the weights of the group, followed by chunks of
+ * @ref chunk_size weights per output channel, stored in 16 bytes: byte i holds weight i in its low nibble and weight
+ * i + 16 in its high nibble, so that both halves are unpacked into consecutive lanes with two shifts.
+ *
+ * The weights are unpacked on the fly and multiplied with int8 dot products (QASYMM8_SIGNED input) or fp32 fused
+ * multiply-accumulates (F16/F32 input), so only half a byte per weight is read from memory.
+ */
+class CpuGemmInt4Kernel : public ICpuKernel<CpuGemmInt4Kernel>
+{
+private:
+    using GemmInt4KernelPtr = std::add_pointer<void(const ITensor *,
+                                                    const ITensor *,
+                                                    const ITensor *,
+                                                    ITensor *,
+                                                    unsigned int,
+                                                    const ActivationLayerInfo &,
+                                                    const Window &)>::type;
+
+public:
+    struct GemmInt4Kernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        GemmInt4KernelPtr            ukernel;
+    };
+
+    /** Number of output channels of a packed block */
+    static constexpr unsigned int block_size = 4;
+    /** Number of weights along K of a packed chunk */
+    static constexpr unsigned int chunk_size = 32;
+    /** Size in bytes of the per-group header of a block: the scales (float) and weight sums (int32) of its channels */
+    static constexpr size_t group_header_size = block_size * (sizeof(float) + sizeof(int32_t));
+
+    CpuGemmInt4Kernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGemmInt4Kernel);
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  src     Input tensor info with dimensions [K, M, batches].
+     *                     Data types supported: QASYMM8_SIGNED/F16/F32.
+     * @param[in]  weights Packed 4-bit weights tensor info with dimensions [ceil(K / 2), N]. Data type supported: U8.
+     * @param[in]  scales  Weights scales tensor info with dimensions [num_groups, N]. Data type supported: F32.
+     * @param[in]  bias    Bias tensor info with dimensions [N]. Can be nullptr. Data type supported: Same as @p dst.
+     * @param[out] dst     Destination tensor info with dimensions [N, M, batches].
+     *                     Data type supported: F32 for QASYMM8_SIGNED @p src, otherwise same as @p src.
+     * @param[in]  info    GEMM information.
+     */
+    void configure(const ITensorInfo  *src,
+                   const ITensorInfo  *weights,
+                   const ITensorInfo  *scales,
+                   const ITensorInfo  *bias,
+                   ITensorInfo        *dst,
+                   const GEMMInt4Info &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuGemmInt4Kernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo  *src,
+                           const ITensorInfo  *weights,
+                           const ITensorInfo  *scales,
+                           const ITensorInfo  *bias,
+                           const ITensorInfo  *dst,
+                           const GEMMInt4Info &info);
+
+    /** Number of weights along K sharing a scale
+     *
+     * @param[in] k          Number of weights per output channel.
+     * @param[in] group_size Requested group size, 0 for per-channel scales.
+     *
+     * @return The group size, rounded up to a whole number of chunks
+     */
+    static unsigned int effective_group_size(unsigned int k, unsigned int group_size);
+    /** Size in bytes of the packed weights buffer
+     *
+     * @param[in] k          Number of weights per output channel.
+     * @param[in] n          Number of output channels.
+     * @param[in] group_size Requested group size, 0 for per-channel scales.
+     *
+     * @return The size in bytes
+     */
+    static size_t packed_size(unsigned int k, unsigned int n, unsigned int group_size);
+    /** Pack the weights and their scales block by block
+     *
+     * @param[in]  weights    Packed 4-bit weights with dimensions [ceil(K / 2), N].
+     * @param[in]  scales     Weights scales with dimensions [num_groups, N].
+     * @param[in]  k          Number of weights per output channel.
+     * @param[in]  group_size Requested group size, 0 for per-channel scales.
+     * @param[out] packed     Destination buffer of at least packed_size() bytes.
+     */
+    static void pack_weights(
+        const ITensor *weights, const ITensor *scales, unsigned int k, unsigned int group_size, ITensor *packed);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<GemmInt4Kernel> &get_available_kernels();
+
+private:
+    ActivationLayerInfo _act_info{};
+    unsigned int        _group_size{0};
+    GemmInt4KernelPtr   _run_method{nullptr};
+    std::string         _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUGEMMINT4KERNEL_H
@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuGemmSparseKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/utils/ActivationUtils.h"
+#include "src/cpu/kernels/gemmsparse/list.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuGemmSparseKernel::GemmSparseKernel> available_kernels = {
+    {"neon_qs8_gemm_sparse", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8_SIGNED); },
+     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_qasymm8_signed_gemm_sparse)},
+    {"neon_fp32_gemm_sparse", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_gemm_sparse)},
+    {"neon_fp16_gemm_sparse",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16 && data.isa.fp16); },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_gemm_sparse)},
+};
+
+DataType output_data_type(DataType src_data_type)
+{
+    return is_data_type_quantized(src_data_type) ? DataType::S32 : src_data_type;
+}
+
+TensorShape compute_output_shape(const ITensorInfo &src, const ITensorInfo &weights)
+{
+    TensorShape out_shape = src.tensor_shape();
+    out_shape.set(0, weights.dimension(0));
+    return out_shape;
+}
+
+Status validate_arguments(const ITensorInfo         *src,
+                          const ITensorInfo         *weights,
+                          const ITensorInfo         *bias,
+                          const ITensorInfo         *dst,
+                          const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8_SIGNED, DataType::F16,
+                                                         DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(src->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->dimension(1) != src->dimension(0),
+                                    "Weights do not match the number of input channels");
+
+    if (is_data_type_quantized(src->data_type()))
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::QASYMM8_SIGNED,
+                                                             DataType::QSYMM8_PER_CHANNEL);
+        const auto &offsets = weights->quantization_info().offset();
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(std::any_of(offsets.begin(), offsets.end(), [](int32_t o) { return o != 0; }),
+                                        "Only symmetric weights are supported");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(act_info.enabled(), "Activations are not supported with S32 output");
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, weights);
+    }
+
+    const DataType dst_data_type = output_data_type(src->data_type());
+    if (bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->data_type() != dst_data_type);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != weights->dimension(0));
+    }
+
+    ARM_COMPUTE_RETURN_ON_ERROR(activation_utils::validate_relu_family(act_info));
+
+    // Validate in case output has been initialized
+    if (dst->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->data_type() != dst_data_type);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), compute_output_shape(*src, *weights));
+    }
+
+    const auto uk = CpuGemmSparseKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+
+bool is_zero(const uint8_t *ptr, DataType data_type)
+{
+    switch (data_type)
+    {
+        case DataType::F32:
+            return *reinterpret_cast<const float *>(ptr) == 0.f;
+        case DataType::F16:
+            return *reinterpret_cast<const half *>(ptr) == half(0.f);
+        default:
+            return *reinterpret_cast<const int8_t *>(ptr) == 0;
+    }
+}
+} // namespace
+
+void CpuGemmSparseKernel::configure(const ITensorInfo         *src,
+                                    const ITensorInfo         *weights,
+                                    const ITensorInfo         *bias,
+                                    ITensorInfo               *dst,
+                                    const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_UNUSED(bias);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, weights, bias, dst, act_info));
+
+    const auto uk = CpuGemmSparseKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _act_info   = act_info;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuGemmSparseKernel/").append(uk->name);
+
+    // Auto initialize output if not initialized
+    const TensorShape out_shape = compute_output_shape(*src, *weights);
+    auto_init_if_empty(*dst, src->clone()
+                                 ->set_tensor_shape(out_shape)
+                                 .set_data_type(output_data_type(src->data_type()))
+                                 .set_quantization_info(QuantizationInfo()));
+
+    // Each window step along X computes an output channel, along Y a row of all the batches
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, out_shape[0], 1));
+    win.set(Window::DimY, Window::Dimension(0, src->dimension(1) * src->dimension(2), 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuGemmSparseKernel::validate(const ITensorInfo         *src,
+                                     const ITensorInfo         *weights,
+                                     const ITensorInfo         *bias,
+                                     const ITensorInfo         *dst,
+                                     const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, weights, bias, dst, act_info));
+    return Status{};
+}
+
+size_t CpuGemmSparseKernel::channel_stride(unsigned int k, size_t element_size)
+{
+    // Header, then for every span of the padded input its kept weights and their gather indices, as many bytes as
+    // the span
+    const size_t k_padded = ceil_to_multiple(k, chunk_size);
+    return channel_header_size + k_padded * element_size;
+}
+
+size_t CpuGemmSparseKernel::packed_size(unsigned int k, unsigned int n, size_t element_size)
+{
+    return static_cast<size_t>(n) * channel_stride(k, element_size);
+}
+
+bool CpuGemmSparseKernel::is_2_4_sparse(const ITensor *weights)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(weights);
+
+    const ITensorInfo *info = weights->info();
+    for (unsigned int oc = 0; oc < info->dimension(0); ++oc)
+    {
+        for (unsigned int k0 = 0; k0 < info->dimension(1); k0 += 4)
+        {
+            unsigned int non_zeros = 0;
+            for (unsigned int kk = k0; kk < std::min(k0 + 4, static_cast<unsigned int>(info->dimension(1))); ++kk)
+            {
+                non_zeros += is_zero(weights->ptr_to_element(Coordinates(oc, kk)), info->data_type()) ? 0 : 1;
+            }
+            if (non_zeros > 2)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void CpuGemmSparseKernel::pack_weights(const ITensor *weights, ITensor *packed)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(weights, packed);
+
+    const ITensorInfo *info         = weights->info();
+    const DataType     data_type    = info->data_type();
+    const size_t       element_size = info->element_size();
+    const unsigned int n            = info->dimension(0);
+    const unsigned int k            = info->dimension(1);
+    const unsigned int k_padded     = ceil_to_multiple(k, chunk_size);
+    const size_t       stride       = channel_stride(k, element_size);
+
+    uint8_t *dst = packed->buffer() + packed->info()->offset_first_element_in_bytes();
+    std::memset(dst, 0, packed_size(k, n, element_size));
+
+    // A span of the input holds 8 / element_size groups of 4 values
+    const unsigned int groups_per_span = span_size / (4 * element_size);
+
+    for (unsigned int oc = 0; oc < n; ++oc)
+    {
+        uint8_t *channel = dst + oc * stride;
+        int32_t  wsum    = 0;
+
+        for (unsigned int g = 0; g < k_padded / 4; ++g)
+        {
+            uint8_t           *span    = channel + channel_header_size + (g / groups_per_span) * span_size;
+            const unsigned int g_span  = g % groups_per_span;
+            uint8_t           *values  = span;
+            uint8_t           *indices = span + span_size / 2;
+
+            // Positions of the kept weights of the group, padded with zero weights
+            unsigned int positions[2] = {0, 1};
+            unsigned int kept         = 0;
+            for (unsigned int p = 0; p < 4 && 4 * g + p < k; ++p)
+            {
+                if (!is_zero(weights->ptr_to_element(Coordinates(oc, 4 * g + p)), data_type))
+                {
+                    if (kept == 2)
+                    {
+                        ARM_COMPUTE_ERROR("Weights do not have 2:4 structured sparsity");
+                    }
+                    positions[kept++] = p;
+                }
+            }
+            if (kept == 1)
+            {
+                positions[1] = (positions[0] == 3) ? 2 : 3;
+            }
+
+            for (unsigned int e = 0; e < 2; ++e)
+            {
+                const unsigned int slot  = (2 * g_span + e) * element_size;
+                uint8_t           *value = values + slot;
+                if (e < kept)
+                {
+                    std::memcpy(value, weights->ptr_to_element(Coordinates(oc, 4 * g + positions[e])), element_size);
+                    if (is_data_type_quantized(data_type))
+                    {
+                        wsum += *reinterpret_cast<const int8_t *>(value);
+                    }
+                }
+
+                // Byte offsets within the span of the input value multiplied by the kept weight
+                for (unsigned int b = 0; b < element_size; ++b)
+                {
+                    indices[slot + b] = static_cast<uint8_t>((4 * g_span + positions[e]) * element_size + b);
+                }
+            }
+        }
+        *reinterpret_cast<int32_t *>(channel) = wsum;
+    }
+}
+
+void CpuGemmSparseKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(tensors.empty());
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src    = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *bias   = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *packed = tensors.get_const_tensor(TensorType::ACL_INT_0);
+    ITensor       *dst    = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(src, packed, bias, dst, _act_info, window);
+}
+
+const char *CpuGemmSparseKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuGemmSparseKernel::GemmSparseKernel> &CpuGemmSparseKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUGEMMSPARSEKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUGEMMSPARSEKERNEL_H
+
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to multiply a matrix by weights with 2:4 structured sparsity
+ *
+ * In every group of 4 consecutive weights along K of an output channel at most 2 are non-zero. The weights are
+ * compressed by @ref pack_weights channel by channel: every 32-byte span of the input is matched by the 16 bytes of
+ * the kept weights and the 16 table lookup indices gathering the input values they multiply. The indices are built
+ * once when packing, so at run time only half of the multiply-accumulates are computed and a span of the input is
+ * gathered with the indices of a tile of channels, while the weights of a channel are read once per tile of rows.
+ */
+class CpuGemmSparseKernel : public ICpuKernel<CpuGemmSparseKernel>
+{
+private:
+    using GemmSparseKernelPtr = std::add_pointer<void(const ITensor *,
+                                                      const ITensor *,
+                                                      const ITensor *,
+                                                      ITensor *,
+                                                      const ActivationLayerInfo &,
+                                                      const Window &)>::type;
+
+public:
+    struct GemmSparseKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        GemmSparseKernelPtr          ukernel;
+    };
+
+    /** Number of weights along K the compressed channels are padded to a multiple of */
+    static constexpr unsigned int chunk_size = 32;
+    /** Size in bytes of the span of the input gathered by an index vector */
+    static constexpr unsigned int span_size = 32;
+    /** Number of rows computed together, reading the compressed weights once */
+    static constexpr int tile_rows = 4;
+    /** Number of channels computed together, loading the spans of the input once */
+    static constexpr int tile_channels = 4;
+    /** Size in bytes of the header of a compressed channel, holding the sum of its weights (int32) */
+    static constexpr size_t channel_header_size = 16;
+
+    CpuGemmSparseKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGemmSparseKernel);
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  src      Input tensor info with dimensions [K, M, batches].
+     *                      Data types supported: QASYMM8_SIGNED/F16/F32.
+     * @param[in]  weights  Weights tensor info with dimensions [N, K].
+     *                      Data types supported: QASYMM8_SIGNED/QSYMM8_PER_CHANNEL with zero offsets for
+     *                      QASYMM8_SIGNED @p src, otherwise same as @p src.
+     * @param[in]  bias     Bias tensor info with dimensions [N]. Can be nullptr. Data type supported: Same as @p dst.
+     * @param[out] dst      Destination tensor info with dimensions [N, M, batches].
+     *                      Data type supported: S32 for QASYMM8_SIGNED @p src, otherwise same as @p src.
+     * @param[in]  act_info Activation applied to the result. Only supported for F16/F32 @p src.
+     */
+    void configure(const ITensorInfo         *src,
+                   const ITensorInfo         *weights,
+                   const ITensorInfo         *bias,
+                   ITensorInfo               *dst,
+                   const ActivationLayerInfo &act_info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuGemmSparseKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo         *src,
+                           const ITensorInfo         *weights,
+                           const ITensorInfo         *bias,
+                           const ITensorInfo         *dst,
+                           const ActivationLayerInfo &act_info);
+
+    /** Size in bytes of a compressed channel
+     *
+     * @param[in] k            Number of input channels.
+     * @param[in] element_size Size in bytes of an element of the weights.
+     *
+     * @return The size in bytes
+     */
+    static size_t channel_stride(unsigned int k, size_t element_size);
+    /** Size in bytes of the compressed weights buffer
+     *
+     * @param[in] k            Number of input channels.
+     * @param[in] n            Number of output channels.
+     * @param[in] element_size Size in bytes of an element of the weights.
+     *
+     * @return The size in bytes
+     */
+    static size_t packed_size(unsigned int k, unsigned int n, size_t element_size);
+    /** Check whether at most 2 weights are non-zero in every group of 4 consecutive weights along K
+     *
+     * @param[in] weights Weights with dimensions [N, K].
+     *
+     * @return True if the weights have 2:4 structured sparsity
+     */
+    static bool is_2_4_sparse(const ITensor *weights);
+    /** Compress weights with 2:4 structured sparsity channel by channel
+     *
+     * @param[in]  weights Weights with dimensions [N, K].
+     * @param[out] packed  Destination buffer of at least packed_size() bytes.
+     */
+    static void pack_weights(const ITensor *weights, ITensor *packed);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<GemmSparseKernel> &get_available_kernels();
+
+private:
+    ActivationLayerInfo _act_info{};
+    GemmSparseKernelPtr _run_method{nullptr};
+    std::string         _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUGEMMSPARSEKERNEL_H
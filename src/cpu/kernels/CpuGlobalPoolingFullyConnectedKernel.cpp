@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuGlobalPoolingFullyConnectedKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/core/utils/ActivationUtils.h"
+#include "src/cpu/kernels/globalpoolingfc/list.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuGlobalPoolingFullyConnectedKernel::GlobalPoolingFullyConnectedKernel> available_kernels = {
+    {"neon_fp32_global_pooling_fc", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_global_pooling_fc)},
+    {"neon_fp16_global_pooling_fc",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16 && data.isa.fp16); },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_global_pooling_fc)},
+};
+
+// Number of 128-bit vectors of output channels accumulated per block
+constexpr unsigned int vectors_per_block = 4;
+
+Status validate_arguments(const ITensorInfo             *src,
+                          const ITensorInfo             *weights,
+                          const ITensorInfo             *biases,
+                          const ITensorInfo             *dst,
+                          const FullyConnectedLayerInfo &fc_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->data_layout() != DataLayout::NHWC, "Only NHWC data layout is supported");
+    ARM_COMPUTE_RETURN_ERROR_ON(src->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, weights);
+
+    const size_t in_channels_idx  = fc_info.transpose_weights ? 0 : 1;
+    const size_t out_channels_idx = fc_info.transpose_weights ? 1 : 0;
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->dimension(in_channels_idx) != src->dimension(0),
+                                    "Weights do not match the number of input channels");
+
+    if (biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, biases);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->dimension(0) != weights->dimension(out_channels_idx));
+    }
+
+    ARM_COMPUTE_RETURN_ON_ERROR(activation_utils::validate_relu_family(fc_info.activation_info));
+
+    // Validate in case output has been initialized
+    if (dst->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(
+            dst->tensor_shape(),
+            misc::shape_calculator::compute_global_pooling_fully_connected_shape(*src, *weights,
+                                                                                 fc_info.transpose_weights));
+    }
+
+    const auto uk = CpuGlobalPoolingFullyConnectedKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+void CpuGlobalPoolingFullyConnectedKernel::configure(const ITensorInfo             *src,
+                                                     const ITensorInfo             *weights,
+                                                     const ITensorInfo             *biases,
+                                                     ITensorInfo                   *dst,
+                                                     const FullyConnectedLayerInfo &fc_info)
+{
+    ARM_COMPUTE_UNUSED(biases);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, weights, biases, dst, fc_info));
+
+    const auto uk = CpuGlobalPoolingFullyConnectedKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _act_info   = fc_info.activation_info;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuGlobalPoolingFullyConnectedKernel/").append(uk->name);
+
+    // Auto initialize output if not initialized
+    const TensorShape out_shape =
+        misc::shape_calculator::compute_global_pooling_fully_connected_shape(*src, *weights, fc_info.transpose_weights);
+    auto_init_if_empty(*dst, src->clone()->set_tensor_shape(out_shape));
+
+    // Each window step along X computes a whole block of output channels
+    const unsigned int block      = block_size(src->data_type());
+    const unsigned int num_blocks = DIV_CEIL(out_shape[0], block);
+
+    Window win = calculate_max_window(*dst, Steps());
+    win.set(Window::DimX, Window::Dimension(0, num_blocks, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuGlobalPoolingFullyConnectedKernel::validate(const ITensorInfo             *src,
+                                                      const ITensorInfo             *weights,
+                                                      const ITensorInfo             *biases,
+                                                      const ITensorInfo             *dst,
+                                                      const FullyConnectedLayerInfo &fc_info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, weights, biases, dst, fc_info));
+    return Status{};
+}
+
+unsigned int CpuGlobalPoolingFullyConnectedKernel::block_size(DataType data_type)
+{
+    return vectors_per_block * 16 / data_size_from_type(data_type);
+}
+
+size_t CpuGlobalPoolingFullyConnectedKernel::packed_elements(unsigned int in_channels,
+                                                             unsigned int out_channels,
+                                                             DataType     data_type)
+{
+    const unsigned int block      = block_size(data_type);
+    const unsigned int num_blocks = DIV_CEIL(out_channels, block);
+    return static_cast<size_t>(num_blocks) * (in_channels + 1) * block;
+}
+
+void CpuGlobalPoolingFullyConnectedKernel::pack_weights(const ITensor *weights,
+                                                        const ITensor *biases,
+                                                        bool           transpose_weights,
+                                                        ITensor       *packed)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(weights, packed);
+
+    const ITensorInfo *weights_info = weights->info();
+    const size_t       element_size = weights_info->element_size();
+    const unsigned int in_channels  = weights_info->dimension(transpose_weights ? 0 : 1);
+    const unsigned int out_channels = weights_info->dimension(transpose_weights ? 1 : 0);
+    const unsigned int block        = block_size(weights_info->data_type());
+    const unsigned int num_blocks   = DIV_CEIL(out_channels, block);
+
+    uint8_t *dst = packed->buffer() + packed->info()->offset_first_element_in_bytes();
+    std::memset(dst, 0, packed_elements(in_channels, out_channels, weights_info->data_type()) * element_size);
+
+    for (unsigned int b = 0; b < num_blocks; ++b)
+    {
+        uint8_t           *block_dst = dst + static_cast<size_t>(b) * (in_channels + 1) * block * element_size;
+        const unsigned int oc_start  = b * block;
+        const unsigned int oc_end    = std::min(oc_start + block, out_channels);
+
+        if (biases != nullptr)
+        {
+            for (unsigned int oc = oc_start; oc < oc_end; ++oc)
+            {
+                std::memcpy(block_dst + (oc - oc_start) * element_size, biases->ptr_to_element(Coordinates(oc)),
+                            element_size);
+            }
+        }
+
+        // Output channels of the block are contiguous for every input channel
+        uint8_t *weights_dst = block_dst + block * element_size;
+        for (unsigned int ic = 0; ic < in_channels; ++ic)
+        {
+            for (unsigned int oc = oc_start; oc < oc_end; ++oc)
+            {
+                const Coordinates id = transpose_weights ? Coordinates(ic, oc) : Coordinates(oc, ic);
+                std::memcpy(weights_dst + (ic * block + oc - oc_start) * element_size, weights->ptr_to_element(id),
+                            element_size);
+            }
+        }
+    }
+}
+
+void CpuGlobalPoolingFullyConnectedKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(tensors.empty());
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src       = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *weights   = tensors.get_const_tensor(TensorType::ACL_INT_1);
+    ITensor       *workspace = tensors.get_tensor(TensorType::ACL_INT_0);
+    ITensor       *dst       = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(src, weights, workspace, dst, _act_info, window, info);
+}
+
+const char *CpuGlobalPoolingFullyConnectedKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuGlobalPoolingFullyConnectedKernel::GlobalPoolingFullyConnectedKernel> &
+CpuGlobalPoolingFullyConnectedKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUGLOBALPOOLINGFULLYCONNECTEDKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUGLOBALPOOLINGFULLYCONNECTEDKERNEL_H
+
+#include "arm_compute/function_info/FullyConnectedLayerInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to compute a global average pooling followed by a fully connected layer
+ *
+ * Every thread reduces the spatial dimensions of the NHWC input into a small per-thread buffer and immediately
+ * multiplies it by its blocks of output channels, so the pooled tensor is never written to memory and the
+ * matrix-vector product is parallelised over output channels.
+ */
+class CpuGlobalPoolingFullyConnectedKernel : public ICpuKernel<CpuGlobalPoolingFullyConnectedKernel>
+{
+private:
+    using GlobalPoolingFullyConnectedKernelPtr = std::add_pointer<void(const ITensor *,
+                                                                       const ITensor *,
+                                                                       ITensor *,
+                                                                       ITensor *,
+                                                                       const ActivationLayerInfo &,
+                                                                       const Window &,
+                                                                       const ThreadInfo &)>::type;
+
+public:
+    struct GlobalPoolingFullyConnectedKernel
+    {
+        const char                          *name;
+        const DataTypeISASelectorPtr         is_selected;
+        GlobalPoolingFullyConnectedKernelPtr ukernel;
+    };
+
+    CpuGlobalPoolingFullyConnectedKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGlobalPoolingFullyConnectedKernel);
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  src     Source tensor info. 3 lower dimensions represent a single input [IFM, width, height],
+     *                     while the fourth dimension represents a batch of inputs.
+     *                     Data types supported: F16/F32. Data layouts supported: NHWC.
+     * @param[in]  weights Weights tensor info with dimensions [IFM, OFM], or [OFM, IFM] if
+     *                     @p fc_info.transpose_weights is false. Data type supported: Same as @p src.
+     * @param[in]  biases  Bias tensor info with dimensions [OFM]. Can be nullptr. Data type supported: Same as @p src.
+     * @param[out] dst     Destination tensor info with dimensions [OFM, batches]. Data type supported: Same as @p src.
+     * @param[in]  fc_info Fully connected layer information.
+     */
+    void configure(const ITensorInfo             *src,
+                   const ITensorInfo             *weights,
+                   const ITensorInfo             *biases,
+                   ITensorInfo                   *dst,
+                   const FullyConnectedLayerInfo &fc_info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuGlobalPoolingFullyConnectedKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo             *src,
+                           const ITensorInfo             *weights,
+                           const ITensorInfo             *biases,
+                           const ITensorInfo             *dst,
+                           const FullyConnectedLayerInfo &fc_info);
+
+    /** Number of output channels computed by every window step */
+    static unsigned int block_size(DataType data_type);
+    /** Number of elements of the packed weights buffer
+     *
+     * @param[in] in_channels  Number of input channels.
+     * @param[in] out_channels Number of output channels.
+     * @param[in] data_type    Data type of the weights.
+     *
+     * @return The number of elements
+     */
+    static size_t packed_elements(unsigned int in_channels, unsigned int out_channels, DataType data_type);
+    /** Pack weights and biases block by block: every block of @ref block_size output channels holds its bias
+     * followed by [IFM][block_size] weights, zero-padded up to a whole block.
+     *
+     * @param[in]  weights           Weights.
+     * @param[in]  biases            Biases. Can be nullptr.
+     * @param[in]  transpose_weights True if @p weights are stored as [IFM, OFM].
+     * @param[out] packed            Destination buffer of at least packed_elements() elements.
+     */
+    static void pack_weights(const ITensor *weights, const ITensor *biases, bool transpose_weights, ITensor *packed);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<GlobalPoolingFullyConnectedKernel> &get_available_kernels();
+
+private:
+    ActivationLayerInfo                  _act_info{};
+    GlobalPoolingFullyConnectedKernelPtr _run_method{nullptr};
+    std::string                          _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUGLOBALPOOLINGFULLYCONNECTEDKERNEL_H
@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuInvertedResidualKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/core/utils/ActivationUtils.h"
+#include "src/cpu/kernels/invertedresidual/list.h"
+
+#include <cstring>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuInvertedResidualKernel::InvertedResidualKernel> available_kernels = {
+    {"neon_fp32_inverted_residual", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_inverted_residual)},
+    {"neon_fp16_inverted_residual",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16 && data.isa.fp16); },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_inverted_residual)},
+};
+
+// Dimension indices of NHWC tensors and weights
+constexpr size_t idx_c = 0;
+constexpr size_t idx_w = 1;
+constexpr size_t idx_h = 2;
+constexpr size_t idx_n = 3;
+
+Status validate_bias(const ITensorInfo *src, const ITensorInfo *bias, size_t channels)
+{
+    if (bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, bias);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != channels);
+    }
+    return Status{};
+}
+
+Status validate_arguments(const ITensorInfo               *src,
+                          const ITensorInfo               *expand_weights,
+                          const ITensorInfo               *expand_bias,
+                          const ITensorInfo               *dw_weights,
+                          const ITensorInfo               *dw_bias,
+                          const ITensorInfo               *proj_weights,
+                          const ITensorInfo               *proj_bias,
+                          const ITensorInfo               *dst,
+                          const InvertedResidualLayerInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, expand_weights, dw_weights, proj_weights, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->data_layout() != DataLayout::NHWC, "Only NHWC data layout is supported");
+    ARM_COMPUTE_RETURN_ERROR_ON(src->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, expand_weights, dw_weights, proj_weights);
+
+    // Expansion: 1x1 convolution from IFM to EFM channels
+    ARM_COMPUTE_RETURN_ERROR_ON(expand_weights->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(expand_weights->dimension(idx_c) != src->dimension(idx_c));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(expand_weights->dimension(idx_w) != 1 || expand_weights->dimension(idx_h) != 1,
+                                    "Expansion stage must be a 1x1 convolution");
+    const size_t exp_channels = expand_weights->dimension(idx_n);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_bias(src, expand_bias, exp_channels));
+
+    // Depthwise: depth multiplier 1, no dilation
+    ARM_COMPUTE_RETURN_ERROR_ON(dw_weights->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(dw_weights->dimension(idx_c) != exp_channels,
+                                    "Only a depth multiplier of 1 is supported");
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_bias(src, dw_bias, exp_channels));
+    const PadStrideInfo &dw_info = info.depthwise_info;
+    ARM_COMPUTE_RETURN_ERROR_ON(dw_info.pad_left() >= dw_weights->dimension(idx_w) ||
+                                dw_info.pad_right() >= dw_weights->dimension(idx_w) ||
+                                dw_info.pad_top() >= dw_weights->dimension(idx_h) ||
+                                dw_info.pad_bottom() >= dw_weights->dimension(idx_h));
+    const auto out_dims = scaled_dimensions_signed(src->dimension(idx_w), src->dimension(idx_h),
+                                                   dw_weights->dimension(idx_w), dw_weights->dimension(idx_h), dw_info);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(out_dims.first < 1 || out_dims.second < 1,
+                                    "Depthwise kernel does not fit in the padded input");
+
+    // Projection: 1x1 convolution from EFM to OFM channels
+    ARM_COMPUTE_RETURN_ERROR_ON(proj_weights->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(proj_weights->dimension(idx_c) != exp_channels);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(proj_weights->dimension(idx_w) != 1 || proj_weights->dimension(idx_h) != 1,
+                                    "Projection stage must be a 1x1 convolution");
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_bias(src, proj_bias, proj_weights->dimension(idx_n)));
+
+    ARM_COMPUTE_RETURN_ON_ERROR(activation_utils::validate_relu_family(info.expand_act));
+    ARM_COMPUTE_RETURN_ON_ERROR(activation_utils::validate_relu_family(info.depthwise_act));
+    ARM_COMPUTE_RETURN_ON_ERROR(activation_utils::validate_relu_family(info.project_act));
+
+    const TensorShape out_shape =
+        misc::shape_calculator::compute_inverted_residual_shape(*src, *dw_weights, *proj_weights, dw_info);
+    if (info.residual)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(out_shape != src->tensor_shape(),
+                                        "Residual connection requires the output shape to match the input shape");
+    }
+
+    // Validate in case output has been initialized
+    if (dst->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), out_shape);
+    }
+
+    const auto uk = CpuInvertedResidualKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+
+void copy_element(const ITensor *src, const Coordinates &id, uint8_t *dst, size_t element_size)
+{
+    std::memcpy(dst, src->ptr_to_element(id), element_size);
+}
+} // namespace
+
+void CpuInvertedResidualKernel::configure(const ITensorInfo               *src,
+                                          const ITensorInfo               *expand_weights,
+                                          const ITensorInfo               *expand_bias,
+                                          const ITensorInfo               *dw_weights,
+                                          const ITensorInfo               *dw_bias,
+                                          const ITensorInfo               *proj_weights,
+                                          const ITensorInfo               *proj_bias,
+                                          ITensorInfo                     *dst,
+                                          const InvertedResidualLayerInfo &info)
+{
+    ARM_COMPUTE_UNUSED(expand_bias, dw_bias, proj_bias);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, expand_weights, dw_weights, proj_weights, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, expand_weights, expand_bias, dw_weights, dw_bias, proj_weights,
+                                                  proj_bias, dst, info));
+
+    const auto uk = CpuInvertedResidualKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _info         = info;
+    _exp_channels = expand_weights->dimension(idx_n);
+    _dw_kernel    = Size2D(dw_weights->dimension(idx_w), dw_weights->dimension(idx_h));
+    _run_method   = uk->ukernel;
+    _name         = std::string("CpuInvertedResidualKernel/").append(uk->name);
+
+    // Auto initialize output if not initialized
+    const TensorShape out_shape =
+        misc::shape_calculator::compute_inverted_residual_shape(*src, *dw_weights, *proj_weights, info.depthwise_info);
+    auto_init_if_empty(*dst, src->clone()->set_tensor_shape(out_shape));
+
+    // Each window step computes a full output row: channels and width are handled by the micro-kernel
+    Window win = calculate_max_window(*dst, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, 1, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuInvertedResidualKernel::validate(const ITensorInfo               *src,
+                                           const ITensorInfo               *expand_weights,
+                                           const ITensorInfo               *expand_bias,
+                                           const ITensorInfo               *dw_weights,
+                                           const ITensorInfo               *dw_bias,
+                                           const ITensorInfo               *proj_weights,
+                                           const ITensorInfo               *proj_bias,
+                                           const ITensorInfo               *dst,
+                                           const InvertedResidualLayerInfo &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, expand_weights, expand_bias, dw_weights, dw_bias,
+                                                   proj_weights, proj_bias, dst, info));
+    return Status{};
+}
+
+CpuInvertedResidualKernel::PackedOffsets CpuInvertedResidualKernel::packed_offsets(unsigned int  in_channels,
+                                                                                   unsigned int  exp_channels,
+                                                                                   unsigned int  out_channels,
+                                                                                   const Size2D &dw_kernel)
+{
+    PackedOffsets offsets{};
+    offsets.expand_weights    = 0;
+    offsets.expand_bias       = offsets.expand_weights + in_channels * exp_channels;
+    offsets.depthwise_weights = offsets.expand_bias + exp_channels;
+    offsets.depthwise_bias    = offsets.depthwise_weights + dw_kernel.area() * exp_channels;
+    offsets.project_weights   = offsets.depthwise_bias + exp_channels;
+    offsets.project_bias      = offsets.project_weights + exp_channels * out_channels;
+    offsets.total             = offsets.project_bias + out_channels;
+    return offsets;
+}
+
+size_t CpuInvertedResidualKernel::working_elements_per_thread(const ITensorInfo *src,
+                                                              const ITensorInfo *dst,
+                                                              unsigned int       exp_channels,
+                                                              const Size2D      &dw_kernel)
+{
+    // Ring of kernel_h expanded input rows followed by one depthwise output row
+    return (dw_kernel.height * src->dimension(idx_w) + dst->dimension(idx_w)) * exp_channels;
+}
+
+void CpuInvertedResidualKernel::pack_weights(const ITensor *expand_weights,
+                                             const ITensor *expand_bias,
+                                             const ITensor *dw_weights,
+                                             const ITensor *dw_bias,
+                                             const ITensor *proj_weights,
+                                             const ITensor *proj_bias,
+                                             ITensor       *packed)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(expand_weights, dw_weights, proj_weights, packed);
+
+    const size_t       element_size = expand_weights->info()->element_size();
+    const unsigned int in_channels  = expand_weights->info()->dimension(idx_c);
+    const unsigned int exp_channels = expand_weights->info()->dimension(idx_n);
+    const unsigned int out_channels = proj_weights->info()->dimension(idx_n);
+    const Size2D       dw_kernel(dw_weights->info()->dimension(idx_w), dw_weights->info()->dimension(idx_h));
+
+    const PackedOffsets offsets = packed_offsets(in_channels, exp_channels, out_channels, dw_kernel);
+    uint8_t            *dst     = packed->buffer() + packed->info()->offset_first_element_in_bytes();
+
+    const auto pack_bias = [&](const ITensor *bias, size_t offset, unsigned int channels)
+    {
+        uint8_t *bias_dst = dst + offset * element_size;
+        if (bias == nullptr)
+        {
+            std::memset(bias_dst, 0, channels * element_size);
+            return;
+        }
+        for (unsigned int c = 0; c < channels; ++c)
+        {
+            copy_element(bias, Coordinates(c), bias_dst + c * element_size, element_size);
+        }
+    };
+
+    // Pointwise weights are transposed so that output channels are contiguous
+    for (unsigned int oc = 0; oc < exp_channels; ++oc)
+    {
+        for (unsigned int ic = 0; ic < in_channels; ++ic)
+        {
+            copy_element(expand_weights, Coordinates(ic, 0, 0, oc),
+                         dst + (offsets.expand_weights + ic * exp_channels + oc) * element_size, element_size);
+        }
+    }
+    pack_bias(expand_bias, offsets.expand_bias, exp_channels);
+
+    for (unsigned int ky = 0; ky < dw_kernel.height; ++ky)
+    {
+        for (unsigned int kx = 0; kx < dw_kernel.width; ++kx)
+        {
+            for (unsigned int c = 0; c < exp_channels; ++c)
+            {
+                copy_element(dw_weights, Coordinates(c, kx, ky),
+                             dst + (offsets.depthwise_weights + (ky * dw_kernel.width + kx) * exp_channels + c) *
+                                       element_size,
+                             element_size);
+            }
+        }
+    }
+    pack_bias(dw_bias, offsets.depthwise_bias, exp_channels);
+
+    for (unsigned int oc = 0; oc < out_channels; ++oc)
+    {
+        for (unsigned int ic = 0; ic < exp_channels; ++ic)
+        {
+            copy_element(proj_weights, Coordinates(ic, 0, 0, oc),
+                         dst + (offsets.project_weights + ic * out_channels + oc) * element_size, element_size);
+        }
+    }
+    pack_bias(proj_bias, offsets.project_bias, out_channels);
+}
+
+void CpuInvertedResidualKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(tensors.empty());
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src       = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *weights   = tensors.get_const_tensor(TensorType::ACL_INT_1);
+    ITensor       *workspace = tensors.get_tensor(TensorType::ACL_INT_0);
+    ITensor       *dst       = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(src, weights, workspace, dst, _exp_channels, _dw_kernel, _info, window, info);
+}
+
+const char *CpuInvertedResidualKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuInvertedResidualKernel::InvertedResidualKernel> &CpuInvertedResidualKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUINVERTEDRESIDUALKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUINVERTEDRESIDUALKERNEL_H
+
+#include "arm_compute/core/Size2D.h"
+#include "arm_compute/function_info/InvertedResidualLayerInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to compute a fused inverted residual block (1x1 expansion, depthwise, 1x1 projection)
+ *
+ * The block is computed depth-first: every thread walks a band of output rows and keeps only the
+ * expanded rows needed by the depthwise stage in its own working buffer, so the expanded tensor is
+ * never written to memory.
+ */
+class CpuInvertedResidualKernel : public ICpuKernel<CpuInvertedResidualKernel>
+{
+private:
+    using InvertedResidualKernelPtr = std::add_pointer<void(const ITensor *,
+                                                            const ITensor *,
+                                                            ITensor *,
+                                                            ITensor *,
+                                                            unsigned int,
+                                                            const Size2D &,
+                                                            const InvertedResidualLayerInfo &,
+                                                            const Window &,
+                                                            const ThreadInfo &)>::type;
+
+public:
+    /** Element offsets of every parameter block inside the packed weights buffer */
+    struct PackedOffsets
+    {
+        size_t expand_weights{0};    /**< Expansion weights, stored as [in_channels][exp_channels] */
+        size_t expand_bias{0};       /**< Expansion bias, [exp_channels] */
+        size_t depthwise_weights{0}; /**< Depthwise weights, stored as [kernel_h][kernel_w][exp_channels] */
+        size_t depthwise_bias{0};    /**< Depthwise bias, [exp_channels] */
+        size_t project_weights{0};   /**< Projection weights, stored as [exp_channels][out_channels] */
+        size_t project_bias{0};      /**< Projection bias, [out_channels] */
+        size_t total{0};             /**< Total number of elements */
+    };
+
+    struct InvertedResidualKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        InvertedResidualKernelPtr    ukernel;
+    };
+
+    CpuInvertedResidualKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuInvertedResidualKernel);
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  src            Source tensor info. 3 lower dimensions represent a single input [IFM, width, height],
+     *                            while every optional dimension from 4 and above represent a batch of inputs.
+     *                            Data types supported: F16/F32. Data layouts supported: NHWC.
+     * @param[in]  expand_weights Expansion weights tensor info with dimensions [IFM, 1, 1, EFM]. Data type supported: Same as @p src.
+     * @param[in]  expand_bias    Expansion bias tensor info with dimensions [EFM]. Can be nullptr. Data type supported: Same as @p src.
+     * @param[in]  dw_weights     Depthwise weights tensor info with dimensions [EFM, kernel_x, kernel_y]. Data type supported: Same as @p src.
+     * @param[in]  dw_bias        Depthwise bias tensor info with dimensions [EFM]. Can be nullptr. Data type supported: Same as @p src.
+     * @param[in]  proj_weights   Projection weights tensor info with dimensions [EFM, 1, 1, OFM]. Data type supported: Same as @p src.
+     * @param[in]  proj_bias      Projection bias tensor info with dimensions [OFM]. Can be nullptr. Data type supported: Same as @p src.
+     * @param[out] dst            Destination tensor info. Data type supported: Same as @p src.
+     * @param[in]  info           Inverted residual block information.
+     */
+    void configure(const ITensorInfo               *src,
+                   const ITensorInfo               *expand_weights,
+                   const ITensorInfo               *expand_bias,
+                   const ITensorInfo               *dw_weights,
+                   const ITensorInfo               *dw_bias,
+                   const ITensorInfo               *proj_weights,
+                   const ITensorInfo               *proj_bias,
+                   ITensorInfo                     *dst,
+                   const InvertedResidualLayerInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuInvertedResidualKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo               *src,
+                           const ITensorInfo               *expand_weights,
+                           const ITensorInfo               *expand_bias,
+                           const ITensorInfo               *dw_weights,
+                           const ITensorInfo               *dw_bias,
+                           const ITensorInfo               *proj_weights,
+                           const ITensorInfo               *proj_bias,
+                           const ITensorInfo               *dst,
+                           const InvertedResidualLayerInfo &info);
+
+    /** Compute the layout of the packed weights buffer
+     *
+     * @param[in] in_channels  Number of input channels.
+     * @param[in] exp_channels Number of expanded channels.
+     * @param[in] out_channels Number of output channels.
+     * @param[in] dw_kernel    Depthwise kernel size.
+     *
+     * @return The element offsets of every parameter block
+     */
+    static PackedOffsets
+    packed_offsets(unsigned int in_channels, unsigned int exp_channels, unsigned int out_channels, const Size2D &dw_kernel);
+    /** Number of elements of the working buffer needed by a single thread
+     *
+     * @param[in] src          Source tensor info.
+     * @param[in] dst          Destination tensor info.
+     * @param[in] exp_channels Number of expanded channels.
+     * @param[in] dw_kernel    Depthwise kernel size.
+     *
+     * @return The number of elements
+     */
+    static size_t working_elements_per_thread(const ITensorInfo *src,
+                                              const ITensorInfo *dst,
+                                              unsigned int       exp_channels,
+                                              const Size2D      &dw_kernel);
+    /** Pack weights and biases of the three stages in the layout described by @ref packed_offsets
+     *
+     * Missing biases are zero-filled.
+     *
+     * @param[in]  expand_weights Expansion weights.
+     * @param[in]  expand_bias    Expansion bias. Can be nullptr.
+     * @param[in]  dw_weights     Depthwise weights.
+     * @param[in]  dw_bias        Depthwise bias. Can be nullptr.
+     * @param[in]  proj_weights   Projection weights.
+     * @param[in]  proj_bias      Projection bias. Can be nullptr.
+     * @param[out] packed         Destination buffer of at least packed_offsets().total elements.
+     */
+    static void pack_weights(const ITensor *expand_weights,
+                             const ITensor *expand_bias,
+                             const ITensor *dw_weights,
+                             const ITensor *dw_bias,
+                             const ITensor *proj_weights,
+                             const ITensor *proj_bias,
+                             ITensor       *packed);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<InvertedResidualKernel> &get_available_kernels();
+
+private:
+    InvertedResidualLayerInfo _info{};
+    unsigned int              _exp_channels{0};
+    Size2D                    _dw_kernel{};
+    InvertedResidualKernelPtr _run_method{nullptr};
+    std::string               _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUINVERTEDRESIDUALKERNEL_H
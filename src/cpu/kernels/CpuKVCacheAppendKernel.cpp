@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuKVCacheAppendKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/kvcache/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuKVCacheAppendKernel::KVCacheAppendKernel> available_kernels = {
+    {"neon_kvcache_append_copy",
+     [](const CastDataTypeISASelectorData &data) { return data.src_dt == data.dst_dt; },
+     &arm_compute::cpu::neon_kvcache_append_copy},
+    {"neon_fp32_kvcache_append_qsymm8",
+     [](const CastDataTypeISASelectorData &data)
+     { return data.src_dt == DataType::F32 && data.dst_dt == DataType::QSYMM8_PER_CHANNEL; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_kvcache_append_qsymm8)},
+    {"neon_fp16_kvcache_append_qsymm8",
+     [](const CastDataTypeISASelectorData &data)
+     { return data.src_dt == DataType::F16 && data.dst_dt == DataType::QSYMM8_PER_CHANNEL && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_kvcache_append_qsymm8)},
+};
+
+Status validate_arguments(const ITensorInfo *src, const ITensorInfo *cache)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, cache);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(cache->data_type() != src->data_type() &&
+                                        cache->data_type() != DataType::QSYMM8_PER_CHANNEL,
+                                    "The cache must have the data type of the input or be QSYMM8_PER_CHANNEL");
+    ARM_COMPUTE_RETURN_ERROR_ON(src->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(cache->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(0) != cache->dimension(0) ||
+                                        src->dimension(2) != cache->dimension(2) ||
+                                        src->dimension(3) != cache->dimension(3),
+                                    "Input and cache must have the same head size, number of heads and batches");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(1) > cache->dimension(1), "Input does not fit in the cache");
+
+    if (cache->data_type() == DataType::QSYMM8_PER_CHANNEL)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(cache->quantization_info().scale().size() != cache->dimension(2),
+                                        "A quantized cache needs one scale per head");
+    }
+
+    const auto uk = CpuKVCacheAppendKernel::get_implementation(
+        CastDataTypeISASelectorData{src->data_type(), cache->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+void CpuKVCacheAppendKernel::configure(const ITensorInfo *src, const ITensorInfo *cache)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, cache);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, cache));
+
+    const auto uk = CpuKVCacheAppendKernel::get_implementation(
+        CastDataTypeISASelectorData{src->data_type(), cache->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuKVCacheAppendKernel/").append(uk->name);
+
+    // Every window step along Y, Z and W writes a whole row of the cache
+    Window win = calculate_max_window(*src, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuKVCacheAppendKernel::validate(const ITensorInfo *src, const ITensorInfo *cache)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, cache));
+    return Status{};
+}
+
+void CpuKVCacheAppendKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(tensors.empty());
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src = tensors.get_const_tensor(TensorType::ACL_SRC);
+    ITensor       *dst = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(src, dst, window);
+}
+
+const char *CpuKVCacheAppendKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuKVCacheAppendKernel::KVCacheAppendKernel> &CpuKVCacheAppendKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
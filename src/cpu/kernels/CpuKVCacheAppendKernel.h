@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUKVCACHEAPPENDKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUKVCACHEAPPENDKERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to write new sequence positions into a KV cache
+ *
+ * The destination is a view of the cache starting at the first free position, so the new keys or values are written
+ * in place with the strides of the cache. Floating-point inputs can be quantized to an int8 cache with one scale per
+ * head.
+ */
+class CpuKVCacheAppendKernel : public ICpuKernel<CpuKVCacheAppendKernel>
+{
+private:
+    using KVCacheAppendKernelPtr = std::add_pointer<void(const ITensor *, ITensor *, const Window &)>::type;
+
+public:
+    struct KVCacheAppendKernel
+    {
+        const char                          *name;
+        const CastDataTypeISASelectorDataPtr is_selected;
+        KVCacheAppendKernelPtr               ukernel;
+    };
+
+    CpuKVCacheAppendKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuKVCacheAppendKernel);
+    /** Initialise the kernel's input and output
+     *
+     * @param[in] src   Source tensor info with dimensions [head_dim, tokens, num_heads, batches].
+     *                  Data types supported: F16/F32.
+     * @param[in] cache Cache storage tensor info with dimensions [head_dim, capacity, num_heads, batches] and
+     *                  capacity >= tokens. Data types supported: Same as @p src, or QSYMM8_PER_CHANNEL with one
+     *                  scale per head.
+     */
+    void configure(const ITensorInfo *src, const ITensorInfo *cache);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuKVCacheAppendKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *cache);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<KVCacheAppendKernel> &get_available_kernels();
+
+private:
+    KVCacheAppendKernelPtr _run_method{nullptr};
+    std::string            _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUKVCACHEAPPENDKERNEL_H
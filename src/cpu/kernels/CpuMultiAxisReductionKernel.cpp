@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuMultiAxisReductionKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuMultiAxisReductionKernel::MultiAxisReductionKernel> available_kernels = {
+    {"neon_fp32_multi_axis_reduction", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_multi_axis_reduction),
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_multi_axis_reduction_combine)},
+    {"neon_fp16_multi_axis_reduction",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16 && data.isa.fp16); },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_multi_axis_reduction),
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_multi_axis_reduction_combine)},
+    {"neon_qu8_multi_axis_reduction",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8); },
+     REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_qu8_multi_axis_reduction),
+     REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_qu8_multi_axis_reduction_combine)},
+    {"neon_qs8_multi_axis_reduction",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8_SIGNED); },
+     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_qs8_multi_axis_reduction),
+     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_qs8_multi_axis_reduction_combine)},
+};
+
+// Number of source elements processed at once along the innermost dimension
+constexpr unsigned int window_step_x = 16;
+
+// Reduced dimensions of the source, with negative axes wrapped around its rank. Out of range axes are ignored
+MultiAxisReductionParams::MaskArray reduced_dimensions(const ITensorInfo *src, const Coordinates &reduction_axis)
+{
+    MultiAxisReductionParams::MaskArray is_reduced{};
+    const int                           rank = static_cast<int>(src->num_dimensions());
+    for (unsigned int i = 0; i < reduction_axis.num_dimensions(); ++i)
+    {
+        const int axis = reduction_axis[i] < 0 ? reduction_axis[i] + rank : reduction_axis[i];
+        if (axis >= 0 && axis < static_cast<int>(multi_axis_reduction_max_dims))
+        {
+            is_reduced[axis] = true;
+        }
+    }
+    return is_reduced;
+}
+
+TensorShape
+compute_output_shape(const ITensorInfo *src, const MultiAxisReductionParams::MaskArray &is_reduced, bool keep_dims)
+{
+    TensorShape out_shape = src->tensor_shape();
+    for (size_t d = multi_axis_reduction_max_dims; d > 0; --d)
+    {
+        if (is_reduced[d - 1])
+        {
+            if (keep_dims)
+            {
+                out_shape.set(d - 1, 1, false);
+            }
+            else if (d - 1 < out_shape.num_dimensions())
+            {
+                out_shape.remove_dimension(d - 1, false);
+            }
+        }
+    }
+    return out_shape;
+}
+
+Status validate_arguments(const ITensorInfo *src,
+                          const ITensorInfo *dst,
+                          const Coordinates &reduction_axis,
+                          ReductionOperation op,
+                          bool               keep_dims)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED,
+                                                         DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->num_dimensions() > multi_axis_reduction_max_dims,
+                                    "Only tensors of up to 4 dimensions are supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(op != ReductionOperation::SUM && op != ReductionOperation::MEAN_SUM &&
+                                        op != ReductionOperation::PROD && op != ReductionOperation::MAX &&
+                                        op != ReductionOperation::MIN,
+                                    "Unsupported reduction operation");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(is_data_type_quantized(src->data_type()) && op == ReductionOperation::PROD,
+                                    "PROD is not supported for quantized types");
+    ARM_COMPUTE_RETURN_ERROR_ON(reduction_axis.num_dimensions() < 1);
+
+    const int rank = static_cast<int>(src->num_dimensions());
+    for (unsigned int i = 0; i < reduction_axis.num_dimensions(); ++i)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(reduction_axis[i] < -rank, "Reduction axis out of range");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(reduction_axis[i] >= static_cast<int>(multi_axis_reduction_max_dims),
+                                        "Unsupported reduction axis");
+    }
+
+    // Validate in case output has been initialized
+    if (dst->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(
+            dst->tensor_shape(), compute_output_shape(src, reduced_dimensions(src, reduction_axis), keep_dims));
+    }
+
+    const auto uk = CpuMultiAxisReductionKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr || uk->combine == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+void CpuMultiAxisReductionKernel::configure(const ITensorInfo *src,
+                                            ITensorInfo       *dst,
+                                            const Coordinates &reduction_axis,
+                                            ReductionOperation op,
+                                            bool               keep_dims,
+                                            unsigned int       num_partials)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+
+    const MultiAxisReductionParams::MaskArray is_reduced = reduced_dimensions(src, reduction_axis);
+
+    // Auto initialize output if not initialized
+    auto_init_if_empty(*dst, src->clone()->set_tensor_shape(compute_output_shape(src, is_reduced, keep_dims)));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, dst, reduction_axis, op, keep_dims));
+
+    const auto uk = CpuMultiAxisReductionKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method     = uk->ukernel;
+    _combine_method = uk->combine;
+    _name           = std::string("CpuMultiAxisReductionKernel/").append(uk->name);
+
+    _params            = MultiAxisReductionParams{};
+    _params.op         = op;
+    _params.is_reduced = is_reduced;
+
+    // Strides of the destination and of a row of partial results along every source dimension
+    size_t num_reduced    = 1;
+    size_t num_outputs    = 1;
+    size_t dst_dim        = 0;
+    size_t largest_reduce = 0;
+    for (size_t d = 0; d < multi_axis_reduction_max_dims; ++d)
+    {
+        _params.shape[d] = src->dimension(d);
+        if (is_reduced[d])
+        {
+            num_reduced *= src->dimension(d);
+            if (src->dimension(d) >= largest_reduce)
+            {
+                largest_reduce     = src->dimension(d);
+                _params.split_axis = d;
+            }
+        }
+        else
+        {
+            const size_t out_dim       = keep_dims ? d : dst_dim++;
+            _params.dst_strides[d]     = dst->strides_in_bytes()[out_dim];
+            _params.partial_strides[d] = num_outputs;
+            num_outputs *= src->dimension(d);
+        }
+    }
+    _params.num_outputs  = num_outputs;
+    _params.num_partials = std::min<size_t>(num_partials, largest_reduce);
+    if (_params.num_partials < 2)
+    {
+        _params.num_partials = 0;
+    }
+
+    // Every output is finalized as acc * scale + offset
+    if (is_data_type_quantized(src->data_type()))
+    {
+        const UniformQuantizationInfo iq_info = src->quantization_info().uniform();
+        const UniformQuantizationInfo oq_info = dst->quantization_info().uniform();
+        const float                   ratio   = iq_info.scale / oq_info.scale;
+
+        // SUM and MEAN_SUM accumulate raw values, so remove the input offset of every reduced element
+        switch (op)
+        {
+            case ReductionOperation::SUM:
+                _params.scale  = ratio;
+                _params.offset = oq_info.offset - static_cast<float>(num_reduced) * iq_info.offset * ratio;
+                break;
+            case ReductionOperation::MEAN_SUM:
+                _params.scale  = ratio / static_cast<float>(num_reduced);
+                _params.offset = oq_info.offset - iq_info.offset * ratio;
+                break;
+            default:
+                _params.scale  = ratio;
+                _params.offset = oq_info.offset - iq_info.offset * ratio;
+                break;
+        }
+    }
+    else if (op == ReductionOperation::MEAN_SUM)
+    {
+        _params.scale = 1.f / static_cast<float>(num_reduced);
+    }
+
+    Window win;
+    if (_params.num_partials != 0)
+    {
+        // Every step along X reduces one slice of the split dimension for all the outputs
+        win.set(Window::DimX, Window::Dimension(0, _params.num_partials, 1));
+    }
+    else
+    {
+        // Every step covers the kept coordinates, blocks of columns along X
+        for (size_t d = 0; d < multi_axis_reduction_max_dims; ++d)
+        {
+            if (!is_reduced[d])
+            {
+                const unsigned int step = d == Window::DimX ? window_step_x : 1;
+                win.set(d, Window::Dimension(0, ceil_to_multiple(src->dimension(d), step), step));
+            }
+        }
+    }
+    ICpuKernel::configure(win);
+}
+
+Status CpuMultiAxisReductionKernel::validate(const ITensorInfo *src,
+                                             const ITensorInfo *dst,
+                                             const Coordinates &reduction_axis,
+                                             ReductionOperation op,
+                                             bool               keep_dims)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, dst, reduction_axis, op, keep_dims));
+    return Status{};
+}
+
+unsigned int CpuMultiAxisReductionKernel::num_partials() const
+{
+    return _params.num_partials;
+}
+
+size_t CpuMultiAxisReductionKernel::partials_size() const
+{
+    // Accumulators are 32-bit for every data type
+    return static_cast<size_t>(_params.num_partials) * _params.num_outputs * sizeof(int32_t);
+}
+
+void CpuMultiAxisReductionKernel::combine(ITensorPack &tensors) const
+{
+    ARM_COMPUTE_ERROR_ON(_combine_method == nullptr || _params.num_partials == 0);
+
+    const ITensor *partials = tensors.get_const_tensor(TensorType::ACL_INT_0);
+    ITensor       *dst      = tensors.get_tensor(TensorType::ACL_DST);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(partials, dst);
+
+    _combine_method(partials, dst, _params);
+}
+
+void CpuMultiAxisReductionKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(tensors.empty());
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src      = tensors.get_const_tensor(TensorType::ACL_SRC);
+    ITensor       *dst      = tensors.get_tensor(TensorType::ACL_DST);
+    ITensor       *partials = tensors.get_tensor(TensorType::ACL_INT_0);
+    ARM_COMPUTE_ERROR_ON(_params.num_partials != 0 && partials == nullptr);
+
+    _run_method(src, dst, partials, _params, window);
+}
+
+const char *CpuMultiAxisReductionKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuMultiAxisReductionKernel::MultiAxisReductionKernel> &
+CpuMultiAxisReductionKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUMULTIAXISREDUCTIONKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUMULTIAXISREDUCTIONKERNEL_H
+
+#include "arm_compute/core/Types.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+#include "src/cpu/kernels/multiaxisreduction/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to reduce any set of axes of a tensor in a single pass
+ *
+ * Every output is accumulated over all its reduced elements at once, in F32 for floating-point types and in S32
+ * for quantized types, and written straight to its position in the destination whether the reduced dimensions are
+ * kept or dropped. When there are too few outputs to keep every thread busy, the reduction can instead be split
+ * into slices of the largest reduced dimension, each reduced into its own row of partial results which are then
+ * merged by @ref CpuMultiAxisReductionKernel::combine.
+ */
+class CpuMultiAxisReductionKernel : public ICpuKernel<CpuMultiAxisReductionKernel>
+{
+private:
+    using MultiAxisReductionKernelPtr = std::add_pointer<void(
+        const ITensor *, ITensor *, ITensor *, const MultiAxisReductionParams &, const Window &)>::type;
+    using MultiAxisReductionCombinePtr =
+        std::add_pointer<void(const ITensor *, ITensor *, const MultiAxisReductionParams &)>::type;
+
+public:
+    struct MultiAxisReductionKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        MultiAxisReductionKernelPtr  ukernel;
+        MultiAxisReductionCombinePtr combine;
+    };
+
+    CpuMultiAxisReductionKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuMultiAxisReductionKernel);
+    /** Initialise the kernel's input and output
+     *
+     * @param[in]  src            Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     *                            Supported tensor rank: up to 4.
+     * @param[out] dst            Destination tensor info. Data type supported: Same as @p src.
+     * @param[in]  reduction_axis Axes to reduce. Negative values wrap around the rank of @p src.
+     * @param[in]  op             Reduction operation: SUM, MEAN_SUM, PROD, MAX or MIN. PROD is not supported for
+     *                            quantized types.
+     * @param[in]  keep_dims      Whether to keep the reduced dimensions with length 1.
+     * @param[in]  num_partials   (Optional) Number of slices the reduction is split into, 0 to parallelise over the
+     *                            outputs only. It is clamped to the size of the split dimension.
+     */
+    void configure(const ITensorInfo *src,
+                   ITensorInfo       *dst,
+                   const Coordinates &reduction_axis,
+                   ReductionOperation op,
+                   bool               keep_dims,
+                   unsigned int       num_partials = 0);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuMultiAxisReductionKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src,
+                           const ITensorInfo *dst,
+                           const Coordinates &reduction_axis,
+                           ReductionOperation op,
+                           bool               keep_dims);
+
+    /** Number of slices the reduction is split into, 0 if it is not split */
+    unsigned int num_partials() const;
+    /** Size in bytes of the partial results buffer, 0 if the reduction is not split */
+    size_t partials_size() const;
+    /** Merge the partial results into the destination
+     *
+     * @param[in] tensors Tensor pack holding the partial results (ACL_INT_0) and the destination (ACL_DST).
+     */
+    void combine(ITensorPack &tensors) const;
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<MultiAxisReductionKernel> &get_available_kernels();
+
+private:
+    MultiAxisReductionParams     _params{};
+    MultiAxisReductionKernelPtr  _run_method{nullptr};
+    MultiAxisReductionCombinePtr _combine_method{nullptr};
+    std::string                  _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUMULTIAXISREDUCTIONKERNEL_H
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuPagedAttentionKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/pagedattention/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuPagedAttentionKernel::PagedAttentionKernel> available_kernels = {
+    {"neon_fp32_paged_attention", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_paged_attention)},
+    {"neon_fp16_paged_attention",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16 && data.isa.fp16); },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_paged_attention)},
+};
+
+Status validate_arguments(const ITensorInfo *q,
+                          const ITensorInfo *k,
+                          const ITensorInfo *v,
+                          const ITensorInfo *block_tables,
+                          const ITensorInfo *seq_lens,
+                          const ITensorInfo *dst,
+                          float              scale)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(q, k, v, block_tables, seq_lens, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(q);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(q, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(q, k, v);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(k, v);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(block_tables, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(seq_lens, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON(q->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(k->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(block_tables->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(seq_lens->num_dimensions() > 1);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(q->dimension(0) != k->dimension(0), "Queries and keys must have the same head size");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(q->dimension(1) % k->dimension(2) != 0,
+                                    "The number of query heads must be a multiple of the number of key/value heads");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(block_tables->dimension(1) != q->dimension(2) ||
+                                        seq_lens->dimension(0) != q->dimension(2),
+                                    "Block tables and lengths must have one entry per sequence");
+    ARM_COMPUTE_RETURN_ERROR_ON(!(scale > 0.f));
+
+    // Validate in case output has been initialized
+    if (dst->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(q, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(q, dst);
+    }
+
+    const auto uk = CpuPagedAttentionKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{q->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+void CpuPagedAttentionKernel::configure(const ITensorInfo *q,
+                                        const ITensorInfo *k,
+                                        const ITensorInfo *v,
+                                        const ITensorInfo *block_tables,
+                                        const ITensorInfo *seq_lens,
+                                        ITensorInfo       *dst,
+                                        float              scale)
+{
+    ARM_COMPUTE_UNUSED(k, v, block_tables, seq_lens);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(q, k, v, block_tables, seq_lens, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(q, k, v, block_tables, seq_lens, dst, scale));
+
+    const auto uk = CpuPagedAttentionKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{q->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _scale      = scale;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuPagedAttentionKernel/").append(uk->name);
+
+    // Auto initialize output if not initialized
+    auto_init_if_empty(*dst, *q->clone());
+
+    // Every window step computes a whole head of a sequence
+    Window win = calculate_max_window(*q, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuPagedAttentionKernel::validate(const ITensorInfo *q,
+                                         const ITensorInfo *k,
+                                         const ITensorInfo *v,
+                                         const ITensorInfo *block_tables,
+                                         const ITensorInfo *seq_lens,
+                                         const ITensorInfo *dst,
+                                         float              scale)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(q, k, v, block_tables, seq_lens, dst, scale));
+    return Status{};
+}
+
+size_t CpuPagedAttentionKernel::working_size(unsigned int head_dim, unsigned int max_positions)
+{
+    return (static_cast<size_t>(max_positions) + head_dim) * sizeof(float);
+}
+
+void CpuPagedAttentionKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(tensors.empty());
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *q            = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *k            = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *v            = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *block_tables = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    const ITensor *seq_lens     = tensors.get_const_tensor(TensorType::ACL_SRC_4);
+    ITensor       *working      = tensors.get_tensor(TensorType::ACL_INT_0);
+    ITensor       *dst          = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(q, k, v, block_tables, seq_lens, working, dst, _scale, window, info);
+}
+
+const char *CpuPagedAttentionKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuPagedAttentionKernel::PagedAttentionKernel> &CpuPagedAttentionKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
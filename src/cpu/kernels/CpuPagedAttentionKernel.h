@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUPAGEDATTENTIONKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUPAGEDATTENTIONKERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to compute the decoding attention of a batch of sequences whose keys and values are stored in blocks
+ *
+ * Every sequence has its own length and block table, so sequences of different lengths are computed in one call
+ * without padding. Query heads are mapped to key/value heads in groups, which covers multi-head, grouped-query and
+ * multi-query attention.
+ */
+class CpuPagedAttentionKernel : public ICpuKernel<CpuPagedAttentionKernel>
+{
+private:
+    using PagedAttentionKernelPtr = std::add_pointer<void(const ITensor *,
+                                                          const ITensor *,
+                                                          const ITensor *,
+                                                          const ITensor *,
+                                                          const ITensor *,
+                                                          ITensor *,
+                                                          ITensor *,
+                                                          float,
+                                                          const Window &,
+                                                          const ThreadInfo &)>::type;
+
+public:
+    struct PagedAttentionKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        PagedAttentionKernelPtr      ukernel;
+    };
+
+    CpuPagedAttentionKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuPagedAttentionKernel);
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  q            Queries tensor info with dimensions [head_dim, num_heads, num_seqs].
+     *                          Data types supported: F16/F32.
+     * @param[in]  k            Key blocks tensor info with dimensions [head_dim, block_size, num_kv_heads, num_blocks].
+     *                          num_heads must be a multiple of num_kv_heads. Data type supported: Same as @p q.
+     * @param[in]  v            Value blocks tensor info. Shape and data type supported: Same as @p k.
+     * @param[in]  block_tables Block tables tensor info with dimensions [max_blocks_per_seq, num_seqs].
+     *                          Data type supported: S32.
+     * @param[in]  seq_lens     Sequence lengths tensor info with dimensions [num_seqs]. Data type supported: S32.
+     * @param[out] dst          Destination tensor info. Shape and data type supported: Same as @p q.
+     * @param[in]  scale        Scale applied to the scores before the softmax.
+     */
+    void configure(const ITensorInfo *q,
+                   const ITensorInfo *k,
+                   const ITensorInfo *v,
+                   const ITensorInfo *block_tables,
+                   const ITensorInfo *seq_lens,
+                   ITensorInfo       *dst,
+                   float              scale);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuPagedAttentionKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *q,
+                           const ITensorInfo *k,
+                           const ITensorInfo *v,
+                           const ITensorInfo *block_tables,
+                           const ITensorInfo *seq_lens,
+                           const ITensorInfo *dst,
+                           float              scale);
+
+    /** Size in bytes of the working buffer of a thread
+     *
+     * @param[in] head_dim      Number of channels of every head.
+     * @param[in] max_positions Maximum number of positions of a sequence, i.e. max_blocks_per_seq * block_size.
+     *
+     * @return The size in bytes
+     */
+    static size_t working_size(unsigned int head_dim, unsigned int max_positions);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<PagedAttentionKernel> &get_available_kernels();
+
+private:
+    float                   _scale{1.f};
+    PagedAttentionKernelPtr _run_method{nullptr};
+    std::string             _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUPAGEDATTENTIONKERNEL_H
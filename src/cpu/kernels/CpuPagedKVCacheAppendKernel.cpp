@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuPagedKVCacheAppendKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <cstring>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+Status validate_arguments(const ITensorInfo *src, const ITensorInfo *slots, const ITensorInfo *pool)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, slots, pool);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, pool);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(slots, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON(src->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(pool->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(slots->num_dimensions() > 1);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(0) != pool->dimension(0) || src->dimension(1) != pool->dimension(2),
+                                    "Input and pool must have the same head size and number of heads");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(slots->dimension(0) != src->dimension(2), "One slot is needed per token");
+    return Status{};
+}
+} // namespace
+
+void CpuPagedKVCacheAppendKernel::configure(const ITensorInfo *src, const ITensorInfo *slots, const ITensorInfo *pool)
+{
+    ARM_COMPUTE_UNUSED(slots, pool);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, slots, pool);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, slots, pool));
+
+    // Every window step writes a whole row of a block
+    Window win = calculate_max_window(*src, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuPagedKVCacheAppendKernel::validate(const ITensorInfo *src, const ITensorInfo *slots, const ITensorInfo *pool)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, slots, pool));
+    return Status{};
+}
+
+void CpuPagedKVCacheAppendKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(tensors.empty());
+
+    const ITensor *src   = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *slots = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    ITensor       *pool  = tensors.get_tensor(TensorType::ACL_DST);
+
+    const size_t   row_size   = src->info()->dimension(0) * src->info()->element_size();
+    const int      block_size = static_cast<int>(pool->info()->dimension(1));
+    const Strides &strides    = pool->info()->strides_in_bytes();
+    uint8_t       *pool_base  = pool->buffer() + pool->info()->offset_first_element_in_bytes();
+
+    Iterator src_it(src, window);
+    execute_window_loop(
+        window,
+        [&](const Coordinates &id)
+        {
+            const int slot = *reinterpret_cast<const int32_t *>(slots->ptr_to_element(Coordinates(id.z())));
+            if (slot < 0)
+            {
+                return;
+            }
+            ARM_COMPUTE_ERROR_ON(slot >= block_size * static_cast<int>(pool->info()->dimension(3)));
+
+            uint8_t *dst = pool_base + (slot % block_size) * strides[1] + id.y() * strides[2] +
+                           (slot / block_size) * strides[3];
+            std::memcpy(dst, src_it.ptr(), row_size);
+        },
+        src_it);
+}
+
+const char *CpuPagedKVCacheAppendKernel::name() const
+{
+    return "CpuPagedKVCacheAppendKernel";
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
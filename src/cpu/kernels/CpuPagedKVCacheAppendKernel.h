@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUPAGEDKVCACHEAPPENDKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUPAGEDKVCACHEAPPENDKERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to write the keys or values of new tokens to their slots of a pool of blocks
+ *
+ * The slot of a token is the index of its row among all the rows of the pool, i.e. block * block_size + offset.
+ * Tokens with a negative slot are skipped.
+ */
+class CpuPagedKVCacheAppendKernel : public ICpuKernel<CpuPagedKVCacheAppendKernel>
+{
+public:
+    CpuPagedKVCacheAppendKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuPagedKVCacheAppendKernel);
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in] src   Source tensor info with dimensions [head_dim, num_heads, tokens]. Data types supported: F16/F32.
+     * @param[in] slots Slots tensor info with dimensions [tokens]. Data type supported: S32.
+     * @param[in] pool  Blocks tensor info with dimensions [head_dim, block_size, num_heads, num_blocks].
+     *                  Data type supported: Same as @p src.
+     */
+    void configure(const ITensorInfo *src, const ITensorInfo *slots, const ITensorInfo *pool);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuPagedKVCacheAppendKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *slots, const ITensorInfo *pool);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUPAGEDKVCACHEAPPENDKERNEL_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022 Arm Limited.
+ * Copyright (c) 2018-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,7 +33,10 @@ namespace cpu
 {
 namespace kernels
 {
-/** Kernel to perform tensor permutation given a permutation vector */
+/** Kernel to perform tensor permutation given a permutation vector
+ *
+ * The permutation is run as a batch of cache-blocked 2D transposes, see @ref cpu::blocked_permute.
+ */
 class CpuPermuteKernel : public ICpuKernel<CpuPermuteKernel>
 {
 public:
@@ -41,9 +44,9 @@ public:
     ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuPermuteKernel);
     /** Configure kernel for a given list of arguments
      *
-     * @note Arbitrary permutation vectors are supported with rank not greater than 4
+     * @note Arbitrary permutation vectors are supported with rank not greater than 6
      *
-     * @param[in]  src  Srouce tensor to permute. Data types supported: All
+     * @param[in]  src  Srouce tensor to permute. Data types supported: All with an element size of 1, 2 or 4 bytes
      * @param[out] dst  Destination tensor. Data types supported: Same as @p src
      * @param[in]  perm Permutation vector
      */
@@ -60,8 +63,18 @@ public:
     void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
     const char *name() const override;
 
+    /** Get the preferred dimension in which the scheduler splits the work into multiple jobs.
+     *
+     * @return The split dimension hint.
+     */
+    size_t get_split_dimension_hint() const
+    {
+        return _split_dimension;
+    }
+
 private:
     PermutationVector _perm{};
+    size_t            _split_dimension{Window::DimY};
 };
 } // namespace kernels
 } // namespace cpu
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024 Arm Limited.
+ * Copyright (c) 2017-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -231,7 +231,8 @@ void CpuReshapeKernel::prepare(ITensorPack &tensors)
     const auto src_row_size       = static_cast<int>(src_info->tensor_shape()[0]);
     const auto dst_row_size       = static_cast<int>(dst_info->tensor_shape()[0]);
 
-    if (!src_has_holes && !dst_has_holes)
+    _is_contiguous = !src_has_holes && !dst_has_holes;
+    if (_is_contiguous)
     {
         std::tie(win, _split_dimension) = calculate_squashed_or_max_window(*dst_info);
         /*
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024 Arm Limited.
+ * Copyright (c) 2017-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -83,8 +83,18 @@ public:
         return _split_dimension;
     }
 
+    /** Whether neither the source nor the destination have holes, as computed by @ref prepare
+     *
+     * @return True if both tensors are contiguous
+     */
+    bool is_contiguous() const
+    {
+        return _is_contiguous;
+    }
+
 private:
     size_t _split_dimension{Window::DimY};
+    bool   _is_contiguous{false};
 
     static constexpr std::size_t _reshape_mws = 10'000;
 
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuResizeNormalizeKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/utils/ScaleUtils.h"
+#include "support/Rounding.h"
+
+#include <cmath>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuResizeNormalizeKernel::ResizeNormalizeKernel> available_kernels = {
+    {"neon_fp32_resize_normalize", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_resize_normalize)},
+    {"neon_fp16_resize_normalize",
+     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16 && data.isa.fp16); },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_resize_normalize)},
+    {"neon_qu8_resize_normalize", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8); },
+     REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_qu8_resize_normalize)},
+};
+
+constexpr size_t num_channels = 3;
+
+Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, const ResizeNormalizeInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::U8);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::F16, DataType::F32, DataType::QASYMM8);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->data_layout() != DataLayout::NHWC || dst->data_layout() != DataLayout::NHWC,
+                                    "Only NHWC data layout is supported");
+    ARM_COMPUTE_RETURN_ERROR_ON(src->num_dimensions() > 4 || dst->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(0) != num_channels || dst->dimension(0) != num_channels,
+                                    "Only interleaved 3-channel images are supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->total_size() == 0, "Destination tensor must be initialized");
+    ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(1) == 0 || dst->dimension(2) == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(3) != src->dimension(3));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->has_padding(), "Padding on the destination tensor is not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON(info.interpolation_policy != InterpolationPolicy::NEAREST_NEIGHBOR &&
+                                info.interpolation_policy != InterpolationPolicy::BILINEAR &&
+                                info.interpolation_policy != InterpolationPolicy::AREA);
+    ARM_COMPUTE_RETURN_ERROR_ON(info.sampling_policy != SamplingPolicy::CENTER &&
+                                info.sampling_policy != SamplingPolicy::TOP_LEFT);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->data_type() == DataType::QASYMM8 &&
+                                        dst->quantization_info().uniform().scale == 0.f,
+                                    "Quantized destination requires a non-zero scale");
+
+    const auto uk = CpuResizeNormalizeKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{dst->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+
+/** Map every output coordinate of one dimension to its source range and interpolation weight */
+void compute_sampling_table(InterpolationPolicy   policy,
+                            SamplingPolicy        sampling_policy,
+                            bool                  align_corners,
+                            int                   in_size,
+                            int                   out_size,
+                            std::vector<int32_t> &start,
+                            std::vector<int32_t> &end,
+                            std::vector<float>   &weight)
+{
+    const float ratio     = scale_utils::calculate_resize_ratio(in_size, out_size, align_corners);
+    const bool  is_center = sampling_policy == SamplingPolicy::CENTER;
+
+    start.resize(out_size);
+    end.resize(out_size);
+    weight.resize(out_size);
+
+    for (int o = 0; o < out_size; ++o)
+    {
+        // Area interpolation behaves as nearest neighbour when upsampling
+        if (policy == InterpolationPolicy::NEAREST_NEIGHBOR || (policy == InterpolationPolicy::AREA && ratio <= 1.f))
+        {
+            const float in_coord = is_center ? (o + 0.5f) * ratio : o * ratio;
+            const float rounded  = (!is_center && align_corners) ? utils::rounding::round_half_away_from_zero(in_coord)
+                                                                 : std::floor(in_coord);
+            const int   idx      = utility::clamp<int>(static_cast<int>(rounded), 0, in_size - 1);
+
+            start[o]  = idx;
+            end[o]    = policy == InterpolationPolicy::AREA ? idx + 1 : idx;
+            weight[o] = 1.f;
+        }
+        else if (policy == InterpolationPolicy::BILINEAR)
+        {
+            const float in_coord = is_center ? (o + 0.5f) * ratio - 0.5f : o * ratio;
+            const int   idx      = static_cast<int>(std::floor(in_coord));
+
+            // Out of range neighbours replicate the border
+            start[o]  = utility::clamp<int>(idx, 0, in_size - 1);
+            end[o]    = utility::clamp<int>(idx + 1, 0, in_size - 1);
+            weight[o] = in_coord - idx;
+        }
+        else
+        {
+            const int from = utility::clamp<int>(static_cast<int>(std::floor(o * ratio)), 0, in_size - 1);
+            const int to   = utility::clamp<int>(static_cast<int>(std::ceil((o + 1) * ratio)), from + 1, in_size);
+
+            start[o]  = from;
+            end[o]    = to;
+            weight[o] = 1.f / (to - from);
+        }
+    }
+}
+} // namespace
+
+void CpuResizeNormalizeKernel::configure(const ITensorInfo *src, ITensorInfo *dst, const ResizeNormalizeInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, dst, info));
+
+    const auto uk = CpuResizeNormalizeKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{dst->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuResizeNormalizeKernel/").append(uk->name);
+
+    const bool align_corners =
+        info.align_corners && scale_utils::is_align_corners_allowed_sampling_policy(info.sampling_policy);
+
+    // The sampling positions only depend on the shapes, so they are computed once for all the images
+    _tables.policy = info.interpolation_policy;
+    compute_sampling_table(info.interpolation_policy, info.sampling_policy, align_corners, src->dimension(1),
+                           dst->dimension(1), _tables.x_start, _tables.x_end, _tables.x_weight);
+    compute_sampling_table(info.interpolation_policy, info.sampling_policy, align_corners, src->dimension(2),
+                           dst->dimension(2), _tables.y_start, _tables.y_end, _tables.y_weight);
+
+    // Fold the mean, the scale and, for quantized outputs, the quantization into one multiply-add
+    float q_scale  = 1.f;
+    float q_offset = 0.f;
+    if (dst->data_type() == DataType::QASYMM8)
+    {
+        const UniformQuantizationInfo qinfo = dst->quantization_info().uniform();
+        q_scale                             = 1.f / qinfo.scale;
+        q_offset                            = static_cast<float>(qinfo.offset);
+    }
+    for (size_t c = 0; c < num_channels; ++c)
+    {
+        _tables.channel_map[c] = info.swap_channels ? static_cast<int>(num_channels - 1 - c) : static_cast<int>(c);
+        _tables.scale[c]       = info.scale[c] * q_scale;
+        _tables.offset[c]      = -info.mean[c] * info.scale[c] * q_scale + q_offset;
+    }
+
+    // Output rows of all the images are flattened along Y so that small batches of large images and large batches
+    // of small images both spread evenly over the threads
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, dst->dimension(2) * dst->dimension(3), 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuResizeNormalizeKernel::validate(const ITensorInfo         *src,
+                                          const ITensorInfo         *dst,
+                                          const ResizeNormalizeInfo &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, dst, info));
+    return Status{};
+}
+
+size_t CpuResizeNormalizeKernel::workspace_size_per_thread(const ITensorInfo *dst)
+{
+    // Two horizontally resampled rows
+    return 2 * dst->dimension(1) * num_channels * sizeof(float);
+}
+
+void CpuResizeNormalizeKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(tensors.empty());
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src       = tensors.get_const_tensor(TensorType::ACL_SRC);
+    ITensor       *workspace = tensors.get_tensor(TensorType::ACL_INT_0);
+    ITensor       *dst       = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(src, workspace, dst, _tables, window, info);
+}
+
+const char *CpuResizeNormalizeKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuResizeNormalizeKernel::ResizeNormalizeKernel> &CpuResizeNormalizeKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPURESIZENORMALIZEKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPURESIZENORMALIZEKERNEL_H
+
+#include "arm_compute/function_info/ResizeNormalizeInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+#include "src/cpu/kernels/resizenormalize/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to resize, reorder and normalize interleaved U8 images in a single pass
+ *
+ * Every output row is produced from at most two horizontally resampled source rows kept in a per-thread buffer,
+ * so the resized U8 image and the float intermediate are never written to memory.
+ */
+class CpuResizeNormalizeKernel : public ICpuKernel<CpuResizeNormalizeKernel>
+{
+private:
+    using ResizeNormalizeKernelPtr = std::add_pointer<void(
+        const ITensor *, ITensor *, ITensor *, const ResizeNormalizeTables &, const Window &, const ThreadInfo &)>::type;
+
+public:
+    struct ResizeNormalizeKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        ResizeNormalizeKernelPtr     ukernel;
+    };
+
+    CpuResizeNormalizeKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuResizeNormalizeKernel);
+    /** Initialise the kernel's input and output
+     *
+     * @param[in]  src  Source tensor info with dimensions [3, width, height, batches]. Data type supported: U8.
+     *                  Data layout supported: NHWC.
+     * @param[out] dst  Destination tensor info with dimensions [3, resized width, resized height, batches].
+     *                  Data types supported: F16/F32/QASYMM8. Data layout supported: NHWC.
+     * @param[in]  info Resize and normalization information.
+     */
+    void configure(const ITensorInfo *src, ITensorInfo *dst, const ResizeNormalizeInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuResizeNormalizeKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *dst, const ResizeNormalizeInfo &info);
+
+    /** Size in bytes of the working buffer needed by every thread
+     *
+     * @param[in] dst Destination tensor info.
+     *
+     * @return The size in bytes
+     */
+    static size_t workspace_size_per_thread(const ITensorInfo *dst);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<ResizeNormalizeKernel> &get_available_kernels();
+
+private:
+    ResizeNormalizeTables    _tables{};
+    ResizeNormalizeKernelPtr _run_method{nullptr};
+    std::string              _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPURESIZENORMALIZEKERNEL_H
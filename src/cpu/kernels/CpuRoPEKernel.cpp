@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuRoPEKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/rope/list.h"
+
+#include <cmath>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuRoPEKernel::RoPEKernel> available_kernels = {
+    {"neon_fp32_rope", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_rope)},
+    {"neon_fp16_rope", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16 && data.isa.fp16); },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_rope)},
+};
+
+Status validate_arguments(const ITensorInfo *q,
+                          const ITensorInfo *k,
+                          const ITensorInfo *positions,
+                          const ITensorInfo *q_dst,
+                          const ITensorInfo *k_dst,
+                          const RoPEInfo    &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(q, k, q_dst, k_dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(q);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(q, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(q, k);
+    ARM_COMPUTE_RETURN_ERROR_ON(q->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(k->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(q->dimension(0) != k->dimension(0) || q->dimension(1) != k->dimension(1) ||
+                                        q->dimension(3) != k->dimension(3),
+                                    "Queries and keys must have the same head size, tokens and batches");
+
+    const unsigned int rotary_dim = info.rotary_dim == 0 ? q->dimension(0) : info.rotary_dim;
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(rotary_dim % 2 != 0 || rotary_dim > q->dimension(0),
+                                    "The number of rotated channels must be even and not larger than the head size");
+    ARM_COMPUTE_RETURN_ERROR_ON(!(info.theta_base > 0.f));
+
+    if (positions != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(positions, 1, DataType::S32);
+        ARM_COMPUTE_RETURN_ERROR_ON(positions->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(positions->dimension(0) != q->dimension(1),
+                                        "Positions must have one entry per token");
+    }
+
+    // Validate in case outputs have been initialized
+    if (q_dst->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(q, q_dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(q, q_dst);
+    }
+    if (k_dst->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(k, k_dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(k, k_dst);
+    }
+
+    const auto uk = CpuRoPEKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{q->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+void CpuRoPEKernel::configure(const ITensorInfo *q,
+                              const ITensorInfo *k,
+                              const ITensorInfo *positions,
+                              ITensorInfo       *q_dst,
+                              ITensorInfo       *k_dst,
+                              const RoPEInfo    &info)
+{
+    ARM_COMPUTE_UNUSED(positions);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(q, k, q_dst, k_dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(q, k, positions, q_dst, k_dst, info));
+
+    const auto uk = CpuRoPEKernel::get_implementation<DataTypeISASelectorData>(
+        DataTypeISASelectorData{q->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _info            = info;
+    _info.rotary_dim = info.rotary_dim == 0 ? q->dimension(0) : info.rotary_dim;
+    _run_method      = uk->ukernel;
+    _name            = std::string("CpuRoPEKernel/").append(uk->name);
+
+    // Frequency of every channel pair
+    const unsigned int half = _info.rotary_dim / 2;
+    _inv_freq.resize(half);
+    for (unsigned int i = 0; i < half; ++i)
+    {
+        _inv_freq[i] = std::pow(_info.theta_base, -2.f * static_cast<float>(i) / static_cast<float>(_info.rotary_dim));
+    }
+
+    // Auto initialize outputs if not initialized
+    auto_init_if_empty(*q_dst, *q->clone());
+    auto_init_if_empty(*k_dst, *k->clone());
+
+    // Every window step rotates a token in all the heads
+    Window win;
+    win.use_tensor_dimensions(TensorShape(1U, q->dimension(1), 1U, q->dimension(3)));
+    ICpuKernel::configure(win);
+}
+
+Status CpuRoPEKernel::validate(const ITensorInfo *q,
+                               const ITensorInfo *k,
+                               const ITensorInfo *positions,
+                               const ITensorInfo *q_dst,
+                               const ITensorInfo *k_dst,
+                               const RoPEInfo    &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(q, k, positions, q_dst, k_dst, info));
+    return Status{};
+}
+
+void CpuRoPEKernel::set_position_offset(int position_offset)
+{
+    _info.position_offset = position_offset;
+}
+
+size_t CpuRoPEKernel::table_size() const
+{
+    return static_cast<size_t>(_info.max_positions) * _info.rotary_dim * sizeof(float);
+}
+
+size_t CpuRoPEKernel::working_size() const
+{
+    return _info.rotary_dim * sizeof(float);
+}
+
+void CpuRoPEKernel::fill_table(ITensor *table) const
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(table);
+    ARM_COMPUTE_ERROR_ON(table->info()->total_size() < table_size());
+
+    const unsigned int half = _info.rotary_dim / 2;
+    auto *row = reinterpret_cast<float *>(table->buffer() + table->info()->offset_first_element_in_bytes());
+    for (unsigned int p = 0; p < _info.max_positions; ++p, row += _info.rotary_dim)
+    {
+        for (unsigned int i = 0; i < half; ++i)
+        {
+            const float angle = static_cast<float>(p) * _inv_freq[i];
+            row[i]            = std::cos(angle);
+            row[half + i]     = std::sin(angle);
+        }
+    }
+}
+
+void CpuRoPEKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(tensors.empty());
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *q         = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *k         = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *positions = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *table     = tensors.get_const_tensor(TensorType::ACL_INT_0);
+    ITensor       *working   = tensors.get_tensor(TensorType::ACL_INT_1);
+    ITensor       *q_dst     = tensors.get_tensor(TensorType::ACL_DST_0);
+    ITensor       *k_dst     = tensors.get_tensor(TensorType::ACL_DST_1);
+
+    _run_method(q, k, positions, table, working, q_dst, k_dst, _inv_freq.data(), _info, window, info);
+}
+
+const char *CpuRoPEKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuRoPEKernel::RoPEKernel> &CpuRoPEKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUROPEKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUROPEKERNEL_H
+
+#include "arm_compute/function_info/RoPEInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to apply a rotary position embedding to queries and keys
+ *
+ * Every window step computes the sines and cosines of a token once, or reads them from the precomputed table, and
+ * rotates the token in all the query and key heads, so both tensors are processed in a single pass.
+ */
+class CpuRoPEKernel : public ICpuKernel<CpuRoPEKernel>
+{
+private:
+    using RoPEKernelPtr = std::add_pointer<void(const ITensor *,
+                                                const ITensor *,
+                                                const ITensor *,
+                                                const ITensor *,
+                                                ITensor *,
+                                                ITensor *,
+                                                ITensor *,
+                                                const float *,
+                                                const RoPEInfo &,
+                                                const Window &,
+                                                const ThreadInfo &)>::type;
+
+public:
+    struct RoPEKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        RoPEKernelPtr                ukernel;
+    };
+
+    CpuRoPEKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuRoPEKernel);
+    /** Initialise the kernel's inputs and outputs
+     *
+     * @param[in]  q         Queries tensor info with dimensions [head_dim, tokens, num_heads, batches].
+     *                       Data types supported: F16/F32.
+     * @param[in]  k         Keys tensor info with dimensions [head_dim, tokens, num_kv_heads, batches].
+     *                       Data type supported: Same as @p q.
+     * @param[in]  positions (Optional) Positions tensor info with dimensions [tokens], added to
+     *                       @p info.position_offset. Can be nullptr to use the token index. Data type supported: S32.
+     * @param[out] q_dst     Rotated queries tensor info. Can be @p q. Shape and data type supported: Same as @p q.
+     * @param[out] k_dst     Rotated keys tensor info. Can be @p k. Shape and data type supported: Same as @p k.
+     * @param[in]  info      Rotary position embedding information.
+     */
+    void configure(const ITensorInfo *q,
+                   const ITensorInfo *k,
+                   const ITensorInfo *positions,
+                   ITensorInfo       *q_dst,
+                   ITensorInfo       *k_dst,
+                   const RoPEInfo    &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuRoPEKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *q,
+                           const ITensorInfo *k,
+                           const ITensorInfo *positions,
+                           const ITensorInfo *q_dst,
+                           const ITensorInfo *k_dst,
+                           const RoPEInfo    &info);
+
+    /** Set the position of the first token used by the next runs
+     *
+     * @param[in] position_offset Position of the first token.
+     */
+    void set_position_offset(int position_offset);
+    /** Size in bytes of the precomputed table, or 0 if the sines and cosines are computed on the fly */
+    size_t table_size() const;
+    /** Size in bytes of the working buffer of a thread */
+    size_t working_size() const;
+    /** Compute the table of sines and cosines
+     *
+     * Every row holds the cosines followed by the sines of the rotary_dim / 2 angles of a position.
+     *
+     * @param[out] table Destination buffer of at least @ref table_size bytes.
+     */
+    void fill_table(ITensor *table) const;
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<RoPEKernel> &get_available_kernels();
+
+private:
+    RoPEInfo           _info{};
+    std::vector<float> _inv_freq{};
+    RoPEKernelPtr      _run_method{nullptr};
+    std::string        _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUROPEKERNEL_H
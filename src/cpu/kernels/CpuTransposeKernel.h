@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,7 +33,10 @@ namespace cpu
 {
 namespace kernels
 {
-/** Kernel which transposes the elements of a matrix */
+/** Kernel which transposes the elements of a matrix
+ *
+ * The matrices are transposed in cache blocks, see @ref cpu::blocked_permute.
+ */
 class CpuTransposeKernel : public ICpuKernel<CpuTransposeKernel>
 {
 public:
@@ -56,6 +59,18 @@ public:
     // Inherited methods overridden:
     void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
     const char *name() const override;
+
+    /** Get the preferred dimension in which the scheduler splits the work into multiple jobs.
+     *
+     * @return The split dimension hint.
+     */
+    size_t get_split_dimension_hint() const
+    {
+        return _split_dimension;
+    }
+
+private:
+    size_t _split_dimension{Window::DimY};
 };
 } // namespace kernels
 } // namespace cpu
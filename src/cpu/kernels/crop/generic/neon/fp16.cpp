@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -42,6 +42,17 @@ void fp16_in_bounds_crop_window(const ITensor *input,
     return in_bounds_crop_window<float16_t>(input, output, output_ptr, input_offset, window_step_x, output_width_start,
                                             output_width_limit, input_has_single_channel, is_width_flipped);
 }
+
+void fp16_crop_resize(const ITensor      *input,
+                      const ITensor      *boxes,
+                      const ITensor      *box_ind,
+                      ITensor            *output,
+                      InterpolationPolicy method,
+                      float               extrapolation_value,
+                      const Window       &window)
+{
+    return crop_resize<float16_t>(input, boxes, box_ind, output, method, extrapolation_value, window);
+}
 } // namespace cpu
 } // namespace arm_compute
 #endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
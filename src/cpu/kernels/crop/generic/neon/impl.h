@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,6 +31,10 @@
 #include "src/core/NEON/wrapper/wrapper.h"
 #include "src/cpu/kernels/crop/generic/neon/crop_helper.h"
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 namespace arm_compute
 {
 namespace cpu
@@ -119,6 +123,175 @@ void in_bounds_crop_window(const ITensor *input,
         }
     }
 }
+
+/** Neighbours of one output column or row of a crop and resize */
+struct CropResizeAxisSample
+{
+    int32_t in0;    /**< Input coordinate of the first neighbour, -1 if it is out of the box or of the input */
+    int32_t in1;    /**< Input coordinate of the second neighbour, -1 if it is out of the box or of the input */
+    float   weight; /**< Weight of the second neighbour */
+};
+
+/** Compute the neighbours of every output column or row of a crop box
+ *
+ * @param[in]  start       Inclusive start coordinate of the box.
+ * @param[in]  end         Inclusive end coordinate of the box, lower than @p start if the box is flipped.
+ * @param[in]  input_size  Size of the input along the axis.
+ * @param[in]  output_size Size of the output along the axis.
+ * @param[in]  method      Interpolation policy.
+ * @param[out] samples     Neighbours of every output coordinate.
+ */
+inline void compute_crop_resize_axis(int32_t                            start,
+                                     int32_t                            end,
+                                     int32_t                            input_size,
+                                     int32_t                            output_size,
+                                     InterpolationPolicy                method,
+                                     std::vector<CropResizeAxisSample> &samples)
+{
+    const int32_t crop_size = std::abs(end - start) + 1;
+    const float   ratio     = static_cast<float>(crop_size) / static_cast<float>(output_size);
+    const auto    to_input  = [&](int32_t c)
+    {
+        const int32_t in = end < start ? start - c : start + c;
+        return (c < crop_size && in >= 0 && in < input_size) ? in : -1;
+    };
+
+    samples.resize(output_size);
+    for (int32_t o = 0; o < output_size; ++o)
+    {
+        const float   pos = o * ratio;
+        const int32_t c   = static_cast<int32_t>(std::floor(pos));
+        if (method == InterpolationPolicy::BILINEAR)
+        {
+            samples[o] = CropResizeAxisSample{to_input(c), to_input(c + 1), pos - c};
+        }
+        else
+        {
+            samples[o] = CropResizeAxisSample{to_input(c), -1, 0.f};
+        }
+    }
+}
+
+/** Blend up to four channel vectors of the input into an output pixel
+ *
+ * @param[out] dst          Output pixel.
+ * @param[in]  src          Pointers to the channels of the neighbours inside the input.
+ * @param[in]  weights      Weights of the neighbours inside the input.
+ * @param[in]  num_src      Number of neighbours inside the input.
+ * @param[in]  constant     Weighted extrapolation value of the neighbours outside of the input.
+ * @param[in]  num_channels Number of channels.
+ */
+template <typename T>
+void crop_resize_blend(
+    float *dst, T *const *src, const float *weights, int num_src, float constant, int32_t num_channels)
+{
+    // Narrow types are loaded 8 bytes at a time
+    constexpr int32_t window_step_x = 4;
+    constexpr int32_t load_size     = std::max<int32_t>(window_step_x, 8 / sizeof(T));
+
+    int32_t c = 0;
+    for (; c + load_size <= num_channels; c += window_step_x)
+    {
+        auto acc = wrapper::vdup_n(constant, wrapper::traits::vector_128_tag());
+        for (int i = 0; i < num_src; ++i)
+        {
+            const auto w = wrapper::vdup_n(weights[i], wrapper::traits::vector_128_tag());
+            acc          = wrapper::vmla(acc, load_as_f32(src[i] + c), w);
+        }
+        wrapper::vstore(dst + c, acc);
+    }
+    for (; c < num_channels; ++c)
+    {
+        float acc = constant;
+        for (int i = 0; i < num_src; ++i)
+        {
+            acc += weights[i] * static_cast<float>(src[i][c]);
+        }
+        dst[c] = acc;
+    }
+}
+
+/** Crop and resize a window of output rows of any boxes
+ *
+ * The neighbours and weights of every output column and row only depend on the box, so they are computed once per
+ * box and every output pixel blends whole channel vectors of the input. The cropped image is never materialised.
+ */
+template <typename T>
+void crop_resize(const ITensor      *input,
+                 const ITensor      *boxes,
+                 const ITensor      *box_ind,
+                 ITensor            *output,
+                 InterpolationPolicy method,
+                 float               extrapolation_value,
+                 const Window       &window)
+{
+    const ITensorInfo &in_info      = *input->info();
+    const ITensorInfo &out_info     = *output->info();
+    const int32_t      num_channels = out_info.dimension(0);
+    const int32_t      out_width    = out_info.dimension(1);
+    const int32_t      out_height   = out_info.dimension(2);
+    const int32_t      in_width     = in_info.dimension(1);
+    const int32_t      in_height    = in_info.dimension(2);
+    const Strides     &in_stride    = in_info.strides_in_bytes();
+    const Strides     &out_stride   = out_info.strides_in_bytes();
+
+    std::vector<CropResizeAxisSample> samples_x;
+    std::vector<CropResizeAxisSample> samples_y;
+
+    for (int32_t b = window[Window::DimW].start(); b < window[Window::DimW].end(); ++b)
+    {
+        // The crop box is specified by normalized coordinates [y0, x0, y1, x1], rounded to the nearest pixel
+        const float x0 = *reinterpret_cast<const float *>(boxes->ptr_to_element(Coordinates(1, b)));
+        const float y0 = *reinterpret_cast<const float *>(boxes->ptr_to_element(Coordinates(0, b)));
+        const float x1 = *reinterpret_cast<const float *>(boxes->ptr_to_element(Coordinates(3, b)));
+        const float y1 = *reinterpret_cast<const float *>(boxes->ptr_to_element(Coordinates(2, b)));
+        compute_crop_resize_axis(std::floor(x0 * (in_width - 1) + 0.5f), std::floor(x1 * (in_width - 1) + 0.5f),
+                                 in_width, out_width, method, samples_x);
+        compute_crop_resize_axis(std::floor(y0 * (in_height - 1) + 0.5f), std::floor(y1 * (in_height - 1) + 0.5f),
+                                 in_height, out_height, method, samples_y);
+
+        const int32_t batch_index = *reinterpret_cast<const int32_t *>(box_ind->ptr_to_element(Coordinates(b)));
+        uint8_t *in_base  = input->buffer() + in_info.offset_first_element_in_bytes() + batch_index * in_stride[3];
+        uint8_t *out_base = output->buffer() + out_info.offset_first_element_in_bytes() + b * out_stride[3];
+
+        for (int32_t y = window.z().start(); y < window.z().end(); ++y)
+        {
+            const CropResizeAxisSample &sy = samples_y[y];
+            for (int32_t x = 0; x < out_width; ++x)
+            {
+                const CropResizeAxisSample &sx = samples_x[x];
+
+                const int32_t rows[4]    = {sy.in0, sy.in0, sy.in1, sy.in1};
+                const int32_t cols[4]    = {sx.in0, sx.in1, sx.in0, sx.in1};
+                const float   weights[4] = {(1.f - sx.weight) * (1.f - sy.weight), sx.weight * (1.f - sy.weight),
+                                            (1.f - sx.weight) * sy.weight, sx.weight * sy.weight};
+
+                T    *src[4];
+                float src_weights[4];
+                int   num_src  = 0;
+                float constant = 0.f;
+                for (int i = 0; i < 4; ++i)
+                {
+                    if (weights[i] == 0.f)
+                    {
+                        continue;
+                    }
+                    if (rows[i] < 0 || cols[i] < 0)
+                    {
+                        constant += weights[i] * extrapolation_value;
+                        continue;
+                    }
+                    src[num_src] = reinterpret_cast<T *>(in_base + rows[i] * in_stride[2] + cols[i] * in_stride[1]);
+                    src_weights[num_src] = weights[i];
+                    ++num_src;
+                }
+
+                crop_resize_blend(reinterpret_cast<float *>(out_base + y * out_stride[2] + x * out_stride[1]), src,
+                                  src_weights, num_src, constant, num_channels);
+            }
+        }
+    }
+}
 } // namespace cpu
 } // namespace arm_compute
 #endif //SRC_CORE_NEON_KERNELS_CROP_IMPL_H
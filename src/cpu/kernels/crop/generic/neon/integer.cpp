@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -112,5 +112,60 @@ void s32_in_bounds_crop_window(const ITensor *input,
     return in_bounds_crop_window<int32_t>(input, output, output_ptr, input_offset, window_step_x, output_width_start,
                                           output_width_limit, input_has_single_channel, is_width_flipped);
 }
+
+void u8_crop_resize(const ITensor      *input,
+                    const ITensor      *boxes,
+                    const ITensor      *box_ind,
+                    ITensor            *output,
+                    InterpolationPolicy method,
+                    float               extrapolation_value,
+                    const Window       &window)
+{
+    return crop_resize<uint8_t>(input, boxes, box_ind, output, method, extrapolation_value, window);
+}
+
+void u16_crop_resize(const ITensor      *input,
+                     const ITensor      *boxes,
+                     const ITensor      *box_ind,
+                     ITensor            *output,
+                     InterpolationPolicy method,
+                     float               extrapolation_value,
+                     const Window       &window)
+{
+    return crop_resize<uint16_t>(input, boxes, box_ind, output, method, extrapolation_value, window);
+}
+
+void u32_crop_resize(const ITensor      *input,
+                     const ITensor      *boxes,
+                     const ITensor      *box_ind,
+                     ITensor            *output,
+                     InterpolationPolicy method,
+                     float               extrapolation_value,
+                     const Window       &window)
+{
+    return crop_resize<uint32_t>(input, boxes, box_ind, output, method, extrapolation_value, window);
+}
+
+void s16_crop_resize(const ITensor      *input,
+                     const ITensor      *boxes,
+                     const ITensor      *box_ind,
+                     ITensor            *output,
+                     InterpolationPolicy method,
+                     float               extrapolation_value,
+                     const Window       &window)
+{
+    return crop_resize<int16_t>(input, boxes, box_ind, output, method, extrapolation_value, window);
+}
+
+void s32_crop_resize(const ITensor      *input,
+                     const ITensor      *boxes,
+                     const ITensor      *box_ind,
+                     ITensor            *output,
+                     InterpolationPolicy method,
+                     float               extrapolation_value,
+                     const Window       &window)
+{
+    return crop_resize<int32_t>(input, boxes, box_ind, output, method, extrapolation_value, window);
+}
 } // namespace cpu
 } // namespace arm_compute
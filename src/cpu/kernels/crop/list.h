@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -51,6 +51,20 @@ DECLARE_CROP_KERNEL(u32_in_bounds_crop_window);
 
 #undef DECLARE_CROP_KERNEL
 
+#define DECLARE_CROP_RESIZE_KERNEL(func_name)                                                           \
+    void func_name(const ITensor *input, const ITensor *boxes, const ITensor *box_ind, ITensor *output, \
+                   InterpolationPolicy method, float extrapolation_value, const Window &window)
+
+DECLARE_CROP_RESIZE_KERNEL(fp16_crop_resize);
+DECLARE_CROP_RESIZE_KERNEL(fp32_crop_resize);
+DECLARE_CROP_RESIZE_KERNEL(s16_crop_resize);
+DECLARE_CROP_RESIZE_KERNEL(s32_crop_resize);
+DECLARE_CROP_RESIZE_KERNEL(u8_crop_resize);
+DECLARE_CROP_RESIZE_KERNEL(u16_crop_resize);
+DECLARE_CROP_RESIZE_KERNEL(u32_crop_resize);
+
+#undef DECLARE_CROP_RESIZE_KERNEL
+
 } // namespace cpu
 } // namespace arm_compute
 #endif //SRC_CORE_NEON_KERNELS_CROP_LIST_H
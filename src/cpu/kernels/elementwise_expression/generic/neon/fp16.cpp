@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#if defined(__aarch64__) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+
+#include "src/cpu/kernels/elementwise_expression/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp16_elementwise_expression(const std::vector<const ITensor *> &srcs,
+                                      ITensor                            *dst,
+                                      const ElementwiseExpressionInfo    &info,
+                                      const Window                       &window)
+{
+    // F16 is involved on at least one side, the other one can be F32 when the expression ends with a cast
+    const bool is_f16_src = srcs[0]->info()->data_type() == DataType::F16;
+    const bool is_f16_dst = dst->info()->data_type() == DataType::F16;
+    if (is_f16_src && is_f16_dst)
+    {
+        elementwise_expression_neon<float16_t, float16_t>(srcs, dst, info, window);
+    }
+    else if (is_f16_src)
+    {
+        elementwise_expression_neon<float16_t, float>(srcs, dst, info, window);
+    }
+    else
+    {
+        elementwise_expression_neon<float, float16_t>(srcs, dst, info, window);
+    }
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif /* defined(__aarch64__) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
@@ -0,0 +1,387 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_ELEMENTWISE_EXPRESSION_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_ELEMENTWISE_EXPRESSION_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/ElementwiseExpressionInfo.h"
+
+#include "src/core/NEON/NEMath.h"
+#include "src/core/NEON/wrapper/wrapper.h"
+#include "src/cpu/kernels/elementwise_expression/list.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <type_traits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Number of elements of a row evaluated at once, so that all the values of an expression stay in the L1 cache */
+constexpr int elementwise_expression_block_size = 64;
+
+/** Constant parameters of an expression node */
+struct ElementwiseExpressionParams
+{
+    float32x4_t a; /**< First parameter of the activation function */
+    float32x4_t b; /**< Second parameter of the activation function */
+};
+
+/** Evaluation of an expression node over a block of values, whose length is a multiple of the vector length */
+using ElementwiseExpressionStepPtr =
+    std::add_pointer<void(const float *, const float *, float *, int, const ElementwiseExpressionParams &)>::type;
+
+#define ELEMENTWISE_EXPRESSION_FUNCTOR(name, expression)                                                    \
+    struct name                                                                                             \
+    {                                                                                                       \
+        static inline float32x4_t apply(float32x4_t x, float32x4_t y, const ElementwiseExpressionParams &p) \
+        {                                                                                                   \
+            ARM_COMPUTE_UNUSED(x, y, p);                                                                    \
+            return expression;                                                                              \
+        }                                                                                                   \
+    };
+
+// Binary operations
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprAdd, wrapper::vadd(x, y))
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprSub, wrapper::vsub(x, y))
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprMul, wrapper::vmul(x, y))
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprDiv, wrapper::vdiv(x, y))
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprMax, wrapper::vmax(x, y))
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprMin, wrapper::vmin(x, y))
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprSquaredDiff, wrapper::vmul(wrapper::vsub(x, y), wrapper::vsub(x, y)))
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprPower, wrapper::vpow(x, y))
+
+// Unary operations
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprNeg, wrapper::vneg(x))
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprAbs, wrapper::vabs(x))
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprExp, wrapper::vexpq(x))
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprLog, wrapper::vlog(x))
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprRsqrt, wrapper::vinvsqrt(x))
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprSin, wrapper::vsin(x))
+
+// Activation functions, matching the ones of CpuActivationKernel
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprIdentity, x)
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprRelu, wrapper::vmax(vdupq_n_f32(0.f), x))
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprBoundedRelu, wrapper::vmin(p.a, wrapper::vmax(vdupq_n_f32(0.f), x)))
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprLuBoundedRelu, wrapper::vmin(p.a, wrapper::vmax(p.b, x)))
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprLeakyRelu,
+                               wrapper::vbsl(wrapper::vcgt(x, vdupq_n_f32(0.f)), x, wrapper::vmul(p.a, x)))
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprLogistic,
+                               wrapper::vinv(wrapper::vadd(vdupq_n_f32(1.f), wrapper::vexpq(wrapper::vneg(x)))))
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprTanh, wrapper::vmul(p.a, wrapper::vtanh(wrapper::vmul(p.b, x))))
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprLinear, wrapper::vmla(p.b, p.a, x))
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprSquare, wrapper::vmul(x, x))
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprSqrt, wrapper::vsqrt(x))
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprSoftRelu,
+                               wrapper::vbsl(wrapper::vcgt(x, vdupq_n_f32(12.f)),
+                                             x,
+                                             wrapper::vlog(wrapper::vadd(vdupq_n_f32(1.f), wrapper::vexpq(x)))))
+ELEMENTWISE_EXPRESSION_FUNCTOR(EltExprElu,
+                               wrapper::vbsl(wrapper::vcge(x, vdupq_n_f32(0.f)),
+                                             x,
+                                             wrapper::vmul(p.a, wrapper::vsub(wrapper::vexpq(x), vdupq_n_f32(1.f)))))
+ELEMENTWISE_EXPRESSION_FUNCTOR(
+    EltExprHardSwish,
+    wrapper::vmul(x,
+                  wrapper::vmul(vdupq_n_f32(0.166666667f),
+                                wrapper::vmin(vdupq_n_f32(6.f),
+                                              wrapper::vmax(vdupq_n_f32(0.f), wrapper::vadd(x, vdupq_n_f32(3.f)))))))
+ELEMENTWISE_EXPRESSION_FUNCTOR(
+    EltExprSwish,
+    wrapper::vmul(x,
+                  wrapper::vinv(wrapper::vadd(vdupq_n_f32(1.f), wrapper::vexpq(wrapper::vneg(wrapper::vmul(p.a, x)))))))
+ELEMENTWISE_EXPRESSION_FUNCTOR(
+    EltExprGelu,
+    wrapper::vmul(x,
+                  wrapper::vmul(vdupq_n_f32(0.5f),
+                                wrapper::vadd(vdupq_n_f32(1.f),
+                                              wrapper::verf(wrapper::vmul(x, vdupq_n_f32(0.707106781f)))))))
+
+#undef ELEMENTWISE_EXPRESSION_FUNCTOR
+
+template <typename Op>
+void elementwise_expression_step(
+    const float *lhs, const float *rhs, float *dst, int len, const ElementwiseExpressionParams &params)
+{
+    for (int x = 0; x < len; x += 4)
+    {
+        vst1q_f32(dst + x, Op::apply(vld1q_f32(lhs + x), vld1q_f32(rhs + x), params));
+    }
+}
+
+inline ElementwiseExpressionStepPtr get_elementwise_expression_activation_step(const ActivationLayerInfo &act_info)
+{
+    using ActFunction = ActivationLayerInfo::ActivationFunction;
+    if (!act_info.enabled())
+    {
+        return &elementwise_expression_step<EltExprIdentity>;
+    }
+    switch (act_info.activation())
+    {
+        case ActFunction::IDENTITY:
+            return &elementwise_expression_step<EltExprIdentity>;
+        case ActFunction::RELU:
+            return &elementwise_expression_step<EltExprRelu>;
+        case ActFunction::BOUNDED_RELU:
+            return &elementwise_expression_step<EltExprBoundedRelu>;
+        case ActFunction::LU_BOUNDED_RELU:
+            return &elementwise_expression_step<EltExprLuBoundedRelu>;
+        case ActFunction::LEAKY_RELU:
+            return &elementwise_expression_step<EltExprLeakyRelu>;
+        case ActFunction::LOGISTIC:
+            return &elementwise_expression_step<EltExprLogistic>;
+        case ActFunction::TANH:
+            return &elementwise_expression_step<EltExprTanh>;
+        case ActFunction::LINEAR:
+            return &elementwise_expression_step<EltExprLinear>;
+        case ActFunction::ABS:
+            return &elementwise_expression_step<EltExprAbs>;
+        case ActFunction::SQUARE:
+            return &elementwise_expression_step<EltExprSquare>;
+        case ActFunction::SQRT:
+            return &elementwise_expression_step<EltExprSqrt>;
+        case ActFunction::SOFT_RELU:
+            return &elementwise_expression_step<EltExprSoftRelu>;
+        case ActFunction::ELU:
+            return &elementwise_expression_step<EltExprElu>;
+        case ActFunction::HARD_SWISH:
+            return &elementwise_expression_step<EltExprHardSwish>;
+        case ActFunction::SWISH:
+            return &elementwise_expression_step<EltExprSwish>;
+        case ActFunction::GELU:
+            return &elementwise_expression_step<EltExprGelu>;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported activation function");
+    }
+}
+
+inline ElementwiseExpressionStepPtr get_elementwise_expression_step(const ElementwiseExpressionNode &node)
+{
+    switch (node.op)
+    {
+        case ElementwiseExpressionOp::ADD:
+            return &elementwise_expression_step<EltExprAdd>;
+        case ElementwiseExpressionOp::SUB:
+            return &elementwise_expression_step<EltExprSub>;
+        case ElementwiseExpressionOp::MUL:
+            return &elementwise_expression_step<EltExprMul>;
+        case ElementwiseExpressionOp::DIV:
+            return &elementwise_expression_step<EltExprDiv>;
+        case ElementwiseExpressionOp::MAX:
+            return &elementwise_expression_step<EltExprMax>;
+        case ElementwiseExpressionOp::MIN:
+            return &elementwise_expression_step<EltExprMin>;
+        case ElementwiseExpressionOp::SQUARED_DIFF:
+            return &elementwise_expression_step<EltExprSquaredDiff>;
+        case ElementwiseExpressionOp::POWER:
+            return &elementwise_expression_step<EltExprPower>;
+        case ElementwiseExpressionOp::NEG:
+            return &elementwise_expression_step<EltExprNeg>;
+        case ElementwiseExpressionOp::ABS:
+            return &elementwise_expression_step<EltExprAbs>;
+        case ElementwiseExpressionOp::EXP:
+            return &elementwise_expression_step<EltExprExp>;
+        case ElementwiseExpressionOp::LOG:
+            return &elementwise_expression_step<EltExprLog>;
+        case ElementwiseExpressionOp::RSQRT:
+            return &elementwise_expression_step<EltExprRsqrt>;
+        case ElementwiseExpressionOp::SIN:
+            return &elementwise_expression_step<EltExprSin>;
+        case ElementwiseExpressionOp::ACTIVATION:
+            return get_elementwise_expression_activation_step(node.act_info);
+        default:
+            ARM_COMPUTE_ERROR("Unsupported elementwise expression operation");
+    }
+}
+
+inline void elementwise_expression_load(const float *src, float *dst, int len)
+{
+    std::memcpy(dst, src, len * sizeof(float));
+}
+
+inline void elementwise_expression_store(const float *src, float *dst, int len)
+{
+    std::memcpy(dst, src, len * sizeof(float));
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+inline void elementwise_expression_load(const float16_t *src, float *dst, int len)
+{
+    int x = 0;
+    for (; x <= len - 4; x += 4)
+    {
+        vst1q_f32(dst + x, vcvt_f32_f16(vld1_f16(src + x)));
+    }
+    for (; x < len; ++x)
+    {
+        dst[x] = static_cast<float>(src[x]);
+    }
+}
+
+inline void elementwise_expression_store(const float *src, float16_t *dst, int len)
+{
+    int x = 0;
+    for (; x <= len - 4; x += 4)
+    {
+        vst1_f16(dst + x, vcvt_f16_f32(vld1q_f32(src + x)));
+    }
+    for (; x < len; ++x)
+    {
+        dst[x] = static_cast<float16_t>(src[x]);
+    }
+}
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+/** Evaluate an elementwise expression in a single pass over the destination
+ *
+ * Every row is evaluated block by block in F32: the inputs of a block are read in place or converted, then every node
+ * writes its block of values, the result being written straight to the destination when possible. No intermediate
+ * value of the expression goes through memory beyond the blocks, which stay in the L1 cache.
+ */
+template <typename TIn, typename TOut>
+void elementwise_expression_neon(const std::vector<const ITensor *> &srcs,
+                                 ITensor                            *dst,
+                                 const ElementwiseExpressionInfo    &info,
+                                 const Window                       &window)
+{
+    constexpr int      block_size = elementwise_expression_block_size;
+    constexpr bool     is_f32_src = std::is_same<TIn, float>::value;
+    constexpr bool     is_f32_dst = std::is_same<TOut, float>::value;
+    constexpr size_t   max_values = elementwise_expression_max_inputs + elementwise_expression_max_nodes;
+    constexpr size_t   max_dims   = Coordinates::num_max_dimensions;
+    const unsigned int num_inputs = info.num_inputs();
+    const auto        &nodes      = info.nodes();
+    const unsigned int num_nodes  = nodes.size();
+    const unsigned int result     = num_inputs + num_nodes - 1;
+
+    // Resolve the operation of every node once
+    std::array<ElementwiseExpressionStepPtr, elementwise_expression_max_nodes> steps{};
+    std::array<ElementwiseExpressionParams, elementwise_expression_max_nodes>  params{};
+    for (unsigned int n = 0; n < num_nodes; ++n)
+    {
+        steps[n]  = get_elementwise_expression_step(nodes[n]);
+        params[n] = ElementwiseExpressionParams{vdupq_n_f32(nodes[n].act_info.a()),
+                                                vdupq_n_f32(nodes[n].act_info.b())};
+    }
+
+    // Strides of the inputs, null along their broadcast dimensions
+    std::array<std::array<size_t, max_dims>, elementwise_expression_max_inputs> src_strides{};
+    std::array<bool, elementwise_expression_max_inputs>                         is_broadcast_x{};
+    for (unsigned int i = 0; i < num_inputs; ++i)
+    {
+        const ITensorInfo *src_info = srcs[i]->info();
+        for (size_t d = 0; d < max_dims; ++d)
+        {
+            src_strides[i][d] = src_info->dimension(d) > 1 ? src_info->strides_in_bytes()[d] : 0;
+        }
+        is_broadcast_x[i] = src_info->dimension(0) == 1;
+    }
+
+    // Blocks of the values that are not read or written in place
+    float                                                      blocks[max_values * block_size];
+    std::array<const float *, max_values>                      values{};
+    std::array<const TIn *, elementwise_expression_max_inputs> rows{};
+
+    const int x_start = window.x().start();
+    const int x_end   = window.x().end();
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    Iterator out(dst, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            for (unsigned int i = 0; i < num_inputs; ++i)
+            {
+                size_t offset = srcs[i]->info()->offset_first_element_in_bytes();
+                for (size_t d = 1; d < max_dims; ++d)
+                {
+                    offset += id[d] * src_strides[i][d];
+                }
+                rows[i] = reinterpret_cast<const TIn *>(srcs[i]->buffer() + offset);
+
+                // Inputs broadcast along the row are splat once
+                if (is_broadcast_x[i])
+                {
+                    float value = 0.f;
+                    elementwise_expression_load(rows[i], &value, 1);
+                    std::fill_n(blocks + i * block_size, block_size, value);
+                    values[i] = blocks + i * block_size;
+                }
+            }
+
+            auto out_ptr = reinterpret_cast<TOut *>(out.ptr());
+            for (int x = x_start; x < x_end; x += block_size)
+            {
+                // Nodes run on whole vectors: partial blocks are padded in the local blocks
+                const int  len      = std::min(block_size, x_end - x);
+                const int  padded   = (len + 3) & ~3;
+                const bool in_place = len == padded;
+
+                for (unsigned int i = 0; i < num_inputs; ++i)
+                {
+                    if (is_broadcast_x[i])
+                    {
+                        continue;
+                    }
+                    if (is_f32_src && in_place)
+                    {
+                        values[i] = reinterpret_cast<const float *>(rows[i] + x);
+                    }
+                    else
+                    {
+                        float *block = blocks + i * block_size;
+                        elementwise_expression_load(rows[i] + x, block, len);
+                        std::fill(block + len, block + padded, 0.f);
+                        values[i] = block;
+                    }
+                }
+
+                const bool is_direct_dst = is_f32_dst && in_place;
+                for (unsigned int n = 0; n < num_nodes; ++n)
+                {
+                    const unsigned int v     = num_inputs + n;
+                    float             *block = (v == result && is_direct_dst) ? reinterpret_cast<float *>(out_ptr + x)
+                                                                               : blocks + v * block_size;
+                    steps[n](values[nodes[n].lhs], values[nodes[n].rhs], block, padded, params[n]);
+                    values[v] = block;
+                }
+
+                if (!is_direct_dst)
+                {
+                    elementwise_expression_store(values[result], out_ptr + x, len);
+                }
+            }
+        },
+        out);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_ELEMENTWISE_EXPRESSION_GENERIC_NEON_IMPL_H
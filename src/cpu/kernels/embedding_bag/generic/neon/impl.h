@@ -0,0 +1,418 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_EMBEDDING_BAG_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_EMBEDDING_BAG_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/EmbeddingBagInfo.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Maximum number of bytes of a row prefetched ahead, the hardware prefetcher following on for longer rows */
+constexpr size_t embedding_bag_max_prefetch_size = 512;
+
+/** Prefetch the leading cache lines of a row */
+inline void embedding_bag_prefetch(const uint8_t *ptr, size_t size)
+{
+    const size_t end = std::min(size, embedding_bag_max_prefetch_size);
+    for (size_t offset = 0; offset < end; offset += 64)
+    {
+        __builtin_prefetch(ptr + offset);
+    }
+}
+
+/** Add a row of floats to an accumulator */
+inline void embedding_bag_accumulate(const float *row, float *acc, int dim)
+{
+    int x = 0;
+    for (; x <= dim - 16; x += 16)
+    {
+        vst1q_f32(acc + x, vaddq_f32(vld1q_f32(acc + x), vld1q_f32(row + x)));
+        vst1q_f32(acc + x + 4, vaddq_f32(vld1q_f32(acc + x + 4), vld1q_f32(row + x + 4)));
+        vst1q_f32(acc + x + 8, vaddq_f32(vld1q_f32(acc + x + 8), vld1q_f32(row + x + 8)));
+        vst1q_f32(acc + x + 12, vaddq_f32(vld1q_f32(acc + x + 12), vld1q_f32(row + x + 12)));
+    }
+    for (; x <= dim - 4; x += 4)
+    {
+        vst1q_f32(acc + x, vaddq_f32(vld1q_f32(acc + x), vld1q_f32(row + x)));
+    }
+    for (; x < dim; ++x)
+    {
+        acc[x] += row[x];
+    }
+}
+
+/** Store an accumulator of floats as values of type T */
+template <typename T>
+inline void embedding_bag_store(const float *acc, T *dst, int dim)
+{
+    for (int x = 0; x < dim; ++x)
+    {
+        dst[x] = static_cast<T>(acc[x]);
+    }
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+/** Add a row of half-precision values to an accumulator of floats */
+inline void embedding_bag_accumulate(const float16_t *row, float *acc, int dim)
+{
+    int x = 0;
+    for (; x <= dim - 8; x += 8)
+    {
+        const float16x8_t v = vld1q_f16(row + x);
+        vst1q_f32(acc + x, vaddq_f32(vld1q_f32(acc + x), vcvt_f32_f16(vget_low_f16(v))));
+        vst1q_f32(acc + x + 4, vaddq_f32(vld1q_f32(acc + x + 4), vcvt_f32_f16(vget_high_f16(v))));
+    }
+    for (; x < dim; ++x)
+    {
+        acc[x] += static_cast<float>(row[x]);
+    }
+}
+
+template <>
+inline void embedding_bag_store(const float *acc, float16_t *dst, int dim)
+{
+    int x = 0;
+    for (; x <= dim - 8; x += 8)
+    {
+        vst1q_f16(dst + x, vcombine_f16(vcvt_f16_f32(vld1q_f32(acc + x)), vcvt_f16_f32(vld1q_f32(acc + x + 4))));
+    }
+    for (; x < dim; ++x)
+    {
+        dst[x] = static_cast<float16_t>(acc[x]);
+    }
+}
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+/** Dequantize 16 values, q * scale + bias, and store them or add them to @p dst */
+template <bool accumulate>
+inline void embedding_bag_dequantize(const int8x16_t &q, const float32x4_t &scale, const float32x4_t &bias, float *dst)
+{
+    const int16x8_t q_lo = vmovl_s8(vget_low_s8(q));
+    const int16x8_t q_hi = vmovl_s8(vget_high_s8(q));
+
+    const float32x4_t v[4] = {vcvtq_f32_s32(vmovl_s16(vget_low_s16(q_lo))),
+                              vcvtq_f32_s32(vmovl_s16(vget_high_s16(q_lo))),
+                              vcvtq_f32_s32(vmovl_s16(vget_low_s16(q_hi))),
+                              vcvtq_f32_s32(vmovl_s16(vget_high_s16(q_hi)))};
+    for (int i = 0; i < 4; ++i)
+    {
+        const float32x4_t init = accumulate ? vaddq_f32(vld1q_f32(dst + 4 * i), bias) : bias;
+        vst1q_f32(dst + 4 * i, vmlaq_f32(init, v[i], scale));
+    }
+}
+
+/** Rows of a floating-point table, gathered without conversion */
+template <typename T>
+struct EmbeddingFloatRows
+{
+    using OutputType = T;
+
+    EmbeddingFloatRows(const ITensor *table, const ITensor *row_params)
+        : base(table->buffer() + table->info()->offset_first_element_in_bytes()),
+          stride(table->info()->strides_in_bytes()[1]),
+          num_rows(table->info()->dimension(1)),
+          dim(table->info()->dimension(0))
+    {
+        ARM_COMPUTE_UNUSED(row_params);
+    }
+
+    void prefetch(int r) const
+    {
+        embedding_bag_prefetch(base + r * stride, dim * sizeof(T));
+    }
+
+    void copy(int r, T *dst) const
+    {
+        std::memcpy(dst, base + r * stride, dim * sizeof(T));
+    }
+
+    void accumulate(int r, float *acc) const
+    {
+        embedding_bag_accumulate(reinterpret_cast<const T *>(base + r * stride), acc, dim);
+    }
+
+    const uint8_t *base;
+    size_t         stride;
+    int            num_rows;
+    int            dim;
+};
+
+/** Rows of a table quantized per row to signed 8-bit values, row r dequantizing to q * scale(r) + bias(r) */
+struct EmbeddingS8Rows
+{
+    using OutputType = float;
+
+    EmbeddingS8Rows(const ITensor *table, const ITensor *row_params)
+        : base(table->buffer() + table->info()->offset_first_element_in_bytes()),
+          stride(table->info()->strides_in_bytes()[1]),
+          params(row_params->buffer() + row_params->info()->offset_first_element_in_bytes()),
+          params_stride(row_params->info()->strides_in_bytes()[1]),
+          num_rows(table->info()->dimension(1)),
+          dim(table->info()->dimension(0))
+    {
+    }
+
+    void prefetch(int r) const
+    {
+        __builtin_prefetch(params + r * params_stride);
+        embedding_bag_prefetch(base + r * stride, dim);
+    }
+
+    template <bool accumulate>
+    void dequantize(int r, float *dst) const
+    {
+        const auto  *src     = reinterpret_cast<const int8_t *>(base + r * stride);
+        const auto  *p       = reinterpret_cast<const float *>(params + r * params_stride);
+        const float  scale   = p[0];
+        const float  bias    = p[1];
+        const auto   scale_v = vdupq_n_f32(scale);
+        const auto   bias_v  = vdupq_n_f32(bias);
+
+        int x = 0;
+        for (; x <= dim - 16; x += 16)
+        {
+            embedding_bag_dequantize<accumulate>(vld1q_s8(src + x), scale_v, bias_v, dst + x);
+        }
+        for (; x < dim; ++x)
+        {
+            dst[x] = (accumulate ? dst[x] : 0.f) + static_cast<float>(src[x]) * scale + bias;
+        }
+    }
+
+    void copy(int r, float *dst) const
+    {
+        dequantize<false>(r, dst);
+    }
+
+    void accumulate(int r, float *acc) const
+    {
+        dequantize<true>(r, acc);
+    }
+
+    const uint8_t *base;
+    size_t         stride;
+    const uint8_t *params;
+    size_t         params_stride;
+    int            num_rows;
+    int            dim;
+};
+
+/** Rows of a table quantized per row to signed 4-bit values packed two per byte, the low nibble holding the even
+ * channel, row r dequantizing to q * scale(r) + bias(r)
+ */
+struct EmbeddingS4Rows
+{
+    using OutputType = float;
+
+    EmbeddingS4Rows(const ITensor *table, const ITensor *row_params)
+        : base(table->buffer() + table->info()->offset_first_element_in_bytes()),
+          stride(table->info()->strides_in_bytes()[1]),
+          params(row_params->buffer() + row_params->info()->offset_first_element_in_bytes()),
+          params_stride(row_params->info()->strides_in_bytes()[1]),
+          num_rows(table->info()->dimension(1)),
+          dim(2 * table->info()->dimension(0))
+    {
+    }
+
+    void prefetch(int r) const
+    {
+        __builtin_prefetch(params + r * params_stride);
+        embedding_bag_prefetch(base + r * stride, dim / 2);
+    }
+
+    template <bool accumulate>
+    void dequantize(int r, float *dst) const
+    {
+        const auto  *src     = reinterpret_cast<const int8_t *>(base + r * stride);
+        const auto  *p       = reinterpret_cast<const float *>(params + r * params_stride);
+        const float  scale   = p[0];
+        const float  bias    = p[1];
+        const auto   scale_v = vdupq_n_f32(scale);
+        const auto   bias_v  = vdupq_n_f32(bias);
+
+        int x = 0;
+        for (; x <= dim - 32; x += 32)
+        {
+            // Sign-extend both nibbles and interleave them back into channel order
+            const int8x16_t   packed = vld1q_s8(src + x / 2);
+            const int8x16x2_t q      = vzipq_s8(vshrq_n_s8(vshlq_n_s8(packed, 4), 4), vshrq_n_s8(packed, 4));
+            embedding_bag_dequantize<accumulate>(q.val[0], scale_v, bias_v, dst + x);
+            embedding_bag_dequantize<accumulate>(q.val[1], scale_v, bias_v, dst + x + 16);
+        }
+        for (; x < dim; ++x)
+        {
+            const int8_t byte = src[x / 2];
+            const int8_t q    = (x % 2 == 0) ? static_cast<int8_t>(byte << 4) >> 4 : byte >> 4;
+            dst[x]            = (accumulate ? dst[x] : 0.f) + static_cast<float>(q) * scale + bias;
+        }
+    }
+
+    void copy(int r, float *dst) const
+    {
+        dequantize<false>(r, dst);
+    }
+
+    void accumulate(int r, float *acc) const
+    {
+        dequantize<true>(r, acc);
+    }
+
+    const uint8_t *base;
+    size_t         stride;
+    const uint8_t *params;
+    size_t         params_stride;
+    int            num_rows;
+    int            dim;
+};
+
+/** Gather the rows selected by the indices and pool them per bag
+ *
+ * Every window step along Y computes an output row. The rows of the indices @p bag_info.prefetch_distance positions
+ * ahead are prefetched, which hides the latency of the random accesses to large tables. Out-of-range indices are
+ * skipped: they produce a row of zeros without pooling and do not count in the mean of a bag.
+ */
+template <typename Rows>
+void embedding_bag_neon(const Rows             &rows,
+                        const ITensor          *indices,
+                        const ITensor          *offsets,
+                        ITensor                *working,
+                        ITensor                *dst,
+                        const EmbeddingBagInfo &bag_info,
+                        const Window           &window,
+                        const ThreadInfo       &info)
+{
+    using T = typename Rows::OutputType;
+
+    const int   dim         = rows.dim;
+    const int   num_indices = indices->info()->dimension(0);
+    const int   distance    = bag_info.prefetch_distance;
+    const bool  pooling     = bag_info.mode != EmbeddingBagMode::NONE;
+    const auto *idx =
+        reinterpret_cast<const int32_t *>(indices->buffer() + indices->info()->offset_first_element_in_bytes());
+
+    const int32_t *bag_offsets = nullptr;
+    int            num_bags    = 0;
+    if (pooling)
+    {
+        bag_offsets =
+            reinterpret_cast<const int32_t *>(offsets->buffer() + offsets->info()->offset_first_element_in_bytes());
+        num_bags    = offsets->info()->dimension(0);
+    }
+
+    // Bags of half-precision rows are accumulated in a F32 buffer of the thread, the other ones in the destination
+    float *thread_acc = nullptr;
+    if (pooling && !std::is_same<T, float>::value)
+    {
+        thread_acc = reinterpret_cast<float *>(working->buffer() + working->info()->offset_first_element_in_bytes()) +
+                     info.thread_id * dim;
+    }
+
+    const auto is_valid = [&](int r) { return r >= 0 && r < rows.num_rows; };
+
+    Iterator out(dst, window);
+    execute_window_loop(
+        window,
+        [&](const Coordinates &id)
+        {
+            auto *out_row = reinterpret_cast<T *>(out.ptr());
+
+            if (!pooling)
+            {
+                const int i = id.y();
+                if (distance > 0 && i + distance < num_indices && is_valid(idx[i + distance]))
+                {
+                    rows.prefetch(idx[i + distance]);
+                }
+                if (is_valid(idx[i]))
+                {
+                    rows.copy(idx[i], out_row);
+                }
+                else
+                {
+                    std::memset(out_row, 0, dim * sizeof(T));
+                }
+                return;
+            }
+
+            // Bag b holds the indices in [offsets[b], offsets[b + 1]), the last one ending at the last index
+            const int b     = id.y();
+            const int start = utility::clamp<int>(bag_offsets[b], 0, num_indices);
+            const int end   = std::max(start, b + 1 < num_bags ? utility::clamp<int>(bag_offsets[b + 1], 0, num_indices)
+                                                               : num_indices);
+
+            float *acc = thread_acc != nullptr ? thread_acc : reinterpret_cast<float *>(out_row);
+            std::fill_n(acc, dim, 0.f);
+
+            int count = 0;
+            for (int i = start; i < end; ++i)
+            {
+                if (distance > 0 && i + distance < num_indices && is_valid(idx[i + distance]))
+                {
+                    rows.prefetch(idx[i + distance]);
+                }
+                if (is_valid(idx[i]))
+                {
+                    rows.accumulate(idx[i], acc);
+                    ++count;
+                }
+            }
+
+            if (bag_info.mode == EmbeddingBagMode::MEAN && count > 1)
+            {
+                const float       inv_count   = 1.f / static_cast<float>(count);
+                const float32x4_t inv_count_v = vdupq_n_f32(inv_count);
+
+                int x = 0;
+                for (; x <= dim - 4; x += 4)
+                {
+                    vst1q_f32(acc + x, vmulq_f32(vld1q_f32(acc + x), inv_count_v));
+                }
+                for (; x < dim; ++x)
+                {
+                    acc[x] *= inv_count;
+                }
+            }
+
+            if (thread_acc != nullptr)
+            {
+                embedding_bag_store(acc, out_row, dim);
+            }
+        },
+        out);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_EMBEDDING_BAG_GENERIC_NEON_IMPL_H
@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_GEMMDYNAMICQUANTIZED_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_GEMMDYNAMICQUANTIZED_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/QuantizationInfo.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include "src/core/NEON/NEAsymm.h"
+#include "src/core/utils/ActivationUtils.h"
+#include "src/cpu/kernels/CpuGemmDynamicQuantizedKernel.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace cpu
+{
+using GemmDynamicQuantizedKernel = kernels::CpuGemmDynamicQuantizedKernel;
+
+/** Load 16 values as floats */
+template <typename T>
+inline float32x4x4_t gemm_dynamic_quantized_load(const T *ptr);
+
+template <>
+inline float32x4x4_t gemm_dynamic_quantized_load(const float *ptr)
+{
+    return {{vld1q_f32(ptr), vld1q_f32(ptr + 4), vld1q_f32(ptr + 8), vld1q_f32(ptr + 12)}};
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+template <>
+inline float32x4x4_t gemm_dynamic_quantized_load(const float16_t *ptr)
+{
+    const float16x8_t v0 = vld1q_f16(ptr);
+    const float16x8_t v1 = vld1q_f16(ptr + 8);
+    return {{vcvt_f32_f16(vget_low_f16(v0)), vcvt_f32_f16(vget_high_f16(v0)), vcvt_f32_f16(vget_low_f16(v1)),
+             vcvt_f32_f16(vget_high_f16(v1))}};
+}
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+/** Horizontal maximum of the lanes of a vector */
+inline float gemm_dynamic_quantized_max(const float32x4_t &v)
+{
+#ifdef __aarch64__
+    return vmaxvq_f32(v);
+#else  //__aarch64__
+    const float32x2_t m = vpmax_f32(vget_low_f32(v), vget_high_f32(v));
+    return vget_lane_f32(vpmax_f32(m, m), 0);
+#endif //__aarch64__
+}
+
+/** Horizontal sum of the lanes of a vector */
+inline int32_t gemm_dynamic_quantized_reduce(const int32x4_t &v)
+{
+#ifdef __aarch64__
+    return vaddvq_s32(v);
+#else  //__aarch64__
+    const int32x2_t s = vadd_s32(vget_low_s32(v), vget_high_s32(v));
+    return vget_lane_s32(vpadd_s32(s, s), 0);
+#endif //__aarch64__
+}
+
+/** Quantize a row of @p k values to symmetric int8 with a scale mapping its largest magnitude to 127
+ *
+ * @param[in]  src   Row to quantize.
+ * @param[in]  k     Number of values of the row.
+ * @param[out] dst   Quantized row, zero-padded to a whole number of chunks.
+ * @param[out] scale Scale of the quantized row.
+ * @param[out] sum   Sum of the quantized values.
+ */
+template <typename T>
+void gemm_dynamic_quantize_row(const T *src, int k, int8_t *dst, float &scale, int32_t &sum)
+{
+    constexpr int chunk = GemmDynamicQuantizedKernel::chunk_size;
+
+    float32x4_t vmax = vdupq_n_f32(0.f);
+    int         i    = 0;
+    for (; i <= k - chunk; i += chunk)
+    {
+        const float32x4x4_t v = gemm_dynamic_quantized_load(src + i);
+        vmax = vmaxq_f32(vmax, vmaxq_f32(vabsq_f32(v.val[0]), vabsq_f32(v.val[1])));
+        vmax = vmaxq_f32(vmax, vmaxq_f32(vabsq_f32(v.val[2]), vabsq_f32(v.val[3])));
+    }
+    float max_abs = gemm_dynamic_quantized_max(vmax);
+    for (; i < k; ++i)
+    {
+        max_abs = std::max(max_abs, std::abs(static_cast<float>(src[i])));
+    }
+
+    scale = (max_abs > 0.f) ? max_abs / 127.f : 1.f;
+    const UniformQuantizationInfo qinfo(scale, 0);
+
+    // Quantized values are within [-127, 127], so the pairwise sums fit in 16 bits
+    int32x4_t vsum = vdupq_n_s32(0);
+    for (i = 0; i <= k - chunk; i += chunk)
+    {
+        const int8x16_t q = vquantize_signed(gemm_dynamic_quantized_load(src + i), qinfo);
+        vst1q_s8(dst + i, q);
+        vsum = vpadalq_s16(vsum, vpaddlq_s8(q));
+    }
+    sum = gemm_dynamic_quantized_reduce(vsum);
+    for (; i < k; ++i)
+    {
+        dst[i] = quantize_qasymm8_signed(static_cast<float>(src[i]), qinfo, RoundingPolicy::TO_NEAREST_EVEN);
+        sum += dst[i];
+    }
+
+    // Padded activations meet zero weights in the packed buffer
+    std::fill(dst + k, dst + ceil_to_multiple(k, chunk), static_cast<int8_t>(0));
+}
+
+/** Accumulate the dot products of a chunk of 16 activations with the weights of the channels of a block */
+inline void gemm_dynamic_quantized_dot(const int8x16_t &a,
+                                       const int8x16_t (&w)[GemmDynamicQuantizedKernel::block_size],
+                                       int32x4_t (&acc)[GemmDynamicQuantizedKernel::block_size])
+{
+    for (unsigned int ch = 0; ch < GemmDynamicQuantizedKernel::block_size; ++ch)
+    {
+#if defined(__ARM_FEATURE_DOTPROD)
+        acc[ch] = vdotq_s32(acc[ch], w[ch], a);
+#else  /* defined(__ARM_FEATURE_DOTPROD) */
+        // |a| <= 127 and |w| <= 128, so two products always fit in 16 bits
+        int16x8_t p = vmull_s8(vget_low_s8(w[ch]), vget_low_s8(a));
+        p           = vmlal_s8(p, vget_high_s8(w[ch]), vget_high_s8(a));
+        acc[ch]     = vpadalq_s16(acc[ch], p);
+#endif /* defined(__ARM_FEATURE_DOTPROD) */
+    }
+}
+
+template <typename T>
+void gemm_dynamic_quantized_neon(const ITensor             *src,
+                                 const ITensor             *packed,
+                                 const ITensor             *bias,
+                                 ITensor                   *working,
+                                 ITensor                   *dst,
+                                 const ActivationLayerInfo &act_info,
+                                 const Window              &window,
+                                 const ThreadInfo          &info)
+{
+    constexpr int chunk      = GemmDynamicQuantizedKernel::chunk_size;
+    constexpr int block_size = GemmDynamicQuantizedKernel::block_size;
+    constexpr int row_tile   = GemmDynamicQuantizedKernel::row_tile;
+
+    const ITensorInfo *src_info = src->info();
+    const ITensorInfo *dst_info = dst->info();
+
+    const int    k              = static_cast<int>(src_info->dimension(0));
+    const int    n              = static_cast<int>(dst_info->dimension(0));
+    const int    rows_per_batch = static_cast<int>(src_info->dimension(1));
+    const int    k_padded       = ceil_to_multiple(k, chunk);
+    const int    num_chunks     = k_padded / chunk;
+    const size_t block_bytes    = GemmDynamicQuantizedKernel::block_header_size + num_chunks * block_size * chunk;
+
+    float lower;
+    float upper;
+    activation_utils::relu_family_bounds(act_info, lower, upper);
+
+    const uint8_t *src_base    = src->buffer() + src_info->offset_first_element_in_bytes();
+    uint8_t       *dst_base    = dst->buffer() + dst_info->offset_first_element_in_bytes();
+    const uint8_t *packed_base = packed->buffer() + packed->info()->offset_first_element_in_bytes();
+    const T       *bias_ptr    = nullptr;
+    if (bias != nullptr)
+    {
+        bias_ptr = reinterpret_cast<const T *>(bias->buffer() + bias->info()->offset_first_element_in_bytes());
+    }
+
+    // Slice of the working buffer of this thread: the scales and sums of the tile rows, then the quantized rows
+    uint8_t *thread_base = working->buffer() + working->info()->offset_first_element_in_bytes() +
+                           info.thread_id * GemmDynamicQuantizedKernel::working_size(k);
+    float   *row_scales = reinterpret_cast<float *>(thread_base);
+    int32_t *row_sums   = reinterpret_cast<int32_t *>(row_scales + row_tile);
+    int8_t  *qrows      = reinterpret_cast<int8_t *>(row_sums + row_tile);
+
+    const int row_end = window[Window::DimY].end();
+    for (int row0 = window[Window::DimY].start(); row0 < row_end; row0 += row_tile)
+    {
+        const int num_rows = std::min(row_tile, row_end - row0);
+
+        T            *dst_rows[row_tile];
+        const int8_t *a_rows[row_tile];
+        for (int r = 0; r < row_tile; ++r)
+        {
+            if (r < num_rows)
+            {
+                const int m     = (row0 + r) % rows_per_batch;
+                const int batch = (row0 + r) / rows_per_batch;
+                const T  *src_row =
+                    reinterpret_cast<const T *>(src_base + m * src_info->strides_in_bytes()[1] +
+                                                batch * src_info->strides_in_bytes()[2]);
+                dst_rows[r] = reinterpret_cast<T *>(dst_base + m * dst_info->strides_in_bytes()[1] +
+                                                    batch * dst_info->strides_in_bytes()[2]);
+                gemm_dynamic_quantize_row(src_row, k, qrows + r * k_padded, row_scales[r], row_sums[r]);
+            }
+            // Rows past the end of the window recompute the last row, so the micro-kernel has no tail
+            a_rows[r] = qrows + std::min(r, num_rows - 1) * k_padded;
+        }
+
+        for (int blk = window[Window::DimX].start(); blk < window[Window::DimX].end(); ++blk)
+        {
+            const uint8_t *block_ptr = packed_base + blk * block_bytes;
+            const float   *w_scales  = reinterpret_cast<const float *>(block_ptr);
+            const int32_t *w_offsets = reinterpret_cast<const int32_t *>(w_scales + block_size);
+            const int8_t  *weights =
+                reinterpret_cast<const int8_t *>(block_ptr + GemmDynamicQuantizedKernel::block_header_size);
+
+            int32x4_t acc[row_tile][block_size];
+            for (auto &row_acc : acc)
+            {
+                for (auto &a : row_acc)
+                {
+                    a = vdupq_n_s32(0);
+                }
+            }
+
+            // Every chunk of weights is loaded once for all the rows of the tile
+            for (int c = 0; c < num_chunks; ++c, weights += block_size * chunk)
+            {
+                int8x16_t w[block_size];
+                for (int ch = 0; ch < block_size; ++ch)
+                {
+                    w[ch] = vld1q_s8(weights + ch * chunk);
+                }
+                for (int r = 0; r < row_tile; ++r)
+                {
+                    gemm_dynamic_quantized_dot(vld1q_s8(a_rows[r] + c * chunk), w, acc[r]);
+                }
+            }
+
+            // Output stage: dequantize with the row and channel scales, add the bias and apply the activation
+            const int n_start = blk * block_size;
+            const int n_valid = std::min(block_size, n - n_start);
+            for (int r = 0; r < num_rows; ++r)
+            {
+                for (int ch = 0; ch < n_valid; ++ch)
+                {
+                    const int32_t dot = gemm_dynamic_quantized_reduce(acc[r][ch]) - w_offsets[ch] * row_sums[r];
+                    const float   b   = (bias_ptr != nullptr) ? static_cast<float>(bias_ptr[n_start + ch]) : 0.f;
+                    const float   out = static_cast<float>(dot) * row_scales[r] * w_scales[ch] + b;
+                    dst_rows[r][n_start + ch] = static_cast<T>(std::min(std::max(out, lower), upper));
+                }
+            }
+        }
+    }
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_GEMMDYNAMICQUANTIZED_GENERIC_NEON_IMPL_H
@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_GEMMINT4_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_GEMMINT4_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include "src/core/utils/ActivationUtils.h"
+#include "src/cpu/kernels/CpuGemmInt4Kernel.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace cpu
+{
+using GemmInt4Kernel = kernels::CpuGemmInt4Kernel;
+
+/** Horizontal sum of the lanes of a vector */
+inline float gemm_int4_reduce(const float32x4_t &v)
+{
+#ifdef __aarch64__
+    return vaddvq_f32(v);
+#else  //__aarch64__
+    const float32x2_t s = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+    return vget_lane_f32(vpadd_f32(s, s), 0);
+#endif //__aarch64__
+}
+
+inline int32_t gemm_int4_reduce(const int32x4_t &v)
+{
+#ifdef __aarch64__
+    return vaddvq_s32(v);
+#else  //__aarch64__
+    const int32x2_t s = vadd_s32(vget_low_s32(v), vget_high_s32(v));
+    return vget_lane_s32(vpadd_s32(s, s), 0);
+#endif //__aarch64__
+}
+
+/** Unpack a chunk of 32 signed 4-bit weights stored in 16 bytes into two vectors of 16 int8 weights */
+inline void gemm_int4_unpack(const int8_t *ptr, int8x16_t &lo, int8x16_t &hi)
+{
+    const int8x16_t v = vld1q_s8(ptr);
+    lo                = vshrq_n_s8(vshlq_n_s8(v, 4), 4);
+    hi                = vshrq_n_s8(v, 4);
+}
+
+/** Convert 8 int8 values into two vectors of floats */
+inline void gemm_int4_to_f32(const int8x8_t &v, float32x4_t &out0, float32x4_t &out1)
+{
+    const int16x8_t v16 = vmovl_s8(v);
+    out0                = vcvtq_f32_s32(vmovl_s16(vget_low_s16(v16)));
+    out1                = vcvtq_f32_s32(vmovl_s16(vget_high_s16(v16)));
+}
+
+/** Load a chunk of 32 activations as floats */
+template <typename T>
+inline void gemm_int4_load(const T *ptr, float32x4_t (&out)[8]);
+
+template <>
+inline void gemm_int4_load(const float *ptr, float32x4_t (&out)[8])
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        out[i] = vld1q_f32(ptr + 4 * i);
+    }
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+template <>
+inline void gemm_int4_load(const float16_t *ptr, float32x4_t (&out)[8])
+{
+    for (int i = 0; i < 4; ++i)
+    {
+        const float16x8_t v = vld1q_f16(ptr + 8 * i);
+        out[2 * i]          = vcvt_f32_f16(vget_low_f16(v));
+        out[2 * i + 1]      = vcvt_f32_f16(vget_high_f16(v));
+    }
+}
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+/** Accumulate the dot products of a chunk of 32 int8 activations with the weights of 4 output channels */
+inline void gemm_int4_dot(const int8x16_t &a0, const int8x16_t &a1, const int8_t *weights, int32x4_t (&acc)[4])
+{
+    for (unsigned int ch = 0; ch < GemmInt4Kernel::block_size; ++ch)
+    {
+        int8x16_t lo;
+        int8x16_t hi;
+        gemm_int4_unpack(weights + ch * 16, lo, hi);
+#if defined(__ARM_FEATURE_DOTPROD)
+        acc[ch] = vdotq_s32(acc[ch], lo, a0);
+        acc[ch] = vdotq_s32(acc[ch], hi, a1);
+#else  /* defined(__ARM_FEATURE_DOTPROD) */
+        // |int4 * int8| <= 1024, so two products always fit in 16 bits
+        int16x8_t p = vmull_s8(vget_low_s8(lo), vget_low_s8(a0));
+        p           = vmlal_s8(p, vget_high_s8(lo), vget_high_s8(a0));
+        acc[ch]     = vpadalq_s16(acc[ch], p);
+        p           = vmull_s8(vget_low_s8(hi), vget_low_s8(a1));
+        p           = vmlal_s8(p, vget_high_s8(hi), vget_high_s8(a1));
+        acc[ch]     = vpadalq_s16(acc[ch], p);
+#endif /* defined(__ARM_FEATURE_DOTPROD) */
+    }
+}
+
+/** Run the multiplication of the rows of @p src by the packed blocks of the window
+ *
+ * @param[in] compute_block Functor computing the 4 outputs of a block for a row: (src_row, block_ptr, float[4])
+ */
+template <typename TIn, typename TOut, typename F>
+void gemm_int4_run(const ITensor             *src,
+                   const ITensor             *packed,
+                   const ITensor             *bias,
+                   ITensor                   *dst,
+                   const ActivationLayerInfo &act_info,
+                   size_t                     block_bytes,
+                   const Window              &window,
+                   const F                   &compute_block)
+{
+    const ITensorInfo *src_info = src->info();
+    const ITensorInfo *dst_info = dst->info();
+
+    const int rows_per_batch = static_cast<int>(src_info->dimension(1));
+    const int n              = static_cast<int>(dst_info->dimension(0));
+
+    float lower;
+    float upper;
+    activation_utils::relu_family_bounds(act_info, lower, upper);
+
+    const uint8_t *src_base    = src->buffer() + src_info->offset_first_element_in_bytes();
+    uint8_t       *dst_base    = dst->buffer() + dst_info->offset_first_element_in_bytes();
+    const uint8_t *packed_base = packed->buffer() + packed->info()->offset_first_element_in_bytes();
+    const TOut    *bias_ptr    = nullptr;
+    if (bias != nullptr)
+    {
+        bias_ptr = reinterpret_cast<const TOut *>(bias->buffer() + bias->info()->offset_first_element_in_bytes());
+    }
+
+    for (int blk = window[Window::DimX].start(); blk < window[Window::DimX].end(); ++blk)
+    {
+        // The weights of a block are reused by all the rows of the window, so they stay in cache
+        const uint8_t *block_ptr = packed_base + blk * block_bytes;
+        const int      n_start   = blk * static_cast<int>(GemmInt4Kernel::block_size);
+        const int      n_valid   = std::min(static_cast<int>(GemmInt4Kernel::block_size), n - n_start);
+
+        for (int row = window[Window::DimY].start(); row < window[Window::DimY].end(); ++row)
+        {
+            const int  m     = row % rows_per_batch;
+            const int  batch = row / rows_per_batch;
+            const TIn *src_row =
+                reinterpret_cast<const TIn *>(src_base + m * src_info->strides_in_bytes()[1] +
+                                              batch * src_info->strides_in_bytes()[2]);
+            TOut *dst_row = reinterpret_cast<TOut *>(dst_base + m * dst_info->strides_in_bytes()[1] +
+                                                     batch * dst_info->strides_in_bytes()[2]);
+
+            float out[GemmInt4Kernel::block_size];
+            compute_block(src_row, block_ptr, out);
+
+            for (int ch = 0; ch < n_valid; ++ch)
+            {
+                const float b         = (bias_ptr != nullptr) ? static_cast<float>(bias_ptr[n_start + ch]) : 0.f;
+                dst_row[n_start + ch] = static_cast<TOut>(std::min(std::max(out[ch] + b, lower), upper));
+            }
+        }
+    }
+}
+
+template <typename T>
+void gemm_int4_fp_neon(const ITensor             *src,
+                       const ITensor             *packed,
+                       const ITensor             *bias,
+                       ITensor                   *dst,
+                       unsigned int               group_size,
+                       const ActivationLayerInfo &act_info,
+                       const Window              &window)
+{
+    constexpr int chunk = GemmInt4Kernel::chunk_size;
+
+    const int    k           = static_cast<int>(src->info()->dimension(0));
+    const int    group       = static_cast<int>(GemmInt4Kernel::effective_group_size(k, group_size));
+    const int    num_groups  = (k + group - 1) / group;
+    const size_t group_bytes = GemmInt4Kernel::group_header_size + (group / chunk) * GemmInt4Kernel::block_size * 16;
+    const size_t block_bytes = num_groups * group_bytes;
+
+    const auto compute_block = [&](const T *src_row, const uint8_t *block_ptr, float *out)
+    {
+        float sum[GemmInt4Kernel::block_size] = {};
+        for (int g = 0; g < num_groups; ++g)
+        {
+            const uint8_t *group_ptr = block_ptr + g * group_bytes;
+            const float   *scales    = reinterpret_cast<const float *>(group_ptr);
+            const int8_t  *weights   = reinterpret_cast<const int8_t *>(group_ptr + GemmInt4Kernel::group_header_size);
+
+            float32x4_t acc[GemmInt4Kernel::block_size];
+            for (auto &a : acc)
+            {
+                a = vdupq_n_f32(0.f);
+            }
+
+            const int k_end = std::min(k, (g + 1) * group);
+            for (int k0 = g * group; k0 < k_end; k0 += chunk, weights += GemmInt4Kernel::block_size * 16)
+            {
+                float32x4_t a[8];
+                if (k0 + chunk <= k)
+                {
+                    gemm_int4_load(src_row + k0, a);
+                }
+                else
+                {
+                    // Left-over activations: the padded weights are zero, so are the padded activations
+                    T tail[chunk] = {};
+                    std::copy(src_row + k0, src_row + k, tail);
+                    gemm_int4_load(tail, a);
+                }
+
+                for (unsigned int ch = 0; ch < GemmInt4Kernel::block_size; ++ch)
+                {
+                    int8x16_t lo;
+                    int8x16_t hi;
+                    gemm_int4_unpack(weights + ch * 16, lo, hi);
+
+                    float32x4_t w[8];
+                    gemm_int4_to_f32(vget_low_s8(lo), w[0], w[1]);
+                    gemm_int4_to_f32(vget_high_s8(lo), w[2], w[3]);
+                    gemm_int4_to_f32(vget_low_s8(hi), w[4], w[5]);
+                    gemm_int4_to_f32(vget_high_s8(hi), w[6], w[7]);
+                    for (int i = 0; i < 8; ++i)
+                    {
+                        acc[ch] = vmlaq_f32(acc[ch], w[i], a[i]);
+                    }
+                }
+            }
+
+            for (unsigned int ch = 0; ch < GemmInt4Kernel::block_size; ++ch)
+            {
+                sum[ch] += gemm_int4_reduce(acc[ch]) * scales[ch];
+            }
+        }
+        std::copy(sum, sum + GemmInt4Kernel::block_size, out);
+    };
+
+    gemm_int4_run<T, T>(src, packed, bias, dst, act_info, block_bytes, window, compute_block);
+}
+
+inline void gemm_int4_s8_neon(const ITensor             *src,
+                              const ITensor             *packed,
+                              const ITensor             *bias,
+                              ITensor                   *dst,
+                              unsigned int               group_size,
+                              const ActivationLayerInfo &act_info,
+                              const Window              &window)
+{
+    constexpr int chunk = GemmInt4Kernel::chunk_size;
+
+    const int    k           = static_cast<int>(src->info()->dimension(0));
+    const int    group       = static_cast<int>(GemmInt4Kernel::effective_group_size(k, group_size));
+    const int    num_groups  = (k + group - 1) / group;
+    const size_t group_bytes = GemmInt4Kernel::group_header_size + (group / chunk) * GemmInt4Kernel::block_size * 16;
+    const size_t block_bytes = num_groups * group_bytes;
+
+    const UniformQuantizationInfo qinfo    = src->info()->quantization_info().uniform();
+    const int32_t                 a_offset = qinfo.offset;
+    const float                   a_scale  = qinfo.scale;
+
+    const auto compute_block = [&](const int8_t *src_row, const uint8_t *block_ptr, float *out)
+    {
+        float sum[GemmInt4Kernel::block_size] = {};
+        for (int g = 0; g < num_groups; ++g)
+        {
+            const uint8_t *group_ptr = block_ptr + g * group_bytes;
+            const float   *scales    = reinterpret_cast<const float *>(group_ptr);
+            const int32_t *wsums     = reinterpret_cast<const int32_t *>(scales + GemmInt4Kernel::block_size);
+            const int8_t  *weights   = reinterpret_cast<const int8_t *>(group_ptr + GemmInt4Kernel::group_header_size);
+
+            int32x4_t acc[GemmInt4Kernel::block_size];
+            for (auto &a : acc)
+            {
+                a = vdupq_n_s32(0);
+            }
+
+            const int k_end = std::min(k, (g + 1) * group);
+            for (int k0 = g * group; k0 < k_end; k0 += chunk, weights += GemmInt4Kernel::block_size * 16)
+            {
+                if (k0 + chunk <= k)
+                {
+                    gemm_int4_dot(vld1q_s8(src_row + k0), vld1q_s8(src_row + k0 + 16), weights, acc);
+                }
+                else
+                {
+                    // Left-over activations: the padded weights are zero, so are the padded activations
+                    int8_t tail[chunk] = {};
+                    std::copy(src_row + k0, src_row + k, tail);
+                    gemm_int4_dot(vld1q_s8(tail), vld1q_s8(tail + 16), weights, acc);
+                }
+            }
+
+            // sum((a - offset) * w) = sum(a * w) - offset * sum(w)
+            for (unsigned int ch = 0; ch < GemmInt4Kernel::block_size; ++ch)
+            {
+                const int32_t dot = gemm_int4_reduce(acc[ch]) - a_offset * wsums[ch];
+                sum[ch] += static_cast<float>(dot) * scales[ch];
+            }
+        }
+        for (unsigned int ch = 0; ch < GemmInt4Kernel::block_size; ++ch)
+        {
+            out[ch] = sum[ch] * a_scale;
+        }
+    };
+
+    gemm_int4_run<int8_t, float>(src, packed, bias, dst, act_info, block_bytes, window, compute_block);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_GEMMINT4_GENERIC_NEON_IMPL_H
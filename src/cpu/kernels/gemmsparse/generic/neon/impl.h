@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_GEMMSPARSE_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_GEMMSPARSE_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include "src/core/utils/ActivationUtils.h"
+#include "src/cpu/kernels/CpuGemmSparseKernel.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace cpu
+{
+using GemmSparseKernel = kernels::CpuGemmSparseKernel;
+
+/** A 32-byte span of the input loaded once and gathered with the index vectors of several channels */
+struct GemmSparseSpan
+{
+    explicit GemmSparseSpan(const uint8_t *span)
+#ifdef __aarch64__
+        : table{{vld1q_u8(span), vld1q_u8(span + 16)}}
+#else  //__aarch64__
+        : table{{vld1_u8(span), vld1_u8(span + 8), vld1_u8(span + 16), vld1_u8(span + 24)}}
+#endif //__aarch64__
+    {
+    }
+
+    /** Gather the 16 bytes of the span selected by @p indices */
+    uint8x16_t gather(const uint8x16_t &indices) const
+    {
+#ifdef __aarch64__
+        return vqtbl2q_u8(table, indices);
+#else  //__aarch64__
+        return vcombine_u8(vtbl4_u8(table, vget_low_u8(indices)), vtbl4_u8(table, vget_high_u8(indices)));
+#endif //__aarch64__
+    }
+
+#ifdef __aarch64__
+    uint8x16x2_t table;
+#else  //__aarch64__
+    uint8x8x4_t table;
+#endif //__aarch64__
+};
+
+/** Accumulator of the products of gathered inputs by compressed weights */
+template <typename T>
+struct GemmSparseAccumulator;
+
+template <>
+struct GemmSparseAccumulator<float>
+{
+    void accumulate(const uint8x16_t &a, const uint8x16_t &w)
+    {
+        acc = vmlaq_f32(acc, vreinterpretq_f32_u8(a), vreinterpretq_f32_u8(w));
+    }
+    float result() const
+    {
+#ifdef __aarch64__
+        return vaddvq_f32(acc);
+#else  //__aarch64__
+        const float32x2_t s = vadd_f32(vget_low_f32(acc), vget_high_f32(acc));
+        return vget_lane_f32(vpadd_f32(s, s), 0);
+#endif //__aarch64__
+    }
+    float32x4_t acc{vdupq_n_f32(0.f)};
+};
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+template <>
+struct GemmSparseAccumulator<float16_t> : public GemmSparseAccumulator<float>
+{
+    // Accumulate in fp32 to preserve the accuracy of long reductions
+    void accumulate(const uint8x16_t &a, const uint8x16_t &w)
+    {
+        const float16x8_t a16 = vreinterpretq_f16_u8(a);
+        const float16x8_t w16 = vreinterpretq_f16_u8(w);
+        acc = vmlaq_f32(acc, vcvt_f32_f16(vget_low_f16(a16)), vcvt_f32_f16(vget_low_f16(w16)));
+        acc = vmlaq_f32(acc, vcvt_f32_f16(vget_high_f16(a16)), vcvt_f32_f16(vget_high_f16(w16)));
+    }
+};
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+template <>
+struct GemmSparseAccumulator<int8_t>
+{
+    void accumulate(const uint8x16_t &a, const uint8x16_t &w)
+    {
+        const int8x16_t a8 = vreinterpretq_s8_u8(a);
+        const int8x16_t w8 = vreinterpretq_s8_u8(w);
+#if defined(__ARM_FEATURE_DOTPROD)
+        acc = vdotq_s32(acc, a8, w8);
+#else  /* defined(__ARM_FEATURE_DOTPROD) */
+        acc = vpadalq_s16(acc, vmull_s8(vget_low_s8(a8), vget_low_s8(w8)));
+        acc = vpadalq_s16(acc, vmull_s8(vget_high_s8(a8), vget_high_s8(w8)));
+#endif /* defined(__ARM_FEATURE_DOTPROD) */
+    }
+    int32_t result() const
+    {
+#ifdef __aarch64__
+        return vaddvq_s32(acc);
+#else  //__aarch64__
+        const int32x2_t s = vadd_s32(vget_low_s32(acc), vget_high_s32(acc));
+        return vget_lane_s32(vpadd_s32(s, s), 0);
+#endif //__aarch64__
+    }
+    int32x4_t acc{vdupq_n_s32(0)};
+};
+
+/** Run the multiplication of the rows of @p src by the compressed channels of the window
+ *
+ * The window is processed in tiles of GemmSparseKernel::tile_rows rows by GemmSparseKernel::tile_channels channels.
+ * Every span of a row is loaded once per tile and gathered with the precomputed index vectors of all the channels,
+ * and the compressed weights of a channel are read once per tile of rows.
+ *
+ * @param[in] output_stage Functor converting the dot product of a channel to the output: (dot, channel, weights_sum)
+ */
+template <typename TIn, typename TOut, typename F>
+void gemm_sparse_run(
+    const ITensor *src, const ITensor *packed, ITensor *dst, const Window &window, const F &output_stage)
+{
+    constexpr int chunk         = GemmSparseKernel::chunk_size;
+    constexpr int span          = GemmSparseKernel::span_size / sizeof(TIn);
+    constexpr int tile_rows     = GemmSparseKernel::tile_rows;
+    constexpr int tile_channels = GemmSparseKernel::tile_channels;
+
+    const ITensorInfo *src_info = src->info();
+    const ITensorInfo *dst_info = dst->info();
+
+    const int    k              = static_cast<int>(src_info->dimension(0));
+    const int    k_full         = k - k % chunk;
+    const int    k_padded       = ceil_to_multiple(k, chunk);
+    const int    rows_per_batch = static_cast<int>(src_info->dimension(1));
+    const size_t stride         = GemmSparseKernel::channel_stride(k, sizeof(TIn));
+
+    const uint8_t *src_base    = src->buffer() + src_info->offset_first_element_in_bytes();
+    uint8_t       *dst_base    = dst->buffer() + dst_info->offset_first_element_in_bytes();
+    const uint8_t *packed_base = packed->buffer() + packed->info()->offset_first_element_in_bytes();
+
+    const int row_end     = window[Window::DimY].end();
+    const int channel_end = window[Window::DimX].end();
+    for (int row0 = window[Window::DimY].start(); row0 < row_end; row0 += tile_rows)
+    {
+        const int num_rows = std::min(tile_rows, row_end - row0);
+
+        // The rows past the end of the window repeat the first one, so that the tile is always full
+        const TIn *src_rows[tile_rows];
+        TOut      *dst_rows[tile_rows];
+        TIn        tails[tile_rows][chunk] = {};
+        for (int r = 0; r < tile_rows; ++r)
+        {
+            const int row   = row0 + std::min(r, num_rows - 1);
+            const int m     = row % rows_per_batch;
+            const int batch = row / rows_per_batch;
+            src_rows[r]     = reinterpret_cast<const TIn *>(src_base + m * src_info->strides_in_bytes()[1] +
+                                                            batch * src_info->strides_in_bytes()[2]);
+            dst_rows[r]     = reinterpret_cast<TOut *>(dst_base + m * dst_info->strides_in_bytes()[1] +
+                                                   batch * dst_info->strides_in_bytes()[2]);
+
+            // The padded weights are zero, so are the padded input values
+            std::copy(src_rows[r] + k_full, src_rows[r] + k, tails[r]);
+        }
+
+        for (int x0 = window[Window::DimX].start(); x0 < channel_end; x0 += tile_channels)
+        {
+            const int num_channels = std::min(tile_channels, channel_end - x0);
+
+            // The channels past the end of the window repeat the last one
+            const uint8_t *spans[tile_channels];
+            for (int c = 0; c < tile_channels; ++c)
+            {
+                spans[c] = packed_base + (x0 + std::min(c, num_channels - 1)) * stride +
+                           GemmSparseKernel::channel_header_size;
+            }
+
+            GemmSparseAccumulator<TIn> acc[tile_rows][tile_channels];
+            for (int k0 = 0; k0 < k_padded; k0 += span)
+            {
+                // Each span of a channel holds its 16 bytes of kept weights, then their 16 gather indices
+                uint8x16_t values[tile_channels];
+                uint8x16_t indices[tile_channels];
+                for (int c = 0; c < tile_channels; ++c)
+                {
+                    values[c]  = vld1q_u8(spans[c]);
+                    indices[c] = vld1q_u8(spans[c] + 16);
+                    spans[c] += GemmSparseKernel::span_size;
+                }
+
+                for (int r = 0; r < tile_rows; ++r)
+                {
+                    const TIn           *a = (k0 < k_full) ? src_rows[r] + k0 : tails[r] + (k0 - k_full);
+                    const GemmSparseSpan in(reinterpret_cast<const uint8_t *>(a));
+                    for (int c = 0; c < tile_channels; ++c)
+                    {
+                        acc[r][c].accumulate(in.gather(indices[c]), values[c]);
+                    }
+                }
+            }
+
+            for (int c = 0; c < num_channels; ++c)
+            {
+                const int32_t wsum = *reinterpret_cast<const int32_t *>(packed_base + (x0 + c) * stride);
+                for (int r = 0; r < num_rows; ++r)
+                {
+                    dst_rows[r][x0 + c] = output_stage(acc[r][c].result(), x0 + c, wsum);
+                }
+            }
+        }
+    }
+}
+
+template <typename T>
+void gemm_sparse_fp_neon(const ITensor             *src,
+                         const ITensor             *packed,
+                         const ITensor             *bias,
+                         ITensor                   *dst,
+                         const ActivationLayerInfo &act_info,
+                         const Window              &window)
+{
+    float lower;
+    float upper;
+    activation_utils::relu_family_bounds(act_info, lower, upper);
+
+    const T *bias_ptr = nullptr;
+    if (bias != nullptr)
+    {
+        bias_ptr = reinterpret_cast<const T *>(bias->buffer() + bias->info()->offset_first_element_in_bytes());
+    }
+
+    const auto output_stage = [&](float dot, int x, int32_t wsum)
+    {
+        ARM_COMPUTE_UNUSED(wsum);
+        const float b = (bias_ptr != nullptr) ? static_cast<float>(bias_ptr[x]) : 0.f;
+        return static_cast<T>(std::min(std::max(dot + b, lower), upper));
+    };
+
+    gemm_sparse_run<T, T>(src, packed, dst, window, output_stage);
+}
+
+inline void gemm_sparse_s8_neon(const ITensor *src,
+                                const ITensor *packed,
+                                const ITensor *bias,
+                                ITensor       *dst,
+                                const Window  &window)
+{
+    const int32_t a_offset = src->info()->quantization_info().uniform().offset;
+
+    const int32_t *bias_ptr = nullptr;
+    if (bias != nullptr)
+    {
+        bias_ptr = reinterpret_cast<const int32_t *>(bias->buffer() + bias->info()->offset_first_element_in_bytes());
+    }
+
+    // sum((a - offset) * w) = sum(a * w) - offset * sum(w)
+    const auto output_stage = [&](int32_t dot, int x, int32_t wsum)
+    {
+        const int32_t b = (bias_ptr != nullptr) ? bias_ptr[x] : 0;
+        return dot - a_offset * wsum + b;
+    };
+
+    gemm_sparse_run<int8_t, int32_t>(src, packed, dst, window, output_stage);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_GEMMSPARSE_GENERIC_NEON_IMPL_H
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_GLOBALPOOLINGFC_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_GLOBALPOOLINGFC_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include "src/core/NEON/wrapper/wrapper.h"
+#include "src/core/utils/ActivationUtils.h"
+#include "src/cpu/kernels/CpuGlobalPoolingFullyConnectedKernel.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace cpu
+{
+template <typename T>
+void global_pooling_fc_neon(const ITensor             *src,
+                            const ITensor             *weights,
+                            ITensor                   *workspace,
+                            ITensor                   *dst,
+                            const ActivationLayerInfo &act_info,
+                            const Window              &window,
+                            const ThreadInfo          &thread_info)
+{
+    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
+    constexpr int step = 16 / sizeof(T);
+
+    const ITensorInfo *src_info = src->info();
+    const ITensorInfo *dst_info = dst->info();
+
+    const int in_ch  = static_cast<int>(src_info->dimension(0));
+    const int in_w   = static_cast<int>(src_info->dimension(1));
+    const int in_h   = static_cast<int>(src_info->dimension(2));
+    const int out_ch = static_cast<int>(dst_info->dimension(0));
+    const int block =
+        static_cast<int>(kernels::CpuGlobalPoolingFullyConnectedKernel::block_size(src_info->data_type()));
+    ARM_COMPUTE_ERROR_ON(block != 4 * step);
+
+    float lower;
+    float upper;
+    activation_utils::relu_family_bounds(act_info, lower, upper);
+    const auto vlower = wrapper::vdup_n(static_cast<T>(lower), ExactTagType{});
+    const auto vupper = wrapper::vdup_n(static_cast<T>(upper), ExactTagType{});
+
+    // Per-thread buffer holding the pooled input channels
+    ARM_COMPUTE_ERROR_ON((thread_info.thread_id + 1) * in_ch * sizeof(T) > workspace->info()->total_size());
+    T *pooled = reinterpret_cast<T *>(workspace->buffer() + workspace->info()->offset_first_element_in_bytes()) +
+                thread_info.thread_id * in_ch;
+
+    const T *packed = reinterpret_cast<const T *>(weights->buffer() + weights->info()->offset_first_element_in_bytes());
+
+    const Strides &src_strides = src_info->strides_in_bytes();
+    const uint8_t *src_base    = src->buffer() + src_info->offset_first_element_in_bytes();
+    uint8_t       *dst_base    = dst->buffer() + dst_info->offset_first_element_in_bytes();
+    const T        scale       = static_cast<T>(1.f / static_cast<float>(in_w * in_h));
+    const auto     vscale      = wrapper::vdup_n(scale, ExactTagType{});
+
+    for (int b = window[Window::DimY].start(); b < window[Window::DimY].end(); ++b)
+    {
+        // Reduce the spatial dimensions. The pooled vector is tiny and stays in cache for the matrix-vector product.
+        std::fill_n(pooled, in_ch, static_cast<T>(0));
+        for (int y = 0; y < in_h; ++y)
+        {
+            for (int x = 0; x < in_w; ++x)
+            {
+                const T *in_px =
+                    reinterpret_cast<const T *>(src_base + x * src_strides[1] + y * src_strides[2] + b * src_strides[3]);
+                int c = 0;
+                for (; c <= in_ch - step; c += step)
+                {
+                    wrapper::vstore(pooled + c,
+                                    wrapper::vadd(wrapper::vloadq(pooled + c), wrapper::vloadq(in_px + c)));
+                }
+                // Compute left-over elements
+                for (; c < in_ch; ++c)
+                {
+                    pooled[c] += in_px[c];
+                }
+            }
+        }
+        int c = 0;
+        for (; c <= in_ch - step; c += step)
+        {
+            wrapper::vstore(pooled + c, wrapper::vmul(wrapper::vloadq(pooled + c), vscale));
+        }
+        for (; c < in_ch; ++c)
+        {
+            pooled[c] *= scale;
+        }
+
+        T *out = reinterpret_cast<T *>(dst_base + b * dst_info->strides_in_bytes()[1]);
+        for (int blk = window[Window::DimX].start(); blk < window[Window::DimX].end(); ++blk)
+        {
+            // Every block holds its bias followed by [in_ch][block] weights
+            const T *block_params = packed + static_cast<size_t>(blk) * (in_ch + 1) * block;
+
+            auto acc0 = wrapper::vloadq(block_params);
+            auto acc1 = wrapper::vloadq(block_params + step);
+            auto acc2 = wrapper::vloadq(block_params + 2 * step);
+            auto acc3 = wrapper::vloadq(block_params + 3 * step);
+
+            const T *w = block_params + block;
+            for (int ic = 0; ic < in_ch; ++ic, w += block)
+            {
+                const auto vin = wrapper::vdup_n(pooled[ic], ExactTagType{});
+                acc0           = wrapper::vmla(acc0, vin, wrapper::vloadq(w));
+                acc1           = wrapper::vmla(acc1, vin, wrapper::vloadq(w + step));
+                acc2           = wrapper::vmla(acc2, vin, wrapper::vloadq(w + 2 * step));
+                acc3           = wrapper::vmla(acc3, vin, wrapper::vloadq(w + 3 * step));
+            }
+            acc0 = wrapper::vmin(wrapper::vmax(acc0, vlower), vupper);
+            acc1 = wrapper::vmin(wrapper::vmax(acc1, vlower), vupper);
+            acc2 = wrapper::vmin(wrapper::vmax(acc2, vlower), vupper);
+            acc3 = wrapper::vmin(wrapper::vmax(acc3, vlower), vupper);
+
+            const int oc = blk * block;
+            if (oc + block <= out_ch)
+            {
+                wrapper::vstore(out + oc, acc0);
+                wrapper::vstore(out + oc + step, acc1);
+                wrapper::vstore(out + oc + 2 * step, acc2);
+                wrapper::vstore(out + oc + 3 * step, acc3);
+            }
+            else
+            {
+                // Last block: the packed weights are zero-padded, only the valid channels are written back
+                T tail[4 * step];
+                wrapper::vstore(tail, acc0);
+                wrapper::vstore(tail + step, acc1);
+                wrapper::vstore(tail + 2 * step, acc2);
+                wrapper::vstore(tail + 3 * step, acc3);
+                std::copy_n(tail, out_ch - oc, out + oc);
+            }
+        }
+    }
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_GLOBALPOOLINGFC_GENERIC_NEON_IMPL_H
@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_INVERTEDRESIDUAL_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_INVERTEDRESIDUAL_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/InvertedResidualLayerInfo.h"
+
+#include "src/core/NEON/wrapper/wrapper.h"
+#include "src/core/utils/ActivationUtils.h"
+#include "src/cpu/kernels/CpuInvertedResidualKernel.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace detail
+{
+/** Clamping bounds equivalent to a RELU-family activation */
+template <typename T>
+struct ActivationBounds
+{
+    T lower;
+    T upper;
+};
+
+template <typename T>
+ActivationBounds<T> activation_bounds(const ActivationLayerInfo &act_info)
+{
+    float lower;
+    float upper;
+    activation_utils::relu_family_bounds(act_info, lower, upper);
+    return ActivationBounds<T>{static_cast<T>(lower), static_cast<T>(upper)};
+}
+
+/** Compute a 1x1 convolution over a row of pixels
+ *
+ * Weights are stored as [in_ch][out_ch] so every input value is broadcast against contiguous output channels.
+ * If @p residual is not nullptr, it is added to the result after the activation.
+ */
+template <typename T>
+void pointwise_row(const T                   *in,
+                   size_t                     in_stride,
+                   int                        width,
+                   int                        in_ch,
+                   const T                   *weights,
+                   const T                   *bias,
+                   int                        out_ch,
+                   T                         *out,
+                   size_t                     out_stride,
+                   const ActivationBounds<T> &bounds,
+                   const T                   *residual,
+                   size_t                     residual_stride)
+{
+    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
+    constexpr int step = 16 / sizeof(T);
+
+    const auto vlower = wrapper::vdup_n(bounds.lower, ExactTagType{});
+    const auto vupper = wrapper::vdup_n(bounds.upper, ExactTagType{});
+
+    const auto store = [&](T *dst, const T *res, auto acc)
+    {
+        acc = wrapper::vmin(wrapper::vmax(acc, vlower), vupper);
+        if (res != nullptr)
+        {
+            acc = wrapper::vadd(acc, wrapper::vloadq(res));
+        }
+        wrapper::vstore(dst, acc);
+    };
+
+    for (int x = 0; x < width; ++x)
+    {
+        const T *in_px  = in + x * in_stride;
+        T       *out_px = out + x * out_stride;
+        const T *res_px = (residual != nullptr) ? residual + x * residual_stride : nullptr;
+
+        int oc = 0;
+        for (; oc <= out_ch - 4 * step; oc += 4 * step)
+        {
+            auto acc0 = wrapper::vloadq(bias + oc);
+            auto acc1 = wrapper::vloadq(bias + oc + step);
+            auto acc2 = wrapper::vloadq(bias + oc + 2 * step);
+            auto acc3 = wrapper::vloadq(bias + oc + 3 * step);
+
+            const T *w = weights + oc;
+            for (int ic = 0; ic < in_ch; ++ic, w += out_ch)
+            {
+                const auto vin = wrapper::vdup_n(in_px[ic], ExactTagType{});
+                acc0           = wrapper::vmla(acc0, vin, wrapper::vloadq(w));
+                acc1           = wrapper::vmla(acc1, vin, wrapper::vloadq(w + step));
+                acc2           = wrapper::vmla(acc2, vin, wrapper::vloadq(w + 2 * step));
+                acc3           = wrapper::vmla(acc3, vin, wrapper::vloadq(w + 3 * step));
+            }
+
+            store(out_px + oc, res_px != nullptr ? res_px + oc : nullptr, acc0);
+            store(out_px + oc + step, res_px != nullptr ? res_px + oc + step : nullptr, acc1);
+            store(out_px + oc + 2 * step, res_px != nullptr ? res_px + oc + 2 * step : nullptr, acc2);
+            store(out_px + oc + 3 * step, res_px != nullptr ? res_px + oc + 3 * step : nullptr, acc3);
+        }
+        for (; oc <= out_ch - step; oc += step)
+        {
+            auto     acc = wrapper::vloadq(bias + oc);
+            const T *w   = weights + oc;
+            for (int ic = 0; ic < in_ch; ++ic, w += out_ch)
+            {
+                acc = wrapper::vmla(acc, wrapper::vdup_n(in_px[ic], ExactTagType{}), wrapper::vloadq(w));
+            }
+            store(out_px + oc, res_px != nullptr ? res_px + oc : nullptr, acc);
+        }
+        // Compute left-over elements
+        for (; oc < out_ch; ++oc)
+        {
+            T acc = bias[oc];
+            for (int ic = 0; ic < in_ch; ++ic)
+            {
+                acc += in_px[ic] * weights[ic * out_ch + oc];
+            }
+            acc = std::min(std::max(acc, bounds.lower), bounds.upper);
+            if (res_px != nullptr)
+            {
+                acc += res_px[oc];
+            }
+            out_px[oc] = acc;
+        }
+    }
+}
+
+/** Compute one output row of a depthwise convolution with depth multiplier 1
+ *
+ * @p rows holds one pointer per kernel row to an expanded input row laid out as [in_w][channels],
+ * or nullptr when the kernel row falls in the vertical padding.
+ */
+template <typename T>
+void depthwise_row(const T *const            *rows,
+                   int                        in_w,
+                   int                        channels,
+                   const T                   *weights,
+                   const T                   *bias,
+                   const Size2D              &kernel,
+                   int                        stride_x,
+                   int                        pad_left,
+                   int                        out_w,
+                   T                         *out,
+                   const ActivationBounds<T> &bounds)
+{
+    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
+    constexpr int step = 16 / sizeof(T);
+
+    const int  kernel_w = static_cast<int>(kernel.width);
+    const int  kernel_h = static_cast<int>(kernel.height);
+    const auto vlower   = wrapper::vdup_n(bounds.lower, ExactTagType{});
+    const auto vupper   = wrapper::vdup_n(bounds.upper, ExactTagType{});
+
+    for (int ox = 0; ox < out_w; ++ox)
+    {
+        const int ix0      = ox * stride_x - pad_left;
+        const int kx_start = std::max(0, -ix0);
+        const int kx_end   = std::min(kernel_w, in_w - ix0);
+        T        *out_px   = out + ox * channels;
+
+        int c = 0;
+        for (; c <= channels - step; c += step)
+        {
+            auto acc = wrapper::vloadq(bias + c);
+            for (int ky = 0; ky < kernel_h; ++ky)
+            {
+                if (rows[ky] == nullptr)
+                {
+                    continue;
+                }
+                const T *w = weights + ky * kernel_w * channels + c;
+                for (int kx = kx_start; kx < kx_end; ++kx)
+                {
+                    acc = wrapper::vmla(acc, wrapper::vloadq(rows[ky] + (ix0 + kx) * channels + c),
+                                        wrapper::vloadq(w + kx * channels));
+                }
+            }
+            wrapper::vstore(out_px + c, wrapper::vmin(wrapper::vmax(acc, vlower), vupper));
+        }
+        // Compute left-over elements
+        for (; c < channels; ++c)
+        {
+            T acc = bias[c];
+            for (int ky = 0; ky < kernel_h; ++ky)
+            {
+                if (rows[ky] == nullptr)
+                {
+                    continue;
+                }
+                for (int kx = kx_start; kx < kx_end; ++kx)
+                {
+                    acc += rows[ky][(ix0 + kx) * channels + c] * weights[(ky * kernel_w + kx) * channels + c];
+                }
+            }
+            out_px[c] = std::min(std::max(acc, bounds.lower), bounds.upper);
+        }
+    }
+}
+} // namespace detail
+
+template <typename T>
+void inverted_residual_neon(const ITensor                   *src,
+                            const ITensor                   *weights,
+                            ITensor                         *workspace,
+                            ITensor                         *dst,
+                            unsigned int                     exp_channels,
+                            const Size2D                    &dw_kernel,
+                            const InvertedResidualLayerInfo &info,
+                            const Window                    &window,
+                            const ThreadInfo                &thread_info)
+{
+    const ITensorInfo *src_info = src->info();
+    const ITensorInfo *dst_info = dst->info();
+
+    const int in_ch    = static_cast<int>(src_info->dimension(0));
+    const int in_w     = static_cast<int>(src_info->dimension(1));
+    const int in_h     = static_cast<int>(src_info->dimension(2));
+    const int out_ch   = static_cast<int>(dst_info->dimension(0));
+    const int out_w    = static_cast<int>(dst_info->dimension(1));
+    const int exp_ch   = static_cast<int>(exp_channels);
+    const int kernel_h = static_cast<int>(dw_kernel.height);
+    const int stride_x = static_cast<int>(info.depthwise_info.stride().first);
+    const int stride_y = static_cast<int>(info.depthwise_info.stride().second);
+    const int pad_left = static_cast<int>(info.depthwise_info.pad_left());
+    const int pad_top  = static_cast<int>(info.depthwise_info.pad_top());
+
+    // Packed parameters
+    const auto offsets = kernels::CpuInvertedResidualKernel::packed_offsets(in_ch, exp_ch, out_ch, dw_kernel);
+    const T   *packed = reinterpret_cast<const T *>(weights->buffer() + weights->info()->offset_first_element_in_bytes());
+
+    // Per-thread working buffer: a ring of kernel_h expanded rows followed by the depthwise output row
+    const size_t working_elements =
+        kernels::CpuInvertedResidualKernel::working_elements_per_thread(src_info, dst_info, exp_channels, dw_kernel);
+    ARM_COMPUTE_ERROR_ON((thread_info.thread_id + 1) * working_elements * sizeof(T) >
+                         workspace->info()->total_size());
+    T *ring = reinterpret_cast<T *>(workspace->buffer() + workspace->info()->offset_first_element_in_bytes()) +
+              thread_info.thread_id * working_elements;
+    T *dw_out = ring + kernel_h * in_w * exp_ch;
+
+    const auto expand_bounds    = detail::activation_bounds<T>(info.expand_act);
+    const auto depthwise_bounds = detail::activation_bounds<T>(info.depthwise_act);
+    const auto project_bounds   = detail::activation_bounds<T>(info.project_act);
+
+    const Strides &src_strides  = src_info->strides_in_bytes();
+    const Strides &dst_strides  = dst_info->strides_in_bytes();
+    const size_t   src_stride_x = src_strides[1] / sizeof(T);
+    const size_t   dst_stride_x = dst_strides[1] / sizeof(T);
+    const uint8_t *src_base     = src->buffer() + src_info->offset_first_element_in_bytes();
+    uint8_t       *dst_base     = dst->buffer() + dst_info->offset_first_element_in_bytes();
+
+    // Input row currently held by each slot of the ring
+    std::vector<int>       slot_row(kernel_h, -1);
+    std::vector<const T *> rows(kernel_h, nullptr);
+
+    for (int b = window[Window::DimW].start(); b < window[Window::DimW].end(); ++b)
+    {
+        std::fill(slot_row.begin(), slot_row.end(), -1);
+        const auto src_row = [&](int y)
+        { return reinterpret_cast<const T *>(src_base + y * src_strides[2] + b * src_strides[3]); };
+
+        for (int oy = window[Window::DimZ].start(); oy < window[Window::DimZ].end(); ++oy)
+        {
+            // Expand the input rows needed by this output row that are not in the ring yet
+            for (int ky = 0; ky < kernel_h; ++ky)
+            {
+                const int iy = oy * stride_y - pad_top + ky;
+                if (iy < 0 || iy >= in_h)
+                {
+                    rows[ky] = nullptr;
+                    continue;
+                }
+                const int slot     = iy % kernel_h;
+                T        *slot_ptr = ring + slot * in_w * exp_ch;
+                if (slot_row[slot] != iy)
+                {
+                    detail::pointwise_row<T>(src_row(iy), src_stride_x, in_w, in_ch, packed + offsets.expand_weights,
+                                             packed + offsets.expand_bias, exp_ch, slot_ptr, exp_ch, expand_bounds,
+                                             nullptr, 0);
+                    slot_row[slot] = iy;
+                }
+                rows[ky] = slot_ptr;
+            }
+
+            detail::depthwise_row<T>(rows.data(), in_w, exp_ch, packed + offsets.depthwise_weights,
+                                     packed + offsets.depthwise_bias, dw_kernel, stride_x, pad_left, out_w, dw_out,
+                                     depthwise_bounds);
+
+            T *out_row = reinterpret_cast<T *>(dst_base + oy * dst_strides[2] + b * dst_strides[3]);
+            detail::pointwise_row<T>(dw_out, exp_ch, out_w, exp_ch, packed + offsets.project_weights,
+                                     packed + offsets.project_bias, out_ch, out_row, dst_stride_x, project_bounds,
+                                     info.residual ? src_row(oy) : nullptr, src_stride_x);
+        }
+    }
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_INVERTEDRESIDUAL_GENERIC_NEON_IMPL_H
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_KVCACHE_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_KVCACHE_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/QuantizationInfo.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/NEAsymm.h"
+
+#include <arm_neon.h>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Load 16 values as floats */
+template <typename T>
+inline float32x4x4_t kvcache_load(const T *ptr);
+
+template <>
+inline float32x4x4_t kvcache_load(const float *ptr)
+{
+    return {{vld1q_f32(ptr), vld1q_f32(ptr + 4), vld1q_f32(ptr + 8), vld1q_f32(ptr + 12)}};
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+template <>
+inline float32x4x4_t kvcache_load(const float16_t *ptr)
+{
+    const float16x8_t v0 = vld1q_f16(ptr);
+    const float16x8_t v1 = vld1q_f16(ptr + 8);
+    return {{vcvt_f32_f16(vget_low_f16(v0)), vcvt_f32_f16(vget_high_f16(v0)), vcvt_f32_f16(vget_low_f16(v1)),
+             vcvt_f32_f16(vget_high_f16(v1))}};
+}
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+/** Quantize rows of keys or values into an int8 cache, the head (Z coordinate) selecting the scale
+ *
+ * @param[in]  src    Rows to append, of dimensions [head_dim, tokens, num_heads, batches].
+ * @param[out] dst    View of the cache starting at the first free position.
+ * @param[in]  window Region on which to execute the kernel, with a single step along X.
+ */
+template <typename T>
+void kvcache_append_qsymm8(const ITensor *src, ITensor *dst, const Window &window)
+{
+    const int                 head_dim = static_cast<int>(src->info()->dimension(0));
+    const std::vector<float> &scales   = dst->info()->quantization_info().scale();
+
+    Iterator src_it(src, window);
+    Iterator dst_it(dst, window);
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &id)
+        {
+            const UniformQuantizationInfo qinfo(scales[id.z()], 0);
+
+            const auto *in  = reinterpret_cast<const T *>(src_it.ptr());
+            auto       *out = reinterpret_cast<int8_t *>(dst_it.ptr());
+
+            int x = 0;
+            for (; x <= head_dim - 16; x += 16)
+            {
+                vst1q_s8(out + x, vquantize_signed(kvcache_load(in + x), qinfo));
+            }
+            for (; x < head_dim; ++x)
+            {
+                out[x] = quantize_qasymm8_signed(static_cast<float>(in[x]), qinfo);
+            }
+        },
+        src_it, dst_it);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_KVCACHE_GENERIC_NEON_IMPL_H
@@ -0,0 +1,557 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_MULTIAXISREDUCTION_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_MULTIAXISREDUCTION_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/wrapper/wrapper.h"
+#include "src/cpu/kernels/multiaxisreduction/list.h"
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace multi_axis_reduction
+{
+// Number of source elements loaded at once, widened to four vectors of 32-bit accumulators
+constexpr int window_step_x = 16;
+// Number of columns accumulated on the stack when the innermost dimension is kept
+constexpr int block_x = 256;
+
+/** Accumulation traits of every source type: floating-point types accumulate in F32, quantized types in S32 */
+template <typename T>
+struct Traits;
+
+template <>
+struct Traits<float>
+{
+    using acc_type = float;
+    using vec_type = float32x4_t;
+
+    static inline void load(const float *ptr, vec_type (&v)[4])
+    {
+        v[0] = vld1q_f32(ptr);
+        v[1] = vld1q_f32(ptr + 4);
+        v[2] = vld1q_f32(ptr + 8);
+        v[3] = vld1q_f32(ptr + 12);
+    }
+    static inline acc_type widen(float value)
+    {
+        return value;
+    }
+    static inline float finalize(acc_type acc, const MultiAxisReductionParams &params)
+    {
+        return acc * params.scale;
+    }
+};
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+template <>
+struct Traits<float16_t>
+{
+    using acc_type = float;
+    using vec_type = float32x4_t;
+
+    // Half-precision values are summed in single precision, so long reductions do not lose the small terms
+    static inline void load(const float16_t *ptr, vec_type (&v)[4])
+    {
+        const float16x8_t a = vld1q_f16(ptr);
+        const float16x8_t b = vld1q_f16(ptr + 8);
+        v[0]                = vcvt_f32_f16(vget_low_f16(a));
+        v[1]                = vcvt_f32_f16(vget_high_f16(a));
+        v[2]                = vcvt_f32_f16(vget_low_f16(b));
+        v[3]                = vcvt_f32_f16(vget_high_f16(b));
+    }
+    static inline acc_type widen(float16_t value)
+    {
+        return static_cast<float>(value);
+    }
+    static inline float16_t finalize(acc_type acc, const MultiAxisReductionParams &params)
+    {
+        return static_cast<float16_t>(acc * params.scale);
+    }
+};
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+/** Requantize an S32 accumulator holding a sum, a mean numerator or a single value */
+template <typename T>
+inline T requantize(int32_t acc, const MultiAxisReductionParams &params)
+{
+    const float value = support::cpp11::nearbyint(static_cast<float>(acc) * params.scale + params.offset);
+    return static_cast<T>(
+        utility::clamp<float>(value, std::numeric_limits<T>::lowest(), std::numeric_limits<T>::max()));
+}
+
+template <>
+struct Traits<uint8_t>
+{
+    using acc_type = int32_t;
+    using vec_type = int32x4_t;
+
+    static inline void load(const uint8_t *ptr, vec_type (&v)[4])
+    {
+        const uint8x16_t a  = vld1q_u8(ptr);
+        const uint16x8_t lo = vmovl_u8(vget_low_u8(a));
+        const uint16x8_t hi = vmovl_u8(vget_high_u8(a));
+        v[0]                = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(lo)));
+        v[1]                = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(lo)));
+        v[2]                = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(hi)));
+        v[3]                = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(hi)));
+    }
+    static inline acc_type widen(uint8_t value)
+    {
+        return value;
+    }
+    static inline uint8_t finalize(acc_type acc, const MultiAxisReductionParams &params)
+    {
+        return requantize<uint8_t>(acc, params);
+    }
+};
+
+template <>
+struct Traits<int8_t>
+{
+    using acc_type = int32_t;
+    using vec_type = int32x4_t;
+
+    static inline void load(const int8_t *ptr, vec_type (&v)[4])
+    {
+        const int8x16_t a  = vld1q_s8(ptr);
+        const int16x8_t lo = vmovl_s8(vget_low_s8(a));
+        const int16x8_t hi = vmovl_s8(vget_high_s8(a));
+        v[0]               = vmovl_s16(vget_low_s16(lo));
+        v[1]               = vmovl_s16(vget_high_s16(lo));
+        v[2]               = vmovl_s16(vget_low_s16(hi));
+        v[3]               = vmovl_s16(vget_high_s16(hi));
+    }
+    static inline acc_type widen(int8_t value)
+    {
+        return value;
+    }
+    static inline int8_t finalize(acc_type acc, const MultiAxisReductionParams &params)
+    {
+        return requantize<int8_t>(acc, params);
+    }
+};
+
+/** Reduction operations on accumulators. The mean is a sum finalized with a scale of 1/N */
+struct Sum
+{
+    template <typename U>
+    static inline U identity()
+    {
+        return U(0);
+    }
+    template <typename V>
+    static inline V vector(const V &a, const V &b)
+    {
+        return wrapper::vadd(a, b);
+    }
+    template <typename U>
+    static inline U scalar(U a, U b)
+    {
+        return a + b;
+    }
+};
+
+struct Prod
+{
+    template <typename U>
+    static inline U identity()
+    {
+        return U(1);
+    }
+    template <typename V>
+    static inline V vector(const V &a, const V &b)
+    {
+        return wrapper::vmul(a, b);
+    }
+    template <typename U>
+    static inline U scalar(U a, U b)
+    {
+        return a * b;
+    }
+};
+
+struct Max
+{
+    template <typename U>
+    static inline U identity()
+    {
+        return std::numeric_limits<U>::has_infinity ? -std::numeric_limits<U>::infinity()
+                                                    : std::numeric_limits<U>::lowest();
+    }
+    template <typename V>
+    static inline V vector(const V &a, const V &b)
+    {
+        return wrapper::vmax(a, b);
+    }
+    template <typename U>
+    static inline U scalar(U a, U b)
+    {
+        return std::max(a, b);
+    }
+};
+
+struct Min
+{
+    template <typename U>
+    static inline U identity()
+    {
+        return std::numeric_limits<U>::has_infinity ? std::numeric_limits<U>::infinity()
+                                                    : std::numeric_limits<U>::max();
+    }
+    template <typename V>
+    static inline V vector(const V &a, const V &b)
+    {
+        return wrapper::vmin(a, b);
+    }
+    template <typename U>
+    static inline U scalar(U a, U b)
+    {
+        return std::min(a, b);
+    }
+};
+
+/** Accumulate @p len consecutive source elements into @p acc */
+template <typename T, typename Op>
+inline void accumulate_row(const T *row, typename Traits<T>::acc_type *acc, int len)
+{
+    using VecType = typename Traits<T>::vec_type;
+
+    int x = 0;
+    for (; x <= len - window_step_x; x += window_step_x)
+    {
+        VecType v[4];
+        Traits<T>::load(row + x, v);
+        for (int i = 0; i < 4; ++i)
+        {
+            wrapper::vstore(acc + x + 4 * i, Op::vector(wrapper::vloadq(acc + x + 4 * i), v[i]));
+        }
+    }
+    for (; x < len; ++x)
+    {
+        acc[x] = Op::scalar(acc[x], Traits<T>::widen(row[x]));
+    }
+}
+
+/** Reduce the source elements of [x_start, x_end) of a row into four vector accumulators and a scalar one */
+template <typename T, typename Op>
+inline void accumulate_span(const T                      *row,
+                            int                           x_start,
+                            int                           x_end,
+                            typename Traits<T>::vec_type (&vacc)[4],
+                            typename Traits<T>::acc_type &sacc)
+{
+    using VecType = typename Traits<T>::vec_type;
+
+    int x = x_start;
+    for (; x <= x_end - window_step_x; x += window_step_x)
+    {
+        VecType v[4];
+        Traits<T>::load(row + x, v);
+        for (int i = 0; i < 4; ++i)
+        {
+            vacc[i] = Op::vector(vacc[i], v[i]);
+        }
+    }
+    for (; x < x_end; ++x)
+    {
+        sacc = Op::scalar(sacc, Traits<T>::widen(row[x]));
+    }
+}
+
+/** Reduce a region of the source
+ *
+ * Kept dimensions iterate over [start, end) and every output reduces the whole [start, end) range of the reduced
+ * dimensions. Outputs are finalized into the destination, or stored unfinalized into @p partial when not nullptr.
+ */
+template <typename T, typename Op>
+void reduce_region(const ITensor                                        *src,
+                   ITensor                                              *dst,
+                   typename Traits<T>::acc_type                         *partial,
+                   const MultiAxisReductionParams                       &params,
+                   const std::array<int, multi_axis_reduction_max_dims> &start,
+                   const std::array<int, multi_axis_reduction_max_dims> &end)
+{
+    using AccType = typename Traits<T>::acc_type;
+    using VecType = typename Traits<T>::vec_type;
+
+    const ITensorInfo &src_info    = *src->info();
+    const Strides     &src_strides = src_info.strides_in_bytes();
+    const uint8_t     *src_base    = src->buffer() + src_info.offset_first_element_in_bytes();
+    uint8_t           *dst_base    = dst->buffer() + dst->info()->offset_first_element_in_bytes();
+
+    // Outer loops walk the kept coordinates, inner loops the reduced ones
+    std::array<int, multi_axis_reduction_max_dims> outer_start{};
+    std::array<int, multi_axis_reduction_max_dims> outer_end{};
+    for (size_t d = 0; d < multi_axis_reduction_max_dims; ++d)
+    {
+        outer_start[d] = params.is_reduced[d] ? 0 : start[d];
+        outer_end[d]   = params.is_reduced[d] ? 1 : end[d];
+    }
+
+    const auto row_offset = [&](int c1, int c2, int c3)
+    { return c1 * src_strides[1] + c2 * src_strides[2] + c3 * src_strides[3]; };
+
+    for (int o3 = outer_start[3]; o3 < outer_end[3]; ++o3)
+    {
+        const int r3_start = params.is_reduced[3] ? start[3] : o3;
+        const int r3_end   = params.is_reduced[3] ? end[3] : o3 + 1;
+        for (int o2 = outer_start[2]; o2 < outer_end[2]; ++o2)
+        {
+            const int r2_start = params.is_reduced[2] ? start[2] : o2;
+            const int r2_end   = params.is_reduced[2] ? end[2] : o2 + 1;
+            for (int o1 = outer_start[1]; o1 < outer_end[1]; ++o1)
+            {
+                const int r1_start = params.is_reduced[1] ? start[1] : o1;
+                const int r1_end   = params.is_reduced[1] ? end[1] : o1 + 1;
+
+                const size_t dst_offset =
+                    o1 * params.dst_strides[1] + o2 * params.dst_strides[2] + o3 * params.dst_strides[3];
+                const size_t partial_offset =
+                    o1 * params.partial_strides[1] + o2 * params.partial_strides[2] + o3 * params.partial_strides[3];
+
+                if (!params.is_reduced[0])
+                {
+                    // Accumulate whole blocks of columns while streaming over the reduced rows
+                    for (int xb = start[0]; xb < end[0]; xb += block_x)
+                    {
+                        const int len = std::min(block_x, end[0] - xb);
+                        AccType   acc[block_x];
+                        std::fill_n(acc, len, Op::template identity<AccType>());
+
+                        for (int r3 = r3_start; r3 < r3_end; ++r3)
+                        {
+                            for (int r2 = r2_start; r2 < r2_end; ++r2)
+                            {
+                                for (int r1 = r1_start; r1 < r1_end; ++r1)
+                                {
+                                    const T *row =
+                                        reinterpret_cast<const T *>(src_base + row_offset(r1, r2, r3)) + xb;
+                                    accumulate_row<T, Op>(row, acc, len);
+                                }
+                            }
+                        }
+
+                        if (partial != nullptr)
+                        {
+                            std::copy_n(acc, len, partial + partial_offset + xb);
+                        }
+                        else
+                        {
+                            T *out = reinterpret_cast<T *>(dst_base + dst_offset) + xb;
+                            for (int x = 0; x < len; ++x)
+                            {
+                                out[x] = Traits<T>::finalize(acc[x], params);
+                            }
+                        }
+                    }
+                }
+                else
+                {
+                    VecType vacc[4];
+                    for (int i = 0; i < 4; ++i)
+                    {
+                        vacc[i] = wrapper::vdup_n(Op::template identity<AccType>(), wrapper::traits::vector_128_tag{});
+                    }
+                    AccType sacc = Op::template identity<AccType>();
+
+                    for (int r3 = r3_start; r3 < r3_end; ++r3)
+                    {
+                        for (int r2 = r2_start; r2 < r2_end; ++r2)
+                        {
+                            for (int r1 = r1_start; r1 < r1_end; ++r1)
+                            {
+                                const T *row = reinterpret_cast<const T *>(src_base + row_offset(r1, r2, r3));
+                                accumulate_span<T, Op>(row, start[0], end[0], vacc, sacc);
+                            }
+                        }
+                    }
+
+                    // Fold the vector accumulators into the scalar one
+                    const VecType v = Op::vector(Op::vector(vacc[0], vacc[1]), Op::vector(vacc[2], vacc[3]));
+                    AccType       lanes[4];
+                    wrapper::vstore(lanes, v);
+                    for (int i = 0; i < 4; ++i)
+                    {
+                        sacc = Op::scalar(sacc, lanes[i]);
+                    }
+
+                    if (partial != nullptr)
+                    {
+                        partial[partial_offset] = sacc;
+                    }
+                    else
+                    {
+                        *reinterpret_cast<T *>(dst_base + dst_offset) = Traits<T>::finalize(sacc, params);
+                    }
+                }
+            }
+        }
+    }
+}
+
+template <typename T, typename Op>
+void reduce(
+    const ITensor *src, ITensor *dst, ITensor *partials, const MultiAxisReductionParams &params, const Window &window)
+{
+    using AccType = typename Traits<T>::acc_type;
+
+    std::array<int, multi_axis_reduction_max_dims> start{};
+    std::array<int, multi_axis_reduction_max_dims> end{};
+    for (size_t d = 0; d < multi_axis_reduction_max_dims; ++d)
+    {
+        end[d] = static_cast<int>(params.shape[d]);
+    }
+
+    if (params.num_partials == 0)
+    {
+        // The window spans the kept dimensions, every output reduces the whole reduced dimensions
+        for (size_t d = 0; d < multi_axis_reduction_max_dims; ++d)
+        {
+            if (!params.is_reduced[d])
+            {
+                start[d] = window[d].start();
+                end[d]   = std::min(window[d].end(), end[d]);
+            }
+        }
+        reduce_region<T, Op>(src, dst, nullptr, params, start, end);
+    }
+    else
+    {
+        // The window spans the slices of the split axis, every slice covers all the outputs
+        AccType  *partial_base = reinterpret_cast<AccType *>(partials->buffer());
+        const int split_size   = end[params.split_axis];
+        for (int p = window.x().start(); p < window.x().end(); ++p)
+        {
+            start[params.split_axis] = p * split_size / static_cast<int>(params.num_partials);
+            end[params.split_axis]   = (p + 1) * split_size / static_cast<int>(params.num_partials);
+            reduce_region<T, Op>(src, dst, partial_base + p * params.num_outputs, params, start, end);
+        }
+    }
+}
+
+template <typename T, typename Op>
+void combine(const ITensor *partials, ITensor *dst, const MultiAxisReductionParams &params)
+{
+    using AccType = typename Traits<T>::acc_type;
+
+    const AccType *partial_base = reinterpret_cast<const AccType *>(partials->buffer());
+    uint8_t       *dst_base     = dst->buffer() + dst->info()->offset_first_element_in_bytes();
+
+    // Partial results are laid out like the source with the reduced dimensions removed
+    std::array<int, multi_axis_reduction_max_dims> size{};
+    for (size_t d = 0; d < multi_axis_reduction_max_dims; ++d)
+    {
+        size[d] = params.is_reduced[d] ? 1 : static_cast<int>(params.shape[d]);
+    }
+
+    for (int c3 = 0; c3 < size[3]; ++c3)
+    {
+        for (int c2 = 0; c2 < size[2]; ++c2)
+        {
+            for (int c1 = 0; c1 < size[1]; ++c1)
+            {
+                for (int c0 = 0; c0 < size[0]; ++c0)
+                {
+                    const size_t index = c0 * params.partial_strides[0] + c1 * params.partial_strides[1] +
+                                         c2 * params.partial_strides[2] + c3 * params.partial_strides[3];
+                    const size_t dst_offset = c0 * params.dst_strides[0] + c1 * params.dst_strides[1] +
+                                              c2 * params.dst_strides[2] + c3 * params.dst_strides[3];
+
+                    AccType acc = partial_base[index];
+                    for (unsigned int p = 1; p < params.num_partials; ++p)
+                    {
+                        acc = Op::scalar(acc, partial_base[p * params.num_outputs + index]);
+                    }
+                    *reinterpret_cast<T *>(dst_base + dst_offset) = Traits<T>::finalize(acc, params);
+                }
+            }
+        }
+    }
+}
+
+} // namespace multi_axis_reduction
+
+/** Dispatch a reduction or combine function on the reduction operation */
+template <typename T>
+void multi_axis_reduction_neon(
+    const ITensor *src, ITensor *dst, ITensor *partials, const MultiAxisReductionParams &params, const Window &window)
+{
+    switch (params.op)
+    {
+        case ReductionOperation::SUM:
+        case ReductionOperation::MEAN_SUM:
+            multi_axis_reduction::reduce<T, multi_axis_reduction::Sum>(src, dst, partials, params, window);
+            break;
+        case ReductionOperation::PROD:
+            multi_axis_reduction::reduce<T, multi_axis_reduction::Prod>(src, dst, partials, params, window);
+            break;
+        case ReductionOperation::MAX:
+            multi_axis_reduction::reduce<T, multi_axis_reduction::Max>(src, dst, partials, params, window);
+            break;
+        case ReductionOperation::MIN:
+            multi_axis_reduction::reduce<T, multi_axis_reduction::Min>(src, dst, partials, params, window);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported reduction operation");
+    }
+}
+
+template <typename T>
+void multi_axis_reduction_combine_neon(const ITensor *partials, ITensor *dst, const MultiAxisReductionParams &params)
+{
+    switch (params.op)
+    {
+        case ReductionOperation::SUM:
+        case ReductionOperation::MEAN_SUM:
+            multi_axis_reduction::combine<T, multi_axis_reduction::Sum>(partials, dst, params);
+            break;
+        case ReductionOperation::PROD:
+            multi_axis_reduction::combine<T, multi_axis_reduction::Prod>(partials, dst, params);
+            break;
+        case ReductionOperation::MAX:
+            multi_axis_reduction::combine<T, multi_axis_reduction::Max>(partials, dst, params);
+            break;
+        case ReductionOperation::MIN:
+            multi_axis_reduction::combine<T, multi_axis_reduction::Min>(partials, dst, params);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported reduction operation");
+    }
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_MULTIAXISREDUCTION_GENERIC_NEON_IMPL_H
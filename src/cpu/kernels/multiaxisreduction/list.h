@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_MULTIAXISREDUCTION_LIST_H
+#define ACL_SRC_CPU_KERNELS_MULTIAXISREDUCTION_LIST_H
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+
+#include <array>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Maximum number of source dimensions handled by the multi-axis reduction micro-kernels */
+constexpr size_t multi_axis_reduction_max_dims = 4;
+
+/** Description of a multi-axis reduction shared by the micro-kernels
+ *
+ * Strides are given for every source dimension and are 0 along reduced dimensions, so the same description covers
+ * destinations that keep the reduced dimensions and destinations that drop them. Every output is finalized as
+ * acc * scale + offset, rounded and saturated for quantized types.
+ *
+ * When @p num_partials is not 0, the split axis is divided into @p num_partials slices and every slice is reduced
+ * into its own row of 32-bit accumulators, later merged into the destination by the combine micro-kernel.
+ */
+struct MultiAxisReductionParams
+{
+    using DimArray  = std::array<size_t, multi_axis_reduction_max_dims>;
+    using MaskArray = std::array<bool, multi_axis_reduction_max_dims>;
+
+    ReductionOperation op{ReductionOperation::SUM}; /**< Reduction operation */
+    DimArray           shape{};                     /**< Source dimensions */
+    MaskArray          is_reduced{};                /**< Reduced source dimensions */
+    DimArray           dst_strides{};               /**< Destination strides in bytes */
+    DimArray           partial_strides{};           /**< Partial result strides in elements */
+    size_t             num_outputs{1};              /**< Number of outputs */
+    unsigned int       split_axis{0};               /**< Reduced dimension divided into slices */
+    unsigned int       num_partials{0};             /**< Number of slices, 0 if not split */
+    float              scale{1.f};                  /**< Multiplier applied to the accumulator */
+    float              offset{0.f};                 /**< Offset added after the multiplication */
+};
+
+#define DECLARE_MULTI_AXIS_REDUCTION_KERNEL(func_name)                                                         \
+    void func_name(const ITensor *src, ITensor *dst, ITensor *partials, const MultiAxisReductionParams &params, \
+                   const Window &window)
+
+#define DECLARE_MULTI_AXIS_REDUCTION_COMBINE_KERNEL(func_name) \
+    void func_name(const ITensor *partials, ITensor *dst, const MultiAxisReductionParams &params)
+
+DECLARE_MULTI_AXIS_REDUCTION_KERNEL(neon_fp32_multi_axis_reduction);
+DECLARE_MULTI_AXIS_REDUCTION_KERNEL(neon_fp16_multi_axis_reduction);
+DECLARE_MULTI_AXIS_REDUCTION_KERNEL(neon_qu8_multi_axis_reduction);
+DECLARE_MULTI_AXIS_REDUCTION_KERNEL(neon_qs8_multi_axis_reduction);
+
+DECLARE_MULTI_AXIS_REDUCTION_COMBINE_KERNEL(neon_fp32_multi_axis_reduction_combine);
+DECLARE_MULTI_AXIS_REDUCTION_COMBINE_KERNEL(neon_fp16_multi_axis_reduction_combine);
+DECLARE_MULTI_AXIS_REDUCTION_COMBINE_KERNEL(neon_qu8_multi_axis_reduction_combine);
+DECLARE_MULTI_AXIS_REDUCTION_COMBINE_KERNEL(neon_qs8_multi_axis_reduction_combine);
+
+#undef DECLARE_MULTI_AXIS_REDUCTION_KERNEL
+#undef DECLARE_MULTI_AXIS_REDUCTION_COMBINE_KERNEL
+
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_MULTIAXISREDUCTION_LIST_H
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_PAGEDATTENTION_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_PAGEDATTENTION_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/NEMath.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Load 4 values as floats */
+template <typename T>
+inline float32x4_t paged_attention_load(const T *ptr);
+
+template <>
+inline float32x4_t paged_attention_load(const float *ptr)
+{
+    return vld1q_f32(ptr);
+}
+
+/** Store 4 floats as values of type T */
+template <typename T>
+inline void paged_attention_store(T *ptr, const float32x4_t &v);
+
+template <>
+inline void paged_attention_store(float *ptr, const float32x4_t &v)
+{
+    vst1q_f32(ptr, v);
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+template <>
+inline float32x4_t paged_attention_load(const float16_t *ptr)
+{
+    return vcvt_f32_f16(vld1_f16(ptr));
+}
+
+template <>
+inline void paged_attention_store(float16_t *ptr, const float32x4_t &v)
+{
+    vst1_f16(ptr, vcvt_f16_f32(v));
+}
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+/** Horizontal sum of the lanes of a vector */
+inline float paged_attention_reduce(const float32x4_t &v)
+{
+#ifdef __aarch64__
+    return vaddvq_f32(v);
+#else  //__aarch64__
+    const float32x2_t s = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+    return vget_lane_f32(vpadd_f32(s, s), 0);
+#endif //__aarch64__
+}
+
+/** Attention of one query per head and sequence over keys and values scattered in blocks
+ *
+ * Every window step computes a query head of a sequence: the scores of all the positions of the sequence are written
+ * to the thread's slice of @p working, followed by the softmax and the weighted sum of the values, accumulated in
+ * single precision.
+ */
+template <typename T>
+void paged_attention_neon(const ITensor    *q,
+                          const ITensor    *k,
+                          const ITensor    *v,
+                          const ITensor    *block_tables,
+                          const ITensor    *seq_lens,
+                          ITensor          *working,
+                          ITensor          *dst,
+                          float             scale,
+                          const Window     &window,
+                          const ThreadInfo &info)
+{
+    const int head_dim      = static_cast<int>(q->info()->dimension(0));
+    const int block_size    = static_cast<int>(k->info()->dimension(1));
+    const int group         = static_cast<int>(q->info()->dimension(1) / k->info()->dimension(2));
+    const int max_positions = static_cast<int>(block_tables->info()->dimension(0)) * block_size;
+
+    const Strides &k_strides = k->info()->strides_in_bytes();
+    const Strides &v_strides = v->info()->strides_in_bytes();
+    const uint8_t *k_base    = k->buffer() + k->info()->offset_first_element_in_bytes();
+    const uint8_t *v_base    = v->buffer() + v->info()->offset_first_element_in_bytes();
+
+    float *scores = reinterpret_cast<float *>(working->buffer() + working->info()->offset_first_element_in_bytes()) +
+                    info.thread_id * (max_positions + head_dim);
+    float *acc = scores + max_positions;
+
+    Iterator q_it(q, window);
+    Iterator dst_it(dst, window);
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &id)
+        {
+            const int   kv_head = id.y() / group;
+            const int   len     = *reinterpret_cast<const int32_t *>(seq_lens->ptr_to_element(Coordinates(id.z())));
+            const auto *table = reinterpret_cast<const int32_t *>(block_tables->ptr_to_element(Coordinates(0, id.z())));
+            const auto *q_ptr = reinterpret_cast<const T *>(q_it.ptr());
+            auto       *out   = reinterpret_cast<T *>(dst_it.ptr());
+
+            // The scores of a longer sequence would overflow the working buffer
+            if (len > max_positions)
+            {
+                ARM_COMPUTE_ERROR("Sequence length exceeds the capacity of its block table");
+            }
+
+            if (len <= 0)
+            {
+                std::fill_n(out, head_dim, static_cast<T>(0));
+                return;
+            }
+
+            const auto row_offset = [&](const Strides &strides, int pos)
+            {
+                return (pos % block_size) * strides[1] + kv_head * strides[2] + table[pos / block_size] * strides[3];
+            };
+
+            // Scores of the query against every key of the sequence
+            float max_score = -std::numeric_limits<float>::infinity();
+            for (int p = 0; p < len; ++p)
+            {
+                const auto *k_ptr = reinterpret_cast<const T *>(k_base + row_offset(k_strides, p));
+
+                float32x4_t vdot = vdupq_n_f32(0.f);
+                int         x    = 0;
+                for (; x <= head_dim - 4; x += 4)
+                {
+                    vdot = vmlaq_f32(vdot, paged_attention_load(q_ptr + x), paged_attention_load(k_ptr + x));
+                }
+                float dot = paged_attention_reduce(vdot);
+                for (; x < head_dim; ++x)
+                {
+                    dot += static_cast<float>(q_ptr[x]) * static_cast<float>(k_ptr[x]);
+                }
+
+                scores[p] = dot * scale;
+                max_score = std::max(max_score, scores[p]);
+            }
+
+            // Softmax numerators
+            const float32x4_t vmax = vdupq_n_f32(max_score);
+            float32x4_t       vsum = vdupq_n_f32(0.f);
+            int               p    = 0;
+            for (; p <= len - 4; p += 4)
+            {
+                const float32x4_t e = vexpq_f32(vsubq_f32(vld1q_f32(scores + p), vmax));
+                vst1q_f32(scores + p, e);
+                vsum = vaddq_f32(vsum, e);
+            }
+            float sum = paged_attention_reduce(vsum);
+            for (; p < len; ++p)
+            {
+                scores[p] = std::exp(scores[p] - max_score);
+                sum += scores[p];
+            }
+
+            // Weighted sum of the values
+            std::fill_n(acc, head_dim, 0.f);
+            for (p = 0; p < len; ++p)
+            {
+                const auto *v_ptr = reinterpret_cast<const T *>(v_base + row_offset(v_strides, p));
+                const float w     = scores[p];
+
+                int x = 0;
+                for (; x <= head_dim - 4; x += 4)
+                {
+                    vst1q_f32(acc + x, vmlaq_n_f32(vld1q_f32(acc + x), paged_attention_load(v_ptr + x), w));
+                }
+                for (; x < head_dim; ++x)
+                {
+                    acc[x] += w * static_cast<float>(v_ptr[x]);
+                }
+            }
+
+            const float inv_sum = 1.f / sum;
+            int         x       = 0;
+            for (; x <= head_dim - 4; x += 4)
+            {
+                paged_attention_store(out + x, vmulq_n_f32(vld1q_f32(acc + x), inv_sum));
+            }
+            for (; x < head_dim; ++x)
+            {
+                out[x] = static_cast<T>(acc[x] * inv_sum);
+            }
+        },
+        q_it, dst_it);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_PAGEDATTENTION_GENERIC_NEON_IMPL_H
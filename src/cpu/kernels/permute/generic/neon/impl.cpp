@@ -0,0 +1,390 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/permute/generic/neon/impl.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/core/utils/math/Math.h"
+
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+constexpr size_t max_dims = Coordinates::num_max_dimensions;
+
+/** Dimensions of the source transposed by a permutation */
+struct TransposedDims
+{
+    size_t inner; /**< Innermost dimension of the source */
+    size_t outer; /**< Source dimension that becomes the innermost dimension of the destination */
+};
+
+/** Source dimension of a destination dimension: dimensions past the permutation vector are not permuted */
+size_t source_dimension(const PermutationVector &perm, size_t dst_dim)
+{
+    return dst_dim < perm.num_dimensions() ? perm[dst_dim] : dst_dim;
+}
+
+TransposedDims get_transposed_dims(const TensorShape &src_shape, const PermutationVector &perm)
+{
+    // Dimensions of size 1 do not move any data, so skip them
+    TransposedDims dims{0, 0};
+    for (size_t d = 0; d < max_dims; ++d)
+    {
+        if (src_shape[d] > 1)
+        {
+            dims.inner = d;
+            break;
+        }
+    }
+    dims.outer = dims.inner;
+    for (size_t d = 0; d < max_dims; ++d)
+    {
+        const size_t src_dim = source_dimension(perm, d);
+        if (src_shape[src_dim] > 1)
+        {
+            dims.outer = src_dim;
+            break;
+        }
+    }
+    return dims;
+}
+
+/** Destination strides indexed by source dimension */
+Strides get_permuted_dst_strides(const ITensorInfo &dst, const PermutationVector &perm)
+{
+    Strides strides{};
+    for (size_t d = 0; d < max_dims; ++d)
+    {
+        strides.set(source_dimension(perm, d), dst.strides_in_bytes()[d]);
+    }
+    return strides;
+}
+
+/** Number of elements of the blocks along the transposed dimensions, small enough to stay in L1 */
+int block_size(size_t element_size)
+{
+    return element_size == 1 ? 64 : 32;
+}
+
+/** Register tile transposes */
+template <typename T>
+struct TransposeTile;
+
+template <>
+struct TransposeTile<uint8_t>
+{
+    static constexpr size_t size = 8;
+
+    static void run(const uint8_t *src, size_t src_stride, uint8_t *dst, size_t dst_stride)
+    {
+        const uint8x8_t row0 = vld1_u8(src + 0 * src_stride);
+        const uint8x8_t row1 = vld1_u8(src + 1 * src_stride);
+        const uint8x8_t row2 = vld1_u8(src + 2 * src_stride);
+        const uint8x8_t row3 = vld1_u8(src + 3 * src_stride);
+        const uint8x8_t row4 = vld1_u8(src + 4 * src_stride);
+        const uint8x8_t row5 = vld1_u8(src + 5 * src_stride);
+        const uint8x8_t row6 = vld1_u8(src + 6 * src_stride);
+        const uint8x8_t row7 = vld1_u8(src + 7 * src_stride);
+
+        // Transpose 2x2
+        const uint8x8x2_t k0_u8 = vtrn_u8(row0, row1);
+        const uint8x8x2_t k1_u8 = vtrn_u8(row2, row3);
+        const uint8x8x2_t k2_u8 = vtrn_u8(row4, row5);
+        const uint8x8x2_t k3_u8 = vtrn_u8(row6, row7);
+
+        // Transpose 4x4
+        const uint16x4x2_t k0_u16 = vtrn_u16(vreinterpret_u16_u8(k0_u8.val[0]), vreinterpret_u16_u8(k1_u8.val[0]));
+        const uint16x4x2_t k1_u16 = vtrn_u16(vreinterpret_u16_u8(k0_u8.val[1]), vreinterpret_u16_u8(k1_u8.val[1]));
+        const uint16x4x2_t k2_u16 = vtrn_u16(vreinterpret_u16_u8(k2_u8.val[0]), vreinterpret_u16_u8(k3_u8.val[0]));
+        const uint16x4x2_t k3_u16 = vtrn_u16(vreinterpret_u16_u8(k2_u8.val[1]), vreinterpret_u16_u8(k3_u8.val[1]));
+
+        // Transpose 8x8
+        const uint32x2x2_t k0_u32 = vtrn_u32(vreinterpret_u32_u16(k0_u16.val[0]), vreinterpret_u32_u16(k2_u16.val[0]));
+        const uint32x2x2_t k1_u32 = vtrn_u32(vreinterpret_u32_u16(k0_u16.val[1]), vreinterpret_u32_u16(k2_u16.val[1]));
+        const uint32x2x2_t k2_u32 = vtrn_u32(vreinterpret_u32_u16(k1_u16.val[0]), vreinterpret_u32_u16(k3_u16.val[0]));
+        const uint32x2x2_t k3_u32 = vtrn_u32(vreinterpret_u32_u16(k1_u16.val[1]), vreinterpret_u32_u16(k3_u16.val[1]));
+
+        vst1_u8(dst + 0 * dst_stride, vreinterpret_u8_u32(k0_u32.val[0]));
+        vst1_u8(dst + 1 * dst_stride, vreinterpret_u8_u32(k2_u32.val[0]));
+        vst1_u8(dst + 2 * dst_stride, vreinterpret_u8_u32(k1_u32.val[0]));
+        vst1_u8(dst + 3 * dst_stride, vreinterpret_u8_u32(k3_u32.val[0]));
+        vst1_u8(dst + 4 * dst_stride, vreinterpret_u8_u32(k0_u32.val[1]));
+        vst1_u8(dst + 5 * dst_stride, vreinterpret_u8_u32(k2_u32.val[1]));
+        vst1_u8(dst + 6 * dst_stride, vreinterpret_u8_u32(k1_u32.val[1]));
+        vst1_u8(dst + 7 * dst_stride, vreinterpret_u8_u32(k3_u32.val[1]));
+    }
+};
+
+template <>
+struct TransposeTile<uint16_t>
+{
+    static constexpr size_t size = 8;
+
+    static void run(const uint8_t *src, size_t src_stride, uint8_t *dst, size_t dst_stride)
+    {
+        uint16x8_t rows[8];
+        for (size_t i = 0; i < 8; ++i)
+        {
+            rows[i] = vld1q_u16(reinterpret_cast<const uint16_t *>(src + i * src_stride));
+        }
+
+        // Transpose the 2x2 blocks of 16-bit elements
+        const uint16x8x2_t k0_u16 = vtrnq_u16(rows[0], rows[1]);
+        const uint16x8x2_t k1_u16 = vtrnq_u16(rows[2], rows[3]);
+        const uint16x8x2_t k2_u16 = vtrnq_u16(rows[4], rows[5]);
+        const uint16x8x2_t k3_u16 = vtrnq_u16(rows[6], rows[7]);
+
+        // Transpose the 2x2 blocks of 32-bit pairs: every half register then holds 4 rows of one column
+        const uint32x4x2_t k0_u32 = vtrnq_u32(vreinterpretq_u32_u16(k0_u16.val[0]),
+                                              vreinterpretq_u32_u16(k1_u16.val[0]));
+        const uint32x4x2_t k1_u32 = vtrnq_u32(vreinterpretq_u32_u16(k0_u16.val[1]),
+                                              vreinterpretq_u32_u16(k1_u16.val[1]));
+        const uint32x4x2_t k2_u32 = vtrnq_u32(vreinterpretq_u32_u16(k2_u16.val[0]),
+                                              vreinterpretq_u32_u16(k3_u16.val[0]));
+        const uint32x4x2_t k3_u32 = vtrnq_u32(vreinterpretq_u32_u16(k2_u16.val[1]),
+                                              vreinterpretq_u32_u16(k3_u16.val[1]));
+
+        // Columns 0 and 4, 1 and 5, 2 and 6, 3 and 7 for rows 0-3 and 4-7
+        const uint16x8_t top[4]    = {vreinterpretq_u16_u32(k0_u32.val[0]), vreinterpretq_u16_u32(k1_u32.val[0]),
+                                      vreinterpretq_u16_u32(k0_u32.val[1]), vreinterpretq_u16_u32(k1_u32.val[1])};
+        const uint16x8_t bottom[4] = {vreinterpretq_u16_u32(k2_u32.val[0]), vreinterpretq_u16_u32(k3_u32.val[0]),
+                                      vreinterpretq_u16_u32(k2_u32.val[1]), vreinterpretq_u16_u32(k3_u32.val[1])};
+        for (size_t i = 0; i < 4; ++i)
+        {
+            vst1q_u16(reinterpret_cast<uint16_t *>(dst + i * dst_stride),
+                      vcombine_u16(vget_low_u16(top[i]), vget_low_u16(bottom[i])));
+            vst1q_u16(reinterpret_cast<uint16_t *>(dst + (i + 4) * dst_stride),
+                      vcombine_u16(vget_high_u16(top[i]), vget_high_u16(bottom[i])));
+        }
+    }
+};
+
+template <>
+struct TransposeTile<uint32_t>
+{
+    static constexpr size_t size = 4;
+
+    static void run(const uint8_t *src, size_t src_stride, uint8_t *dst, size_t dst_stride)
+    {
+        const uint32x4_t row0 = vld1q_u32(reinterpret_cast<const uint32_t *>(src + 0 * src_stride));
+        const uint32x4_t row1 = vld1q_u32(reinterpret_cast<const uint32_t *>(src + 1 * src_stride));
+        const uint32x4_t row2 = vld1q_u32(reinterpret_cast<const uint32_t *>(src + 2 * src_stride));
+        const uint32x4_t row3 = vld1q_u32(reinterpret_cast<const uint32_t *>(src + 3 * src_stride));
+
+        const uint32x4x2_t k0_u32 = vtrnq_u32(row0, row1);
+        const uint32x4x2_t k1_u32 = vtrnq_u32(row2, row3);
+
+        vst1q_u32(reinterpret_cast<uint32_t *>(dst + 0 * dst_stride),
+                  vcombine_u32(vget_low_u32(k0_u32.val[0]), vget_low_u32(k1_u32.val[0])));
+        vst1q_u32(reinterpret_cast<uint32_t *>(dst + 1 * dst_stride),
+                  vcombine_u32(vget_low_u32(k0_u32.val[1]), vget_low_u32(k1_u32.val[1])));
+        vst1q_u32(reinterpret_cast<uint32_t *>(dst + 2 * dst_stride),
+                  vcombine_u32(vget_high_u32(k0_u32.val[0]), vget_high_u32(k1_u32.val[0])));
+        vst1q_u32(reinterpret_cast<uint32_t *>(dst + 3 * dst_stride),
+                  vcombine_u32(vget_high_u32(k0_u32.val[1]), vget_high_u32(k1_u32.val[1])));
+    }
+};
+
+/** Strides in bytes of a 2D block, the destination offset of element (r, c) being r * dst_r + c * dst_c */
+struct BlockStrides
+{
+    size_t src_r;
+    size_t src_c;
+    size_t dst_r;
+    size_t dst_c;
+};
+
+template <typename T>
+void transpose_scalar(const uint8_t      *src,
+                      uint8_t            *dst,
+                      const BlockStrides &strides,
+                      size_t              row_start,
+                      size_t              row_end,
+                      size_t              col_start,
+                      size_t              col_end)
+{
+    for (size_t r = row_start; r < row_end; ++r)
+    {
+        for (size_t c = col_start; c < col_end; ++c)
+        {
+            *reinterpret_cast<T *>(dst + r * strides.dst_r + c * strides.dst_c) =
+                *reinterpret_cast<const T *>(src + r * strides.src_r + c * strides.src_c);
+        }
+    }
+}
+
+/** Transpose a block whose rows are read along the source innermost dimension and written along the destination one */
+template <typename T>
+void transpose_block(const uint8_t *src, uint8_t *dst, const BlockStrides &strides, size_t rows, size_t cols)
+{
+    if (strides.src_c != sizeof(T) || strides.dst_r != sizeof(T))
+    {
+        transpose_scalar<T>(src, dst, strides, 0, rows, 0, cols);
+        return;
+    }
+
+    constexpr size_t tile = TransposeTile<T>::size;
+
+    size_t r = 0;
+    for (; r + tile <= rows; r += tile)
+    {
+        size_t c = 0;
+        for (; c + tile <= cols; c += tile)
+        {
+            TransposeTile<T>::run(src + r * strides.src_r + c * sizeof(T), strides.src_r,
+                                  dst + r * sizeof(T) + c * strides.dst_c, strides.dst_c);
+        }
+        transpose_scalar<T>(src, dst, strides, r, r + tile, c, cols);
+    }
+    transpose_scalar<T>(src, dst, strides, r, rows, 0, cols);
+}
+
+template <typename T>
+void copy_block(const uint8_t *src, size_t src_stride, uint8_t *dst, size_t dst_stride, size_t cols)
+{
+    if (src_stride == sizeof(T) && dst_stride == sizeof(T))
+    {
+        std::memcpy(dst, src, cols * sizeof(T));
+        return;
+    }
+
+    for (size_t c = 0; c < cols; ++c)
+    {
+        *reinterpret_cast<T *>(dst + c * dst_stride) = *reinterpret_cast<const T *>(src + c * src_stride);
+    }
+}
+
+template <typename T>
+void blocked_permute_impl(const ITensor *src, ITensor *dst, const PermutationVector &perm, const Window &window)
+{
+    const ITensorInfo   &src_info    = *src->info();
+    const TransposedDims dims        = get_transposed_dims(src_info.tensor_shape(), perm);
+    const Strides       &src_strides = src_info.strides_in_bytes();
+    const Strides        dst_strides = get_permuted_dst_strides(*dst->info(), perm);
+
+    const uint8_t *src_base = src->buffer() + src_info.offset_first_element_in_bytes();
+    uint8_t       *dst_base = dst->buffer() + dst->info()->offset_first_element_in_bytes();
+
+    const int inner_size = src_info.dimension(dims.inner);
+    const int outer_size = src_info.dimension(dims.outer);
+    const int inner_step = window[dims.inner].step();
+    const int outer_step = window[dims.outer].step();
+
+    const BlockStrides block_strides{src_strides[dims.outer], src_strides[dims.inner], dst_strides[dims.outer],
+                                     dst_strides[dims.inner]};
+
+    execute_window_loop(window,
+                        [&](const Coordinates &id)
+                        {
+                            size_t src_offset = 0;
+                            size_t dst_offset = 0;
+                            for (size_t d = 0; d < max_dims; ++d)
+                            {
+                                src_offset += id[d] * src_strides[d];
+                                dst_offset += id[d] * dst_strides[d];
+                            }
+
+                            const size_t cols = std::min(inner_step, inner_size - id[dims.inner]);
+                            if (dims.inner == dims.outer)
+                            {
+                                copy_block<T>(src_base + src_offset, src_strides[dims.inner], dst_base + dst_offset,
+                                              dst_strides[dims.inner], cols);
+                            }
+                            else
+                            {
+                                const size_t rows = std::min(outer_step, outer_size - id[dims.outer]);
+                                transpose_block<T>(src_base + src_offset, dst_base + dst_offset, block_strides, rows,
+                                                   cols);
+                            }
+                        });
+}
+} // namespace
+
+bool is_valid_permutation(const PermutationVector &perm)
+{
+    std::array<bool, max_dims> is_used{};
+    for (size_t i = 0; i < perm.num_dimensions(); ++i)
+    {
+        if (perm[i] >= perm.num_dimensions() || is_used[perm[i]])
+        {
+            return false;
+        }
+        is_used[perm[i]] = true;
+    }
+    return true;
+}
+
+Window calculate_blocked_permute_window(const ITensorInfo &src, const PermutationVector &perm, size_t &split_dim)
+{
+    const TensorShape   &shape = src.tensor_shape();
+    const TransposedDims dims  = get_transposed_dims(shape, perm);
+    const int            block = block_size(src.element_size());
+
+    Window win = calculate_max_window(src, Steps());
+    // The window end is rounded up to whole blocks, the last block of each dimension being clamped at run time
+    win.set(dims.inner, Window::Dimension(0, ceil_to_multiple(static_cast<int>(shape[dims.inner]), block), block));
+    win.set(dims.outer, Window::Dimension(0, ceil_to_multiple(static_cast<int>(shape[dims.outer]), block), block));
+
+    split_dim = Window::DimX;
+    for (size_t d = 1; d < max_dims; ++d)
+    {
+        if (win.num_iterations(d) > win.num_iterations(split_dim))
+        {
+            split_dim = d;
+        }
+    }
+    return win;
+}
+
+void blocked_permute(const ITensor *src, ITensor *dst, const PermutationVector &perm, const Window &window)
+{
+    switch (src->info()->element_size())
+    {
+        case 1:
+            blocked_permute_impl<uint8_t>(src, dst, perm, window);
+            break;
+        case 2:
+            blocked_permute_impl<uint16_t>(src, dst, perm, window);
+            break;
+        case 4:
+            blocked_permute_impl<uint32_t>(src, dst, perm, window);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Element size not supported");
+            break;
+    }
+}
+} // namespace cpu
+} // namespace arm_compute
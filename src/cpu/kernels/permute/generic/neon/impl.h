@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_PERMUTE_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_PERMUTE_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Check that a permutation vector is a valid permutation of its dimensions
+ *
+ * @param[in] perm Permutation vector.
+ *
+ * @return True if every dimension appears exactly once
+ */
+bool is_valid_permutation(const PermutationVector &perm);
+
+/** Calculate the window of a blocked permutation
+ *
+ * A permutation is run as a batch of 2D transposes between the innermost dimension of the source and the source
+ * dimension that becomes the innermost dimension of the destination. These two dimensions are stepped by cache blocks,
+ * every other dimension by one element.
+ *
+ * @param[in]  src       Source tensor info.
+ * @param[in]  perm      Permutation vector.
+ * @param[out] split_dim Dimension with the most window steps, to split the work between threads.
+ *
+ * @return The window
+ */
+Window calculate_blocked_permute_window(const ITensorInfo &src, const PermutationVector &perm, size_t &split_dim);
+
+/** Permute the blocks of a window calculated by @ref calculate_blocked_permute_window
+ *
+ * Blocks are transposed with NEON register tiles (8x8 for 8-bit and 16-bit elements, 4x4 for 32-bit elements)
+ * when the two dimensions are contiguous in memory, and copied row by row when the innermost dimension is kept.
+ *
+ * @param[in]  src    Source tensor. Element sizes supported: 1, 2 and 4 bytes.
+ * @param[out] dst    Destination tensor.
+ * @param[in]  perm   Permutation vector.
+ * @param[in]  window Window of blocks to permute.
+ */
+void blocked_permute(const ITensor *src, ITensor *dst, const PermutationVector &perm, const Window &window);
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_PERMUTE_GENERIC_NEON_IMPL_H
@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_RESIZENORMALIZE_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_RESIZENORMALIZE_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/cpu/kernels/resizenormalize/list.h"
+
+#include <arm_neon.h>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace resize_normalize
+{
+constexpr int num_channels = 3;
+// Channels repeat every 3 elements and vectors hold 4, so the normalization constants repeat every 12 elements
+constexpr int step = 12;
+
+/** Resample one source row horizontally into 3 interleaved float channels, applying the channel reorder */
+inline void resample_row(
+    const uint8_t *in_row, size_t stride_x, const ResizeNormalizeTables &tables, int out_width, float *out)
+{
+    const int c0 = tables.channel_map[0];
+    const int c1 = tables.channel_map[1];
+    const int c2 = tables.channel_map[2];
+
+    switch (tables.policy)
+    {
+        case InterpolationPolicy::NEAREST_NEIGHBOR:
+        {
+            for (int xo = 0; xo < out_width; ++xo, out += num_channels)
+            {
+                const uint8_t *p = in_row + tables.x_start[xo] * stride_x;
+                out[0]           = p[c0];
+                out[1]           = p[c1];
+                out[2]           = p[c2];
+            }
+            break;
+        }
+        case InterpolationPolicy::BILINEAR:
+        {
+            for (int xo = 0; xo < out_width; ++xo, out += num_channels)
+            {
+                const uint8_t *p0 = in_row + tables.x_start[xo] * stride_x;
+                const uint8_t *p1 = in_row + tables.x_end[xo] * stride_x;
+                const float    w  = tables.x_weight[xo];
+                out[0]            = p0[c0] + (p1[c0] - p0[c0]) * w;
+                out[1]            = p0[c1] + (p1[c1] - p0[c1]) * w;
+                out[2]            = p0[c2] + (p1[c2] - p0[c2]) * w;
+            }
+            break;
+        }
+        case InterpolationPolicy::AREA:
+        {
+            for (int xo = 0; xo < out_width; ++xo, out += num_channels)
+            {
+                uint32_t s0 = 0;
+                uint32_t s1 = 0;
+                uint32_t s2 = 0;
+                for (int x = tables.x_start[xo]; x < tables.x_end[xo]; ++x)
+                {
+                    const uint8_t *p = in_row + x * stride_x;
+                    s0 += p[c0];
+                    s1 += p[c1];
+                    s2 += p[c2];
+                }
+                const float w = tables.x_weight[xo];
+                out[0]        = s0 * w;
+                out[1]        = s1 * w;
+                out[2]        = s2 * w;
+            }
+            break;
+        }
+        default:
+            ARM_COMPUTE_ERROR("Unsupported interpolation policy");
+    }
+}
+
+/** Store 12 normalized values */
+template <typename T>
+inline void store(T *ptr, const float32x4_t &v0, const float32x4_t &v1, const float32x4_t &v2);
+
+template <>
+inline void store(float *ptr, const float32x4_t &v0, const float32x4_t &v1, const float32x4_t &v2)
+{
+    vst1q_f32(ptr, v0);
+    vst1q_f32(ptr + 4, v1);
+    vst1q_f32(ptr + 8, v2);
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+template <>
+inline void store(float16_t *ptr, const float32x4_t &v0, const float32x4_t &v1, const float32x4_t &v2)
+{
+    vst1_f16(ptr, vcvt_f16_f32(v0));
+    vst1_f16(ptr + 4, vcvt_f16_f32(v1));
+    vst1_f16(ptr + 8, vcvt_f16_f32(v2));
+}
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+template <>
+inline void store(uint8_t *ptr, const float32x4_t &v0, const float32x4_t &v1, const float32x4_t &v2)
+{
+    // The quantization scale and offset are already folded into the normalization constants
+#ifdef __aarch64__
+    const int32x4_t r0 = vcvtnq_s32_f32(v0);
+    const int32x4_t r1 = vcvtnq_s32_f32(v1);
+    const int32x4_t r2 = vcvtnq_s32_f32(v2);
+#else  //__aarch64__
+    const int32x4_t r0 = vcvtq_s32_f32(v0);
+    const int32x4_t r1 = vcvtq_s32_f32(v1);
+    const int32x4_t r2 = vcvtq_s32_f32(v2);
+#endif //__aarch64__
+    const int16x4_t r2_s16 = vqmovn_s32(r2);
+    const uint8x8_t lo     = vqmovun_s16(vcombine_s16(vqmovn_s32(r0), vqmovn_s32(r1)));
+    const uint8x8_t hi     = vqmovun_s16(vcombine_s16(r2_s16, r2_s16));
+    vst1_u8(ptr, lo);
+    vst1_lane_u32(reinterpret_cast<uint32_t *>(ptr + 8), vreinterpret_u32_u8(hi), 0);
+}
+
+/** Store a single normalized value */
+template <typename T>
+inline T convert(float v)
+{
+    return static_cast<T>(v);
+}
+
+template <>
+inline uint8_t convert(float v)
+{
+    return static_cast<uint8_t>(utility::clamp<int>(static_cast<int>(std::nearbyint(v)), 0, 255));
+}
+} // namespace resize_normalize
+
+template <typename T>
+void resize_normalize_neon(const ITensor               *src,
+                           ITensor                     *workspace,
+                           ITensor                     *dst,
+                           const ResizeNormalizeTables &tables,
+                           const Window                &window,
+                           const ThreadInfo            &thread_info)
+{
+    using namespace resize_normalize;
+
+    const ITensorInfo *src_info = src->info();
+    const ITensorInfo *dst_info = dst->info();
+
+    const int in_height    = static_cast<int>(src_info->dimension(2));
+    const int out_width    = static_cast<int>(dst_info->dimension(1));
+    const int out_height   = static_cast<int>(dst_info->dimension(2));
+    const int row_elements = out_width * num_channels;
+
+    const size_t in_stride_x  = src_info->strides_in_bytes()[1];
+    const size_t in_stride_y  = src_info->strides_in_bytes()[2];
+    const size_t in_stride_b  = src_info->strides_in_bytes()[3];
+    const size_t out_stride_y = dst_info->strides_in_bytes()[2];
+    const size_t out_stride_b = dst_info->strides_in_bytes()[3];
+
+    const uint8_t *src_base = src->buffer() + src_info->offset_first_element_in_bytes();
+    uint8_t       *dst_base = dst->buffer() + dst_info->offset_first_element_in_bytes();
+
+    // Every thread owns two horizontally resampled rows
+    float *row0 = reinterpret_cast<float *>(workspace->buffer() + workspace->info()->offset_first_element_in_bytes()) +
+                  static_cast<size_t>(thread_info.thread_id) * 2 * row_elements;
+    float *row1 = row0 + row_elements;
+
+    // Source rows held by row0 and row1, tagged with the image index so that they are not reused across images
+    int64_t cached0 = -1;
+    int64_t cached1 = -1;
+
+    float scale_pattern[step];
+    float offset_pattern[step];
+    for (int i = 0; i < step; ++i)
+    {
+        scale_pattern[i]  = tables.scale[i % num_channels];
+        offset_pattern[i] = tables.offset[i % num_channels];
+    }
+    const float32x4_t vs0 = vld1q_f32(scale_pattern);
+    const float32x4_t vs1 = vld1q_f32(scale_pattern + 4);
+    const float32x4_t vs2 = vld1q_f32(scale_pattern + 8);
+    const float32x4_t vo0 = vld1q_f32(offset_pattern);
+    const float32x4_t vo1 = vld1q_f32(offset_pattern + 4);
+    const float32x4_t vo2 = vld1q_f32(offset_pattern + 8);
+
+    const auto resample = [&](const uint8_t *in_image, int y, float *out)
+    { resample_row(in_image + y * in_stride_y, in_stride_x, tables, out_width, out); };
+
+    // Rows of all the images are flattened along the Y dimension of the window
+    for (int r = window.y().start(); r < window.y().end(); r += window.y().step())
+    {
+        const int      b        = r / out_height;
+        const int      yo       = r % out_height;
+        const int      y0       = tables.y_start[yo];
+        const int      y1       = tables.y_end[yo];
+        const int64_t  key0     = static_cast<int64_t>(b) * in_height + y0;
+        const int64_t  key1     = static_cast<int64_t>(b) * in_height + y1;
+        const uint8_t *in_image = src_base + b * in_stride_b;
+
+        // The resized row is row0 * w0 + row1 * w1
+        float w0 = 1.f;
+        float w1 = 0.f;
+
+        switch (tables.policy)
+        {
+            case InterpolationPolicy::NEAREST_NEIGHBOR:
+            {
+                if (cached0 != key0)
+                {
+                    resample(in_image, y0, row0);
+                    cached0 = key0;
+                }
+                break;
+            }
+            case InterpolationPolicy::BILINEAR:
+            {
+                // Consecutive output rows usually share a source row when upscaling
+                if (cached0 != key0)
+                {
+                    if (cached1 == key0)
+                    {
+                        std::swap(row0, row1);
+                        std::swap(cached0, cached1);
+                    }
+                    else
+                    {
+                        resample(in_image, y0, row0);
+                        cached0 = key0;
+                    }
+                }
+                if (cached1 != key1)
+                {
+                    resample(in_image, y1, row1);
+                    cached1 = key1;
+                }
+                w1 = tables.y_weight[yo];
+                w0 = 1.f - w1;
+                break;
+            }
+            case InterpolationPolicy::AREA:
+            {
+                resample(in_image, y0, row0);
+                for (int y = y0 + 1; y < y1; ++y)
+                {
+                    resample(in_image, y, row1);
+                    int i = 0;
+                    for (; i <= row_elements - 4; i += 4)
+                    {
+                        vst1q_f32(row0 + i, vaddq_f32(vld1q_f32(row0 + i), vld1q_f32(row1 + i)));
+                    }
+                    for (; i < row_elements; ++i)
+                    {
+                        row0[i] += row1[i];
+                    }
+                }
+                cached0 = -1;
+                cached1 = -1;
+                w0      = tables.y_weight[yo];
+                break;
+            }
+            default:
+                ARM_COMPUTE_ERROR("Unsupported interpolation policy");
+        }
+
+        // Blend the rows, normalize and convert in a single pass over the output row
+        T           *out_ptr    = reinterpret_cast<T *>(dst_base + b * out_stride_b + yo * out_stride_y);
+        const float *second_row = (tables.policy == InterpolationPolicy::BILINEAR) ? row1 : row0;
+
+        const float32x4_t vw0 = vdupq_n_f32(w0);
+        const float32x4_t vw1 = vdupq_n_f32(w1);
+
+        int i = 0;
+        for (; i <= row_elements - step; i += step)
+        {
+            const float      *r0 = row0 + i;
+            const float      *r1 = second_row + i;
+            const float32x4_t a0 = vmlaq_f32(vmulq_f32(vld1q_f32(r0), vw0), vld1q_f32(r1), vw1);
+            const float32x4_t a1 = vmlaq_f32(vmulq_f32(vld1q_f32(r0 + 4), vw0), vld1q_f32(r1 + 4), vw1);
+            const float32x4_t a2 = vmlaq_f32(vmulq_f32(vld1q_f32(r0 + 8), vw0), vld1q_f32(r1 + 8), vw1);
+            store<T>(out_ptr + i, vmlaq_f32(vo0, a0, vs0), vmlaq_f32(vo1, a1, vs1), vmlaq_f32(vo2, a2, vs2));
+        }
+        for (; i < row_elements; ++i)
+        {
+            const float a = row0[i] * w0 + second_row[i] * w1;
+            out_ptr[i]    = convert<T>(a * scale_pattern[i % step] + offset_pattern[i % step]);
+        }
+    }
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_RESIZENORMALIZE_GENERIC_NEON_IMPL_H
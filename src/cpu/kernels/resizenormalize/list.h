@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_RESIZENORMALIZE_LIST_H
+#define ACL_SRC_CPU_KERNELS_RESIZENORMALIZE_LIST_H
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+
+#include <array>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Sampling tables shared by the resize-normalize micro-kernels
+ *
+ * Every output column and row maps to the source range [start, end). Bilinear interpolation blends the two
+ * (replicate-clamped) end points with the given weight, area interpolation averages the range with the given
+ * weight being the reciprocal of its size, and nearest neighbour reads start only.
+ */
+struct ResizeNormalizeTables
+{
+    InterpolationPolicy  policy{InterpolationPolicy::BILINEAR}; /**< Interpolation type */
+    std::vector<int32_t> x_start{};                             /**< First source column of every output column */
+    std::vector<int32_t> x_end{};                               /**< Last (bilinear) or one past last (area) column */
+    std::vector<float>   x_weight{};                            /**< Horizontal interpolation weight */
+    std::vector<int32_t> y_start{};                             /**< First source row of every output row */
+    std::vector<int32_t> y_end{};                               /**< Last (bilinear) or one past last (area) row */
+    std::vector<float>   y_weight{};                            /**< Vertical interpolation weight */
+    std::array<int, 3>   channel_map{{0, 1, 2}};                /**< Source channel read by every output channel */
+    std::array<float, 3> scale{{1.f, 1.f, 1.f}};                /**< Multiplier applied to the resized value */
+    std::array<float, 3> offset{{0.f, 0.f, 0.f}};               /**< Offset added after the multiplication */
+};
+
+#define DECLARE_RESIZE_NORMALIZE_KERNEL(func_name)                                                            \
+    void func_name(const ITensor *src, ITensor *workspace, ITensor *dst, const ResizeNormalizeTables &tables, \
+                   const Window &window, const ThreadInfo &thread_info)
+
+DECLARE_RESIZE_NORMALIZE_KERNEL(neon_fp32_resize_normalize);
+DECLARE_RESIZE_NORMALIZE_KERNEL(neon_fp16_resize_normalize);
+DECLARE_RESIZE_NORMALIZE_KERNEL(neon_qu8_resize_normalize);
+
+#undef DECLARE_RESIZE_NORMALIZE_KERNEL
+
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_RESIZENORMALIZE_LIST_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023 Arm Limited.
+ * Copyright (c) 2019-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,12 @@
 #include "arm_compute/core/CPP/CPPTypes.h"
 #include "arm_compute/core/Helpers.h"
 
+#include "src/core/NEON/NEAsymm.h"
+#include "src/core/NEON/wrapper/wrapper.h"
+
+#include <algorithm>
+#include <vector>
+
 namespace arm_compute
 {
 class ITensor;
@@ -270,6 +276,261 @@ inline float compute_region_coordinate(int p, float bin_size, float roi_anchor,
     return utility::clamp(region_start, 0.0f, max_value);
 }
 
+/** Bilinear sampling point along one axis of a ROI */
+struct ROIAlignAxisSample
+{
+    int   low;    /**< Coordinate of the first neighbour */
+    int   high;   /**< Coordinate of the second neighbour */
+    float w_low;  /**< Weight of the first neighbour */
+    float w_high; /**< Weight of the second neighbour */
+};
+
+/** Accumulate the bilinear blend of four neighbouring channel vectors
+ *
+ * @param[in, out] acc          Accumulators, one per channel.
+ * @param[in]      src          Pointers to the channels of the four neighbours.
+ * @param[in]      weights      Weights of the four neighbours.
+ * @param[in]      num_channels Number of channels.
+ * @param[in]      qinfo        Quantization information of the input, ignored for floating point types.
+ */
+inline void roi_align_accumulate(
+    float *acc, const float *const *src, const float *weights, int num_channels, const UniformQuantizationInfo &qinfo)
+{
+    ARM_COMPUTE_UNUSED(qinfo);
+    const auto w0 = wrapper::vdup_n(weights[0], wrapper::traits::vector_128_tag());
+    const auto w1 = wrapper::vdup_n(weights[1], wrapper::traits::vector_128_tag());
+    const auto w2 = wrapper::vdup_n(weights[2], wrapper::traits::vector_128_tag());
+    const auto w3 = wrapper::vdup_n(weights[3], wrapper::traits::vector_128_tag());
+
+    int c = 0;
+    for (; c <= num_channels - 4; c += 4)
+    {
+        auto a = wrapper::vloadq(acc + c);
+        a      = wrapper::vmla(a, wrapper::vloadq(src[0] + c), w0);
+        a      = wrapper::vmla(a, wrapper::vloadq(src[1] + c), w1);
+        a      = wrapper::vmla(a, wrapper::vloadq(src[2] + c), w2);
+        a      = wrapper::vmla(a, wrapper::vloadq(src[3] + c), w3);
+        wrapper::vstore(acc + c, a);
+    }
+    for (; c < num_channels; ++c)
+    {
+        acc[c] += weights[0] * src[0][c] + weights[1] * src[1][c] + weights[2] * src[2][c] + weights[3] * src[3][c];
+    }
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+inline void roi_align_accumulate(float                         *acc,
+                                 const float16_t *const        *src,
+                                 const float                   *weights,
+                                 int                            num_channels,
+                                 const UniformQuantizationInfo &qinfo)
+{
+    ARM_COMPUTE_UNUSED(qinfo);
+    const float32x4_t w[4] = {vdupq_n_f32(weights[0]), vdupq_n_f32(weights[1]), vdupq_n_f32(weights[2]),
+                              vdupq_n_f32(weights[3])};
+
+    int c = 0;
+    for (; c <= num_channels - 8; c += 8)
+    {
+        float32x4_t lo = vld1q_f32(acc + c);
+        float32x4_t hi = vld1q_f32(acc + c + 4);
+        for (int i = 0; i < 4; ++i)
+        {
+            const float16x8_t v = vld1q_f16(src[i] + c);
+            lo                  = vmlaq_f32(lo, vcvt_f32_f16(vget_low_f16(v)), w[i]);
+            hi                  = vmlaq_f32(hi, vcvt_f32_f16(vget_high_f16(v)), w[i]);
+        }
+        vst1q_f32(acc + c, lo);
+        vst1q_f32(acc + c + 4, hi);
+    }
+    for (; c < num_channels; ++c)
+    {
+        acc[c] += weights[0] * static_cast<float>(src[0][c]) + weights[1] * static_cast<float>(src[1][c]) +
+                  weights[2] * static_cast<float>(src[2][c]) + weights[3] * static_cast<float>(src[3][c]);
+    }
+}
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+template <typename T>
+inline void roi_align_accumulate_quantized(
+    float *acc, const T *const *src, const float *weights, int num_channels, const UniformQuantizationInfo &qinfo)
+{
+    const float32x4_t w[4] = {vdupq_n_f32(weights[0]), vdupq_n_f32(weights[1]), vdupq_n_f32(weights[2]),
+                              vdupq_n_f32(weights[3])};
+
+    int c = 0;
+    for (; c <= num_channels - 8; c += 8)
+    {
+        float32x4_t lo = vld1q_f32(acc + c);
+        float32x4_t hi = vld1q_f32(acc + c + 4);
+        for (int i = 0; i < 4; ++i)
+        {
+            const float32x4x2_t v = vdequantize(wrapper::vload(src[i] + c), qinfo);
+            lo                    = vmlaq_f32(lo, v.val[0], w[i]);
+            hi                    = vmlaq_f32(hi, v.val[1], w[i]);
+        }
+        vst1q_f32(acc + c, lo);
+        vst1q_f32(acc + c + 4, hi);
+    }
+    for (; c < num_channels; ++c)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            acc[c] += weights[i] * ((static_cast<int32_t>(src[i][c]) - qinfo.offset) * qinfo.scale);
+        }
+    }
+}
+
+inline void roi_align_accumulate(
+    float *acc, const uint8_t *const *src, const float *weights, int num_channels, const UniformQuantizationInfo &qinfo)
+{
+    roi_align_accumulate_quantized(acc, src, weights, num_channels, qinfo);
+}
+
+inline void roi_align_accumulate(
+    float *acc, const int8_t *const *src, const float *weights, int num_channels, const UniformQuantizationInfo &qinfo)
+{
+    roi_align_accumulate_quantized(acc, src, weights, num_channels, qinfo);
+}
+
+/** Convert an averaged value to the output data type */
+template <typename T>
+inline T roi_align_convert(float value, const UniformQuantizationInfo &qinfo)
+{
+    ARM_COMPUTE_UNUSED(qinfo);
+    return static_cast<T>(value);
+}
+
+template <>
+inline uint8_t roi_align_convert<uint8_t>(float value, const UniformQuantizationInfo &qinfo)
+{
+    return quantize_qasymm8(value, qinfo);
+}
+
+template <>
+inline int8_t roi_align_convert<int8_t>(float value, const UniformQuantizationInfo &qinfo)
+{
+    return quantize_qasymm8_signed(value, qinfo);
+}
+
+/** Compute the sampling points of every bin of a ROI along one axis
+ *
+ * @param[in]  pooled_size Number of bins.
+ * @param[in]  bin_size    Size of a bin.
+ * @param[in]  grid_size   Number of sampling points in a bin.
+ * @param[in]  roi_anchor  Start of the ROI.
+ * @param[in]  max_value   Size of the input along the axis.
+ * @param[out] samples     Sampling points, @p grid_size per bin.
+ * @param[out] valid_bins  Whether every bin overlaps the input.
+ */
+inline void compute_roi_align_axis(int                              pooled_size,
+                                   float                            bin_size,
+                                   int                              grid_size,
+                                   float                            roi_anchor,
+                                   float                            max_value,
+                                   std::vector<ROIAlignAxisSample> &samples,
+                                   std::vector<bool>               &valid_bins)
+{
+    samples.resize(pooled_size * grid_size);
+    valid_bins.resize(pooled_size);
+    for (int p = 0; p < pooled_size; ++p)
+    {
+        const float region_start = compute_region_coordinate(p, bin_size, roi_anchor, max_value);
+        const float region_end   = compute_region_coordinate(p + 1, bin_size, roi_anchor, max_value);
+        valid_bins[p]            = region_end > region_start;
+        for (int i = 0; i < grid_size; ++i)
+        {
+            // Align the window in the middle of every bin
+            const float pos = region_start + (i + 0.5) * bin_size / float(grid_size);
+            const int   low = pos;
+            const float l   = pos - low;
+            const float h   = 1. - l;
+
+            samples[p * grid_size + i] = ROIAlignAxisSample{low, low + 1, h, l};
+        }
+    }
+}
+
+/** ROI align of a single NHWC ROI
+ *
+ * The sampling points and their weights only depend on the ROI, so they are computed once per axis and every
+ * output bin blends whole channel vectors of its neighbours instead of recomputing them for every channel.
+ */
+template <typename input_data_type>
+void roi_align_nhwc(const ITensor             *input,
+                    ITensor                   *output,
+                    int                        roi_indx,
+                    unsigned int               roi_batch,
+                    float                      roi_anchor_x,
+                    float                      roi_anchor_y,
+                    float                      bin_size_x,
+                    float                      bin_size_y,
+                    const ROIPoolingLayerInfo &pool_info,
+                    std::vector<float>        &acc)
+{
+    const ITensorInfo &in_info      = *input->info();
+    const int          num_channels = in_info.dimension(0);
+    const int          pooled_w     = pool_info.pooled_width();
+    const int          pooled_h     = pool_info.pooled_height();
+    const int grid_x = (pool_info.sampling_ratio() > 0) ? pool_info.sampling_ratio() : int(ceil(bin_size_x));
+    const int grid_y = (pool_info.sampling_ratio() > 0) ? pool_info.sampling_ratio() : int(ceil(bin_size_y));
+
+    std::vector<ROIAlignAxisSample> samples_x;
+    std::vector<ROIAlignAxisSample> samples_y;
+    std::vector<bool>               valid_x;
+    std::vector<bool>               valid_y;
+    compute_roi_align_axis(pooled_w, bin_size_x, grid_x, roi_anchor_x, in_info.dimension(1), samples_x, valid_x);
+    compute_roi_align_axis(pooled_h, bin_size_y, grid_y, roi_anchor_y, in_info.dimension(2), samples_y, valid_y);
+
+    const ITensorInfo             &out_info   = *output->info();
+    const UniformQuantizationInfo  in_qinfo   = in_info.quantization_info().uniform();
+    const UniformQuantizationInfo  out_qinfo  = out_info.quantization_info().uniform();
+    const Strides                 &in_stride  = in_info.strides_in_bytes();
+    const Strides                 &out_stride = out_info.strides_in_bytes();
+    const uint8_t *in_base  = input->buffer() + in_info.offset_first_element_in_bytes() + roi_batch * in_stride[3];
+    uint8_t       *out_base = output->buffer() + out_info.offset_first_element_in_bytes() + roi_indx * out_stride[3];
+
+    for (int py = 0; py < pooled_h; ++py)
+    {
+        for (int px = 0; px < pooled_w; ++px)
+        {
+            std::fill(acc.begin(), acc.end(), 0.f);
+            float count = 1.f;
+            if (valid_x[px] && valid_y[py])
+            {
+                count = grid_x * grid_y;
+                for (int iy = 0; iy < grid_y; ++iy)
+                {
+                    const ROIAlignAxisSample &sy = samples_y[py * grid_y + iy];
+                    for (int ix = 0; ix < grid_x; ++ix)
+                    {
+                        const ROIAlignAxisSample &sx = samples_x[px * grid_x + ix];
+
+                        const input_data_type *src[4] = {
+                            reinterpret_cast<const input_data_type *>(in_base + sy.low * in_stride[2] +
+                                                                      sx.low * in_stride[1]),
+                            reinterpret_cast<const input_data_type *>(in_base + sy.low * in_stride[2] +
+                                                                      sx.high * in_stride[1]),
+                            reinterpret_cast<const input_data_type *>(in_base + sy.high * in_stride[2] +
+                                                                      sx.low * in_stride[1]),
+                            reinterpret_cast<const input_data_type *>(in_base + sy.high * in_stride[2] +
+                                                                      sx.high * in_stride[1])};
+                        const float weights[4] = {sy.w_low * sx.w_low, sy.w_low * sx.w_high, sy.w_high * sx.w_low,
+                                                  sy.w_high * sx.w_high};
+                        roi_align_accumulate(acc.data(), src, weights, num_channels, in_qinfo);
+                    }
+                }
+            }
+
+            auto *out_ptr = reinterpret_cast<input_data_type *>(out_base + py * out_stride[2] + px * out_stride[1]);
+            for (int c = 0; c < num_channels; ++c)
+            {
+                out_ptr[c] = roi_align_convert<input_data_type>(acc[c] / count, out_qinfo);
+            }
+        }
+    }
+}
+
 template <typename input_data_type, typename roi_data_type>
 void roi_align(const ITensor      *input,
                ITensor            *output,
@@ -283,8 +544,8 @@ void roi_align(const ITensor      *input,
     const DataLayout data_layout    = input->info()->data_layout();
     const size_t     values_per_roi = rois->info()->dimension(0);
 
-    const int roi_list_start = window.x().start();
-    const int roi_list_end   = window.x().end();
+    const int roi_list_start = window.y().start();
+    const int roi_list_end   = window.y().end();
 
     const unsigned int idx_width  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
     const unsigned int idx_height = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
@@ -301,6 +562,9 @@ void roi_align(const ITensor      *input,
 
     const auto             *rois_ptr   = reinterpret_cast<const roi_data_type *>(rois->buffer());
     const QuantizationInfo &rois_qinfo = rois->info()->quantization_info();
+
+    // Per-thread channel accumulators of the NHWC path
+    std::vector<float> acc(data_layout == DataLayout::NHWC ? input_chanels : 0);
     for (int roi_indx = roi_list_start; roi_indx < roi_list_end; ++roi_indx)
     {
         const unsigned int roi_batch = rois_ptr[values_per_roi * roi_indx];
@@ -327,6 +591,13 @@ void roi_align(const ITensor      *input,
         float       bin_size_x   = roi_dims_x / pool_info.pooled_width();
         float       bin_size_y   = roi_dims_y / pool_info.pooled_height();
 
+        if (data_layout == DataLayout::NHWC)
+        {
+            roi_align_nhwc<input_data_type>(input, output, roi_indx, roi_batch, roi_anchor_x, roi_anchor_y, bin_size_x,
+                                            bin_size_y, pool_info, acc);
+            continue;
+        }
+
         // Iterate through all feature maps
         for (int ch = 0; ch < input_chanels; ++ch)
         {
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_ROPE_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_ROPE_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/RoPEInfo.h"
+
+#include <arm_neon.h>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Load 4 values as floats */
+template <typename T>
+inline float32x4_t rope_load(const T *ptr);
+
+/** Load 4 interleaved pairs of values as floats, even channels first */
+template <typename T>
+inline float32x4x2_t rope_load2(const T *ptr);
+
+/** Store 4 floats as values of type T */
+template <typename T>
+inline void rope_store(T *ptr, const float32x4_t &v);
+
+/** Store 4 pairs of floats interleaved, as values of type T */
+template <typename T>
+inline void rope_store2(T *ptr, const float32x4x2_t &v);
+
+template <>
+inline float32x4_t rope_load(const float *ptr)
+{
+    return vld1q_f32(ptr);
+}
+
+template <>
+inline float32x4x2_t rope_load2(const float *ptr)
+{
+    return vld2q_f32(ptr);
+}
+
+template <>
+inline void rope_store(float *ptr, const float32x4_t &v)
+{
+    vst1q_f32(ptr, v);
+}
+
+template <>
+inline void rope_store2(float *ptr, const float32x4x2_t &v)
+{
+    vst2q_f32(ptr, v);
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+template <>
+inline float32x4_t rope_load(const float16_t *ptr)
+{
+    return vcvt_f32_f16(vld1_f16(ptr));
+}
+
+template <>
+inline float32x4x2_t rope_load2(const float16_t *ptr)
+{
+    const float16x4x2_t v = vld2_f16(ptr);
+    return {{vcvt_f32_f16(v.val[0]), vcvt_f32_f16(v.val[1])}};
+}
+
+template <>
+inline void rope_store(float16_t *ptr, const float32x4_t &v)
+{
+    vst1_f16(ptr, vcvt_f16_f32(v));
+}
+
+template <>
+inline void rope_store2(float16_t *ptr, const float32x4x2_t &v)
+{
+    const float16x4x2_t r = {{vcvt_f16_f32(v.val[0]), vcvt_f16_f32(v.val[1])}};
+    vst2_f16(ptr, r);
+}
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+/** Rotate the channel pairs of a head
+ *
+ * @param[in]  src        Source row of head_dim values.
+ * @param[out] dst        Destination row of head_dim values. Can be @p src.
+ * @param[in]  cs         Cosines followed by the sines of the rotary_dim / 2 angles.
+ * @param[in]  mode       Layout of the channel pairs.
+ * @param[in]  rotary_dim Number of rotated channels.
+ * @param[in]  head_dim   Number of channels of the head. The channels past @p rotary_dim are copied.
+ */
+template <typename T>
+void rope_rotate_row(const T *src, T *dst, const float *cs, RoPEMode mode, int rotary_dim, int head_dim)
+{
+    const int    half = rotary_dim / 2;
+    const float *cs_c = cs;
+    const float *cs_s = cs + half;
+
+    int i = 0;
+    if (mode == RoPEMode::NEOX)
+    {
+        for (; i <= half - 4; i += 4)
+        {
+            const float32x4_t x0 = rope_load(src + i);
+            const float32x4_t x1 = rope_load(src + half + i);
+            const float32x4_t c  = vld1q_f32(cs_c + i);
+            const float32x4_t s  = vld1q_f32(cs_s + i);
+            rope_store(dst + i, vmlsq_f32(vmulq_f32(x0, c), x1, s));
+            rope_store(dst + half + i, vmlaq_f32(vmulq_f32(x1, c), x0, s));
+        }
+        for (; i < half; ++i)
+        {
+            const float x0 = static_cast<float>(src[i]);
+            const float x1 = static_cast<float>(src[half + i]);
+            dst[i]         = static_cast<T>(x0 * cs_c[i] - x1 * cs_s[i]);
+            dst[half + i]  = static_cast<T>(x1 * cs_c[i] + x0 * cs_s[i]);
+        }
+    }
+    else
+    {
+        for (; i <= half - 4; i += 4)
+        {
+            const float32x4x2_t x = rope_load2(src + 2 * i);
+            const float32x4_t   c = vld1q_f32(cs_c + i);
+            const float32x4_t   s = vld1q_f32(cs_s + i);
+            const float32x4x2_t r = {{vmlsq_f32(vmulq_f32(x.val[0], c), x.val[1], s),
+                                      vmlaq_f32(vmulq_f32(x.val[1], c), x.val[0], s)}};
+            rope_store2(dst + 2 * i, r);
+        }
+        for (; i < half; ++i)
+        {
+            const float x0 = static_cast<float>(src[2 * i]);
+            const float x1 = static_cast<float>(src[2 * i + 1]);
+            dst[2 * i]     = static_cast<T>(x0 * cs_c[i] - x1 * cs_s[i]);
+            dst[2 * i + 1] = static_cast<T>(x1 * cs_c[i] + x0 * cs_s[i]);
+        }
+    }
+
+    if (src != dst && rotary_dim < head_dim)
+    {
+        std::memcpy(dst + rotary_dim, src + rotary_dim, (head_dim - rotary_dim) * sizeof(T));
+    }
+}
+
+/** Rotate a token in all the heads of a tensor with dimensions [head_dim, tokens, num_heads, batches] */
+template <typename T>
+void rope_rotate_heads(
+    const ITensor *src, ITensor *dst, int token, int batch, const float *cs, RoPEMode mode, int rotary_dim)
+{
+    const int      head_dim    = static_cast<int>(src->info()->dimension(0));
+    const int      num_heads   = static_cast<int>(src->info()->dimension(2));
+    const Strides &src_strides = src->info()->strides_in_bytes();
+    const Strides &dst_strides = dst->info()->strides_in_bytes();
+
+    const uint8_t *src_row = src->buffer() + src->info()->offset_first_element_in_bytes() + token * src_strides[1] +
+                             batch * src_strides[3];
+    uint8_t *dst_row = dst->buffer() + dst->info()->offset_first_element_in_bytes() + token * dst_strides[1] +
+                       batch * dst_strides[3];
+
+    for (int h = 0; h < num_heads; ++h, src_row += src_strides[2], dst_row += dst_strides[2])
+    {
+        rope_rotate_row(reinterpret_cast<const T *>(src_row), reinterpret_cast<T *>(dst_row), cs, mode, rotary_dim,
+                        head_dim);
+    }
+}
+
+/** Rotary position embedding of queries and keys
+ *
+ * Every window step handles a token of a batch: its sines and cosines are read from @p table when the position is
+ * covered by it, otherwise they are computed into the thread's slice of @p working. The token is then rotated in all
+ * the query heads and all the key heads.
+ */
+template <typename T>
+void rope_neon(const ITensor    *q,
+               const ITensor    *k,
+               const ITensor    *positions,
+               const ITensor    *table,
+               ITensor          *working,
+               ITensor          *q_dst,
+               ITensor          *k_dst,
+               const float      *inv_freq,
+               const RoPEInfo   &rope_info,
+               const Window     &window,
+               const ThreadInfo &info)
+{
+    const int rotary_dim = static_cast<int>(rope_info.rotary_dim);
+    const int half       = rotary_dim / 2;
+    const int table_rows = table != nullptr ? static_cast<int>(rope_info.max_positions) : 0;
+
+    const float *table_ptr =
+        table != nullptr
+            ? reinterpret_cast<const float *>(table->buffer() + table->info()->offset_first_element_in_bytes())
+            : nullptr;
+    float *scratch = reinterpret_cast<float *>(working->buffer() + working->info()->offset_first_element_in_bytes()) +
+                     info.thread_id * rotary_dim;
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &id)
+        {
+            const int token = id.y();
+            const int pos   = rope_info.position_offset +
+                            (positions != nullptr
+                                 ? *reinterpret_cast<const int32_t *>(positions->ptr_to_element(Coordinates(token)))
+                                 : token);
+
+            const float *cs = nullptr;
+            if (pos >= 0 && pos < table_rows)
+            {
+                cs = table_ptr + static_cast<size_t>(pos) * rotary_dim;
+            }
+            else
+            {
+                for (int i = 0; i < half; ++i)
+                {
+                    const float angle = static_cast<float>(pos) * inv_freq[i];
+                    scratch[i]        = std::cos(angle);
+                    scratch[half + i] = std::sin(angle);
+                }
+                cs = scratch;
+            }
+
+            rope_rotate_heads<T>(q, q_dst, token, id[3], cs, rope_info.mode, rotary_dim);
+            rope_rotate_heads<T>(k, k_dst, token, id[3], cs, rope_info.mode, rotary_dim);
+        });
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_ROPE_GENERIC_NEON_IMPL_H
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuElementwiseExpression.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/cpu/kernels/CpuElementwiseExpressionKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void CpuElementwiseExpression::configure(const std::vector<const ITensorInfo *> &srcs,
+                                         ITensorInfo                            *dst,
+                                         const ElementwiseExpressionInfo        &info)
+{
+    ARM_COMPUTE_LOG_PARAMS(srcs, dst);
+
+    auto kernel = std::make_unique<kernels::CpuElementwiseExpressionKernel>();
+    kernel->configure(srcs, dst, info);
+
+    // Split over the outermost dimension with enough rows for every thread, and over the rows themselves for
+    // single-row problems
+    const Window      &win         = kernel->window();
+    const unsigned int num_threads = NEScheduler::get().num_threads();
+    _split_dimension               = Window::DimX;
+    for (size_t d = Coordinates::num_max_dimensions; d > Window::DimX; --d)
+    {
+        if (win.num_iterations(d - 1) >= num_threads && d - 1 != Window::DimX)
+        {
+            _split_dimension = d - 1;
+            break;
+        }
+    }
+    if (_split_dimension == Window::DimX && win.num_iterations(Window::DimX) < 16 * num_threads)
+    {
+        _split_dimension = Window::DimY;
+    }
+
+    _kernel = std::move(kernel);
+}
+
+Status CpuElementwiseExpression::validate(const std::vector<const ITensorInfo *> &srcs,
+                                          const ITensorInfo                      *dst,
+                                          const ElementwiseExpressionInfo        &info)
+{
+    return kernels::CpuElementwiseExpressionKernel::validate(srcs, dst, info);
+}
+
+void CpuElementwiseExpression::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+    NEScheduler::get().schedule_op(_kernel.get(), _split_dimension, _kernel->window(), tensors);
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuEmbeddingBag.h"
+
+#include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/cpu/kernels/CpuEmbeddingBagKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void CpuEmbeddingBag::configure(const ITensorInfo      *table,
+                                const ITensorInfo      *row_params,
+                                const ITensorInfo      *indices,
+                                const ITensorInfo      *offsets,
+                                ITensorInfo            *dst,
+                                const EmbeddingBagInfo &info)
+{
+    ARM_COMPUTE_LOG_PARAMS(table, row_params, indices, offsets, dst, info);
+
+    auto kernel = std::make_unique<kernels::CpuEmbeddingBagKernel>();
+    kernel->configure(table, row_params, indices, offsets, dst, info);
+
+    // Every thread owns a slice of the accumulator buffer
+    _aux_mem.clear();
+    if (kernel->working_size() > 0)
+    {
+        _aux_mem.push_back(experimental::MemoryInfo(TensorType::ACL_INT_0, experimental::MemoryLifetime::Temporary,
+                                                    kernel->working_size() * NEScheduler::get().num_threads()));
+    }
+
+    _kernel = std::move(kernel);
+}
+
+Status CpuEmbeddingBag::validate(const ITensorInfo      *table,
+                                 const ITensorInfo      *row_params,
+                                 const ITensorInfo      *indices,
+                                 const ITensorInfo      *offsets,
+                                 const ITensorInfo      *dst,
+                                 const EmbeddingBagInfo &info)
+{
+    return kernels::CpuEmbeddingBagKernel::validate(table, row_params, indices, offsets, dst, info);
+}
+
+void CpuEmbeddingBag::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+    NEScheduler::get().schedule_op(_kernel.get(), Window::DimY, _kernel->window(), tensors);
+}
+
+experimental::MemoryRequirements CpuEmbeddingBag::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023, 2025 Arm Limited.
+ * Copyright (c) 2021-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -558,8 +558,8 @@ void CpuFullyConnected::prepare(ITensorPack &tensors)
         {
             // Run reshape weights kernel and mark weights as unused
             ITensorPack transpose_pack{{ACL_SRC, weights}, {ACL_DST, reshaped_weights.get()}};
-            NEScheduler::get().schedule_op(_transpose_weights.get(), Window::DimY, _transpose_weights->window(),
-                                           transpose_pack);
+            NEScheduler::get().schedule_op(_transpose_weights.get(), _transpose_weights->get_split_dimension_hint(),
+                                           _transpose_weights->window(), transpose_pack);
 
             cur_weights->mark_as_unused();
             cur_weights = reshaped_weights.get();
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUGEMMDIRECTCONV3D_H
+#define ACL_SRC_CPU_OPERATORS_CPUGEMMDIRECTCONV3D_H
+
+#include "arm_compute/core/TensorInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuOperator.h"
+#include "src/cpu/operators/CpuActivation.h"
+#include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
+
+namespace arm_compute
+{
+// Forward declarations
+struct Conv3dInfo;
+namespace cpu
+{
+/** Function to run a 3D convolution as an indirect GEMM
+ *
+ * No im2col is performed: the assembly GEMM reads the source through an indirection table holding, for every kernel
+ * point and output point, a pointer to the matching row of IFM input values, or to a row of zero points when it falls
+ * in the padding.
+ *
+ * @note The table is built when the operator is first prepared with the source tensor, and rebuilt by the runs whose
+ *       source memory differs from the one it was built for. Concurrent runs of the same operator are serialized.
+ *
+ *  This function calls the following functions:
+ *
+ * -# @ref CpuGemmAssemblyDispatch
+ * -# @ref CpuActivation (if the activation can not be fused in the GEMM)
+ */
+class CpuGemmDirectConv3d : public ICpuOperator
+{
+public:
+    CpuGemmDirectConv3d();
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGemmDirectConv3d);
+    ~CpuGemmDirectConv3d();
+    /** Set the input and output tensors.
+     *
+     * Valid data layouts:
+     * - NDHWC
+     *
+     * Valid data type configurations:
+     * |src0           |src1           |src2           |dst            |
+     * |:--------------|:--------------|:--------------|:--------------|
+     * |QASYMM8        |QASYMM8        |S32            |QASYMM8        |
+     * |QASYMM8_SIGNED |QASYMM8_SIGNED |S32            |QASYMM8_SIGNED |
+     * |F16            |F16            |F16            |F16            |
+     * |F32            |F32            |F32            |F32            |
+     *
+     * @param[in]  src     Source tensor info. 4 lower dimensions represent a single input [IFM, width, height, depth],
+     *                     while every optional dimension from 5 and above represent a batch of inputs.
+     *                     Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in]  weights Weights tensor info. Weights are 5D tensor with dimensions [OFM, IFM, kernel_x, kernel_y, kernel_z].
+     *                     Data type supported: Same as @p src.
+     * @param[in]  biases  Biases tensor info. Shared biases supported. Biases are 1D tensor with dimensions [OFM].
+     *                     Data type supported: Should match @p src data type, except for input of QASYMM8/QASYMM8_SIGNED type where biases should be of S32 type.
+     * @param[out] dst     Destination tensor info. 4 lower dimensions represent a single output [OFM, width, height, depth], while the rest represent batch of outputs.
+     *                     Data types supported: Same as @p src.
+     * @param[in]  info    Contains padding, stride and activation information described in @ref Conv3dInfo.
+     */
+    void configure(const ITensorInfo *src,
+                   const ITensorInfo *weights,
+                   const ITensorInfo *biases,
+                   ITensorInfo       *dst,
+                   const Conv3dInfo  &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref CpuGemmDirectConv3d
+     *
+     * Similar to CpuGemmDirectConv3d::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src,
+                           const ITensorInfo *weights,
+                           const ITensorInfo *biases,
+                           const ITensorInfo *dst,
+                           const Conv3dInfo  &info);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &constants) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    std::unique_ptr<CpuGemmAssemblyDispatch> _gemm_asm_func;
+    std::unique_ptr<CpuActivation>           _activation_func;
+    bool                                     _run_activation;
+    bool                                     _is_prepared;
+};
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // ACL_SRC_CPU_OPERATORS_CPUGEMMDIRECTCONV3D_H
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuGemmDynamicQuantized.h"
+
+#include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/cpu/kernels/CpuGemmDynamicQuantizedKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void CpuGemmDynamicQuantized::configure(const ITensorInfo         *a,
+                                        const ITensorInfo         *weights,
+                                        const ITensorInfo         *bias,
+                                        ITensorInfo               *dst,
+                                        const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_LOG_PARAMS(a, weights, bias, dst, act_info);
+
+    auto k = std::make_unique<kernels::CpuGemmDynamicQuantizedKernel>();
+    k->configure(a, weights, bias, dst, act_info);
+
+    _are_weights_const = weights->are_values_constant();
+    _is_prepared       = false;
+
+    // Every thread owns a slice of the working buffer holding its quantized rows
+    const unsigned int num_threads = NEScheduler::get().num_threads();
+    const size_t       working_size =
+        kernels::CpuGemmDynamicQuantizedKernel::working_size(a->dimension(0)) * num_threads;
+    const size_t packed_size =
+        kernels::CpuGemmDynamicQuantizedKernel::packed_size(a->dimension(0), weights->dimension(0));
+
+    _aux_mem.clear();
+    _aux_mem.push_back(
+        experimental::MemoryInfo(TensorType::ACL_INT_0, experimental::MemoryLifetime::Persistent, packed_size));
+    _aux_mem.push_back(
+        experimental::MemoryInfo(TensorType::ACL_INT_1, experimental::MemoryLifetime::Temporary, working_size));
+
+    _kernel = std::move(k);
+}
+
+Status CpuGemmDynamicQuantized::validate(const ITensorInfo         *a,
+                                         const ITensorInfo         *weights,
+                                         const ITensorInfo         *bias,
+                                         const ITensorInfo         *dst,
+                                         const ActivationLayerInfo &act_info)
+{
+    return kernels::CpuGemmDynamicQuantizedKernel::validate(a, weights, bias, dst, act_info);
+}
+
+void CpuGemmDynamicQuantized::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared || !_are_weights_const)
+    {
+        const ITensor *weights = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+        ITensor       *packed  = tensors.get_tensor(TensorType::ACL_INT_0);
+        ARM_COMPUTE_ERROR_ON_NULLPTR(weights, packed);
+
+        kernels::CpuGemmDynamicQuantizedKernel::pack_weights(weights, packed);
+
+        if (_are_weights_const)
+        {
+            weights->mark_as_unused();
+        }
+        _is_prepared = true;
+    }
+}
+
+void CpuGemmDynamicQuantized::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    prepare(tensors);
+
+    // Split over blocks of output channels when there are enough of them for every thread, at the cost of
+    // quantizing the input rows in every thread, otherwise over rows
+    const unsigned int num_blocks      = _kernel->window().num_iterations(Window::DimX);
+    const auto         split_dimension = num_blocks >= NEScheduler::get().num_threads() ? Window::DimX : Window::DimY;
+    NEScheduler::get().schedule_op(_kernel.get(), split_dimension, _kernel->window(), tensors);
+}
+
+experimental::MemoryRequirements CpuGemmDynamicQuantized::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
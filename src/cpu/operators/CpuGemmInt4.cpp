@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuGemmInt4.h"
+
+#include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/cpu/kernels/CpuGemmInt4Kernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void CpuGemmInt4::configure(const ITensorInfo  *a,
+                            const ITensorInfo  *weights,
+                            const ITensorInfo  *scales,
+                            const ITensorInfo  *bias,
+                            ITensorInfo        *dst,
+                            const GEMMInt4Info &info)
+{
+    ARM_COMPUTE_LOG_PARAMS(a, weights, scales, bias, dst);
+
+    auto k = std::make_unique<kernels::CpuGemmInt4Kernel>();
+    k->configure(a, weights, scales, bias, dst, info);
+
+    _k                 = a->dimension(0);
+    _group_size        = info.group_size;
+    _are_weights_const = weights->are_values_constant() && scales->are_values_constant();
+    _is_prepared       = false;
+
+    // The weights are re-packed once into interleaved blocks of output channels
+    const size_t packed_size = kernels::CpuGemmInt4Kernel::packed_size(_k, weights->dimension(1), _group_size);
+
+    _aux_mem.clear();
+    _aux_mem.push_back(
+        experimental::MemoryInfo(TensorType::ACL_INT_0, experimental::MemoryLifetime::Persistent, packed_size));
+
+    _kernel = std::move(k);
+}
+
+Status CpuGemmInt4::validate(const ITensorInfo  *a,
+                             const ITensorInfo  *weights,
+                             const ITensorInfo  *scales,
+                             const ITensorInfo  *bias,
+                             const ITensorInfo  *dst,
+                             const GEMMInt4Info &info)
+{
+    return kernels::CpuGemmInt4Kernel::validate(a, weights, scales, bias, dst, info);
+}
+
+void CpuGemmInt4::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared || !_are_weights_const)
+    {
+        const ITensor *weights = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+        const ITensor *scales  = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+        ITensor       *packed  = tensors.get_tensor(TensorType::ACL_INT_0);
+        ARM_COMPUTE_ERROR_ON_NULLPTR(weights, scales, packed);
+
+        kernels::CpuGemmInt4Kernel::pack_weights(weights, scales, _k, _group_size, packed);
+
+        if (_are_weights_const)
+        {
+            weights->mark_as_unused();
+            scales->mark_as_unused();
+        }
+        _is_prepared = true;
+    }
+}
+
+void CpuGemmInt4::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    prepare(tensors);
+
+    // Split over blocks of output channels so that every thread streams its own weights, otherwise over rows
+    const unsigned int num_blocks      = _kernel->window().num_iterations(Window::DimX);
+    const auto         split_dimension = num_blocks >= NEScheduler::get().num_threads() ? Window::DimX : Window::DimY;
+    NEScheduler::get().schedule_op(_kernel.get(), split_dimension, _kernel->window(), tensors);
+}
+
+experimental::MemoryRequirements CpuGemmInt4::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUGEMMINT4_H
+#define ACL_SRC_CPU_OPERATORS_CPUGEMMINT4_H
+
+#include "arm_compute/function_info/GEMMInt4Info.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuOperator.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to run @ref kernels::CpuGemmInt4Kernel
+ *
+ * The tensor pack is expected to hold:
+ * - ACL_SRC_0: a
+ * - ACL_SRC_1: packed 4-bit weights
+ * - ACL_SRC_2: bias
+ * - ACL_SRC_3: weights scales
+ * - ACL_DST: dst
+ */
+class CpuGemmInt4 : public ICpuOperator
+{
+public:
+    /** Initialise the operator's inputs and output
+     *
+     * Similar to @ref NEGEMMInt4::configure()
+     *
+     */
+    void configure(const ITensorInfo  *a,
+                   const ITensorInfo  *weights,
+                   const ITensorInfo  *scales,
+                   const ITensorInfo  *bias,
+                   ITensorInfo        *dst,
+                   const GEMMInt4Info &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuGemmInt4::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo  *a,
+                           const ITensorInfo  *weights,
+                           const ITensorInfo  *scales,
+                           const ITensorInfo  *bias,
+                           const ITensorInfo  *dst,
+                           const GEMMInt4Info &info);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    unsigned int                     _k{0};
+    unsigned int                     _group_size{0};
+    bool                             _are_weights_const{true};
+    bool                             _is_prepared{false};
+    experimental::MemoryRequirements _aux_mem{};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUGEMMINT4_H
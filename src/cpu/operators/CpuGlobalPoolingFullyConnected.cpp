@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuGlobalPoolingFullyConnected.h"
+
+#include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/cpu/kernels/CpuGlobalPoolingFullyConnectedKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void CpuGlobalPoolingFullyConnected::configure(const ITensorInfo             *src,
+                                               const ITensorInfo             *weights,
+                                               const ITensorInfo             *biases,
+                                               ITensorInfo                   *dst,
+                                               const FullyConnectedLayerInfo &fc_info)
+{
+    ARM_COMPUTE_LOG_PARAMS(src, weights, biases, dst, fc_info);
+
+    auto k = std::make_unique<kernels::CpuGlobalPoolingFullyConnectedKernel>();
+    k->configure(src, weights, biases, dst, fc_info);
+
+    _transpose_weights = fc_info.transpose_weights;
+    _are_weights_const = weights->are_values_constant() && (biases == nullptr || biases->are_values_constant());
+    _is_prepared       = false;
+
+    // Every thread owns a slice of the working buffer holding its pooled input channels
+    const unsigned int num_threads  = NEScheduler::get().num_threads();
+    const size_t       element_size = src->element_size();
+    const unsigned int in_channels  = src->dimension(0);
+    const unsigned int out_channels = dst->dimension(0);
+
+    const size_t working_size = in_channels * num_threads * element_size;
+    const size_t packed_size =
+        kernels::CpuGlobalPoolingFullyConnectedKernel::packed_elements(in_channels, out_channels, src->data_type()) *
+        element_size;
+
+    _aux_mem.clear();
+    _aux_mem.push_back(
+        experimental::MemoryInfo(TensorType::ACL_INT_0, experimental::MemoryLifetime::Temporary, working_size));
+    _aux_mem.push_back(
+        experimental::MemoryInfo(TensorType::ACL_INT_1, experimental::MemoryLifetime::Persistent, packed_size));
+
+    _kernel = std::move(k);
+}
+
+Status CpuGlobalPoolingFullyConnected::validate(const ITensorInfo             *src,
+                                                const ITensorInfo             *weights,
+                                                const ITensorInfo             *biases,
+                                                const ITensorInfo             *dst,
+                                                const FullyConnectedLayerInfo &fc_info)
+{
+    return kernels::CpuGlobalPoolingFullyConnectedKernel::validate(src, weights, biases, dst, fc_info);
+}
+
+void CpuGlobalPoolingFullyConnected::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared || !_are_weights_const)
+    {
+        const ITensor *weights = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+        const ITensor *biases  = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+        ITensor       *packed  = tensors.get_tensor(TensorType::ACL_INT_1);
+        ARM_COMPUTE_ERROR_ON_NULLPTR(weights, packed);
+
+        kernels::CpuGlobalPoolingFullyConnectedKernel::pack_weights(weights, biases, _transpose_weights, packed);
+
+        if (_are_weights_const)
+        {
+            weights->mark_as_unused();
+            if (biases != nullptr)
+            {
+                biases->mark_as_unused();
+            }
+        }
+        _is_prepared = true;
+    }
+}
+
+void CpuGlobalPoolingFullyConnected::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    prepare(tensors);
+
+    // Split over blocks of output channels so the matrix-vector product uses every thread, otherwise over batches
+    const auto split_dimension = _kernel->window().num_iterations(Window::DimX) != 1 ? Window::DimX : Window::DimY;
+    NEScheduler::get().schedule_op(_kernel.get(), split_dimension, _kernel->window(), tensors);
+}
+
+experimental::MemoryRequirements CpuGlobalPoolingFullyConnected::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuInvertedResidual.h"
+
+#include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/cpu/kernels/CpuInvertedResidualKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void CpuInvertedResidual::configure(const ITensorInfo               *src,
+                                    const ITensorInfo               *expand_weights,
+                                    const ITensorInfo               *expand_bias,
+                                    const ITensorInfo               *dw_weights,
+                                    const ITensorInfo               *dw_bias,
+                                    const ITensorInfo               *proj_weights,
+                                    const ITensorInfo               *proj_bias,
+                                    ITensorInfo                     *dst,
+                                    const InvertedResidualLayerInfo &info)
+{
+    ARM_COMPUTE_LOG_PARAMS(src, expand_weights, expand_bias, dw_weights, dw_bias, proj_weights, proj_bias, dst);
+
+    auto k = std::make_unique<kernels::CpuInvertedResidualKernel>();
+    k->configure(src, expand_weights, expand_bias, dw_weights, dw_bias, proj_weights, proj_bias, dst, info);
+
+    _are_weights_const = expand_weights->are_values_constant() && dw_weights->are_values_constant() &&
+                         proj_weights->are_values_constant();
+    _is_prepared = false;
+
+    // Every thread owns a slice of the working buffer holding the expanded rows of its band
+    const unsigned int num_threads  = NEScheduler::get().num_threads();
+    const size_t       element_size = src->element_size();
+    const unsigned int exp_channels = expand_weights->dimension(3);
+    const Size2D       dw_kernel(dw_weights->dimension(1), dw_weights->dimension(2));
+
+    const size_t working_size =
+        kernels::CpuInvertedResidualKernel::working_elements_per_thread(src, dst, exp_channels, dw_kernel) *
+        num_threads * element_size;
+    const size_t packed_size = kernels::CpuInvertedResidualKernel::packed_offsets(
+                                   src->dimension(0), exp_channels, proj_weights->dimension(3), dw_kernel)
+                                   .total *
+                               element_size;
+
+    _aux_mem.clear();
+    _aux_mem.push_back(
+        experimental::MemoryInfo(TensorType::ACL_INT_0, experimental::MemoryLifetime::Temporary, working_size));
+    _aux_mem.push_back(
+        experimental::MemoryInfo(TensorType::ACL_INT_1, experimental::MemoryLifetime::Persistent, packed_size));
+
+    _kernel = std::move(k);
+}
+
+Status CpuInvertedResidual::validate(const ITensorInfo               *src,
+                                     const ITensorInfo               *expand_weights,
+                                     const ITensorInfo               *expand_bias,
+                                     const ITensorInfo               *dw_weights,
+                                     const ITensorInfo               *dw_bias,
+                                     const ITensorInfo               *proj_weights,
+                                     const ITensorInfo               *proj_bias,
+                                     const ITensorInfo               *dst,
+                                     const InvertedResidualLayerInfo &info)
+{
+    return kernels::CpuInvertedResidualKernel::validate(src, expand_weights, expand_bias, dw_weights, dw_bias,
+                                                        proj_weights, proj_bias, dst, info);
+}
+
+void CpuInvertedResidual::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared || !_are_weights_const)
+    {
+        const ITensor *expand_weights = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+        const ITensor *expand_bias    = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+        const ITensor *dw_weights     = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+        const ITensor *dw_bias        = tensors.get_const_tensor(TensorType::ACL_SRC_4);
+        const ITensor *proj_weights   = tensors.get_const_tensor(TensorType::ACL_SRC_5);
+        const ITensor *proj_bias      = tensors.get_const_tensor(TensorType::ACL_SRC_6);
+        ITensor       *packed         = tensors.get_tensor(TensorType::ACL_INT_1);
+        ARM_COMPUTE_ERROR_ON_NULLPTR(expand_weights, dw_weights, proj_weights, packed);
+
+        kernels::CpuInvertedResidualKernel::pack_weights(expand_weights, expand_bias, dw_weights, dw_bias,
+                                                         proj_weights, proj_bias, packed);
+
+        if (_are_weights_const)
+        {
+            for (const ITensor *t : {expand_weights, expand_bias, dw_weights, dw_bias, proj_weights, proj_bias})
+            {
+                if (t != nullptr)
+                {
+                    t->mark_as_unused();
+                }
+            }
+        }
+        _is_prepared = true;
+    }
+}
+
+void CpuInvertedResidual::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    prepare(tensors);
+
+    // Split over output rows so each thread walks a contiguous band, otherwise over batches
+    const auto split_dimension = _kernel->window().num_iterations(Window::DimZ) != 1 ? Window::DimZ : Window::DimW;
+    NEScheduler::get().schedule_op(_kernel.get(), split_dimension, _kernel->window(), tensors);
+}
+
+experimental::MemoryRequirements CpuInvertedResidual::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuKVCacheAppend.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/cpu/kernels/CpuKVCacheAppendKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void CpuKVCacheAppend::configure(const ITensorInfo *src, const ITensorInfo *cache)
+{
+    ARM_COMPUTE_LOG_PARAMS(src, cache);
+
+    auto k = std::make_unique<kernels::CpuKVCacheAppendKernel>();
+    k->configure(src, cache);
+    _kernel = std::move(k);
+}
+
+Status CpuKVCacheAppend::validate(const ITensorInfo *src, const ITensorInfo *cache)
+{
+    return kernels::CpuKVCacheAppendKernel::validate(src, cache);
+}
+
+void CpuKVCacheAppend::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    // A decoding step appends a single token, in which case the rows are split over the heads
+    const unsigned int num_tokens      = _kernel->window().num_iterations(Window::DimY);
+    const auto         split_dimension = num_tokens >= NEScheduler::get().num_threads() ? Window::DimY : Window::DimZ;
+    NEScheduler::get().schedule_op(_kernel.get(), split_dimension, _kernel->window(), tensors);
+}
+} // namespace cpu
+} // namespace arm_compute
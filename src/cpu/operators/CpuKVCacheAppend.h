@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUKVCACHEAPPEND_H
+#define ACL_SRC_CPU_OPERATORS_CPUKVCACHEAPPEND_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuOperator.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to run @ref kernels::CpuKVCacheAppendKernel
+ *
+ * The tensor pack is expected to hold:
+ * - ACL_SRC: keys or values to append
+ * - ACL_DST: view of the cache starting at the first free position, with the shape of ACL_SRC
+ */
+class CpuKVCacheAppend : public ICpuOperator
+{
+public:
+    /** Initialise the operator's input and output
+     *
+     * Similar to @ref NEKVCacheAppend::configure()
+     *
+     * @param[in] src   Source tensor info with dimensions [head_dim, tokens, num_heads, batches].
+     * @param[in] cache Cache storage tensor info with dimensions [head_dim, capacity, num_heads, batches].
+     */
+    void configure(const ITensorInfo *src, const ITensorInfo *cache);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuKVCacheAppend::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *cache);
+
+    // Inherited methods overridden:
+    void run(ITensorPack &tensors) override;
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUKVCACHEAPPEND_H
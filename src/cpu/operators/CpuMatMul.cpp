@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Arm Limited.
+ * Copyright (c) 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -80,6 +80,30 @@ Status get_gemmlowp_output_stage_info(const ITensorInfo         *src,
 
     return Status{};
 }
+
+/** Compute how many consecutive lhs batches share the same rhs matrix
+ *
+ * Each rhs batch dimension must either match the lhs one or divide it. Broadcasting is only supported along a single
+ * dimension whose lower batch dimensions are all 1, so that the collapsed lhs batch i reads the collapsed rhs batch
+ * i / group, as for the query heads of grouped-query attention sharing a key/value head.
+ */
+Status get_batch_group_size(const TensorShape &lhs, const TensorShape &rhs, size_t &group)
+{
+    group = 1;
+    for (unsigned int i = 2; i < Coordinates::num_max_dimensions; i++)
+    {
+        if (lhs[i] == rhs[i])
+        {
+            continue;
+        }
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(rhs[i] == 0 || lhs[i] % rhs[i] != 0,
+                                        "Batch dimensions of rhs must be equal to or divide the ones of lhs.");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(group != 1 || lhs.total_size_lower(i) != lhs.total_size_lower(2),
+                                        "Broadcasting is only supported in the innermost non-unit batch dimension of lhs.");
+        group = lhs[i] / rhs[i];
+    }
+    return Status{};
+}
 } // namespace
 
 CpuMatMul::CpuMatMul()
@@ -90,7 +114,8 @@ CpuMatMul::CpuMatMul()
       _rhs_transposed(),
       _original_lhs_shape(),
       _original_rhs_shape(),
-      _original_dst_shape()
+      _original_dst_shape(),
+      _batch_group(1)
 {
 }
 
@@ -144,12 +169,13 @@ Status CpuMatMul::validate(const ITensorInfo         *lhs,
                                     "The product AB is defined only if the number of columns in A is equal to the "
                                     "number of rows in B (after transpose)");
 
-    // Iterate over dimensions to be collapsed in operator - check dimensions are equivalent between tensors
-    for (unsigned int i = 2; i < Coordinates::num_max_dimensions; i++)
-    {
-        ARM_COMPUTE_RETURN_ERROR_ON_MSG(lhs_to_use->dimension(i) != rhs_to_use->dimension(i),
-                                        "Broadcasting in Batch dimension is unsupported by this operator.");
-    }
+    // Check the batch dimensions of rhs are equal to or can be broadcast to the ones of lhs
+    size_t batch_group = 1;
+    ARM_COMPUTE_RETURN_ON_ERROR(
+        get_batch_group_size(lhs_to_use->tensor_shape(), rhs_to_use->tensor_shape(), batch_group));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->total_size() != 0 && dst->tensor_shape().total_size_upper(2) !=
+                                                                  lhs->tensor_shape().total_size_upper(2),
+                                    "The batch dimensions of dst must match the ones of lhs.");
 
     // Quantized-specific configuration
     if (is_data_type_quantized(lhs->data_type()))
@@ -193,7 +219,9 @@ void CpuMatMul::configure(ITensorInfo               *lhs,
     // 1. Create and reshape tensors
     // ------------------------------------------------------
     // a. Clone TensorInfo to prevent changing original tensor values during setup
-    // b. Change shape of lhs/dst to [x, y, 1, collapsed(z)] to match assembly kernel configuration
+    // b. Change shape of lhs/dst to [x, y, group, collapsed(z) / group] to match assembly kernel configuration, where
+    //    group is the number of lhs batches sharing a rhs matrix: the assembly kernel runs them as batches of the same
+    //    multi, so a broadcast rhs is read in place and never replicated
     // c. For rhs collapse all dimensions larger than 3 to z dimension
     TensorInfo lhs_to_use = *lhs->clone();
     TensorInfo dst_to_use = *dst->clone();
@@ -203,12 +231,11 @@ void CpuMatMul::configure(ITensorInfo               *lhs,
     _original_lhs_shape = lhs_to_use.tensor_shape();
     _original_dst_shape = dst_to_use.tensor_shape();
     _original_rhs_shape = rhs_to_use.tensor_shape();
+    _batch_group        = _original_lhs_shape.total_size_upper(2) / _original_rhs_shape.total_size_upper(2);
 
     // Reshape lhs for use with assembly kernels.
-    lhs_to_use.set_tensor_shape(
-        TensorShape(_original_lhs_shape.x(), _original_lhs_shape.y(), 1, _original_lhs_shape.collapsed_from(2).z()));
-    dst_to_use.set_tensor_shape(
-        TensorShape(_original_dst_shape.x(), _original_dst_shape.y(), 1, _original_dst_shape.collapsed_from(2).z()));
+    lhs_to_use.set_tensor_shape(asm_shape(_original_lhs_shape));
+    dst_to_use.set_tensor_shape(asm_shape(_original_dst_shape));
     rhs_to_use.set_tensor_shape(_original_rhs_shape.collapsed_from(2));
 
     // 2.  Configuration for transpose of lhs/rhs
@@ -289,14 +316,10 @@ void CpuMatMul::run(ITensorPack &tensors)
     auto rhs = tensors.get_const_tensor(ACL_SRC_1);
     auto dst = tensors.get_tensor(ACL_DST);
 
-    // Reshape LHS and DST to ensure compatibility with GEMM asm kernel (Batch dimensions is 4th for lhs and dst within asm)
+    // Reshape LHS and DST to ensure compatibility with GEMM asm kernel (Multi dimension is 4th for lhs and dst within asm)
     // Collapse RHS (necessary to support dimensions larger than 3 in gemm assembly)
-    lhs->info()->set_tensor_shape(
-        TensorShape(_original_lhs_shape.x(), _original_lhs_shape.y(), 1,
-                    _original_lhs_shape.collapsed_from(2).z())); // Collapsed 3+ dimensions into z
-    dst->info()->set_tensor_shape(
-        TensorShape(_original_dst_shape.x(), _original_dst_shape.y(), 1,
-                    _original_dst_shape.collapsed_from(2).z())); // Collapsed 3+ dimensions into z
+    lhs->info()->set_tensor_shape(asm_shape(_original_lhs_shape));
+    dst->info()->set_tensor_shape(asm_shape(_original_dst_shape));
     rhs->info()->set_tensor_shape(_original_rhs_shape.collapsed_from(2));
 
     // Initialise object to handle stored transposed tensors in auxillary memory
@@ -310,16 +333,16 @@ void CpuMatMul::run(ITensorPack &tensors)
     if (_adj_lhs)
     {
         ITensorPack lhs_transpose_pack = {{TensorType::ACL_SRC, lhs}, {TensorType::ACL_DST, lhs_transposed.get()}};
-        NEScheduler::get().schedule_op(_transpose_kernel_lhs.get(), Window::DimY, _transpose_kernel_lhs->window(),
-                                       lhs_transpose_pack);
+        NEScheduler::get().schedule_op(_transpose_kernel_lhs.get(), _transpose_kernel_lhs->get_split_dimension_hint(),
+                                       _transpose_kernel_lhs->window(), lhs_transpose_pack);
         asm_tensors.add_const_tensor(TensorType::ACL_SRC_0, lhs_transposed.get());
     }
     // Run transpose rhs if necessary
     if (_adj_rhs)
     {
         ITensorPack rhs_transpose_pack = {{TensorType::ACL_SRC, rhs}, {TensorType::ACL_DST, rhs_transposed.get()}};
-        NEScheduler::get().schedule_op(_transpose_kernel_rhs.get(), Window::DimY, _transpose_kernel_rhs->window(),
-                                       rhs_transpose_pack);
+        NEScheduler::get().schedule_op(_transpose_kernel_rhs.get(), _transpose_kernel_rhs->get_split_dimension_hint(),
+                                       _transpose_kernel_rhs->window(), rhs_transpose_pack);
         asm_tensors.add_const_tensor(TensorType::ACL_SRC_1, rhs_transposed.get());
     }
     // Run asm kernel
@@ -331,6 +354,13 @@ void CpuMatMul::run(ITensorPack &tensors)
     rhs->info()->set_tensor_shape(_original_rhs_shape);
 }
 
+TensorShape CpuMatMul::asm_shape(const TensorShape &shape) const
+{
+    // Collapse 3+ dimensions and split them into [group, multis]
+    const size_t batches = shape.total_size_upper(2);
+    return TensorShape(shape.x(), shape.y(), _batch_group, batches / _batch_group);
+}
+
 experimental::MemoryRequirements CpuMatMul::workspace() const
 {
     return _aux_mem;
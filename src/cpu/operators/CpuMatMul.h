@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -99,6 +99,9 @@ private:
         Count
     };
 
+    /** Shape of lhs/dst as seen by the assembly kernel: [x, y, group, collapsed(z) / group] */
+    TensorShape asm_shape(const TensorShape &shape) const;
+
     // Define unique pointers to kernels/operators used by matmul
     std::unique_ptr<kernels::CpuTransposeKernel> _transpose_kernel_lhs{nullptr};
     std::unique_ptr<kernels::CpuTransposeKernel> _transpose_kernel_rhs{nullptr};
@@ -113,6 +116,9 @@ private:
     TensorShape _original_rhs_shape{};
     TensorShape _original_dst_shape{};
 
+    // Number of consecutive lhs batches multiplied by the same rhs matrix
+    size_t _batch_group{1};
+
     // Note : adj_lhs means the same as transposing lhs
     bool                             _adj_lhs{false};
     bool                             _adj_rhs{false};
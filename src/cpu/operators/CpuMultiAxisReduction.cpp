@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuMultiAxisReduction.h"
+
+#include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/cpu/kernels/CpuMultiAxisReductionKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+// Minimum number of source elements reduced by every slice when the reduction is split
+constexpr size_t min_elements_per_partial = 4096;
+} // namespace
+
+void CpuMultiAxisReduction::configure(const ITensorInfo *src,
+                                      ITensorInfo       *dst,
+                                      const Coordinates &reduction_axis,
+                                      ReductionOperation op,
+                                      bool               keep_dims)
+{
+    ARM_COMPUTE_LOG_PARAMS(src, dst, reduction_axis, op, keep_dims);
+
+    auto kernel = std::make_unique<kernels::CpuMultiAxisReductionKernel>();
+    kernel->configure(src, dst, reduction_axis, op, keep_dims);
+
+    // Split over the outermost kept dimension with enough steps for every thread, or the kept dimension with the
+    // most steps
+    const Window      &win         = kernel->window();
+    const unsigned int num_threads = NEScheduler::get().num_threads();
+    size_t             max_steps   = 0;
+    _split_dimension               = Window::DimX;
+    for (size_t d = Coordinates::num_max_dimensions; d > 0; --d)
+    {
+        const size_t steps = win.num_iterations(d - 1);
+        if (steps >= num_threads)
+        {
+            _split_dimension = d - 1;
+            max_steps        = steps;
+            break;
+        }
+        if (steps > max_steps)
+        {
+            _split_dimension = d - 1;
+            max_steps        = steps;
+        }
+    }
+
+    // Too few outputs to keep every thread busy: split the reduction itself if there is enough work per slice
+    const size_t num_partials =
+        std::min<size_t>(num_threads, src->tensor_shape().total_size() / min_elements_per_partial);
+    if (max_steps < num_threads && num_partials > 1)
+    {
+        kernel->configure(src, dst, reduction_axis, op, keep_dims, num_partials);
+        _split_dimension = Window::DimX;
+    }
+
+    _aux_mem.clear();
+    if (kernel->num_partials() != 0)
+    {
+        _aux_mem.push_back(experimental::MemoryInfo(TensorType::ACL_INT_0, experimental::MemoryLifetime::Temporary,
+                                                    kernel->partials_size()));
+    }
+
+    _kernel = std::move(kernel);
+}
+
+Status CpuMultiAxisReduction::validate(const ITensorInfo *src,
+                                       const ITensorInfo *dst,
+                                       const Coordinates &reduction_axis,
+                                       ReductionOperation op,
+                                       bool               keep_dims)
+{
+    return kernels::CpuMultiAxisReductionKernel::validate(src, dst, reduction_axis, op, keep_dims);
+}
+
+void CpuMultiAxisReduction::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    auto *kernel = static_cast<kernels::CpuMultiAxisReductionKernel *>(_kernel.get());
+    NEScheduler::get().schedule_op(kernel, _split_dimension, kernel->window(), tensors);
+    if (kernel->num_partials() != 0)
+    {
+        kernel->combine(tensors);
+    }
+}
+
+experimental::MemoryRequirements CpuMultiAxisReduction::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
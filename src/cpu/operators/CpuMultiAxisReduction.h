@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUMULTIAXISREDUCTION_H
+#define ACL_SRC_CPU_OPERATORS_CPUMULTIAXISREDUCTION_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuOperator.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to run @ref kernels::CpuMultiAxisReductionKernel
+ *
+ * Outputs are computed in parallel when there are enough of them for every thread. Otherwise every thread reduces
+ * a slice of the largest reduced dimension into a temporary buffer and the slices are merged once they are done.
+ *
+ * The tensor pack is expected to hold:
+ * - ACL_SRC: src
+ * - ACL_DST: dst
+ */
+class CpuMultiAxisReduction : public ICpuOperator
+{
+public:
+    /** Initialise the operator's input and output
+     *
+     * @param[in]  src            Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     *                            Supported tensor rank: up to 4.
+     * @param[out] dst            Destination tensor info. Data type supported: Same as @p src.
+     * @param[in]  reduction_axis Axes to reduce. Negative values wrap around the rank of @p src.
+     * @param[in]  op             Reduction operation: SUM, MEAN_SUM, PROD, MAX or MIN. PROD is not supported for
+     *                            quantized types.
+     * @param[in]  keep_dims      Whether to keep the reduced dimensions with length 1.
+     */
+    void configure(const ITensorInfo *src,
+                   ITensorInfo       *dst,
+                   const Coordinates &reduction_axis,
+                   ReductionOperation op,
+                   bool               keep_dims);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuMultiAxisReduction::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src,
+                           const ITensorInfo *dst,
+                           const Coordinates &reduction_axis,
+                           ReductionOperation op,
+                           bool               keep_dims);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    size_t                           _split_dimension{Window::DimX};
+    experimental::MemoryRequirements _aux_mem{};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUMULTIAXISREDUCTION_H
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuPagedAttention.h"
+
+#include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/cpu/kernels/CpuPagedAttentionKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void CpuPagedAttention::configure(const ITensorInfo *q,
+                                  const ITensorInfo *k,
+                                  const ITensorInfo *v,
+                                  const ITensorInfo *block_tables,
+                                  const ITensorInfo *seq_lens,
+                                  ITensorInfo       *dst,
+                                  float              scale)
+{
+    ARM_COMPUTE_LOG_PARAMS(q, k, v, block_tables, seq_lens, dst, scale);
+
+    auto kernel = std::make_unique<kernels::CpuPagedAttentionKernel>();
+    kernel->configure(q, k, v, block_tables, seq_lens, dst, scale);
+
+    // Every thread owns a slice of the working buffer holding the scores of the longest possible sequence
+    const unsigned int num_threads   = NEScheduler::get().num_threads();
+    const unsigned int max_positions = block_tables->dimension(0) * k->dimension(1);
+    const size_t       working_size =
+        kernels::CpuPagedAttentionKernel::working_size(q->dimension(0), max_positions) * num_threads;
+
+    _aux_mem.clear();
+    _aux_mem.push_back(
+        experimental::MemoryInfo(TensorType::ACL_INT_0, experimental::MemoryLifetime::Temporary, working_size));
+
+    _kernel = std::move(kernel);
+}
+
+Status CpuPagedAttention::validate(const ITensorInfo *q,
+                                   const ITensorInfo *k,
+                                   const ITensorInfo *v,
+                                   const ITensorInfo *block_tables,
+                                   const ITensorInfo *seq_lens,
+                                   const ITensorInfo *dst,
+                                   float              scale)
+{
+    return kernels::CpuPagedAttentionKernel::validate(q, k, v, block_tables, seq_lens, dst, scale);
+}
+
+void CpuPagedAttention::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    // Split over sequences when there are enough of them for every thread, otherwise over heads
+    const unsigned int num_seqs        = _kernel->window().num_iterations(Window::DimZ);
+    const auto         split_dimension = num_seqs >= NEScheduler::get().num_threads() ? Window::DimZ : Window::DimY;
+    NEScheduler::get().schedule_op(_kernel.get(), split_dimension, _kernel->window(), tensors);
+}
+
+experimental::MemoryRequirements CpuPagedAttention::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
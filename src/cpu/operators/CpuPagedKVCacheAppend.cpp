@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuPagedKVCacheAppend.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/cpu/kernels/CpuPagedKVCacheAppendKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void CpuPagedKVCacheAppend::configure(const ITensorInfo *src, const ITensorInfo *slots, const ITensorInfo *pool)
+{
+    ARM_COMPUTE_LOG_PARAMS(src, slots, pool);
+
+    auto k = std::make_unique<kernels::CpuPagedKVCacheAppendKernel>();
+    k->configure(src, slots, pool);
+    _kernel = std::move(k);
+}
+
+Status CpuPagedKVCacheAppend::validate(const ITensorInfo *src, const ITensorInfo *slots, const ITensorInfo *pool)
+{
+    return kernels::CpuPagedKVCacheAppendKernel::validate(src, slots, pool);
+}
+
+void CpuPagedKVCacheAppend::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    // Batched decoding appends a single token per sequence, in which case the rows are split over the heads
+    const unsigned int num_tokens      = _kernel->window().num_iterations(Window::DimZ);
+    const auto         split_dimension = num_tokens >= NEScheduler::get().num_threads() ? Window::DimZ : Window::DimY;
+    NEScheduler::get().schedule_op(_kernel.get(), split_dimension, _kernel->window(), tensors);
+}
+} // namespace cpu
+} // namespace arm_compute
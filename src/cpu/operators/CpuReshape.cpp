@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2024 Arm Limited.
+ * Copyright (c) 2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -48,13 +48,26 @@ Status CpuReshape::validate(const ITensorInfo *src, const ITensorInfo *dst)
 void CpuReshape::run(ITensorPack &tensors)
 {
     ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+    auto *kernel = static_cast<kernels::CpuReshapeKernel *>(_kernel.get());
     if (!_is_prepared)
     {
-        static_cast<kernels::CpuReshapeKernel *>(_kernel.get())->prepare(tensors);
+        kernel->prepare(tensors);
         _is_prepared = true;
     }
-    const auto split_dimension = static_cast<kernels::CpuReshapeKernel *>(_kernel.get())->get_split_dimension();
-    NEScheduler::get().schedule_op(_kernel.get(), split_dimension, _kernel->window(), tensors);
+
+    // Contiguous tensors that share their memory, e.g. a destination aliasing the source, already hold the result
+    if (kernel->is_contiguous())
+    {
+        const ITensor *src = tensors.get_const_tensor(TensorType::ACL_SRC);
+        const ITensor *dst = tensors.get_const_tensor(TensorType::ACL_DST);
+        if (src->buffer() + src->info()->offset_first_element_in_bytes() ==
+            dst->buffer() + dst->info()->offset_first_element_in_bytes())
+        {
+            return;
+        }
+    }
+
+    NEScheduler::get().schedule_op(kernel, kernel->get_split_dimension(), kernel->window(), tensors);
 }
 } // namespace cpu
 } // namespace arm_compute
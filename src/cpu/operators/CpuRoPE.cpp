@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuRoPE.h"
+
+#include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/cpu/kernels/CpuRoPEKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void CpuRoPE::configure(const ITensorInfo *q,
+                        const ITensorInfo *k,
+                        const ITensorInfo *positions,
+                        ITensorInfo       *q_dst,
+                        ITensorInfo       *k_dst,
+                        const RoPEInfo    &info)
+{
+    ARM_COMPUTE_LOG_PARAMS(q, k, positions, q_dst, k_dst, info);
+
+    auto kernel = std::make_unique<kernels::CpuRoPEKernel>();
+    kernel->configure(q, k, positions, q_dst, k_dst, info);
+
+    _is_prepared = false;
+
+    // The table is computed once, while every thread owns a slice of the working buffer for the positions it misses
+    const unsigned int num_threads = NEScheduler::get().num_threads();
+
+    _aux_mem.clear();
+    if (kernel->table_size() > 0)
+    {
+        _aux_mem.push_back(experimental::MemoryInfo(TensorType::ACL_INT_0, experimental::MemoryLifetime::Persistent,
+                                                    kernel->table_size()));
+    }
+    _aux_mem.push_back(experimental::MemoryInfo(TensorType::ACL_INT_1, experimental::MemoryLifetime::Temporary,
+                                                kernel->working_size() * num_threads));
+
+    _kernel = std::move(kernel);
+}
+
+Status CpuRoPE::validate(const ITensorInfo *q,
+                         const ITensorInfo *k,
+                         const ITensorInfo *positions,
+                         const ITensorInfo *q_dst,
+                         const ITensorInfo *k_dst,
+                         const RoPEInfo    &info)
+{
+    return kernels::CpuRoPEKernel::validate(q, k, positions, q_dst, k_dst, info);
+}
+
+void CpuRoPE::set_position_offset(int position_offset)
+{
+    static_cast<kernels::CpuRoPEKernel *>(_kernel.get())->set_position_offset(position_offset);
+}
+
+void CpuRoPE::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared)
+    {
+        const auto *kernel = static_cast<const kernels::CpuRoPEKernel *>(_kernel.get());
+        if (kernel->table_size() > 0)
+        {
+            ITensor *table = tensors.get_tensor(TensorType::ACL_INT_0);
+            ARM_COMPUTE_ERROR_ON_NULLPTR(table);
+            kernel->fill_table(table);
+        }
+        _is_prepared = true;
+    }
+}
+
+void CpuRoPE::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    prepare(tensors);
+
+    // Split over tokens when there are enough of them for every thread, otherwise over batches
+    const unsigned int num_tokens      = _kernel->window().num_iterations(Window::DimY);
+    const auto         split_dimension = num_tokens >= NEScheduler::get().num_threads() ? Window::DimY : Window::DimW;
+    NEScheduler::get().schedule_op(_kernel.get(), split_dimension, _kernel->window(), tensors);
+}
+
+experimental::MemoryRequirements CpuRoPE::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
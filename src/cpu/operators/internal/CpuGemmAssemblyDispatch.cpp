@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025 Arm Limited.
+ * Copyright (c) 2018-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,7 @@
 #include "src/cpu/kernels/assembly/CpuGemmAssemblyWrapperKernel.h"
 #include "src/cpu/operators/CpuTranspose.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
+#include "support/Mutex.h"
 
 #include <arm_neon.h>
 
@@ -119,6 +120,10 @@ Params extract_parameters(const ITensorInfo *a, const ITensorInfo *b, const ITen
     {
         p.indirect = true;
         p.sections = b->tensor_shape()[2] * b->tensor_shape()[3];
+        if (info.conv3d)
+        {
+            p.sections *= b->tensor_shape()[4];
+        }
     }
     else
     {
@@ -131,6 +136,12 @@ Params extract_parameters(const ITensorInfo *a, const ITensorInfo *b, const ITen
     {
         p.M       = d->tensor_shape().y() * d->tensor_shape().z();
         p.batches = d->tensor_shape().total_size_upper(3) / p.multis;
+        if (info.conv3d)
+        {
+            // The depth of the output is folded into M as well
+            p.M *= d->tensor_shape()[3];
+            p.batches = d->tensor_shape().total_size_upper(4) / p.multis;
+        }
     }
 
     return p;
@@ -247,7 +258,10 @@ private:
      * @param[in]  info GEMM meta-data
      */
     void configure_indirect(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, const AsmGemmInfo &info);
-    /** Prepare the indirect buffer */
+    /** Fill the indirect buffer with pointers to the rows of the source tensor
+     *
+     * @param[in] tensors Tensor pack holding the source tensor as ACL_SRC_0.
+     */
     void prepare_indirect_buffer(ITensorPack &tensors);
 
     /** Operator to transpose B before gemm or pretranspose_B_array*/
@@ -277,6 +291,11 @@ private:
     std::vector<const TypeInput *>        _indirect_buf{};
     std::vector<TypeInput>                _indirect_pad{};
     arm_gemm::ConvolutionParameters       _cp{};
+    int64_t                               _input_depth{1};
+    int64_t                               _kernel_depth{1};
+    int64_t                               _output_depth{1};
+    const uint8_t                        *_indirect_src{nullptr};
+    arm_compute::Mutex                    _indirect_mtx{};
     experimental::MemoryRequirements      _aux_mem{Count};
     bool                                  _B_pretranspose_required{false};
     bool                                  _is_b_constant{true};
@@ -308,48 +327,64 @@ Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::set_requantize_data(co
 template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
 void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare_indirect_buffer(ITensorPack &tensors)
 {
-    auto             a              = tensors.get_const_tensor(TensorType::ACL_SRC_0);
-    const TypeInput *A_ptr          = reinterpret_cast<TypeInput *>(a->buffer());
-    const int        multis         = 1;
-    const int        batches        = a->info()->tensor_shape().total_size_upper(3);
-    const size_t     stride_A       = a->info()->strides_in_bytes().y() / sizeof(TypeInput);
-    const size_t     batch_stride_A = a->info()->strides_in_bytes()[3] / sizeof(TypeInput);
-    const size_t     multi_stride_A = a->info()->strides_in_bytes()[4] / sizeof(TypeInput);
-
-    const size_t output_hw    = _cp.output_height * _cp.output_width;
-    const int    batch_size   = _cp.kernel_height * _cp.kernel_width * output_hw * sizeof(TypeInput);
-    const size_t batch_stride = batch_size / sizeof(TypeInput);
-    const int    multi_size   = batch_size * batches;
-    const size_t multi_stride = multi_size / sizeof(TypeInput);
+    auto a = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a);
+    const TypeInput *A_ptr =
+        reinterpret_cast<const TypeInput *>(a->buffer() + a->info()->offset_first_element_in_bytes());
+    const size_t a_batch_idx    = _gemm_info.conv3d ? 4 : 3;
+    const int    multis         = 1;
+    const int    batches        = a->info()->tensor_shape().total_size_upper(a_batch_idx);
+    const size_t stride_A       = a->info()->strides_in_bytes().y() / sizeof(TypeInput);
+    const size_t batch_stride_A = a->info()->strides_in_bytes()[a_batch_idx] / sizeof(TypeInput);
+    const size_t multi_stride_A = a->info()->strides_in_bytes()[a_batch_idx + 1] / sizeof(TypeInput);
+
+    const size_t output_size  = _output_depth * _cp.output_height * _cp.output_width;
+    const size_t batch_stride = _kernel_depth * _cp.kernel_height * _cp.kernel_width * output_size;
+    const size_t multi_stride = batch_stride * batches;
 
     for (int64_t m = 0; m < multis; m++)
     {
         for (int64_t b = 0; b < batches; b++)
         {
-            for (int64_t output_y = 0; output_y < _cp.output_height; output_y++)
+            for (int64_t output_z = 0; output_z < _output_depth; output_z++)
             {
-                for (int64_t output_x = 0; output_x < _cp.output_width; output_x++)
+                for (int64_t output_y = 0; output_y < _cp.output_height; output_y++)
                 {
-                    int64_t output_xy = (output_y * _cp.output_width) + output_x;
-
-                    for (int64_t kernel_y = 0; kernel_y < _cp.kernel_height; kernel_y++)
+                    for (int64_t output_x = 0; output_x < _cp.output_width; output_x++)
                     {
-                        for (int64_t kernel_x = 0; kernel_x < _cp.kernel_width; kernel_x++)
-                        {
-                            int64_t input_x   = (output_x * _cp.output_stride_w) + kernel_x - _cp.padding_left;
-                            int64_t input_y   = (output_y * _cp.output_stride_h) + kernel_y - _cp.padding_top;
-                            int64_t kernel_xy = (kernel_y * _cp.kernel_width) + kernel_x;
-                            int64_t input_xy  = (input_y * _cp.input_width) + input_x;
+                        const int64_t output_xyz =
+                            (((output_z * _cp.output_height) + output_y) * _cp.output_width) + output_x;
 
-                            if (input_x < 0 || input_x >= _cp.input_width || input_y < 0 || input_y >= _cp.input_height)
-                            {
-                                _indirect_buf[m * multi_stride + b * batch_stride + kernel_xy * output_hw + output_xy] =
-                                    _indirect_pad.data();
-                            }
-                            else
+                        for (int64_t kernel_z = 0; kernel_z < _kernel_depth; kernel_z++)
+                        {
+                            for (int64_t kernel_y = 0; kernel_y < _cp.kernel_height; kernel_y++)
                             {
-                                _indirect_buf[m * multi_stride + b * batch_stride + kernel_xy * output_hw + output_xy] =
-                                    A_ptr + (m * multi_stride_A + b * batch_stride_A + input_xy * stride_A);
+                                for (int64_t kernel_x = 0; kernel_x < _cp.kernel_width; kernel_x++)
+                                {
+                                    const int64_t input_x =
+                                        (output_x * _cp.output_stride_w) + kernel_x - _cp.padding_left;
+                                    const int64_t input_y =
+                                        (output_y * _cp.output_stride_h) + kernel_y - _cp.padding_top;
+                                    const int64_t input_z =
+                                        (output_z * _gemm_info.stride_depth) + kernel_z - _gemm_info.padding_front;
+                                    const int64_t kernel_xyz =
+                                        (((kernel_z * _cp.kernel_height) + kernel_y) * _cp.kernel_width) + kernel_x;
+                                    const int64_t input_xyz =
+                                        (((input_z * _cp.input_height) + input_y) * _cp.input_width) + input_x;
+                                    const size_t idx =
+                                        m * multi_stride + b * batch_stride + kernel_xyz * output_size + output_xyz;
+
+                                    if (input_x < 0 || input_x >= _cp.input_width || input_y < 0 ||
+                                        input_y >= _cp.input_height || input_z < 0 || input_z >= _input_depth)
+                                    {
+                                        _indirect_buf[idx] = _indirect_pad.data();
+                                    }
+                                    else
+                                    {
+                                        _indirect_buf[idx] =
+                                            A_ptr + (m * multi_stride_A + b * batch_stride_A + input_xyz * stride_A);
+                                    }
+                                }
                             }
                         }
                     }
@@ -357,6 +392,7 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare_indirect_
             }
         }
     }
+    _indirect_src = a->buffer();
 }
 
 template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
@@ -366,6 +402,7 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure_indirec
                                                                                   const AsmGemmInfo &info)
 {
     ARM_COMPUTE_ERROR_ON(!(info.method == AsmConvMethod::Conv || info.method == AsmConvMethod::Indirect));
+    ARM_COMPUTE_ERROR_ON(info.conv3d && info.method != AsmConvMethod::Indirect);
 
     float zeropad = 0.f;
     if (is_data_type_quantized(a->data_type()))
@@ -381,6 +418,10 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure_indirec
     const auto output_width   = static_cast<int64_t>(d->tensor_shape()[1]);
     const auto output_height  = static_cast<int64_t>(d->tensor_shape()[2]);
 
+    _input_depth  = info.conv3d ? static_cast<int64_t>(a->tensor_shape()[3]) : 1;
+    _kernel_depth = info.conv3d ? static_cast<int64_t>(b->tensor_shape()[4]) : 1;
+    _output_depth = info.conv3d ? static_cast<int64_t>(d->tensor_shape()[3]) : 1;
+
     _cp = {input_width,
            input_height,
            input_channels,
@@ -403,20 +444,19 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure_indirec
 
     if (info.method == AsmConvMethod::Indirect)
     {
-        const unsigned int multis    = 1;
-        const unsigned int batches   = a->tensor_shape().total_size_upper(3);
-        const unsigned int kernel_hw = _cp.kernel_width * _cp.kernel_height;
-        const unsigned int output_hw = _cp.output_width * _cp.output_height;
-
-        using TypeInputPtr        = TypeInput *;
-        const int    batch_size   = kernel_hw * output_hw * sizeof(TypeInputPtr);
-        const size_t batch_stride = batch_size / sizeof(TypeInputPtr);
-        const int    multi_size   = batch_size * batches;
-        const size_t multi_stride = multi_size / sizeof(TypeInputPtr);
-
-        _indirect_buf = std::vector<const TypeInput *>(multi_size * multis);
-        _indirect_arg = std::vector<const TypeInput *const *>(sizeof(TypeInput **) * kernel_hw * multis * batches);
+        const unsigned int multis      = 1;
+        const unsigned int batches     = a->tensor_shape().total_size_upper(info.conv3d ? 4 : 3);
+        const unsigned int kernel_size = _kernel_depth * _cp.kernel_height * _cp.kernel_width;
+        const unsigned int output_size = _output_depth * _cp.output_height * _cp.output_width;
+
+        // One pointer per kernel point and output point, laid out [multi][batch][kernel point][output point]
+        const size_t batch_stride = static_cast<size_t>(kernel_size) * output_size;
+        const size_t multi_stride = batch_stride * batches;
+
+        _indirect_buf = std::vector<const TypeInput *>(multi_stride * multis);
+        _indirect_arg = std::vector<const TypeInput *const *>(kernel_size * multis * batches);
         _indirect_pad = std::vector<TypeInput>(_cp.input_channels, TypeInput(zeropad));
+        _indirect_src = nullptr;
 
         // Set indirect argument
         int64_t pos = 0;
@@ -424,9 +464,10 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure_indirec
         {
             for (int64_t b = 0; b < batches; b++)
             {
-                for (int64_t kernel_xy = 0; kernel_xy < kernel_hw; kernel_xy++)
+                for (int64_t kernel_xyz = 0; kernel_xyz < kernel_size; kernel_xyz++)
                 {
-                    _indirect_arg[pos++] = &_indirect_buf[m * multi_stride + b * batch_stride + kernel_xy * output_hw];
+                    _indirect_arg[pos++] =
+                        &_indirect_buf[m * multi_stride + b * batch_stride + kernel_xyz * output_size];
                 }
             }
         }
@@ -549,6 +590,17 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure(const I
 template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
 void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare(ITensorPack &tensors)
 {
+    // The indirect buffer points into the source tensor, so it is built once the source memory is known. The packs
+    // given when preparing the weights usually do not hold the source, in which case this happens on the first run.
+    if (_gemm_info.method == AsmConvMethod::Indirect && _indirect_src == nullptr)
+    {
+        auto a = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+        if (a != nullptr && a->buffer() != nullptr)
+        {
+            prepare_indirect_buffer(tensors);
+        }
+    }
+
     if (!_is_prepared)
     {
         auto b = tensors.get_const_tensor(TensorType::ACL_SRC_1);
@@ -604,11 +656,6 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare(ITensorPa
             // its memory will be auto-managed by the handler
         }
 
-        if (_gemm_info.method == AsmConvMethod::Indirect)
-        {
-            prepare_indirect_buffer(tensors);
-        }
-
         _is_prepared = true;
     }
 }
@@ -634,6 +681,14 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
     auto d = tensors.get_tensor(TensorType::ACL_DST);
     ARM_COMPUTE_ERROR_ON_NULLPTR(a, d);
 
+    // The indirect buffer points into the source tensor and is rebuilt when the source memory changes, so runs of an
+    // indirect convolution are serialized to keep one run from reading the buffer while another one rebuilds it
+    arm_compute::unique_lock<arm_compute::Mutex> indirect_lock{};
+    if (_gemm_info.method == AsmConvMethod::Indirect)
+    {
+        indirect_lock = arm_compute::unique_lock<arm_compute::Mutex>(_indirect_mtx);
+    }
+
     // Only update at runtime if the src quantization is dynamic
     if (std::is_same<OutputStage, arm_gemm::DequantizeFloat>::value &&
         (a->info()->quantization_info().is_dynamic() || b->info()->quantization_info().is_dynamic()))
@@ -647,9 +702,9 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
     int       ldb = 0;
     const int ldd = d->info()->strides_in_bytes().y() / d->info()->element_size();
 
-    const size_t a_batch_idx = _gemm_info.reinterpret_input_as_3d != 0 ? 3 : 2;
+    const size_t a_batch_idx = _gemm_info.reinterpret_input_as_3d != 0 ? (_gemm_info.conv3d ? 4 : 3) : 2;
     const size_t a_multi_idx = a_batch_idx + 1;
-    const size_t d_batch_idx = _gemm_info.depth_output_gemm3d != 0 ? 3 : 2;
+    const size_t d_batch_idx = _gemm_info.depth_output_gemm3d != 0 ? (_gemm_info.conv3d ? 4 : 3) : 2;
     const size_t d_multi_idx = d_batch_idx + 1;
 
     int       batch_stride_a = a->info()->strides_in_bytes()[a_batch_idx] / a->info()->element_size();
@@ -772,6 +827,11 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
 
     if (_gemm_info.method == AsmConvMethod::Indirect)
     {
+        // The source memory changed since the buffer was built, e.g. a different buffer was imported
+        if (a->buffer() != _indirect_src)
+        {
+            prepare_indirect_buffer(tensors);
+        }
         in0_ptr        = nullptr;
         lda            = 0;
         batch_stride_a = 0;
@@ -1065,6 +1125,8 @@ Status CpuGemmAssemblyDispatch::validate(
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_BF16_UNSUPPORTED(a);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(!(info.reshape_b_only_on_first_run),
                                     "Assembly kernel will not be executed when reshape_b_only_on_first_run is false");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.conv3d && info.method != AsmConvMethod::Indirect,
+                                    "3D convolutions are only supported through an indirect buffer");
 
 #ifndef __aarch64__
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->element_size() == 1, "8bit integer types only supported for aarch64");
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025 Arm Limited.
+ * Copyright (c) 2018-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -52,6 +52,8 @@ struct AsmGemmInfo
     bool                      depth_output_gemm3d{false};
     int64_t                   padding_top{0};
     int64_t                   padding_left{0};
+    int64_t                   padding_front{0};
+    int64_t                   stride_depth{1};
     float                     padding_value{0.f};
     bool                      fast_mode{false};
     bool                      fixed_format{false};
@@ -66,6 +68,10 @@ struct AsmGemmInfo
      *       fixed format kernels do not accept weights (B) with any prior transformations
      */
     bool transpose_b{false};
+    /** Whether the indirect convolution is 3D, with NDHWC a and d and [OFM, IFM, kernel_x, kernel_y, kernel_z] b
+     * @note Only supported by @ref AsmConvMethod::Indirect
+     */
+    bool conv3d{false};
 };
 
 /** Assembly kernel glue */
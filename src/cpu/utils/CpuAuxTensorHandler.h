@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,7 @@
 #include "arm_compute/core/ITensorPack.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/WorkspaceArena.h"
 
 #include "src/common/utils/Log.h"
 #include "support/Cast.h"
@@ -74,6 +75,10 @@ namespace cpu
  *          tensor_pack.add_tensor(aux_handler.get());
  *      }
  *      op.run(tensor_pack);
+ *
+ * @note About workspace arenas
+ * If a @ref WorkspaceArena is bound to the calling thread (see @ref WorkspaceArenaScope), newly needed tensors are
+ * carved out of it instead of being allocated, and given back to the arena when the handler is destroyed.
  */
 class CpuAuxTensorHandler
 {
@@ -116,8 +121,20 @@ public:
         {
             if (!bypass_alloc)
             {
-                _tensor.allocator()->allocate();
-                ARM_COMPUTE_LOG_INFO_WITH_FUNCNAME_ACL("Allocating auxiliary tensor");
+                WorkspaceArena *arena = WorkspaceArena::get_thread_arena();
+                if (arena != nullptr)
+                {
+                    // Same default alignment as TensorAllocator::allocate()
+                    _arena_buffer = arena->allocate(info.total_size(), 64);
+                    _arena        = arena;
+                    _tensor.allocator()->import_memory(_arena_buffer);
+                    ARM_COMPUTE_LOG_INFO_WITH_FUNCNAME_ACL("Allocating auxiliary tensor from workspace arena");
+                }
+                else
+                {
+                    _tensor.allocator()->allocate();
+                    ARM_COMPUTE_LOG_INFO_WITH_FUNCNAME_ACL("Allocating auxiliary tensor");
+                }
             }
 
             if (pack_inject)
@@ -166,6 +183,11 @@ public:
         {
             _injected_tensor_pack->remove_tensor(_injected_slot_id);
         }
+        if (_arena != nullptr)
+        {
+            _tensor.allocator()->free();
+            _arena->release(_arena_buffer);
+        }
     }
 
     ITensor *get()
@@ -179,9 +201,11 @@ public:
     }
 
 private:
-    Tensor       _tensor{};
-    ITensorPack *_injected_tensor_pack{nullptr};
-    int          _injected_slot_id{TensorType::ACL_UNKNOWN};
+    Tensor          _tensor{};
+    ITensorPack    *_injected_tensor_pack{nullptr};
+    int             _injected_slot_id{TensorType::ACL_UNKNOWN};
+    WorkspaceArena *_arena{nullptr};
+    void           *_arena_buffer{nullptr};
 };
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -768,6 +768,20 @@ NodeID GraphBuilder::add_roi_align_node(
     return nid;
 }
 
+NodeID GraphBuilder::add_rope_node(Graph &g, NodeParams params, NodeIdxPair q, NodeIdxPair k, const RoPEInfo &info)
+{
+    check_nodeidx_pair(q, g);
+    check_nodeidx_pair(k, g);
+
+    NodeID nid = g.add_node<RoPELayerNode>(info);
+
+    g.add_connection(q.node_id, q.index, nid, 0);
+    g.add_connection(k.node_id, k.index, nid, 1);
+
+    set_node_params(g, nid, params);
+    return nid;
+}
+
 NodeID GraphBuilder::add_scale_layer(Graph              &g,
                                      const NodeParams   &params,
                                      NodeIdxPair         input,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,8 +30,11 @@
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/PassManager.h"
+#include "arm_compute/graph/QuantizationCalibrator.h"
 #include "arm_compute/graph/TypePrinter.h"
 #include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/WorkspaceArena.h"
 
 #include "src/common/utils/Log.h"
 
@@ -47,6 +50,10 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
 {
     ARM_COMPUTE_LOG_INFO_WITH_FUNCNAME_ACL("Initiate graph configuration!");
 
+    // Functions query the scheduler while being configured, make sure they see the one of the graph
+    SchedulerScope      scheduler_scope(ctx.config().runtime_ctx);
+    WorkspaceArenaScope arena_scope(ctx.config().runtime_ctx);
+
     // Check if graph has been registered
     if (_workloads.find(graph.id()) != std::end(_workloads))
     {
@@ -100,6 +107,13 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     detail::allocate_const_tensors(graph);
     detail::call_all_const_node_accessors(graph);
 
+    // Record the constants before preparing the functions releases them
+    const GraphConfig &config = ctx.config();
+    if (config.calibrator != nullptr && !config.use_calibrated_quantization)
+    {
+        config.calibrator->observe_constants(graph);
+    }
+
     // Prepare graph
     detail::prepare_all_tasks(workload);
 
@@ -129,6 +143,9 @@ void GraphManager::execute_graph(Graph &graph)
     auto it = _workloads.find(graph.id());
     ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
 
+    SchedulerScope      scheduler_scope(it->second.ctx->config().runtime_ctx);
+    WorkspaceArenaScope arena_scope(it->second.ctx->config().runtime_ctx);
+
     while (true)
     {
         // Call input accessors
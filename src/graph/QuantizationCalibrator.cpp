@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/QuantizationCalibrator.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/Utils.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Read the values of a mapped FP32 tensor, and their per-channel ranges along @p channel_dim if not negative */
+void read_tensor(const ITensor &tensor, int channel_dim, std::vector<float> &values, std::vector<TensorRange> &channels)
+{
+    const TensorShape &shape = tensor.info()->tensor_shape();
+
+    values.clear();
+    values.reserve(shape.total_size());
+    channels.assign(channel_dim >= 0 ? shape[channel_dim] : 0,
+                    TensorRange(std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest()));
+
+    Window window;
+    window.use_tensor_dimensions(shape);
+    Iterator it(&tensor, window);
+    execute_window_loop(
+        window,
+        [&](const Coordinates &id)
+        {
+            const float value = *reinterpret_cast<const float *>(it.ptr());
+            values.push_back(value);
+            if (channel_dim >= 0)
+            {
+                TensorRange &channel = channels[id[channel_dim]];
+                channel.first        = std::min(channel.first, value);
+                channel.second       = std::max(channel.second, value);
+            }
+        },
+        it);
+}
+} // namespace
+
+QuantizationCalibrator::QuantizationCalibrator(const CalibrationInfo &info) : _info(info), _statistics()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(info.num_bins < 4 || info.num_bins % 4 != 0, "The number of bins must be a multiple of 4");
+    ARM_COMPUTE_ERROR_ON_MSG(info.percentile <= 50.f || info.percentile > 100.f, "Percentile must be in (50, 100]");
+}
+
+const CalibrationInfo &QuantizationCalibrator::info() const
+{
+    return _info;
+}
+
+void QuantizationCalibrator::record(TensorStatistics &stats, const std::vector<float> &values)
+{
+    if (values.empty())
+    {
+        return;
+    }
+
+    const auto  minmax  = std::minmax_element(values.begin(), values.end());
+    const float abs_max = std::max(std::abs(*minmax.first), std::abs(*minmax.second));
+
+    if (stats.histogram.empty())
+    {
+        stats.min   = *minmax.first;
+        stats.max   = *minmax.second;
+        stats.bound = std::max(abs_max, std::numeric_limits<float>::min());
+        stats.histogram.assign(_info.num_bins, 0);
+    }
+    stats.min = std::min(stats.min, *minmax.first);
+    stats.max = std::max(stats.max, *minmax.second);
+
+    // Double the histogram range until it covers the new values: every pair of bins merges into the middle half
+    const size_t num_bins = stats.histogram.size();
+    while (abs_max > stats.bound)
+    {
+        std::vector<uint64_t> folded(num_bins, 0);
+        for (size_t i = 0; i < num_bins; ++i)
+        {
+            folded[num_bins / 4 + i / 2] += stats.histogram[i];
+        }
+        stats.histogram.swap(folded);
+        stats.bound *= 2.f;
+    }
+
+    const float bin_scale = static_cast<float>(num_bins) / (2.f * stats.bound);
+    for (const float value : values)
+    {
+        const auto bin = static_cast<size_t>(std::max(0.f, (value + stats.bound) * bin_scale));
+        ++stats.histogram[std::min(bin, num_bins - 1)];
+    }
+}
+
+void QuantizationCalibrator::observe(Tensor &tensor)
+{
+    ITensorHandle *handle = tensor.handle();
+    if (tensor.desc().data_type != DataType::F32 || handle == nullptr)
+    {
+        return;
+    }
+
+    std::vector<float>       values;
+    std::vector<TensorRange> channels;
+
+    handle->map(true);
+    if (handle->tensor().buffer() != nullptr)
+    {
+        read_tensor(handle->tensor(), -1, values, channels);
+    }
+    handle->unmap();
+
+    TensorStatistics &stats = _statistics[tensor.id()];
+    stats.shape             = tensor.desc().shape;
+    record(stats, values);
+}
+
+void QuantizationCalibrator::observe_constants(Graph &g)
+{
+    for (const NodeID &nid : g.nodes(NodeType::Const))
+    {
+        INode  *node   = g.node(nid);
+        Tensor *tensor = node != nullptr ? node->output(0) : nullptr;
+        if (tensor == nullptr || tensor->handle() == nullptr || tensor->desc().data_type != DataType::F32)
+        {
+            continue;
+        }
+
+        // Weights are quantized per output channel
+        int channel_dim = -1;
+        for (const EdgeID &eid : tensor->bound_edges())
+        {
+            const Edge *edge = g.edge(eid);
+            if (edge != nullptr && edge->consumer() != nullptr && edge->consumer_idx() == 1)
+            {
+                channel_dim = weights_channel_dimension(*edge->consumer());
+            }
+        }
+
+        std::vector<float>       values;
+        std::vector<TensorRange> channels;
+
+        ITensorHandle *handle = tensor->handle();
+        handle->map(true);
+        if (handle->tensor().buffer() != nullptr)
+        {
+            read_tensor(handle->tensor(), channel_dim, values, channels);
+        }
+        handle->unmap();
+
+        // Constants are the same at every run
+        TensorStatistics stats{};
+        stats.shape          = tensor->desc().shape;
+        stats.channel_ranges = std::move(channels);
+        record(stats, values);
+        _statistics[tensor->id()] = std::move(stats);
+    }
+}
+
+bool QuantizationCalibrator::has_range(TensorID tid, const TensorShape &shape) const
+{
+    const auto it = _statistics.find(tid);
+    return it != _statistics.end() && !it->second.histogram.empty() && it->second.shape == shape;
+}
+
+TensorRange QuantizationCalibrator::range(TensorID tid) const
+{
+    const TensorStatistics &stats = _statistics.at(tid);
+
+    float min = stats.min;
+    float max = stats.max;
+    if (_info.method == CalibrationMethod::PERCENTILE && !stats.histogram.empty())
+    {
+        // Discard the same fraction of the values on both tails of the histogram
+        const std::vector<uint64_t> &histogram = stats.histogram;
+        const size_t                 num_bins  = histogram.size();
+        const float                  bin_width = 2.f * stats.bound / num_bins;
+        const double                 total     = std::accumulate(histogram.begin(), histogram.end(), 0.0);
+        const double                 tail      = total * (100.0 - _info.percentile) / 100.0;
+
+        size_t lower_bin = 0;
+        double lower_sum = 0.0;
+        while (lower_bin < num_bins && lower_sum + histogram[lower_bin] <= tail)
+        {
+            lower_sum += histogram[lower_bin++];
+        }
+        size_t upper_bin = num_bins;
+        double upper_sum = 0.0;
+        while (upper_bin > lower_bin && upper_sum + histogram[upper_bin - 1] <= tail)
+        {
+            upper_sum += histogram[--upper_bin];
+        }
+
+        min = std::max(min, -stats.bound + lower_bin * bin_width);
+        max = std::min(max, -stats.bound + upper_bin * bin_width);
+    }
+
+    return TensorRange(std::min(min, 0.f), std::max(max, 0.f));
+}
+
+std::vector<TensorRange> QuantizationCalibrator::channel_ranges(TensorID tid) const
+{
+    const auto it = _statistics.find(tid);
+    return it != _statistics.end() ? it->second.channel_ranges : std::vector<TensorRange>();
+}
+
+int QuantizationCalibrator::weights_channel_dimension(const INode &node)
+{
+    const Tensor *weights = node.input(1);
+    if (weights == nullptr)
+    {
+        return -1;
+    }
+
+    switch (node.type())
+    {
+        case NodeType::ConvolutionLayer:
+            return static_cast<int>(get_dimension_idx(weights->desc().layout, DataLayoutDimension::BATCHES));
+        case NodeType::DepthwiseConvolutionLayer:
+            return static_cast<int>(get_dimension_idx(weights->desc().layout, DataLayoutDimension::CHANNEL));
+        default:
+            return -1;
+    }
+}
+} // namespace graph
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -94,11 +94,18 @@ PassManager create_default_pass_manager(Target target, const GraphConfig &cfg)
             }
         }
     }
+    pm.append(std::make_unique<LayoutPropagationMutator>());
     pm.append(std::make_unique<NodeFusionMutator>());
+    pm.append(std::make_unique<ElementwiseFusionMutator>());
     pm.append(std::make_unique<GroupedConvolutionMutator>());
     pm.append(std::make_unique<InPlaceOperationMutator>());
+    if (cfg.use_calibrated_quantization && cfg.calibrator != nullptr)
+    {
+        pm.append(std::make_unique<CalibratedQuantizationMutator>(*cfg.calibrator));
+    }
 
     // Passes that mutate backend information
+    pm.append(std::make_unique<ReshapeAliasMutator>());
     pm.append(std::make_unique<DepthConcatSubTensorMutator>());
     pm.append(std::make_unique<SplitLayerSubTensorMutator>());
     pm.append(std::make_unique<NodeExecutionMethodMutator>());
@@ -229,5 +236,19 @@ void configure_tensor(Tensor *tensor)
     }
 }
 
+bool is_contiguous(const ITensorInfo &info)
+{
+    size_t packed_stride = info.element_size();
+    for (size_t d = 0; d < info.num_dimensions(); ++d)
+    {
+        if (info.strides_in_bytes()[d] != packed_stride)
+        {
+            return false;
+        }
+        packed_stride *= info.dimension(d);
+    }
+    return info.padding().empty();
+}
+
 } // namespace graph
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -95,6 +95,12 @@ Status CLNodeValidator::validate(INode *node)
         case NodeType::GenerateProposalsLayer:
             return detail::validate_generate_proposals_layer<CLGenerateProposalsLayer>(
                 *polymorphic_downcast<GenerateProposalsLayerNode *>(node));
+        case NodeType::GlobalPoolingFullyConnectedLayer:
+            return ARM_COMPUTE_CREATE_ERROR(arm_compute::ErrorCode::RUNTIME_ERROR,
+                                            "Unsupported operation : GlobalPoolingFullyConnectedLayer");
+        case NodeType::InvertedResidualLayer:
+            return ARM_COMPUTE_CREATE_ERROR(arm_compute::ErrorCode::RUNTIME_ERROR,
+                                            "Unsupported operation : InvertedResidualLayer");
         case NodeType::L2NormalizeLayer:
             return detail::validate_l2_normalize_layer<CLL2NormalizeLayer>(
                 *polymorphic_downcast<L2NormalizeLayerNode *>(node));
@@ -121,11 +127,16 @@ Status CLNodeValidator::validate(INode *node)
             return detail::validate_reshape_layer<CLReshapeLayer>(*polymorphic_downcast<ReshapeLayerNode *>(node));
         case NodeType::ROIAlignLayer:
             return detail::validate_roi_align_layer<CLROIAlignLayer>(*polymorphic_downcast<ROIAlignLayerNode *>(node));
+        case NodeType::RoPELayer:
+            return ARM_COMPUTE_CREATE_ERROR(arm_compute::ErrorCode::RUNTIME_ERROR, "Unsupported operation : RoPELayer");
         case NodeType::SliceLayer:
             return detail::validate_slice_layer<CLSlice>(*polymorphic_downcast<SliceLayerNode *>(node));
         case NodeType::StridedSliceLayer:
             return detail::validate_strided_slice_layer<CLStridedSlice>(
                 *polymorphic_downcast<StridedSliceLayerNode *>(node));
+        case NodeType::ElementwiseExpressionLayer:
+            return ARM_COMPUTE_CREATE_ERROR(arm_compute::ErrorCode::RUNTIME_ERROR,
+                                            "Unsupported operation : ElementwiseExpressionLayer");
         case NodeType::EltwiseLayer:
             return detail::validate_eltwise_Layer<CLEltwiseLayerFunctions>(
                 *polymorphic_downcast<EltwiseLayerNode *>(node));
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021,2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@
 
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/graph/backends/BackendRegistrar.h"
+#include "arm_compute/graph/backends/NEON/NEAliasTensorHandle.h"
 #include "arm_compute/graph/backends/NEON/NEFunctionFactory.h"
 #include "arm_compute/graph/backends/NEON/NENodeValidator.h"
 #include "arm_compute/graph/backends/NEON/NESubTensorHandle.h"
@@ -52,7 +53,7 @@ namespace backends
 /** Register CPU backend */
 static detail::BackendRegistrar<NEDeviceBackend> NEDeviceBackend_registrar(Target::NEON);
 
-NEDeviceBackend::NEDeviceBackend() : _allocator()
+NEDeviceBackend::NEDeviceBackend() : _allocator(), _config_allocator(nullptr)
 {
 }
 
@@ -63,18 +64,25 @@ void NEDeviceBackend::initialize_backend()
 
 void NEDeviceBackend::release_backend_context(GraphContext &ctx)
 {
-    //Nothing to do
-    ARM_COMPUTE_UNUSED(ctx);
+    // The backend is shared by all the graphs, so stop using the allocator of a context once it is released
+    if (_config_allocator == ctx.config().allocator)
+    {
+        _config_allocator = nullptr;
+    }
 }
 
 void NEDeviceBackend::setup_backend_context(GraphContext &ctx)
 {
     // Set number of threads
-    if (ctx.config().num_threads >= 0)
+    // Schedulers provided through a runtime context (e.g. scheduler partitions) are already sized by the user
+    if (ctx.config().num_threads >= 0 && ctx.config().runtime_ctx == nullptr)
     {
         Scheduler::get().set_num_threads(ctx.config().num_threads);
     }
 
+    // Tensors and memory pools are allocated with the configured allocator, if any
+    _config_allocator = ctx.config().allocator;
+
     // Create function level memory manager
     if (ctx.memory_management_ctx(Target::NEON) == nullptr)
     {
@@ -83,7 +91,7 @@ void NEDeviceBackend::setup_backend_context(GraphContext &ctx)
         mm_ctx.intra_mm    = create_memory_manager(MemoryManagerAffinity::Offset);
         mm_ctx.cross_mm    = create_memory_manager(MemoryManagerAffinity::Offset);
         mm_ctx.cross_group = std::make_shared<MemoryGroup>(mm_ctx.cross_mm);
-        mm_ctx.allocator   = &_allocator;
+        mm_ctx.allocator   = backend_allocator();
 
         ctx.insert_memory_management_ctx(std::move(mm_ctx));
     }
@@ -106,7 +114,7 @@ bool NEDeviceBackend::is_backend_supported()
 
 IAllocator *NEDeviceBackend::backend_allocator()
 {
-    return &_allocator;
+    return (_config_allocator != nullptr) ? _config_allocator : &_allocator;
 }
 
 std::unique_ptr<ITensorHandle> NEDeviceBackend::create_tensor(const Tensor &tensor)
@@ -119,7 +127,7 @@ std::unique_ptr<ITensorHandle> NEDeviceBackend::create_tensor(const Tensor &tens
     TensorInfo info(tensor_desc.shape, 1, tensor_desc.data_type, tensor_desc.quant_info);
     info.set_data_layout(tensor_desc.layout);
 
-    return std::make_unique<NETensorHandle>(info);
+    return std::make_unique<NETensorHandle>(info, _config_allocator);
 }
 
 std::unique_ptr<ITensorHandle>
@@ -133,6 +141,16 @@ NEDeviceBackend::create_subtensor(ITensorHandle *parent, TensorShape shape, Coor
     return std::make_unique<NESubTensorHandle>(parent, shape, coords, extend_parent);
 }
 
+std::unique_ptr<ITensorHandle> NEDeviceBackend::create_tensor_alias(ITensorHandle *parent, TensorShape shape)
+{
+    if (parent == nullptr)
+    {
+        return nullptr;
+    }
+
+    return std::make_unique<NEAliasTensorHandle>(parent, shape);
+}
+
 std::unique_ptr<arm_compute::IFunction> NEDeviceBackend::configure_node(INode &node, GraphContext &ctx)
 {
     ARM_COMPUTE_LOG_GRAPH_VERBOSE("Configuring CPU node with ID : " << node.id() << std::endl);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021,2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -83,6 +83,7 @@ struct NEFusedLayerTypes
     using ConvolutionLayer          = NEConvolutionLayer;
     using DepthwiseConvolutionLayer = NEDepthwiseConvolutionLayer;
     using FuseBatchNormalization    = NEFuseBatchNormalization;
+    using InvertedResidualLayer     = NEInvertedResidualLayer;
 };
 
 namespace detail
@@ -161,6 +162,9 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
         case NodeType::DetectionPostProcessLayer:
             return detail::create_detection_post_process_layer<NEDetectionPostProcessLayer, NETargetInfo>(
                 *polymorphic_downcast<DetectionPostProcessLayerNode *>(node));
+        case NodeType::ElementwiseExpressionLayer:
+            return detail::create_elementwise_expression_layer<NEElementwiseExpression, NETargetInfo>(
+                *polymorphic_downcast<ElementwiseExpressionLayerNode *>(node));
         case NodeType::EltwiseLayer:
             return detail::create_eltwise_layer<NEEltwiseFunctions, NETargetInfo>(
                 *polymorphic_downcast<EltwiseLayerNode *>(node));
@@ -180,6 +184,13 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
             return detail::create_fused_depthwise_convolution_batch_normalization_layer<NEFusedLayerTypes,
                                                                                         NETargetInfo>(
                 *polymorphic_downcast<FusedDepthwiseConvolutionBatchNormalizationNode *>(node), ctx);
+        case NodeType::GlobalPoolingFullyConnectedLayer:
+            return detail::create_global_pooling_fully_connected_layer<NEGlobalPoolingFullyConnectedLayer,
+                                                                       NETargetInfo>(
+                *polymorphic_downcast<GlobalPoolingFullyConnectedLayerNode *>(node), ctx);
+        case NodeType::InvertedResidualLayer:
+            return detail::create_inverted_residual_layer<NEFusedLayerTypes, NETargetInfo>(
+                *polymorphic_downcast<InvertedResidualLayerNode *>(node), ctx);
         case NodeType::L2NormalizeLayer:
             return detail::create_l2_normalize_layer<NEL2NormalizeLayer, NETargetInfo>(
                 *polymorphic_downcast<L2NormalizeLayerNode *>(node), ctx);
@@ -216,6 +227,8 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
                 *polymorphic_downcast<ReshapeLayerNode *>(node));
         case NodeType::ResizeLayer:
             return detail::create_resize_layer<NEScale, NETargetInfo>(*polymorphic_downcast<ResizeLayerNode *>(node));
+        case NodeType::RoPELayer:
+            return detail::create_rope_layer<NERoPE, NETargetInfo>(*polymorphic_downcast<RoPELayerNode *>(node), ctx);
         case NodeType::SliceLayer:
             return detail::create_slice_layer<NESlice, NETargetInfo>(*polymorphic_downcast<SliceLayerNode *>(node));
         case NodeType::SoftmaxLayer:
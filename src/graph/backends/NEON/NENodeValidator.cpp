@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -95,6 +95,12 @@ Status NENodeValidator::validate(INode *node)
         case NodeType::GenerateProposalsLayer:
             return ARM_COMPUTE_CREATE_ERROR(arm_compute::ErrorCode::RUNTIME_ERROR,
                                             "Unsupported operation : GenerateProposalsLayer");
+        case NodeType::GlobalPoolingFullyConnectedLayer:
+            return detail::validate_global_pooling_fully_connected_layer<NEGlobalPoolingFullyConnectedLayer>(
+                *polymorphic_downcast<GlobalPoolingFullyConnectedLayerNode *>(node));
+        case NodeType::InvertedResidualLayer:
+            return detail::validate_inverted_residual_layer<NEInvertedResidualLayer>(
+                *polymorphic_downcast<InvertedResidualLayerNode *>(node));
         case NodeType::L2NormalizeLayer:
             return detail::validate_l2_normalize_layer<NEL2NormalizeLayer>(
                 *polymorphic_downcast<L2NormalizeLayerNode *>(node));
@@ -122,11 +128,16 @@ Status NENodeValidator::validate(INode *node)
         case NodeType::ROIAlignLayer:
             return ARM_COMPUTE_CREATE_ERROR(arm_compute::ErrorCode::RUNTIME_ERROR,
                                             "Unsupported operation : ROIAlignLayer");
+        case NodeType::RoPELayer:
+            return detail::validate_rope_layer<NERoPE>(*polymorphic_downcast<RoPELayerNode *>(node));
         case NodeType::SliceLayer:
             return detail::validate_slice_layer<NESlice>(*polymorphic_downcast<SliceLayerNode *>(node));
         case NodeType::StridedSliceLayer:
             return detail::validate_strided_slice_layer<NEStridedSlice>(
                 *polymorphic_downcast<StridedSliceLayerNode *>(node));
+        case NodeType::ElementwiseExpressionLayer:
+            return detail::validate_elementwise_expression_layer<NEElementwiseExpression>(
+                *polymorphic_downcast<ElementwiseExpressionLayerNode *>(node));
         case NodeType::EltwiseLayer:
             return detail::validate_eltwise_Layer<NEEltwiseLayerFunctions>(
                 *polymorphic_downcast<EltwiseLayerNode *>(node));
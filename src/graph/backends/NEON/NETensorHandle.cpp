@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,9 +33,10 @@ namespace graph
 {
 namespace backends
 {
-NETensorHandle::NETensorHandle(const ITensorInfo &info) : _tensor()
+NETensorHandle::NETensorHandle(const ITensorInfo &info, IAllocator *allocator) : _tensor()
 {
     _tensor.allocator()->init(info);
+    _tensor.allocator()->set_backing_allocator(allocator);
 }
 
 void NETensorHandle::allocate()
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,9 +27,15 @@
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/FlattenLayerNode.h"
+#include "arm_compute/graph/nodes/ReshapeLayerNode.h"
+#include "arm_compute/graph/QuantizationCalibrator.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/Utils.h"
 
+#include "support/Cast.h"
+
 namespace arm_compute
 {
 namespace graph
@@ -131,6 +137,52 @@ void allocate_all_tensors(Graph &g)
     }
 }
 
+void update_tensor_alias(INode &node)
+{
+    ReshapeLayerNode *reshape = nullptr;
+    FlattenLayerNode *flatten = nullptr;
+    if (node.type() == NodeType::ReshapeLayer)
+    {
+        reshape = arm_compute::utils::cast::polymorphic_downcast<ReshapeLayerNode *>(&node);
+    }
+    else if (node.type() == NodeType::FlattenLayer)
+    {
+        flatten = arm_compute::utils::cast::polymorphic_downcast<FlattenLayerNode *>(&node);
+    }
+    if ((reshape == nullptr || reshape->is_enabled()) && (flatten == nullptr || flatten->is_enabled()))
+    {
+        return;
+    }
+
+    Tensor *input  = node.input(0);
+    Tensor *output = node.output(0);
+    ARM_COMPUTE_ERROR_ON(input == nullptr || input->handle() == nullptr || output == nullptr);
+
+    backends::IDeviceBackend      &backend = backends::BackendRegistry::get().get_backend(output->desc().target);
+    std::unique_ptr<ITensorHandle> handle  = nullptr;
+    if (is_contiguous(*input->handle()->tensor().info()))
+    {
+        handle = backend.create_tensor_alias(input->handle(), output->desc().shape);
+    }
+
+    if (handle == nullptr)
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("The input of the node with ID : " << node.id() << " and name : " << node.name()
+                                                                         << " is padded, copying it" << std::endl);
+        handle = backend.create_tensor(*output);
+        ARM_COMPUTE_ERROR_ON_MSG(!handle, "Couldn't create backend handle!");
+        if (reshape != nullptr)
+        {
+            reshape->set_enabled(true);
+        }
+        else
+        {
+            flatten->set_enabled(true);
+        }
+    }
+    output->set_handle(std::move(handle));
+}
+
 ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::vector<NodeID> &node_order)
 {
     ExecutionWorkload workload;
@@ -146,6 +198,9 @@ ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::ve
         auto node = g.node(node_id);
         if (node != nullptr)
         {
+            // The producers of the node are configured, so the padding of its inputs is final
+            update_tensor_alias(*node);
+
             Target                     assigned_target = node->assigned_target();
             backends::IDeviceBackend  &backend         = backends::BackendRegistry::get().get_backend(assigned_target);
             std::unique_ptr<IFunction> func            = backend.configure_node(*node, ctx);
@@ -242,10 +297,32 @@ void call_all_tasks(ExecutionWorkload &workload)
         }
     }
 
+    // Record the ranges of the tensors while they are still valid, if calibrating
+    const GraphConfig      &config     = workload.ctx->config();
+    QuantizationCalibrator *calibrator = config.use_calibrated_quantization ? nullptr : config.calibrator;
+    if (calibrator != nullptr)
+    {
+        for (auto &input : workload.inputs)
+        {
+            calibrator->observe(*input);
+        }
+    }
+
     // Execute tasks
     for (auto &task : workload.tasks)
     {
         task();
+        if (calibrator != nullptr && task.node != nullptr)
+        {
+            for (unsigned int i = 0; i < task.node->num_outputs(); ++i)
+            {
+                Tensor *output = task.node->output(i);
+                if (output != nullptr)
+                {
+                    calibrator->observe(*output);
+                }
+            }
+        }
     }
 
     // Release memory for the transition buffers
@@ -0,0 +1,635 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/CalibratedQuantizationMutator.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/ITensorAccessor.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/graph/QuantizationCalibrator.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "support/Cast.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <set>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Accessor that loads a FP32 constant and stores it quantized */
+class QuantizingAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] accessor    Accessor of the FP32 constant
+     * @param[in] desc        Descriptor of the FP32 constant
+     * @param[in] scales      Quantization scale, or one scale per channel
+     * @param[in] offset      Quantization offset
+     * @param[in] channel_dim Dimension indexing @p scales if there is more than one scale
+     */
+    QuantizingAccessor(ITensorAccessorUPtr accessor,
+                       TensorDescriptor    desc,
+                       std::vector<float>  scales,
+                       int32_t             offset,
+                       size_t              channel_dim)
+        : _accessor(std::move(accessor)),
+          _desc(std::move(desc)),
+          _scales(std::move(scales)),
+          _offset(offset),
+          _channel_dim(channel_dim)
+    {
+    }
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        if (!_accessor->access_tensor_data())
+        {
+            return _accessor->access_tensor(tensor);
+        }
+
+        TensorInfo src_info(_desc.shape, 1, _desc.data_type);
+        src_info.set_data_layout(_desc.layout);
+
+        arm_compute::Tensor src;
+        src.allocator()->init(src_info);
+        src.allocator()->allocate();
+        if (!_accessor->access_tensor(src))
+        {
+            return false;
+        }
+
+        const bool   is_s32    = tensor.info()->data_type() == DataType::S32;
+        const double min_value =
+            is_s32 ? std::numeric_limits<int32_t>::lowest() : std::numeric_limits<int8_t>::lowest();
+        const double max_value = is_s32 ? std::numeric_limits<int32_t>::max() : std::numeric_limits<int8_t>::max();
+
+        Window window;
+        window.use_tensor_dimensions(_desc.shape);
+        Iterator src_it(&src, window);
+        execute_window_loop(
+            window,
+            [&](const Coordinates &id)
+            {
+                const float  scale  = _scales.size() > 1 ? _scales[id[_channel_dim]] : _scales[0];
+                const double value  = std::round(*reinterpret_cast<const float *>(src_it.ptr()) / scale) + _offset;
+                const double result = std::max(min_value, std::min(max_value, value));
+                if (is_s32)
+                {
+                    *reinterpret_cast<int32_t *>(tensor.ptr_to_element(id)) = static_cast<int32_t>(result);
+                }
+                else
+                {
+                    *reinterpret_cast<int8_t *>(tensor.ptr_to_element(id)) = static_cast<int8_t>(result);
+                }
+            },
+            src_it);
+
+        return true;
+    }
+
+    bool access_tensor_data() override
+    {
+        return _accessor->access_tensor_data();
+    }
+
+private:
+    ITensorAccessorUPtr _accessor;
+    TensorDescriptor    _desc;
+    std::vector<float>  _scales;
+    int32_t             _offset;
+    size_t              _channel_dim;
+};
+
+QuantizationInfo asymmetric_quantization_info(const TensorRange &range)
+{
+    const float scale  = range.second > range.first ? (range.second - range.first) / 255.f : 1.f;
+    const int   offset = static_cast<int>(std::lround(-128.f - range.first / scale));
+    return QuantizationInfo(scale, std::max(-128, std::min(127, offset)));
+}
+
+float symmetric_scale(const TensorRange &range)
+{
+    const float abs_max = std::max(std::abs(range.first), std::abs(range.second));
+    return abs_max > 0.f ? abs_max / 127.f : 1.f;
+}
+
+bool is_weighted(const INode &node)
+{
+    return node.type() == NodeType::ConvolutionLayer || node.type() == NodeType::DepthwiseConvolutionLayer ||
+           node.type() == NodeType::FullyConnectedLayer;
+}
+
+/** Nodes whose output values are a subset of their input values */
+bool preserves_range(const INode &node)
+{
+    switch (node.type())
+    {
+        case NodeType::FlattenLayer:
+        case NodeType::PermuteLayer:
+        case NodeType::ReshapeLayer:
+        case NodeType::SliceLayer:
+        case NodeType::SplitLayer:
+        case NodeType::StridedSliceLayer:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/** Nodes running quantized with the quantization of their input */
+bool keeps_input_quantization(const INode &node)
+{
+    return preserves_range(node) || node.type() == NodeType::PoolingLayer;
+}
+
+/** Nodes running quantized with a fixed output quantization */
+bool has_fixed_output_quantization(const INode &node)
+{
+    if (node.type() == NodeType::SoftmaxLayer)
+    {
+        return true;
+    }
+    if (node.type() == NodeType::ActivationLayer)
+    {
+        const auto act = arm_compute::utils::cast::polymorphic_downcast<const ActivationLayerNode *>(&node)
+                             ->activation_info()
+                             .activation();
+        return act == ActivationLayerInfo::ActivationFunction::LOGISTIC ||
+               act == ActivationLayerInfo::ActivationFunction::TANH;
+    }
+    return false;
+}
+
+bool is_in_place(const INode &node)
+{
+    return node.num_inputs() != 0 && node.num_outputs() != 0 && node.input(0) != nullptr &&
+           node.input(0) == node.output(0);
+}
+
+bool is_const_input(const INode &node, size_t idx)
+{
+    const Edge *edge = node.input_edge(idx);
+    return edge != nullptr && edge->producer() != nullptr && edge->producer()->type() == NodeType::Const;
+}
+
+const INode *get_producer(const Graph &g, const Tensor &tensor)
+{
+    for (const EdgeID &eid : tensor.bound_edges())
+    {
+        const Edge *edge = g.edge(eid);
+        if (edge != nullptr && edge->producer() != nullptr)
+        {
+            return edge->producer();
+        }
+    }
+    return nullptr;
+}
+
+/** Range of a tensor
+ *
+ * Aliased reshapes and sub-tensor concatenations or splits are not run by a task of their own, so the range of their
+ * outputs is not recorded: it is then derived from the ranges of their inputs.
+ */
+bool get_range(const Graph &g, const QuantizationCalibrator &calibrator, const Tensor &tensor, TensorRange &range)
+{
+    if (calibrator.has_range(tensor.id(), tensor.desc().shape))
+    {
+        range = calibrator.range(tensor.id());
+        return true;
+    }
+
+    const INode *producer = get_producer(g, tensor);
+    if (producer == nullptr || producer->num_inputs() == 0 ||
+        (!preserves_range(*producer) && producer->type() != NodeType::ConcatenateLayer))
+    {
+        return false;
+    }
+
+    range = TensorRange(0.f, 0.f);
+    for (size_t i = 0; i < producer->num_inputs(); ++i)
+    {
+        TensorRange input_range;
+        if (producer->input(i) == nullptr || !get_range(g, calibrator, *producer->input(i), input_range))
+        {
+            return false;
+        }
+        range.first  = std::min(range.first, input_range.first);
+        range.second = std::max(range.second, input_range.second);
+    }
+    return true;
+}
+
+bool is_supported_type(const INode &node)
+{
+    switch (node.type())
+    {
+        case NodeType::ConcatenateLayer:
+        case NodeType::FlattenLayer:
+        case NodeType::FullyConnectedLayer:
+        case NodeType::PermuteLayer:
+        case NodeType::ReshapeLayer:
+        case NodeType::SliceLayer:
+        case NodeType::SoftmaxLayer:
+        case NodeType::SplitLayer:
+        case NodeType::StridedSliceLayer:
+            return true;
+        case NodeType::ConvolutionLayer:
+            return arm_compute::utils::cast::polymorphic_downcast<const ConvolutionLayerNode *>(&node)->num_groups() ==
+                   1;
+        case NodeType::DepthwiseConvolutionLayer:
+            return true;
+        case NodeType::PoolingLayer:
+            return arm_compute::utils::cast::polymorphic_downcast<const PoolingLayerNode *>(&node)
+                       ->pooling_info()
+                       .pool_type != PoolingType::L2;
+        case NodeType::EltwiseLayer:
+        {
+            const EltwiseOperation op =
+                arm_compute::utils::cast::polymorphic_downcast<const EltwiseLayerNode *>(&node)->eltwise_operation();
+            return op == EltwiseOperation::Add || op == EltwiseOperation::Sub || op == EltwiseOperation::Mul;
+        }
+        case NodeType::ActivationLayer:
+        {
+            using ActFunc     = ActivationLayerInfo::ActivationFunction;
+            const ActFunc act = arm_compute::utils::cast::polymorphic_downcast<const ActivationLayerNode *>(&node)
+                                    ->activation_info()
+                                    .activation();
+            return act == ActFunc::RELU || act == ActFunc::BOUNDED_RELU || act == ActFunc::LU_BOUNDED_RELU ||
+                   act == ActFunc::LOGISTIC || act == ActFunc::TANH || act == ActFunc::LEAKY_RELU ||
+                   act == ActFunc::HARD_SWISH || act == ActFunc::IDENTITY;
+        }
+        default:
+            return false;
+    }
+}
+
+bool can_quantize(const Graph &g, const QuantizationCalibrator &calibrator, const INode &node)
+{
+    if (!is_supported_type(node) || (is_in_place(node) && has_fixed_output_quantization(node)))
+    {
+        return false;
+    }
+
+    TensorRange range;
+    for (size_t i = 0; i < node.num_outputs(); ++i)
+    {
+        const Tensor *output = node.output(i);
+        if (output == nullptr || output->desc().data_type != DataType::F32)
+        {
+            return false;
+        }
+        if (!keeps_input_quantization(node) && !has_fixed_output_quantization(node) && !is_in_place(node) &&
+            !get_range(g, calibrator, *output, range))
+        {
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        const Tensor *input = node.input(i);
+        if (input == nullptr)
+        {
+            // Only the bias is optional
+            if (is_weighted(node) && i == 2)
+            {
+                continue;
+            }
+            return false;
+        }
+        if (input->desc().data_type != DataType::F32)
+        {
+            return false;
+        }
+
+        const bool is_weights = is_weighted(node) && i == 1;
+        const bool is_bias    = is_weighted(node) && i == 2;
+        if (!is_const_input(node, i))
+        {
+            if (is_weights || is_bias || !get_range(g, calibrator, *input, range))
+            {
+                return false;
+            }
+            continue;
+        }
+
+        // Constants are converted in place, so they cannot be shared with a FP32 node
+        if (input->bound_edges().size() != 1)
+        {
+            return false;
+        }
+        if (!is_bias && !calibrator.has_range(input->id(), input->desc().shape))
+        {
+            return false;
+        }
+        if (is_weights && node.type() != NodeType::FullyConnectedLayer)
+        {
+            const int channel_dim = QuantizationCalibrator::weights_channel_dimension(node);
+            if (channel_dim < 0 ||
+                calibrator.channel_ranges(input->id()).size() != input->desc().shape[static_cast<size_t>(channel_dim)])
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/** Quantize a constant when it is loaded
+ *
+ * @param[in,out] tensor      Constant to quantize.
+ * @param[in]     data_type   Quantized data type.
+ * @param[in]     scales      Quantization scale, or one scale per channel.
+ * @param[in]     offset      Quantization offset.
+ * @param[in]     channel_dim Dimension indexing @p scales if there is more than one scale.
+ */
+void quantize_constant(
+    Tensor &tensor, DataType data_type, const std::vector<float> &scales, int32_t offset, size_t channel_dim)
+{
+    ITensorAccessorUPtr accessor = tensor.extract_accessor();
+    if (accessor != nullptr)
+    {
+        tensor.set_accessor(
+            std::make_unique<QuantizingAccessor>(std::move(accessor), tensor.desc(), scales, offset, channel_dim));
+    }
+
+    tensor.desc().data_type  = data_type;
+    tensor.desc().quant_info = scales.size() > 1 ? QuantizationInfo(scales) : QuantizationInfo(scales[0], offset);
+}
+
+void quantize_constants(const QuantizationCalibrator &calibrator, INode &node)
+{
+    const float        input_scale = node.input(0)->desc().quant_info.uniform().scale;
+    std::vector<float> weights_scales;
+
+    for (size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        Tensor *tensor = node.input(i);
+        if (tensor == nullptr || !is_const_input(node, i))
+        {
+            continue;
+        }
+
+        if (is_weighted(node) && i == 1)
+        {
+            if (node.type() == NodeType::FullyConnectedLayer)
+            {
+                weights_scales = {symmetric_scale(calibrator.range(tensor->id()))};
+                quantize_constant(*tensor, DataType::QASYMM8_SIGNED, weights_scales, 0, 0);
+            }
+            else
+            {
+                weights_scales.clear();
+                for (const TensorRange &range : calibrator.channel_ranges(tensor->id()))
+                {
+                    weights_scales.push_back(symmetric_scale(range));
+                }
+                const int channel_dim = QuantizationCalibrator::weights_channel_dimension(node);
+                quantize_constant(*tensor, DataType::QSYMM8_PER_CHANNEL, weights_scales, 0,
+                                  static_cast<size_t>(channel_dim));
+            }
+        }
+        else if (is_weighted(node) && i == 2)
+        {
+            std::vector<float> bias_scales(weights_scales);
+            for (float &scale : bias_scales)
+            {
+                scale *= input_scale;
+            }
+            quantize_constant(*tensor, DataType::S32, bias_scales, 0, 0);
+        }
+        else
+        {
+            const QuantizationInfo qinfo = asymmetric_quantization_info(calibrator.range(tensor->id()));
+            quantize_constant(*tensor, DataType::QASYMM8_SIGNED, {qinfo.uniform().scale}, qinfo.uniform().offset, 0);
+        }
+    }
+}
+
+QuantizationInfo output_quantization_info(const Graph                  &g,
+                                          const QuantizationCalibrator &calibrator,
+                                          const INode                  &node,
+                                          const Tensor                 &output)
+{
+    if (node.type() == NodeType::SoftmaxLayer)
+    {
+        return QuantizationInfo(1.f / 256.f, -128);
+    }
+    if (node.type() == NodeType::ActivationLayer && has_fixed_output_quantization(node))
+    {
+        const auto act = arm_compute::utils::cast::polymorphic_downcast<const ActivationLayerNode *>(&node)
+                             ->activation_info()
+                             .activation();
+        return act == ActivationLayerInfo::ActivationFunction::TANH ? QuantizationInfo(1.f / 128.f, 0)
+                                                                     : QuantizationInfo(1.f / 256.f, -128);
+    }
+    if (keeps_input_quantization(node))
+    {
+        return node.input(0)->desc().quant_info;
+    }
+
+    TensorRange range;
+    const bool  has_range = get_range(g, calibrator, output, range);
+    ARM_COMPUTE_ERROR_ON(!has_range);
+    ARM_COMPUTE_UNUSED(has_range);
+    return asymmetric_quantization_info(range);
+}
+} // namespace
+
+CalibratedQuantizationMutator::CalibratedQuantizationMutator(const QuantizationCalibrator &calibrator)
+    : _calibrator(calibrator)
+{
+}
+
+const char *CalibratedQuantizationMutator::name()
+{
+    return "CalibratedQuantizationMutator";
+}
+
+IGraphMutator::MutationType CalibratedQuantizationMutator::type() const
+{
+    return IGraphMutator::MutationType::IR;
+}
+
+unsigned int CalibratedQuantizationMutator::num_quantized_nodes() const
+{
+    return _num_quantized_nodes;
+}
+
+void CalibratedQuantizationMutator::mutate(Graph &g)
+{
+    _num_quantized_nodes = 0;
+
+    // Select the nodes to quantize
+    std::set<NodeID> quantized;
+    for (auto &node : g.nodes())
+    {
+        if (node != nullptr && can_quantize(g, _calibrator, *node))
+        {
+            quantized.insert(node->id());
+        }
+    }
+
+    // An in-place node shares its tensor with the producer of its input, so both are either quantized or not
+    bool is_changed = true;
+    while (is_changed)
+    {
+        is_changed = false;
+        for (auto &node : g.nodes())
+        {
+            if (node == nullptr || !is_in_place(*node) || node->input_edge(0) == nullptr)
+            {
+                continue;
+            }
+            const INode *producer = node->input_edge(0)->producer();
+            if ((quantized.count(node->id()) != 0) != (producer != nullptr && quantized.count(producer->id()) != 0))
+            {
+                quantized.erase(node->id());
+                if (producer != nullptr)
+                {
+                    quantized.erase(producer->id());
+                }
+                is_changed = true;
+            }
+        }
+    }
+
+    if (quantized.empty())
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Calibrated quantization mutator couldn't be applied" << std::endl);
+        return;
+    }
+
+    // Insert a quantization or dequantization node between the nodes running in different data types
+    const size_t num_nodes = g.nodes().size();
+    for (NodeID nid = 0; nid < num_nodes; ++nid)
+    {
+        INode *node = g.node(nid);
+        if (node == nullptr || node->type() == NodeType::Const)
+        {
+            continue;
+        }
+
+        const bool is_quantized = quantized.count(nid) != 0;
+        for (size_t idx = 0; idx < node->num_outputs(); ++idx)
+        {
+            Tensor *tensor = node->output(idx);
+            if (tensor == nullptr)
+            {
+                continue;
+            }
+
+            // The range may depend on the producer bound to the tensor, so get it before disconnecting the consumers
+            TensorRange range(0.f, 0.f);
+            if (!is_quantized)
+            {
+                get_range(g, _calibrator, *tensor, range);
+            }
+
+            std::vector<NodeIdxPair> converted_consumers;
+            const std::set<EdgeID>   output_edges = node->output_edges();
+            for (const EdgeID &eid : output_edges)
+            {
+                const Edge *edge = g.edge(eid);
+                if (edge != nullptr && edge->producer_idx() == idx && edge->consumer() != nullptr &&
+                    (quantized.count(edge->consumer_id()) != 0) != is_quantized)
+                {
+                    converted_consumers.push_back({edge->consumer_id(), edge->consumer_idx()});
+                    g.remove_connection(eid);
+                }
+            }
+            if (converted_consumers.empty())
+            {
+                continue;
+            }
+
+            NodeID convert_id = EmptyNodeID;
+            if (is_quantized)
+            {
+                convert_id = g.add_node<DequantizationLayerNode>();
+            }
+            else
+            {
+                convert_id =
+                    g.add_node<QuantizationLayerNode>(asymmetric_quantization_info(range), DataType::QASYMM8_SIGNED);
+            }
+
+            INode *convert_node = g.node(convert_id);
+            convert_node->set_common_node_parameters(
+                NodeParams{node->name() + (is_quantized ? "_dequantize" : "_quantize"), node->requested_target()});
+            g.add_connection(nid, idx, convert_id, 0);
+            for (const NodeIdxPair &consumer : converted_consumers)
+            {
+                g.add_connection(convert_id, 0, consumer.node_id, consumer.index);
+            }
+
+            // Outputs are read in FP32
+            if (is_quantized && tensor->accessor() != nullptr)
+            {
+                convert_node->output(0)->set_accessor(tensor->extract_accessor());
+            }
+        }
+    }
+
+    // Quantize the tensors from the inputs to the outputs, as the quantization of some nodes depends on their inputs
+    for (const NodeID &nid : dfs(g))
+    {
+        INode *node = g.node(nid);
+        if (node == nullptr || quantized.count(nid) == 0)
+        {
+            continue;
+        }
+
+        // The output of an in-place node is quantized by the producer of its input
+        if (!is_in_place(*node))
+        {
+            for (size_t idx = 0; idx < node->num_outputs(); ++idx)
+            {
+                Tensor *output            = node->output(idx);
+                output->desc().quant_info = output_quantization_info(g, _calibrator, *node, *output);
+                output->desc().data_type  = DataType::QASYMM8_SIGNED;
+            }
+        }
+        quantize_constants(_calibrator, *node);
+        ++_num_quantized_nodes;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_INFO("Quantized " << _num_quantized_nodes << " nodes to QASYMM8_SIGNED, "
+                                            << g.nodes(NodeType::QuantizationLayer).size() << " quantization and "
+                                            << g.nodes(NodeType::DequantizationLayer).size()
+                                            << " dequantization nodes inserted" << std::endl);
+}
+} // namespace graph
+} // namespace arm_compute
@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/ElementwiseFusionMutator.h"
+
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "src/graph/mutators/MutatorUtils.h"
+#include "support/Cast.h"
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <set>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+using arm_compute::utils::cast::polymorphic_downcast;
+
+bool is_fusable_activation(const ActivationLayerInfo &act_info)
+{
+    // Activations implemented by the fused expression kernel
+    static const std::set<Activation> supported_activations = {
+        Activation::ABS,        Activation::BOUNDED_RELU, Activation::ELU,
+        Activation::GELU,       Activation::HARD_SWISH,   Activation::IDENTITY,
+        Activation::LEAKY_RELU, Activation::LINEAR,       Activation::LOGISTIC,
+        Activation::LU_BOUNDED_RELU, Activation::RELU,    Activation::SOFT_RELU,
+        Activation::SQRT,       Activation::SQUARE,       Activation::SWISH,
+        Activation::TANH};
+
+    return !act_info.enabled() || supported_activations.count(act_info.activation()) != 0;
+}
+
+bool is_fusable_node(const INode &node)
+{
+    if (node.assigned_target() != Target::NEON || node.num_outputs() != 1 || node.output(0) == nullptr)
+    {
+        return false;
+    }
+
+    // All the tensors of the node must be non-quantized float tensors of the same type
+    const DataType data_type = node.output(0)->desc().data_type;
+    if (data_type != DataType::F32 && data_type != DataType::F16)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        const Tensor *input = node.input(i);
+        if (input == nullptr || input->desc().data_type != data_type)
+        {
+            return false;
+        }
+    }
+
+    switch (node.type())
+    {
+        case NodeType::EltwiseLayer:
+            return is_fusable_activation(polymorphic_downcast<const EltwiseLayerNode *>(&node)->fused_activation());
+        case NodeType::UnaryEltwiseLayer:
+        {
+            const auto desc = polymorphic_downcast<const UnaryEltwiseLayerNode *>(&node)->eltwise_descriptor();
+            return desc.op == UnaryEltwiseOperation::Exp && is_fusable_activation(desc.fused_activation);
+        }
+        case NodeType::ActivationLayer:
+            return is_fusable_activation(polymorphic_downcast<const ActivationLayerNode *>(&node)->activation_info());
+        default:
+            return false;
+    }
+}
+
+// An edge is fused when its producer is only consumed through it and can be evaluated as part of the consumer
+bool is_fused_edge(const Edge *edge)
+{
+    if (edge == nullptr || edge->producer() == nullptr || edge->consumer() == nullptr || edge->tensor() == nullptr)
+    {
+        return false;
+    }
+
+    const INode *producer = edge->producer();
+    const INode *consumer = edge->consumer();
+    return is_fusable_node(*producer) && is_fusable_node(*consumer) && producer->output_edges().size() == 1 &&
+           edge->tensor()->accessor() == nullptr && producer->assigned_target() == consumer->assigned_target();
+}
+
+ElementwiseExpressionOp get_expression_op(EltwiseOperation op)
+{
+    switch (op)
+    {
+        case EltwiseOperation::Add:
+            return ElementwiseExpressionOp::ADD;
+        case EltwiseOperation::Sub:
+            return ElementwiseExpressionOp::SUB;
+        case EltwiseOperation::Mul:
+            return ElementwiseExpressionOp::MUL;
+        case EltwiseOperation::Max:
+            return ElementwiseExpressionOp::MAX;
+        case EltwiseOperation::Div:
+            return ElementwiseExpressionOp::DIV;
+        case EltwiseOperation::Min:
+            return ElementwiseExpressionOp::MIN;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported element-wise operation");
+    }
+}
+
+/** Tree of fused nodes rooted at the node producing the result */
+struct FusedTree
+{
+    std::vector<NodeIdxPair> inputs{}; /**< External producers, in input order */
+    std::vector<INode *>     nodes{};  /**< Fused nodes in evaluation order, the root last */
+};
+
+// Collect the external inputs and the nodes of the tree in post-order
+void collect_tree(INode *node, FusedTree &tree)
+{
+    for (size_t i = 0; i < node->num_inputs(); ++i)
+    {
+        const Edge *edge = node->input_edge(i);
+        if (is_fused_edge(edge))
+        {
+            collect_tree(edge->producer(), tree);
+        }
+        else
+        {
+            const NodeIdxPair input{edge->producer_id(), edge->producer_idx()};
+            const auto        it = std::find_if(tree.inputs.begin(), tree.inputs.end(), [&](const NodeIdxPair &p)
+                                                { return p.node_id == input.node_id && p.index == input.index; });
+            if (it == tree.inputs.end())
+            {
+                tree.inputs.push_back(input);
+            }
+        }
+    }
+    tree.nodes.push_back(node);
+}
+
+ElementwiseExpressionInfo::Value get_operand(const Edge                                               *edge,
+                                             const FusedTree                                          &tree,
+                                             const std::map<NodeID, ElementwiseExpressionInfo::Value> &values)
+{
+    if (is_fused_edge(edge))
+    {
+        return values.at(edge->producer_id());
+    }
+    const auto it = std::find_if(tree.inputs.begin(), tree.inputs.end(), [&](const NodeIdxPair &p)
+                                 { return p.node_id == edge->producer_id() && p.index == edge->producer_idx(); });
+    ARM_COMPUTE_ERROR_ON(it == tree.inputs.end());
+    return static_cast<ElementwiseExpressionInfo::Value>(std::distance(tree.inputs.begin(), it));
+}
+
+ElementwiseExpressionInfo build_expression(const FusedTree &tree)
+{
+    ElementwiseExpressionInfo                          info(static_cast<unsigned int>(tree.inputs.size()));
+    std::map<NodeID, ElementwiseExpressionInfo::Value> values;
+
+    for (INode *node : tree.nodes)
+    {
+        const auto          src = get_operand(node->input_edge(0), tree, values);
+        ActivationLayerInfo act_info{};
+
+        ElementwiseExpressionInfo::Value value = src;
+        switch (node->type())
+        {
+            case NodeType::EltwiseLayer:
+            {
+                const auto *eltwise_node = polymorphic_downcast<const EltwiseLayerNode *>(node);
+                value    = info.binary(get_expression_op(eltwise_node->eltwise_operation()), src,
+                                       get_operand(node->input_edge(1), tree, values));
+                act_info = eltwise_node->fused_activation();
+                break;
+            }
+            case NodeType::UnaryEltwiseLayer:
+            {
+                const auto *unary_node = polymorphic_downcast<const UnaryEltwiseLayerNode *>(node);
+                value                  = info.unary(ElementwiseExpressionOp::EXP, src);
+                act_info               = unary_node->eltwise_descriptor().fused_activation;
+                break;
+            }
+            case NodeType::ActivationLayer:
+                act_info = polymorphic_downcast<const ActivationLayerNode *>(node)->activation_info();
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Unsupported node type");
+        }
+        if (act_info.enabled() || node->type() == NodeType::ActivationLayer)
+        {
+            value = info.activation(value, act_info);
+        }
+        values[node->id()] = value;
+    }
+    return info;
+}
+
+void fuse_elementwise_tree(Graph &g, INode *root)
+{
+    FusedTree tree{};
+    collect_tree(root, tree);
+
+    const ElementwiseExpressionInfo info = build_expression(tree);
+    if (tree.inputs.size() > elementwise_expression_max_inputs ||
+        info.nodes().size() > elementwise_expression_max_nodes)
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Prevented fusion of element-wise nodes into node with ID : "
+                                      << root->id() << " as the expression is too large" << std::endl);
+        return;
+    }
+
+    const Target target   = root->assigned_target();
+    std::string  name     = tree.nodes.front()->name();
+    const NodeID fused_id = g.add_node<ElementwiseExpressionLayerNode>(info);
+    for (size_t i = 1; i < tree.nodes.size(); ++i)
+    {
+        name += "+" + tree.nodes[i]->name();
+    }
+
+    // Connect the external inputs to the fused node
+    for (size_t i = 0; i < tree.inputs.size(); ++i)
+    {
+        g.add_connection(tree.inputs[i].node_id, tree.inputs[i].index, fused_id, i);
+    }
+
+    INode *fused_node = g.node(fused_id);
+    fused_node->set_assigned_target(target);
+    fused_node->set_common_node_parameters(NodeParams{name, target});
+
+    // The fused kernel is not available on every architecture, so leave the nodes untouched if the backend cannot
+    // run the expression
+    configure_tensor(fused_node->output(0));
+    const Status status = backends::BackendRegistry::get().get_backend(target).validate_node(*fused_node);
+    if (!bool(status))
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Prevented fusion of element-wise nodes into node with ID : "
+                                      << root->id() << " as the backend does not support it : "
+                                      << status.error_description() << std::endl);
+        g.remove_node(fused_id);
+        return;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing " << tree.nodes.size() << " element-wise nodes into node with ID : "
+                                            << root->id() << std::endl);
+
+    // Remove the fused nodes, the root handing its consumers and accessor over to the fused node
+    std::vector<NodeID> ids;
+    for (INode *node : tree.nodes)
+    {
+        ids.push_back(node->id());
+    }
+    detail::transfer_driving_nodes_and_remove_old_node(g, fused_node, root, true);
+    ids.pop_back();
+    for (NodeID id : ids)
+    {
+        g.remove_node(id);
+    }
+}
+} // namespace
+
+const char *ElementwiseFusionMutator::name()
+{
+    return "ElementwiseFusionMutator";
+}
+
+IGraphMutator::MutationType ElementwiseFusionMutator::type() const
+{
+    return IGraphMutator::MutationType::Backend;
+}
+
+void ElementwiseFusionMutator::mutate(Graph &g)
+{
+    // Roots are fusable nodes with a fused input edge whose output is not fused into another node
+    std::vector<NodeID> roots;
+    for (const auto &node : g.nodes())
+    {
+        if (node == nullptr || !is_fusable_node(*node))
+        {
+            continue;
+        }
+
+        bool has_fused_input = false;
+        for (size_t i = 0; i < node->num_inputs(); ++i)
+        {
+            has_fused_input = has_fused_input || is_fused_edge(node->input_edge(i));
+        }
+        const bool has_fused_output =
+            node->output_edges().size() == 1 && is_fused_edge(g.edge(*node->output_edges().begin()));
+        if (has_fused_input && !has_fused_output)
+        {
+            roots.push_back(node->id());
+        }
+    }
+
+    // Trees are disjoint, so fusing one does not change the others
+    for (NodeID id : roots)
+    {
+        INode *root = g.node(id);
+        if (root != nullptr)
+        {
+            fuse_elementwise_tree(g, root);
+        }
+    }
+}
+} // namespace graph
+} // namespace arm_compute
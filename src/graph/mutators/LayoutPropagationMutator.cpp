@@ -0,0 +1,361 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/LayoutPropagationMutator.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/ITensorAccessor.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/ConstNode.h"
+#include "arm_compute/graph/nodes/PermuteLayerNode.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/graph/mutators/MutatorUtils.h"
+#include "support/Cast.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Accessor that loads a constant in its original shape and layout, and stores it permuted */
+class PermutingAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] accessor Accessor of the original constant
+     * @param[in] desc     Descriptor of the original constant
+     * @param[in] perm     Permutation from the original constant to the accessed tensor
+     */
+    PermutingAccessor(ITensorAccessorUPtr accessor, TensorDescriptor desc, PermutationVector perm)
+        : _accessor(std::move(accessor)), _desc(std::move(desc)), _perm(perm)
+    {
+    }
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        if (!_accessor->access_tensor_data())
+        {
+            return _accessor->access_tensor(tensor);
+        }
+
+        TensorInfo src_info(_desc.shape, 1, _desc.data_type, _desc.quant_info);
+        src_info.set_data_layout(_desc.layout);
+
+        arm_compute::Tensor src;
+        src.allocator()->init(src_info);
+        src.allocator()->allocate();
+        if (!_accessor->access_tensor(src))
+        {
+            return false;
+        }
+
+        const size_t element_size = src_info.element_size();
+
+        Window window;
+        window.use_tensor_dimensions(_desc.shape);
+        Iterator src_it(&src, window);
+        execute_window_loop(
+            window,
+            [&](const Coordinates &id)
+            {
+                Coordinates dst_id = id;
+                permute(dst_id, _perm);
+                std::memcpy(tensor.ptr_to_element(dst_id), src_it.ptr(), element_size);
+            },
+            src_it);
+
+        return true;
+    }
+
+    bool access_tensor_data() override
+    {
+        return _accessor->access_tensor_data();
+    }
+
+private:
+    ITensorAccessorUPtr _accessor;
+    TensorDescriptor    _desc;
+    PermutationVector   _perm;
+};
+
+bool is_layout_agnostic(const INode &node)
+{
+    switch (node.type())
+    {
+        case NodeType::ActivationLayer:
+        case NodeType::DequantizationLayer:
+        case NodeType::QuantizationLayer:
+        case NodeType::UnaryEltwiseLayer:
+            return node.num_inputs() == 1 && node.num_outputs() == 1;
+        default:
+            return false;
+    }
+}
+
+/** Permutation equivalent to applying @p first and then @p second */
+PermutationVector compose_permutations(const PermutationVector &first, const PermutationVector &second)
+{
+    const size_t      num_dims = std::max(first.num_dimensions(), second.num_dimensions());
+    PermutationVector result{};
+    for (size_t i = 0; i < num_dims; ++i)
+    {
+        result.set(i, i < first.num_dimensions() ? first[i] : static_cast<uint32_t>(i));
+    }
+    permute(result, second);
+    return result;
+}
+
+bool is_identity(const PermutationVector &perm)
+{
+    for (size_t i = 0; i < perm.num_dimensions(); ++i)
+    {
+        if (perm[i] != i)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Single consumer of the only output of a node, or nullptr if the output is shared or has an accessor */
+INode *get_single_consumer(Graph &g, INode &node)
+{
+    if (node.num_outputs() != 1 || node.output(0) == nullptr || node.output(0)->accessor() != nullptr ||
+        node.output_edges().size() != 1)
+    {
+        return nullptr;
+    }
+    const Edge *output_edge = g.edge(*node.output_edges().begin());
+    return output_edge != nullptr ? output_edge->consumer() : nullptr;
+}
+
+/** Fold a permutation of a constant into the constant
+ *
+ * @return The number of removed permutations
+ */
+unsigned int fold_constant_permute(Graph &g, PermuteLayerNode &permute_node)
+{
+    const Edge *input_edge    = permute_node.input_edge(0);
+    Tensor     *output_tensor = permute_node.output(0);
+    if (input_edge == nullptr || input_edge->producer() == nullptr || input_edge->tensor() == nullptr ||
+        input_edge->producer()->type() != NodeType::Const || input_edge->tensor()->bound_edges().size() != 1 ||
+        output_tensor == nullptr || output_tensor->accessor() != nullptr || permute_node.output_edges().empty())
+    {
+        return 0;
+    }
+
+    INode *const_node = input_edge->producer();
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Folding permute node with ID : " << permute_node.id()
+                                                                     << " into constant node with ID : "
+                                                                     << const_node->id() << std::endl);
+
+    const TensorDescriptor         const_desc    = input_edge->tensor()->desc();
+    const PermutationVector        perm          = permute_node.permutation_vector();
+    auto                           accessor      = input_edge->tensor()->extract_accessor();
+    const std::vector<NodeIdxPair> driving_nodes = get_driving_nodes(permute_node);
+
+    const NodeID folded_id   = g.add_node<ConstNode>(output_tensor->desc());
+    INode       *folded_node = g.node(folded_id);
+    folded_node->set_common_node_parameters(NodeParams{const_node->name(), const_node->requested_target()});
+    folded_node->set_assigned_target(const_node->assigned_target());
+
+    g.remove_node(permute_node.id());
+    g.remove_node(const_node->id());
+
+    for (const auto &driving_node : driving_nodes)
+    {
+        g.add_connection(folded_id, 0, driving_node.node_id, driving_node.index);
+    }
+
+    if (accessor != nullptr)
+    {
+        folded_node->output(0)->set_accessor(
+            std::make_unique<PermutingAccessor>(std::move(accessor), const_desc, perm));
+    }
+
+    return 1;
+}
+
+/** Remove a permutation followed by its inverse, possibly through layout-agnostic nodes, or merge two consecutive
+ * permutations
+ *
+ * @return The number of removed permutations
+ */
+unsigned int remove_redundant_permute(Graph &g, PermuteLayerNode &permute_node)
+{
+    const Edge *input_edge = permute_node.input_edge(0);
+    if (input_edge == nullptr || input_edge->producer() == nullptr || input_edge->tensor() == nullptr)
+    {
+        return 0;
+    }
+
+    // Walk through the layout-agnostic nodes following the permutation
+    std::vector<INode *> agnostic_nodes;
+    INode               *next_node = get_single_consumer(g, permute_node);
+    while (next_node != nullptr && is_layout_agnostic(*next_node))
+    {
+        agnostic_nodes.push_back(next_node);
+        next_node = get_single_consumer(g, *next_node);
+    }
+    if (next_node == nullptr || next_node->type() != NodeType::PermuteLayer || next_node->output(0) == nullptr)
+    {
+        return 0;
+    }
+
+    auto *inverse_node = arm_compute::utils::cast::polymorphic_downcast<PermuteLayerNode *>(next_node);
+
+    const TensorDescriptor &input_desc  = input_edge->tensor()->desc();
+    const TensorDescriptor &output_desc = inverse_node->output(0)->desc();
+    const NodeIdxPair       driver{input_edge->producer_id(), input_edge->producer_idx()};
+    const PermutationVector perm =
+        compose_permutations(permute_node.permutation_vector(), inverse_node->permutation_vector());
+
+    if (is_identity(perm) && input_desc.layout == output_desc.layout)
+    {
+        Tensor *driver_tensor = input_edge->tensor();
+        if (agnostic_nodes.empty() && inverse_node->output(0)->accessor() != nullptr &&
+            driver_tensor->accessor() != nullptr)
+        {
+            return 0;
+        }
+
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Removing inverse permute nodes with ID : "
+                                      << permute_node.id() << " and " << inverse_node->id() << std::endl);
+
+        if (agnostic_nodes.empty())
+        {
+            auto                           accessor      = inverse_node->output(0)->extract_accessor();
+            const std::vector<NodeIdxPair> driving_nodes = get_driving_nodes(*inverse_node);
+
+            g.remove_node(permute_node.id());
+            g.remove_node(inverse_node->id());
+
+            for (const auto &driving_node : driving_nodes)
+            {
+                g.add_connection(driver.node_id, driver.index, driving_node.node_id, driving_node.index);
+            }
+            if (accessor != nullptr)
+            {
+                driver_tensor->set_accessor(std::move(accessor));
+            }
+        }
+        else
+        {
+            // The layout-agnostic nodes now run on the tensor before the permutation
+            g.remove_node(permute_node.id());
+            g.add_connection(driver.node_id, driver.index, agnostic_nodes.front()->id(), 0);
+            for (size_t i = 1; i < agnostic_nodes.size(); ++i)
+            {
+                agnostic_nodes[i]->forward_descriptors();
+            }
+            detail::transfer_driving_nodes_and_remove_old_node(g, agnostic_nodes.back(), inverse_node, false);
+        }
+        return 2;
+    }
+
+    if (!agnostic_nodes.empty())
+    {
+        return 0;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Merging permute nodes with ID : " << permute_node.id() << " and "
+                                                                     << inverse_node->id() << std::endl);
+
+    const NodeID merged_id   = g.add_node<PermuteLayerNode>(perm, output_desc.layout);
+    INode       *merged_node = g.node(merged_id);
+    merged_node->set_common_node_parameters(
+        NodeParams{permute_node.name() + "+" + inverse_node->name(), inverse_node->requested_target()});
+    merged_node->set_assigned_target(inverse_node->assigned_target());
+
+    g.remove_node(permute_node.id());
+    g.add_connection(driver.node_id, driver.index, merged_id, 0);
+    detail::transfer_driving_nodes_and_remove_old_node(g, merged_node, inverse_node, false);
+
+    return 1;
+}
+} // namespace
+
+const char *LayoutPropagationMutator::name()
+{
+    return "LayoutPropagationMutator";
+}
+
+IGraphMutator::MutationType LayoutPropagationMutator::type() const
+{
+    return IGraphMutator::MutationType::IR;
+}
+
+unsigned int LayoutPropagationMutator::num_removed_permutes() const
+{
+    return _num_removed_permutes;
+}
+
+void LayoutPropagationMutator::mutate(Graph &g)
+{
+    _num_removed_permutes = 0;
+
+    // Every rewrite removes at least one permutation, so repeat until the graph no longer changes
+    bool is_changed = true;
+    while (is_changed)
+    {
+        is_changed = false;
+
+        // Copy the IDs as the tagged node list is updated when nodes are added or removed
+        const std::vector<NodeID> permute_ids = g.nodes(NodeType::PermuteLayer);
+        for (const NodeID &permute_id : permute_ids)
+        {
+            INode *node = g.node(permute_id);
+            if (node == nullptr)
+            {
+                continue;
+            }
+
+            auto        *permute_node = arm_compute::utils::cast::polymorphic_downcast<PermuteLayerNode *>(node);
+            unsigned int num_removed  = fold_constant_permute(g, *permute_node);
+            if (num_removed == 0)
+            {
+                num_removed = remove_redundant_permute(g, *permute_node);
+            }
+
+            _num_removed_permutes += num_removed;
+            is_changed = is_changed || (num_removed != 0);
+        }
+    }
+
+    if (_num_removed_permutes != 0)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Removed " << _num_removed_permutes << " permute nodes, "
+                                              << g.nodes(NodeType::PermuteLayer).size() << " left" << std::endl);
+    }
+}
+} // namespace graph
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,6 +36,18 @@ namespace graph
  * @param[in] padding_list List of padding pairs
  */
 bool is_padding_in_height_or_width(const DataLayout &layout, const PaddingList &padding_list);
+
+namespace detail
+{
+/** Connect the consumers of a node to the output of a new node, move its output accessor and remove it
+ *
+ * @param[in, out] g                 Graph to mutate
+ * @param[in]      new_node          Node replacing @p old_node
+ * @param[in]      old_node          Node to remove
+ * @param[in]      add_output_tensor True to configure the output tensor of @p new_node
+ */
+void transfer_driving_nodes_and_remove_old_node(Graph &g, INode *new_node, INode *old_node, bool add_output_tensor);
+} // namespace detail
 } // namespace graph
 } // namespace arm_compute
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,9 +28,12 @@
 #include "arm_compute/graph/GraphBuilder.h"
 #include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/nodes/FusedConvolutionBatchNormalizationNode.h"
+#include "arm_compute/graph/nodes/GlobalPoolingFullyConnectedLayerNode.h"
+#include "arm_compute/graph/nodes/InvertedResidualLayerNode.h"
 #include "arm_compute/graph/nodes/Nodes.h"
 #include "arm_compute/graph/Utils.h"
 
+#include "src/core/utils/ActivationUtils.h"
 #include "src/graph/mutators/MutatorUtils.h"
 #include "support/Cast.h"
 
@@ -316,6 +319,279 @@ void fuse_pad_with_convolution(Graph &g, const Edge *output_edge)
     }
 }
 
+/** Description of a single stage of an inverted residual block */
+struct InvertedResidualStage
+{
+    INode              *node{nullptr};       /**< Convolution node of the stage */
+    PadStrideInfo       conv_info{};         /**< Convolution padding and stride information */
+    ActivationLayerInfo act_info{};          /**< Activation fused to the stage */
+    float               epsilon{0.001f};     /**< Epsilon of the fused batch normalization, if any */
+    bool                is_depthwise{false}; /**< True if the stage is a depthwise convolution */
+};
+
+bool get_inverted_residual_stage(INode *node, InvertedResidualStage &stage)
+{
+    if (node == nullptr || node->output(0) == nullptr)
+    {
+        return false;
+    }
+
+    stage.node = node;
+    switch (node->type())
+    {
+        case NodeType::ConvolutionLayer:
+        {
+            auto *conv_node    = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(node);
+            stage.conv_info    = conv_node->convolution_info();
+            stage.act_info     = conv_node->fused_activation();
+            stage.is_depthwise = false;
+            return conv_node->num_groups() == 1;
+        }
+        case NodeType::FusedConvolutionBatchNormalizationLayer:
+        {
+            auto *conv_node =
+                arm_compute::utils::cast::polymorphic_downcast<FusedConvolutionBatchNormalizationNode *>(node);
+            stage.conv_info    = conv_node->convolution_info();
+            stage.act_info     = conv_node->fused_activation();
+            stage.epsilon      = conv_node->epsilon();
+            stage.is_depthwise = false;
+            return conv_node->num_groups() == 1;
+        }
+        case NodeType::DepthwiseConvolutionLayer:
+        {
+            auto *dwc_node     = arm_compute::utils::cast::polymorphic_downcast<DepthwiseConvolutionLayerNode *>(node);
+            stage.conv_info    = dwc_node->convolution_info();
+            stage.act_info     = dwc_node->fused_activation();
+            stage.is_depthwise = true;
+            return dwc_node->depth_multiplier() == 1;
+        }
+        case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
+        {
+            auto *dwc_node =
+                arm_compute::utils::cast::polymorphic_downcast<FusedDepthwiseConvolutionBatchNormalizationNode *>(node);
+            stage.conv_info    = dwc_node->convolution_info();
+            stage.act_info     = dwc_node->fused_activation();
+            stage.epsilon      = dwc_node->epsilon();
+            stage.is_depthwise = true;
+            return dwc_node->depth_multiplier() == 1;
+        }
+        default:
+            return false;
+    }
+}
+
+bool is_pointwise_stage(const InvertedResidualStage &stage)
+{
+    const Tensor *weights = stage.node->input(1);
+    if (stage.is_depthwise || weights == nullptr)
+    {
+        return false;
+    }
+
+    const TensorDescriptor &weights_desc = weights->desc();
+    return get_dimension_size(weights_desc, DataLayoutDimension::WIDTH) == 1 &&
+           get_dimension_size(weights_desc, DataLayoutDimension::HEIGHT) == 1 &&
+           stage.conv_info.stride() == std::make_pair(1U, 1U) && !stage.conv_info.has_padding();
+}
+
+void fuse_inverted_residual_block(Graph &g, const Edge *output_edge, unsigned int)
+{
+    ARM_COMPUTE_ERROR_ON(output_edge == nullptr);
+
+    // Match expansion -> depthwise -> projection chain
+    InvertedResidualStage expand{};
+    InvertedResidualStage depthwise{};
+    InvertedResidualStage project{};
+    if (!get_inverted_residual_stage(output_edge->producer(), expand) || !is_pointwise_stage(expand) ||
+        !get_inverted_residual_stage(output_edge->consumer(), depthwise) || !depthwise.is_depthwise ||
+        depthwise.node->output_edges().size() != 1)
+    {
+        return;
+    }
+
+    const Edge *dwc_output_edge = g.edge(*depthwise.node->output_edges().begin());
+    if (dwc_output_edge == nullptr || !get_inverted_residual_stage(dwc_output_edge->consumer(), project) ||
+        !is_pointwise_stage(project))
+    {
+        return;
+    }
+
+    // Only float NHWC blocks with clamp-style activations are supported by the fused kernel
+    const Edge *input_edge = expand.node->input_edge(0);
+    if (input_edge == nullptr || input_edge->tensor() == nullptr)
+    {
+        return;
+    }
+    const TensorDescriptor &input_desc = input_edge->tensor()->desc();
+    const Target            target     = expand.node->assigned_target();
+    if (input_desc.layout != DataLayout::NHWC ||
+        (input_desc.data_type != DataType::F32 && input_desc.data_type != DataType::F16) ||
+        depthwise.node->assigned_target() != target || project.node->assigned_target() != target ||
+        !activation_utils::is_relu_family(expand.act_info) || !activation_utils::is_relu_family(depthwise.act_info) ||
+        !activation_utils::is_relu_family(project.act_info))
+    {
+        return;
+    }
+
+    // Prevent fusion if an intermediate node has an output accessor
+    if (expand.node->output(0)->accessor() != nullptr || depthwise.node->output(0)->accessor() != nullptr)
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE(
+            "Prevented fusion of inverted residual block due to the presence of an output accessor\n");
+        return;
+    }
+
+    // Absorb the shortcut addition if it adds the block input to the projection output
+    INode *last_node = project.node;
+    bool   residual  = false;
+    if (project.node->output_edges().size() == 1 && project.node->output(0)->accessor() == nullptr)
+    {
+        const Edge *proj_output_edge = g.edge(*project.node->output_edges().begin());
+        INode      *consumer         = proj_output_edge != nullptr ? proj_output_edge->consumer() : nullptr;
+        if (consumer != nullptr && consumer->type() == NodeType::EltwiseLayer && consumer->output(0) != nullptr)
+        {
+            auto *eltwise_node = arm_compute::utils::cast::polymorphic_downcast<EltwiseLayerNode *>(consumer);
+            const size_t shortcut_idx = 1 - proj_output_edge->consumer_idx();
+            if (eltwise_node->eltwise_operation() == EltwiseOperation::Add &&
+                !eltwise_node->fused_activation().enabled() &&
+                eltwise_node->input_id(shortcut_idx) == input_edge->tensor_id() &&
+                eltwise_node->output(0)->desc().shape == input_desc.shape)
+            {
+                last_node = eltwise_node;
+                residual  = true;
+            }
+        }
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing inverted residual block with nodes with ID : "
+                                  << expand.node->id() << ", " << depthwise.node->id() << ", " << project.node->id()
+                                  << (residual ? " and shortcut addition" : "") << std::endl);
+
+    // Create the fused node
+    const InvertedResidualLayerInfo info(depthwise.conv_info, expand.act_info, depthwise.act_info, project.act_info,
+                                         residual);
+    const NodeID                    fused_id = g.add_node<InvertedResidualLayerNode>(
+        info, std::array<float, InvertedResidualLayerNode::num_stages>{
+                  {expand.epsilon, depthwise.epsilon, project.epsilon}});
+
+    // Add connections from the block input and the stage parameters to the fused node
+    g.add_connection(input_edge->producer_id(), input_edge->producer_idx(), fused_id, 0);
+
+    const std::array<const InvertedResidualStage *, InvertedResidualLayerNode::num_stages> stages = {
+        {&expand, &depthwise, &project}};
+    for (size_t s = 0; s < stages.size(); ++s)
+    {
+        // Stage parameters follow the input in the same order on plain and batch normalization fused nodes
+        const INode *stage_node = stages[s]->node;
+        for (size_t i = 1; i < stage_node->num_inputs(); ++i)
+        {
+            const Edge *edge = stage_node->input_edge(i);
+            if (edge != nullptr)
+            {
+                g.add_connection(edge->producer_id(), edge->producer_idx(), fused_id,
+                                 InvertedResidualLayerNode::input_idx(
+                                     static_cast<InvertedResidualLayerNode::Stage>(s),
+                                     static_cast<InvertedResidualLayerNode::StageInput>(i - 1)));
+            }
+        }
+    }
+
+    std::string name = expand.node->name() + "+" + depthwise.node->name() + "+" + project.node->name();
+    if (residual)
+    {
+        name += "+" + last_node->name();
+    }
+    const NodeID expand_id    = expand.node->id();
+    const NodeID depthwise_id = depthwise.node->id();
+    const NodeID project_id   = project.node->id();
+
+    auto fused_node = g.node(fused_id);
+    transfer_driving_nodes_and_remove_old_node(g, fused_node, last_node, true);
+
+    fused_node->set_assigned_target(target);
+    fused_node->set_common_node_parameters(NodeParams{name, target});
+
+    // Remove the remaining nodes of the block
+    if (residual)
+    {
+        g.remove_node(project_id);
+    }
+    g.remove_node(depthwise_id);
+    g.remove_node(expand_id);
+}
+
+void fuse_global_pooling_with_fully_connected(Graph &g, const Edge *output_edge)
+{
+    ARM_COMPUTE_ERROR_ON(output_edge == nullptr);
+
+    auto *pool_node = arm_compute::utils::cast::polymorphic_downcast<PoolingLayerNode *>(output_edge->producer());
+    auto *fc_node = arm_compute::utils::cast::polymorphic_downcast<FullyConnectedLayerNode *>(output_edge->consumer());
+    ARM_COMPUTE_ERROR_ON(pool_node->output(0) == nullptr || fc_node->output(0) == nullptr);
+
+    // The pooled tensor must feed the fully connected input, not its weights
+    const Edge *input_edge = pool_node->input_edge(0);
+    if (output_edge->consumer_idx() != 0 || input_edge == nullptr || input_edge->tensor() == nullptr)
+    {
+        return;
+    }
+
+    // Only float NHWC global average pooling is supported by the fused kernel
+    const TensorDescriptor &input_desc = input_edge->tensor()->desc();
+    const PoolingLayerInfo  pool_info  = pool_node->pooling_info();
+    const bool              is_global =
+        pool_info.is_global_pooling ||
+        (pool_info.pool_size.width == get_dimension_size(input_desc, DataLayoutDimension::WIDTH) &&
+         pool_info.pool_size.height == get_dimension_size(input_desc, DataLayoutDimension::HEIGHT) &&
+         !pool_info.pad_stride_info.has_padding());
+    const FullyConnectedLayerInfo fc_info = fc_node->info();
+    if (input_desc.layout != DataLayout::NHWC ||
+        (input_desc.data_type != DataType::F32 && input_desc.data_type != DataType::F16) ||
+        pool_info.pool_type != PoolingType::AVG || !is_global ||
+        fc_node->assigned_target() != pool_node->assigned_target() ||
+        !activation_utils::is_relu_family(fc_info.activation_info))
+    {
+        return;
+    }
+
+    // Prevent fusion if the pooled tensor has an output accessor
+    if (pool_node->output(0)->accessor() != nullptr)
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE(
+            "Prevented fusion of global pooling with fully connected due to the presence of an output accessor\n");
+        return;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing global pooling node with ID : " << pool_node->id()
+                                                                          << " with fully connected node with ID : "
+                                                                          << fc_node->id() << std::endl);
+
+    const Target       target      = pool_node->assigned_target();
+    const unsigned int num_outputs = fc_node->output(0)->desc().shape[0];
+    const NodeID       fused_id    = g.add_node<GlobalPoolingFullyConnectedLayerNode>(num_outputs, fc_info);
+
+    // Add connections from the pooling input and the fully connected parameters to the fused node
+    g.add_connection(input_edge->producer_id(), input_edge->producer_idx(), fused_id, 0);
+    for (size_t i = 1; i < fc_node->num_inputs(); ++i)
+    {
+        const Edge *edge = fc_node->input_edge(i);
+        if (edge != nullptr)
+        {
+            g.add_connection(edge->producer_id(), edge->producer_idx(), fused_id, i);
+        }
+    }
+
+    const std::string name    = pool_node->name() + "+" + fc_node->name();
+    const NodeID      pool_id = pool_node->id();
+
+    auto fused_node = g.node(fused_id);
+    transfer_driving_nodes_and_remove_old_node(g, fused_node, fc_node, true);
+
+    fused_node->set_assigned_target(target);
+    fused_node->set_common_node_parameters(NodeParams{name, target});
+
+    g.remove_node(pool_id);
+}
+
 template <typename N1, typename N2, typename F, typename... Args>
 void fuse_layer(Graph &g, std::function<bool(INode &)> const &prec, const F fuse_fcn, Args &&...optional_arguments)
 {
@@ -387,9 +663,10 @@ void NodeFusionMutator::mutate(Graph &g)
         Activation::SQUARE,     Activation::TANH};
 
     // Preconditions
-    auto empty_prec     = [](INode &) { return true; };
-    auto cl_target_prec = [](INode &n) { return n.assigned_target() == Target::CL; };
-    auto qs8_prec       = [&g](INode &n)
+    auto empty_prec       = [](INode &) { return true; };
+    auto cl_target_prec   = [](INode &n) { return n.assigned_target() == Target::CL; };
+    auto neon_target_prec = [](INode &n) { return n.assigned_target() == Target::NEON; };
+    auto qs8_prec         = [&g](INode &n)
     {
         ARM_COMPUTE_ERROR_ON(n.output(0) == nullptr);
 
@@ -423,6 +700,13 @@ void NodeFusionMutator::mutate(Graph &g)
         g, empty_prec, detail::fuse_convolution_with_batch_normalization);
     detail::fuse_layer<DepthwiseConvolutionLayerNode, BatchNormalizationLayerNode>(
         g, empty_prec, detail::fuse_depthwise_convolution_with_batch_normalization);
+    // Match inverted residual blocks last, once their stages carry fused batch normalizations and activations
+    detail::fuse_layer<ConvolutionLayerNode>(g, neon_target_prec, detail::fuse_inverted_residual_block);
+    detail::fuse_layer<FusedConvolutionBatchNormalizationNode>(g, neon_target_prec,
+                                                               detail::fuse_inverted_residual_block);
+    // Classifier heads are matched after the fully connected layer has absorbed its activation
+    detail::fuse_layer<PoolingLayerNode, FullyConnectedLayerNode>(g, neon_target_prec,
+                                                                  detail::fuse_global_pooling_with_fully_connected);
 }
 } // namespace graph
 } // namespace arm_compute
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/ReshapeAliasMutator.h"
+
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/FlattenLayerNode.h"
+#include "arm_compute/graph/nodes/ReshapeLayerNode.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "support/Cast.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+bool can_alias(Graph &g, INode &node)
+{
+    const Edge *input_edge    = node.input_edge(0);
+    Tensor     *input_tensor  = node.input(0);
+    Tensor     *output_tensor = node.output(0);
+    if (input_edge == nullptr || input_edge->producer() == nullptr || input_tensor == nullptr ||
+        output_tensor == nullptr || input_tensor->handle() == nullptr || output_tensor->handle() == nullptr)
+    {
+        return false;
+    }
+
+    // Constant tensors can be released once their consumers are prepared, and the outputs of split layers are
+    // replaced by sub-tensors after this pass
+    const NodeType producer_type = input_edge->producer()->type();
+    if (producer_type == NodeType::Const || producer_type == NodeType::SplitLayer)
+    {
+        return false;
+    }
+
+    // The reshape must be the only reader of its input, otherwise an in-place consumer of the output could overwrite
+    // data that is still needed
+    if (input_tensor->bound_edges().size() != 1)
+    {
+        return false;
+    }
+
+    // Concatenations replace the handles of their inputs with sub-tensors of their output, and split layers create
+    // sub-tensors of their input that must keep pointing to the handle they were created from
+    for (const EdgeID &eid : output_tensor->bound_edges())
+    {
+        const Edge *output_edge = g.edge(eid);
+        if (output_edge != nullptr && output_edge->consumer() != nullptr &&
+            (output_edge->consumer()->type() == NodeType::ConcatenateLayer ||
+             output_edge->consumer()->type() == NodeType::SplitLayer))
+        {
+            return false;
+        }
+    }
+
+    const ITensorInfo &input_info = *input_tensor->handle()->tensor().info();
+    return input_tensor->desc().target == output_tensor->desc().target &&
+           input_info.tensor_shape().total_size() == output_tensor->desc().shape.total_size() &&
+           is_contiguous(input_info);
+}
+} // namespace
+
+const char *ReshapeAliasMutator::name()
+{
+    return "ReshapeAliasMutator";
+}
+
+IGraphMutator::MutationType ReshapeAliasMutator::type() const
+{
+    return IGraphMutator::MutationType::Backend;
+}
+
+void ReshapeAliasMutator::mutate(Graph &g)
+{
+    // Early exit if no reshape operations exist in graph
+    if (g.nodes(NodeType::ReshapeLayer).empty() && g.nodes(NodeType::FlattenLayer).empty())
+    {
+        return;
+    }
+
+    // Perform topological sort
+    std::vector<NodeID> topological_sorted_node_ids = dfs(g);
+
+    // Should be in order of execution so that chains of reshapes alias the first input
+    for (auto &node_id : topological_sorted_node_ids)
+    {
+        INode *node = g.node(node_id);
+        if (node == nullptr ||
+            (node->type() != NodeType::ReshapeLayer && node->type() != NodeType::FlattenLayer) ||
+            !is_target_supported(node->assigned_target()) || !can_alias(g, *node))
+        {
+            continue;
+        }
+
+        Tensor *input_tensor  = node->input(0);
+        Tensor *output_tensor = node->output(0);
+
+        backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(output_tensor->desc().target);
+        std::unique_ptr<ITensorHandle> handle =
+            backend.create_tensor_alias(input_tensor->handle(), output_tensor->desc().shape);
+        if (handle == nullptr)
+        {
+            continue;
+        }
+
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Using a tensor alias for the node with ID : " << node->id() << " and name : "
+                                                                                      << node->name() << std::endl);
+        output_tensor->set_handle(std::move(handle));
+
+        if (node->type() == NodeType::ReshapeLayer)
+        {
+            arm_compute::utils::cast::polymorphic_downcast<ReshapeLayerNode *>(node)->set_enabled(false);
+        }
+        else
+        {
+            arm_compute::utils::cast::polymorphic_downcast<FlattenLayerNode *>(node)->set_enabled(false);
+        }
+    }
+}
+} // namespace graph
+} // namespace arm_compute
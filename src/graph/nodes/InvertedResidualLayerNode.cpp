@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/nodes/InvertedResidualLayerNode.h"
+
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INodeVisitor.h"
+#include "arm_compute/graph/Utils.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+InvertedResidualLayerNode::InvertedResidualLayerNode(InvertedResidualLayerInfo     info,
+                                                     std::array<float, num_stages> epsilons)
+    : _info(std::move(info)), _epsilons(epsilons)
+{
+    _input_edges.resize(1 + num_stages * num_stage_inputs, EmptyEdgeID);
+    _outputs.resize(1, NullTensorID);
+}
+
+InvertedResidualLayerInfo InvertedResidualLayerNode::info() const
+{
+    return _info;
+}
+
+float InvertedResidualLayerNode::epsilon(Stage stage) const
+{
+    return _epsilons[static_cast<size_t>(stage)];
+}
+
+size_t InvertedResidualLayerNode::input_idx(Stage stage, StageInput input)
+{
+    return 1 + static_cast<size_t>(stage) * num_stage_inputs + static_cast<size_t>(input);
+}
+
+TensorDescriptor InvertedResidualLayerNode::compute_output_descriptor(const TensorDescriptor &input_descriptor,
+                                                                      const TensorDescriptor &dw_weights_descriptor,
+                                                                      const TensorDescriptor &proj_weights_descriptor,
+                                                                      const PadStrideInfo    &info)
+{
+    unsigned int output_width  = 0;
+    unsigned int output_height = 0;
+
+    const unsigned int input_width     = get_dimension_size(input_descriptor, DataLayoutDimension::WIDTH);
+    const unsigned int input_height    = get_dimension_size(input_descriptor, DataLayoutDimension::HEIGHT);
+    const unsigned int kernel_width    = get_dimension_size(dw_weights_descriptor, DataLayoutDimension::WIDTH);
+    const unsigned int kernel_height   = get_dimension_size(dw_weights_descriptor, DataLayoutDimension::HEIGHT);
+    const unsigned int output_channels = get_dimension_size(proj_weights_descriptor, DataLayoutDimension::BATCHES);
+
+    std::tie(output_width, output_height) =
+        scaled_dimensions(input_width, input_height, kernel_width, kernel_height, info);
+
+    TensorDescriptor output_descriptor = input_descriptor;
+    output_descriptor.shape.set(get_dimension_idx(output_descriptor.layout, DataLayoutDimension::WIDTH), output_width);
+    output_descriptor.shape.set(get_dimension_idx(output_descriptor.layout, DataLayoutDimension::HEIGHT),
+                                output_height);
+    output_descriptor.shape.set(get_dimension_idx(output_descriptor.layout, DataLayoutDimension::CHANNEL),
+                                output_channels);
+
+    return output_descriptor;
+}
+
+bool InvertedResidualLayerNode::forward_descriptors()
+{
+    if ((input_id(0) != NullTensorID) && (input_id(input_idx(Stage::Depthwise, StageInput::Weights)) != NullTensorID) &&
+        (input_id(input_idx(Stage::Project, StageInput::Weights)) != NullTensorID) && (output_id(0) != NullTensorID))
+    {
+        Tensor *dst = output(0);
+        ARM_COMPUTE_ERROR_ON(dst == nullptr);
+        dst->desc() = configure_output(0);
+        return true;
+    }
+    return false;
+}
+
+TensorDescriptor InvertedResidualLayerNode::configure_output(size_t idx) const
+{
+    ARM_COMPUTE_UNUSED(idx);
+    const Tensor *src          = input(0);
+    const Tensor *dw_weights   = input(input_idx(Stage::Depthwise, StageInput::Weights));
+    const Tensor *proj_weights = input(input_idx(Stage::Project, StageInput::Weights));
+
+    ARM_COMPUTE_ERROR_ON(src == nullptr || dw_weights == nullptr || proj_weights == nullptr);
+
+    return compute_output_descriptor(src->desc(), dw_weights->desc(), proj_weights->desc(), _info.depthwise_info);
+}
+
+NodeType InvertedResidualLayerNode::type() const
+{
+    return InvertedResidualLayerNode::node_type;
+}
+
+void InvertedResidualLayerNode::accept(INodeVisitor &v)
+{
+    v.visit(*this);
+}
+} // namespace graph
+} // namespace arm_compute
@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/HugePageAllocator.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/runtime/IScheduler.h"
+#include "arm_compute/runtime/MemoryRegion.h"
+#include "arm_compute/runtime/Scheduler.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <vector>
+
+#if !defined(_WIN64) && !defined(BARE_METAL)
+#include <sys/mman.h>
+#include <unistd.h>
+#define ARM_COMPUTE_HUGE_PAGE_ALLOCATOR_CAN_MMAP
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif /* defined(__linux__) */
+#endif /* !defined(_WIN64) && !defined(BARE_METAL) */
+
+namespace arm_compute
+{
+namespace
+{
+/** Memory obtained from the system: [start, start + length) is released, ptr is the aligned address handed out */
+struct Mapping
+{
+    void  *ptr{nullptr};
+    void  *start{nullptr};
+    size_t length{0};
+};
+
+size_t system_page_size()
+{
+#if defined(ARM_COMPUTE_HUGE_PAGE_ALLOCATOR_CAN_MMAP)
+    const long page_size = sysconf(_SC_PAGESIZE);
+    return page_size > 0 ? static_cast<size_t>(page_size) : 4096;
+#else  /* defined(ARM_COMPUTE_HUGE_PAGE_ALLOCATOR_CAN_MMAP) */
+    return 4096;
+#endif /* defined(ARM_COMPUTE_HUGE_PAGE_ALLOCATOR_CAN_MMAP) */
+}
+
+uintptr_t round_up(uintptr_t value, size_t multiple)
+{
+    return DIV_CEIL(value, multiple) * multiple;
+}
+
+void bind_to_numa_node(void *ptr, size_t length, int node)
+{
+#if defined(ARM_COMPUTE_HUGE_PAGE_ALLOCATOR_CAN_MMAP) && defined(__linux__) && defined(SYS_mbind)
+    // Raw system call to avoid depending on libnuma
+    constexpr int mpol_bind = 2;
+    constexpr int bits      = sizeof(unsigned long) * 8;
+
+    std::vector<unsigned long> node_mask(node / bits + 1, 0UL);
+    node_mask[node / bits] |= 1UL << (node % bits);
+
+    // The binding is a hint: on failure the memory keeps the default policy
+    syscall(SYS_mbind, ptr, length, mpol_bind, node_mask.data(), node_mask.size() * bits + 1, 0);
+#else  /* defined(ARM_COMPUTE_HUGE_PAGE_ALLOCATOR_CAN_MMAP) && defined(__linux__) && defined(SYS_mbind) */
+    ARM_COMPUTE_UNUSED(ptr, length, node);
+#endif /* defined(ARM_COMPUTE_HUGE_PAGE_ALLOCATOR_CAN_MMAP) && defined(__linux__) && defined(SYS_mbind) */
+}
+
+void first_touch(void *ptr, size_t size, IScheduler *scheduler)
+{
+    IScheduler        &sched       = scheduler != nullptr ? *scheduler : Scheduler::get();
+    const size_t       page_size   = system_page_size();
+    const size_t       num_pages   = DIV_CEIL(size, page_size);
+    const unsigned int num_threads = std::max(1U, sched.num_threads());
+    const size_t       chunk       = DIV_CEIL(num_pages, num_threads);
+
+    // Every worker faults in a contiguous range of pages, so that they are local to the thread using them
+    std::vector<IScheduler::Workload> workloads;
+    for (size_t first = 0; first < num_pages; first += chunk)
+    {
+        const size_t last = std::min(first + chunk, num_pages);
+        workloads.emplace_back(
+            [=](const ThreadInfo &)
+            {
+                volatile uint8_t *mem = static_cast<uint8_t *>(ptr);
+                for (size_t page = first; page < last; ++page)
+                {
+                    mem[page * page_size] = 0;
+                }
+            });
+    }
+    sched.run_tagged_workloads(workloads, "HugePageAllocator/first_touch");
+}
+
+Mapping map_memory(size_t size, size_t alignment, const HugePageAllocatorInfo &info)
+{
+    Mapping mapping;
+
+#if defined(ARM_COMPUTE_HUGE_PAGE_ALLOCATOR_CAN_MMAP)
+    const size_t page_size    = system_page_size();
+    const bool   use_huge     = info.huge_pages != HugePagePolicy::NONE && size >= info.huge_page_size;
+    const int    prot         = PROT_READ | PROT_WRITE;
+    const int    flags        = MAP_PRIVATE | MAP_ANONYMOUS;
+    bool         is_hugetlbfs = false;
+
+#if defined(MAP_HUGETLB)
+    if (use_huge && info.huge_pages == HugePagePolicy::EXPLICIT)
+    {
+        const size_t length = round_up(size, info.huge_page_size);
+        void        *ptr    = mmap(nullptr, length, prot, flags | MAP_HUGETLB, -1, 0);
+        if (ptr != MAP_FAILED)
+        {
+            if (alignment == 0 || reinterpret_cast<uintptr_t>(ptr) % alignment == 0)
+            {
+                mapping      = Mapping{ptr, ptr, length};
+                is_hugetlbfs = true;
+            }
+            else
+            {
+                munmap(ptr, length);
+            }
+        }
+        // Otherwise no huge page is reserved: fall back to transparent huge pages
+    }
+#endif /* defined(MAP_HUGETLB) */
+
+    if (!is_hugetlbfs)
+    {
+        // Over-reserve to align the base address, then return the unused head and tail to the system
+        const size_t base_alignment = std::max({page_size, alignment, use_huge ? info.huge_page_size : size_t(0)});
+        if (size > std::numeric_limits<size_t>::max() - page_size - base_alignment)
+        {
+            throw std::bad_alloc();
+        }
+        const size_t reserved = round_up(size, page_size) + base_alignment;
+
+        // Fail like operator new, also in release builds
+        void *base = mmap(nullptr, reserved, prot, flags, -1, 0);
+        if (base == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+
+        const uintptr_t base_addr = reinterpret_cast<uintptr_t>(base);
+        const uintptr_t aligned   = round_up(base_addr, base_alignment);
+        const uintptr_t start     = aligned - (aligned - base_addr) % page_size;
+        const uintptr_t end       = round_up(aligned + size, page_size);
+
+        if (start > base_addr)
+        {
+            munmap(base, start - base_addr);
+        }
+        if (base_addr + reserved > end)
+        {
+            munmap(reinterpret_cast<void *>(end), base_addr + reserved - end);
+        }
+
+        mapping = Mapping{reinterpret_cast<void *>(aligned), reinterpret_cast<void *>(start), end - start};
+
+#if defined(MADV_HUGEPAGE)
+        if (use_huge)
+        {
+            madvise(mapping.start, mapping.length, MADV_HUGEPAGE);
+        }
+#endif /* defined(MADV_HUGEPAGE) */
+    }
+
+    if (info.numa_node >= 0)
+    {
+        bind_to_numa_node(mapping.start, mapping.length, info.numa_node);
+    }
+#else  /* defined(ARM_COMPUTE_HUGE_PAGE_ALLOCATOR_CAN_MMAP) */
+    // No virtual memory control: plain aligned allocation, still without zero-initialization
+    if (size > std::numeric_limits<size_t>::max() - alignment)
+    {
+        throw std::bad_alloc();
+    }
+    uint8_t *base  = new uint8_t[size + alignment];
+    void    *ptr   = base;
+    size_t   space = size + alignment;
+    if (alignment != 0)
+    {
+        std::align(alignment, size, ptr, space);
+    }
+    mapping = Mapping{ptr, base, size + alignment};
+#endif /* defined(ARM_COMPUTE_HUGE_PAGE_ALLOCATOR_CAN_MMAP) */
+
+    if (info.first_touch)
+    {
+        first_touch(mapping.ptr, size, info.scheduler);
+    }
+
+    return mapping;
+}
+
+void unmap_memory(void *start, size_t length)
+{
+#if defined(ARM_COMPUTE_HUGE_PAGE_ALLOCATOR_CAN_MMAP)
+    munmap(start, length);
+#else  /* defined(ARM_COMPUTE_HUGE_PAGE_ALLOCATOR_CAN_MMAP) */
+    ARM_COMPUTE_UNUSED(length);
+    delete[] static_cast<uint8_t *>(start);
+#endif /* defined(ARM_COMPUTE_HUGE_PAGE_ALLOCATOR_CAN_MMAP) */
+}
+
+/** Memory region owning a mapping created by @ref HugePageAllocator */
+class MappedMemoryRegion final : public IMemoryRegion
+{
+public:
+    MappedMemoryRegion(size_t size, const Mapping &mapping) : IMemoryRegion(size), _mapping(mapping)
+    {
+    }
+    ~MappedMemoryRegion()
+    {
+        if (_mapping.start != nullptr)
+        {
+            unmap_memory(_mapping.start, _mapping.length);
+        }
+    }
+    MappedMemoryRegion(const MappedMemoryRegion &)            = delete;
+    MappedMemoryRegion &operator=(const MappedMemoryRegion &) = delete;
+
+    // Inherited methods overridden :
+    void *buffer() override
+    {
+        return _mapping.ptr;
+    }
+    const void *buffer() const override
+    {
+        return _mapping.ptr;
+    }
+    std::unique_ptr<IMemoryRegion> extract_subregion(size_t offset, size_t size) override
+    {
+        if (_mapping.ptr != nullptr && (offset < _size) && (_size - offset >= size))
+        {
+            return std::make_unique<MemoryRegion>(static_cast<uint8_t *>(_mapping.ptr) + offset, size);
+        }
+        return nullptr;
+    }
+
+private:
+    Mapping _mapping;
+};
+} // namespace
+
+HugePageAllocator::HugePageAllocator(const HugePageAllocatorInfo &info) : _info(info), _allocations(), _mtx()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_info.huge_page_size == 0, "Huge page size must not be zero");
+}
+
+HugePageAllocator::~HugePageAllocator()
+{
+    for (auto &allocation : _allocations)
+    {
+        unmap_memory(allocation.second.first, allocation.second.second);
+    }
+}
+
+const HugePageAllocatorInfo &HugePageAllocator::info() const
+{
+    return _info;
+}
+
+void *HugePageAllocator::allocate(size_t size, size_t alignment)
+{
+    if (size == 0)
+    {
+        return nullptr;
+    }
+
+    const Mapping mapping = map_memory(size, alignment, _info);
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    _allocations.emplace(mapping.ptr, std::make_pair(mapping.start, mapping.length));
+    return mapping.ptr;
+}
+
+void HugePageAllocator::free(void *ptr)
+{
+    std::unique_lock<std::mutex> lock(_mtx);
+
+    const auto it = _allocations.find(ptr);
+    if (it != _allocations.end())
+    {
+        const auto allocation = it->second;
+        _allocations.erase(it);
+        lock.unlock();
+
+        unmap_memory(allocation.first, allocation.second);
+    }
+}
+
+std::unique_ptr<IMemoryRegion> HugePageAllocator::make_region(size_t size, size_t alignment)
+{
+    if (size == 0)
+    {
+        return std::make_unique<MemoryRegion>(nullptr, 0);
+    }
+    return std::make_unique<MappedMemoryRegion>(size, map_memory(size, alignment, _info));
+}
+} // namespace arm_compute
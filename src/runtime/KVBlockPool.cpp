@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/KVBlockPool.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+KVBlockPool::KVBlockPool() : _info(), _keys(), _values(), _free_blocks(), _sequences(), _next_seq(0), _mtx()
+{
+}
+
+KVBlockPool::~KVBlockPool() = default;
+
+void KVBlockPool::init(const KVBlockPoolInfo &info)
+{
+    ARM_COMPUTE_ERROR_THROW_ON(KVBlockPool::validate(info));
+
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    _info = info;
+    _sequences.clear();
+
+    // Blocks are handed out from the back, lowest indices first
+    _free_blocks.resize(info.num_blocks);
+    for (size_t i = 0; i < info.num_blocks; ++i)
+    {
+        _free_blocks[i] = static_cast<int32_t>(info.num_blocks - 1 - i);
+    }
+
+    const TensorInfo storage_info(TensorShape(info.head_dim, info.block_size, info.num_heads, info.num_blocks), 1,
+                                  info.data_type);
+    _keys.allocator()->init(storage_info);
+    _values.allocator()->init(storage_info);
+}
+
+Status KVBlockPool::validate(const KVBlockPoolInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON(info.head_dim == 0 || info.block_size == 0 || info.num_heads == 0 ||
+                                info.num_blocks == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.data_type != DataType::F16 && info.data_type != DataType::F32,
+                                    "Unsupported KV block pool data type");
+    return Status{};
+}
+
+const KVBlockPoolInfo &KVBlockPool::info() const
+{
+    return _info;
+}
+
+void KVBlockPool::allocate()
+{
+    _keys.allocator()->allocate();
+    _values.allocator()->allocate();
+}
+
+ITensor *KVBlockPool::keys()
+{
+    return &_keys;
+}
+
+ITensor *KVBlockPool::values()
+{
+    return &_values;
+}
+
+int KVBlockPool::add_sequence()
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    const int                                   seq = _next_seq++;
+    _sequences.emplace(seq, Sequence());
+    return seq;
+}
+
+void KVBlockPool::remove_sequence(int seq)
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    auto it = _sequences.find(seq);
+    if (it == _sequences.end())
+    {
+        ARM_COMPUTE_ERROR("Unknown sequence");
+    }
+
+    // Most recently used blocks are handed out first
+    _free_blocks.insert(_free_blocks.end(), it->second.blocks.rbegin(), it->second.blocks.rend());
+    _sequences.erase(it);
+}
+
+bool KVBlockPool::append(int seq, size_t num_tokens, int32_t *slots)
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    auto it = _sequences.find(seq);
+    if (it == _sequences.end())
+    {
+        ARM_COMPUTE_ERROR("Unknown sequence");
+    }
+    Sequence &sequence = it->second;
+
+    const size_t new_length = sequence.length + num_tokens;
+    const size_t num_blocks = (new_length + _info.block_size - 1) / _info.block_size;
+    if (num_blocks > sequence.blocks.size() + _free_blocks.size())
+    {
+        return false;
+    }
+
+    while (sequence.blocks.size() < num_blocks)
+    {
+        sequence.blocks.push_back(_free_blocks.back());
+        _free_blocks.pop_back();
+    }
+
+    if (slots != nullptr)
+    {
+        for (size_t i = 0; i < num_tokens; ++i)
+        {
+            const size_t pos = sequence.length + i;
+            slots[i]         = sequence.blocks[pos / _info.block_size] * static_cast<int32_t>(_info.block_size) +
+                       static_cast<int32_t>(pos % _info.block_size);
+        }
+    }
+    sequence.length = new_length;
+    return true;
+}
+
+size_t KVBlockPool::length(int seq) const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    auto it = _sequences.find(seq);
+    if (it == _sequences.end())
+    {
+        ARM_COMPUTE_ERROR("Unknown sequence");
+    }
+    return it->second.length;
+}
+
+std::vector<int32_t> KVBlockPool::block_table(int seq) const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    auto it = _sequences.find(seq);
+    if (it == _sequences.end())
+    {
+        ARM_COMPUTE_ERROR("Unknown sequence");
+    }
+    return it->second.blocks;
+}
+
+size_t KVBlockPool::num_free_blocks() const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    return _free_blocks.size();
+}
+
+void KVBlockPool::fill_block_tables(const std::vector<int> &seqs, ITensor *block_tables, ITensor *seq_lens) const
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(block_tables, seq_lens);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(block_tables, 1, DataType::S32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(seq_lens, 1, DataType::S32);
+    ARM_COMPUTE_ERROR_ON(block_tables->info()->dimension(1) < seqs.size());
+    ARM_COMPUTE_ERROR_ON(seq_lens->info()->dimension(0) < seqs.size());
+
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    const size_t max_blocks = block_tables->info()->dimension(0);
+    for (size_t b = 0; b < seqs.size(); ++b)
+    {
+        auto it = _sequences.find(seqs[b]);
+        if (it == _sequences.end())
+        {
+            ARM_COMPUTE_ERROR("Unknown sequence");
+        }
+        if (it->second.blocks.size() > max_blocks)
+        {
+            ARM_COMPUTE_ERROR("Block table too small for the sequence");
+        }
+
+        auto *table = reinterpret_cast<int32_t *>(block_tables->ptr_to_element(Coordinates(0, b)));
+        std::fill_n(table, max_blocks, 0);
+        std::copy(it->second.blocks.begin(), it->second.blocks.end(), table);
+
+        *reinterpret_cast<int32_t *>(seq_lens->ptr_to_element(Coordinates(b))) =
+            static_cast<int32_t>(it->second.length);
+    }
+}
+} // namespace arm_compute
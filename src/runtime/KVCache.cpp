@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/KVCache.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+namespace arm_compute
+{
+KVCache::KVCache() : _info(), _storage(), _views(), _length(0)
+{
+}
+
+KVCache::~KVCache() = default;
+
+void KVCache::init(const KVCacheInfo &info)
+{
+    ARM_COMPUTE_ERROR_THROW_ON(KVCache::validate(info));
+
+    _info   = info;
+    _length = 0;
+    _views.clear();
+
+    const TensorShape      shape(info.head_dim, info.capacity, info.num_heads, info.batches);
+    const QuantizationInfo qinfo =
+        info.data_type == DataType::QSYMM8_PER_CHANNEL ? QuantizationInfo(info.head_scales) : QuantizationInfo();
+    _storage.allocator()->init(TensorInfo(shape, 1, info.data_type, qinfo));
+}
+
+Status KVCache::validate(const KVCacheInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON(info.head_dim == 0 || info.capacity == 0 || info.num_heads == 0 || info.batches == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.data_type != DataType::F16 && info.data_type != DataType::F32 &&
+                                        info.data_type != DataType::QSYMM8_PER_CHANNEL,
+                                    "Unsupported KV cache data type");
+    if (info.data_type == DataType::QSYMM8_PER_CHANNEL)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.head_scales.size() != info.num_heads,
+                                        "A quantized KV cache needs one scale per head");
+        for (float scale : info.head_scales)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(!(scale > 0.f), "Head scales must be positive");
+        }
+    }
+    return Status{};
+}
+
+const KVCacheInfo &KVCache::info() const
+{
+    return _info;
+}
+
+TensorAllocator *KVCache::allocator()
+{
+    return _storage.allocator();
+}
+
+ITensor *KVCache::tensor()
+{
+    return &_storage;
+}
+
+size_t KVCache::length() const
+{
+    return _length;
+}
+
+size_t KVCache::capacity() const
+{
+    return _info.capacity;
+}
+
+void KVCache::set_length(size_t length)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(length > _info.capacity, "KV cache length exceeds its capacity");
+    _length = length;
+}
+
+void KVCache::reset()
+{
+    _length = 0;
+}
+
+ITensor *KVCache::view(size_t length)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(length == 0 || length > _info.capacity, "Invalid KV cache view length");
+
+    auto it = _views.find(length);
+    if (it == _views.end())
+    {
+        const TensorShape shape(_info.head_dim, length, _info.num_heads, _info.batches);
+        it = _views.emplace(length, std::make_unique<SubTensor>(&_storage, shape, Coordinates())).first;
+    }
+    return it->second.get();
+}
+
+ITensor *KVCache::view()
+{
+    return view(_length);
+}
+
+QuantizationInfo KVCache::head_quantization_info(size_t head) const
+{
+    ARM_COMPUTE_ERROR_ON(head >= _info.num_heads);
+    if (_info.data_type != DataType::QSYMM8_PER_CHANNEL)
+    {
+        return QuantizationInfo();
+    }
+    return QuantizationInfo(_info.head_scales[head]);
+}
+} // namespace arm_compute
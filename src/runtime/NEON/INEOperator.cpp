@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited.
+ * Copyright (c) 2020-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -50,6 +50,7 @@ void INEOperator::run(ITensorPack &tensors)
 
 void INEOperator::run(ITensorPack &tensors, const Window &window)
 {
+    SchedulerScope scope(_ctx);
     NEScheduler::get().schedule_op(_kernel.get(), Window::DimY, window, tensors);
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,9 +25,9 @@
 
 #include "arm_compute/core/Window.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Scheduler.h"
 
 #include "src/core/NEON/INEKernel.h"
-#include "src/runtime/Utils.h"
 
 namespace arm_compute
 {
@@ -39,6 +39,7 @@ INESimpleFunctionNoBorder::INESimpleFunctionNoBorder(IRuntimeContext *ctx) : _ke
 
 void INESimpleFunctionNoBorder::run()
 {
-    utils::schedule_kernel_on_ctx(_ctx, _kernel.get(), Window::DimY);
+    SchedulerScope scope(_ctx);
+    NEScheduler::get().schedule(_kernel.get(), Window::DimY);
 }
 } // namespace arm_compute
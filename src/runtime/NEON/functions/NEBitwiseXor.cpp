@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,10 @@
 
 using namespace arm_compute;
 
+NEBitwiseXor::NEBitwiseXor(IRuntimeContext *ctx) : INESimpleFunctionNoBorder(ctx)
+{
+}
+
 void NEBitwiseXor::configure(const ITensor *input1, const ITensor *input2, ITensor *output)
 {
     ARM_COMPUTE_LOG_PARAMS(input1, input2, output);
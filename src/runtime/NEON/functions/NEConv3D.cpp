@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2024 Arm Limited.
+ * Copyright (c) 2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,22 +26,54 @@
 #include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/Tensor.h"
 
 #include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/operators/CpuDirectConv3d.h"
+#include "src/cpu/operators/CpuGemmDirectConv3d.h"
 
 namespace arm_compute
 {
 using namespace arm_compute::experimental;
 
+namespace
+{
+/** Whether the indirect GEMM is expected to be faster than the direct kernel
+ *
+ * Every entry of the indirection table points to IFM input values that are multiplied by OFM weights, so the table
+ * and the reshaped weights only pay off once a kernel point carries enough work. Below that the direct kernel wins.
+ */
+bool use_gemm_conv3d(const ITensorInfo *input,
+                     const ITensorInfo *weights,
+                     const ITensorInfo *biases,
+                     const ITensorInfo *output,
+                     const Conv3dInfo  &conv_info)
+{
+    constexpr size_t min_macs_per_kernel_point = 32;
+
+    const size_t ifm = input->dimension(0);
+    const size_t ofm = weights->dimension(0);
+    return ifm * ofm >= min_macs_per_kernel_point &&
+           bool(cpu::CpuGemmDirectConv3d::validate(input, weights, biases, output, conv_info));
+}
+} // namespace
+
 struct NEConv3D::Impl
 {
+    const ITensor                     *weights{nullptr};
     std::unique_ptr<cpu::ICpuOperator> op{nullptr};
     ITensorPack                        run_pack{};
+    ITensorPack                        prep_pack{};
+    WorkspaceData<Tensor>              workspace{};
+    MemoryGroup                        memory_group{};
+    bool                               is_prepared{false};
+    experimental::MemoryRequirements   aux_mem_req{};
 };
 
-NEConv3D::NEConv3D() : _impl(std::make_unique<Impl>())
+NEConv3D::NEConv3D(std::shared_ptr<IMemoryManager> memory_manager) : _impl(std::make_unique<Impl>())
 {
+    _impl->memory_group = MemoryGroup(std::move(memory_manager));
 }
 
 NEConv3D::~NEConv3D() = default;
@@ -55,15 +87,28 @@ void NEConv3D::configure(
         input->info(), weights->info(), ((biases != nullptr) ? biases->info() : nullptr), output->info(), conv_info));
     ARM_COMPUTE_LOG_PARAMS(input, weights, biases, output, conv_info);
 
-    auto f = std::make_unique<cpu::CpuDirectConv3d>();
-    f->configure(input->info(), weights->info(), ((biases != nullptr) ? biases->info() : nullptr), output->info(),
-                 conv_info);
-    _impl->op = std::move(f);
+    _impl->weights     = weights;
+    _impl->is_prepared = false;
 
-    if (_impl->op != nullptr)
+    const ITensorInfo *biases_info = (biases != nullptr) ? biases->info() : nullptr;
+    if (use_gemm_conv3d(input->info(), weights->info(), biases_info, output->info(), conv_info))
+    {
+        auto f = std::make_unique<cpu::CpuGemmDirectConv3d>();
+        f->configure(input->info(), weights->info(), biases_info, output->info(), conv_info);
+        _impl->op = std::move(f);
+    }
+    else
     {
-        _impl->run_pack = {{ACL_SRC_0, input}, {ACL_SRC_1, weights}, {ACL_SRC_2, biases}, {ACL_DST, output}};
+        auto f = std::make_unique<cpu::CpuDirectConv3d>();
+        f->configure(input->info(), weights->info(), biases_info, output->info(), conv_info);
+        _impl->op = std::move(f);
     }
+
+    _impl->aux_mem_req = _impl->op->workspace();
+    _impl->run_pack    = {{ACL_SRC_0, input}, {ACL_SRC_1, weights}, {ACL_SRC_2, biases}, {ACL_DST, output}};
+    _impl->prep_pack   = {{ACL_SRC_1, weights}, {ACL_SRC_2, biases}};
+    _impl->workspace   = manage_workspace<Tensor>(_impl->aux_mem_req, _impl->memory_group, _impl->run_pack,
+                                                  _impl->prep_pack, /* allocate_now */ false);
 }
 
 Status NEConv3D::validate(const ITensorInfo *input,
@@ -73,6 +118,7 @@ Status NEConv3D::validate(const ITensorInfo *input,
                           const Conv3dInfo  &conv_info)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, weights, biases, output);
+    // The direct convolution supports every configuration the indirect GEMM does
     ARM_COMPUTE_RETURN_ON_ERROR(cpu::CpuDirectConv3d::validate(input, weights, biases, output, conv_info));
 
     return Status{};
@@ -80,9 +126,31 @@ Status NEConv3D::validate(const ITensorInfo *input,
 
 void NEConv3D::run()
 {
-    if (_impl->op != nullptr)
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    _impl->op->run(_impl->run_pack);
+}
+
+void NEConv3D::prepare()
+{
+    if (!_impl->is_prepared)
     {
-        _impl->op->run(_impl->run_pack);
+        allocate_tensors(_impl->aux_mem_req, _impl->workspace);
+        _impl->op->prepare(_impl->prep_pack);
+
+        auto has_reshape =
+            std::find_if(_impl->aux_mem_req.begin(), _impl->aux_mem_req.end(),
+                         [](const MemoryInfo &m) -> bool { return m.lifetime == MemoryLifetime::Persistent; });
+
+        if (has_reshape != std::end(_impl->aux_mem_req))
+        {
+            _impl->weights->mark_as_unused();
+        }
+
+        // Release temporary tensors that are only used in prepare stage
+        release_temporaries<Tensor>(_impl->aux_mem_req, _impl->workspace);
+        _impl->is_prepared = true;
     }
 }
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@
 
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Utils.h"
+#include "arm_compute/core/utils/math/Math.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
@@ -73,21 +74,188 @@ compute_upsample_info(const PadStrideInfo &info, uint32_t deconv_pad_x, uint32_t
                                         deconv_pad_bottom, DimensionRoundingType::FLOOR),
                           negative_padding);
 }
+
+/** Phase decomposition of a strided deconvolution along one spatial axis
+ *
+ * An output whose uncropped coordinate is q * stride + p only receives the taps p, p + stride, ... of the kernel, so
+ * all the outputs of phase p are a stride 1 convolution of the original input with these taps. In the flipped weights
+ * they start at (kernel - 1 - p) % stride. Every phase computes the same range of q, so that the phases can be
+ * interleaved and then cropped to the output.
+ */
+struct PhaseAxis
+{
+    unsigned int              phase_size{0};  /**< Number of outputs of every phase */
+    unsigned int              pad_after{0};   /**< Convolution padding after the input, common to all the phases */
+    unsigned int              crop_before{0}; /**< Interleaved outputs before the first output */
+    unsigned int              crop_after{0};  /**< Interleaved outputs after the last output */
+    std::vector<unsigned int> kernel_size{};  /**< Number of taps of every phase */
+    std::vector<unsigned int> first_tap{};    /**< Index of the first tap of every phase in the flipped weights */
+    std::vector<unsigned int> pad_before{};   /**< Convolution padding before the input of every phase */
+};
+
+bool compute_phase_axis(int input_size, int kernel_size, int stride, int pad, int output_size, PhaseAxis &axis)
+{
+    // Phases without taps would only hold the bias
+    if (kernel_size < stride)
+    {
+        return false;
+    }
+
+    const int first_q = pad / stride;
+    const int last_q  = DIV_CEIL(pad + output_size, stride);
+    if (last_q < input_size)
+    {
+        return false;
+    }
+
+    axis              = PhaseAxis{};
+    axis.phase_size   = last_q - first_q;
+    axis.pad_after    = last_q - input_size;
+    axis.crop_before  = pad - first_q * stride;
+    axis.crop_after   = last_q * stride - pad - output_size;
+    for (int p = 0; p < stride; ++p)
+    {
+        const int taps = DIV_CEIL(kernel_size - p, stride);
+        if (taps - 1 < first_q)
+        {
+            return false;
+        }
+        axis.kernel_size.push_back(taps);
+        axis.first_tap.push_back((kernel_size - 1 - p) % stride);
+        axis.pad_before.push_back(taps - 1 - first_q);
+    }
+    return true;
+}
+
+TensorShape compute_phase_shape(const TensorShape &shape,
+                                DataLayout         data_layout,
+                                unsigned int       width,
+                                unsigned int       height,
+                                unsigned int       batch_multiplier)
+{
+    const unsigned int width_idx   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const unsigned int height_idx  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const unsigned int batches_idx = get_data_layout_dimension_index(data_layout, DataLayoutDimension::BATCHES);
+
+    TensorShape phase_shape{shape};
+    phase_shape.set(width_idx, width);
+    phase_shape.set(height_idx, height);
+    phase_shape.set(batches_idx, shape[batches_idx] * batch_multiplier);
+    return phase_shape;
+}
+
+void compute_phase_slice(const TensorShape &weights_shape,
+                         DataLayout         data_layout,
+                         unsigned int       first_tap_x,
+                         unsigned int       first_tap_y,
+                         unsigned int       stride_x,
+                         unsigned int       stride_y,
+                         Coordinates       &starts,
+                         Coordinates       &ends,
+                         BiStrides         &strides)
+{
+    const unsigned int width_idx  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const unsigned int height_idx = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+
+    for (unsigned int d = 0; d < weights_shape.num_dimensions(); ++d)
+    {
+        starts.set(d, 0);
+        ends.set(d, weights_shape[d]);
+        strides.set(d, 1);
+    }
+    starts.set(width_idx, first_tap_x);
+    starts.set(height_idx, first_tap_y);
+    strides.set(width_idx, stride_x);
+    strides.set(height_idx, stride_y);
+}
+
+Status validate_phase_decomposition(const ITensorInfo   *input,
+                                    const ITensorInfo   *weights,
+                                    const ITensorInfo   *bias,
+                                    const ITensorInfo   *output,
+                                    const PadStrideInfo &info,
+                                    bool                 enable_fast_math,
+                                    const WeightsInfo   &weights_info,
+                                    PhaseAxis           &phase_x,
+                                    PhaseAxis           &phase_y)
+{
+    const DataLayout   data_layout = input->data_layout();
+    const unsigned int width_idx   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const unsigned int height_idx  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const unsigned int stride_x    = info.stride().first;
+    const unsigned int stride_y    = info.stride().second;
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(stride_x == 1 && stride_y == 1, "Unit strides do not need a phase decomposition");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights_info.weight_format() != WeightFormat::UNSPECIFIED,
+                                    "Fixed format weights can not be split in phases");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!compute_phase_axis(input->dimension(width_idx), weights->dimension(width_idx),
+                                                        stride_x, info.pad_left(), output->dimension(width_idx),
+                                                        phase_x),
+                                    "Kernel width and padding not supported by the phase decomposition");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!compute_phase_axis(input->dimension(height_idx), weights->dimension(height_idx),
+                                                        stride_y, info.pad_top(), output->dimension(height_idx),
+                                                        phase_y),
+                                    "Kernel height and padding not supported by the phase decomposition");
+
+    const TensorInfo phase_output_info(output->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(
+        compute_phase_shape(output->tensor_shape(), data_layout, phase_x.phase_size, phase_y.phase_size, 1)));
+    for (unsigned int py = 0; py < stride_y; ++py)
+    {
+        for (unsigned int px = 0; px < stride_x; ++px)
+        {
+            TensorShape phase_weights_shape{weights->tensor_shape()};
+            phase_weights_shape.set(width_idx, phase_x.kernel_size[px]);
+            phase_weights_shape.set(height_idx, phase_y.kernel_size[py]);
+            const TensorInfo phase_weights_info(
+                weights->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(phase_weights_shape));
+
+            Coordinates starts{};
+            Coordinates ends{};
+            BiStrides   strides{};
+            compute_phase_slice(weights->tensor_shape(), data_layout, phase_x.first_tap[px], phase_y.first_tap[py],
+                                stride_x, stride_y, starts, ends, strides);
+            ARM_COMPUTE_RETURN_ON_ERROR(NEStridedSlice::validate(weights, &phase_weights_info, starts, ends, strides));
+
+            const PadStrideInfo conv_info(1, 1, phase_x.pad_before[px], phase_x.pad_after, phase_y.pad_before[py],
+                                          phase_y.pad_after, DimensionRoundingType::FLOOR);
+            ARM_COMPUTE_RETURN_ON_ERROR(NEConvolutionLayer::validate(input, &phase_weights_info, bias,
+                                                                     &phase_output_info, conv_info, weights_info,
+                                                                     Size2D(1U, 1U), ActivationLayerInfo(),
+                                                                     enable_fast_math));
+        }
+    }
+
+    const TensorInfo phases_info(output->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(
+        compute_phase_shape(output->tensor_shape(), data_layout, phase_x.phase_size, phase_y.phase_size,
+                            stride_x * stride_y)));
+    const CropInfo   crop_info(phase_x.crop_before, phase_x.crop_after, phase_y.crop_before, phase_y.crop_after);
+    ARM_COMPUTE_RETURN_ON_ERROR(NEBatchToSpaceLayer::validate(&phases_info, stride_x, stride_y, output, crop_info));
+
+    return Status{};
+}
 } // namespace
 
 NEDeconvolutionLayer::NEDeconvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager) // NOLINT
-    : _memory_group(memory_manager),
+    : _memory_manager(memory_manager),
+      _memory_group(memory_manager),
       _conv_f(memory_manager),
       _upsample_f(),
       _flip_weights(),
+      _phase_weights_f(),
+      _phase_conv_f(),
+      _interleave_f(),
       _scaled_output(),
       _weights_flipped(),
       _flip_axis(),
+      _phase_weights(),
+      _phase_outputs(),
+      _phases(),
       _original_weights(nullptr),
       _input(nullptr),
       _info(),
       _is_prepared(false),
-      _do_upsampling(true)
+      _do_upsampling(true),
+      _do_phase_decomposition(false)
 {
 }
 
@@ -144,9 +312,17 @@ Status NEDeconvolutionLayer::validate(const ITensorInfo   *input,
         }
     }
 
+    // These checks must cover everything the convolution of the generic path checks on the output, as the phase
+    // decomposition below only validates views of the output
     if (output->tensor_shape().total_size() > 0)
     {
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, output);
+        if (is_data_type_quantized_asymmetric(output->data_type()))
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(output->quantization_info().uniform().scale <= 0.f,
+                                            "Output's quantization scale is invalid.");
+        }
 
         const TensorShape output_shape = compute_deconvolution_output_shape(out_dims, *input, *weights);
 
@@ -156,12 +332,33 @@ Status NEDeconvolutionLayer::validate(const ITensorInfo   *input,
                                         "Output's height is invalid.");
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(output->dimension(Window::DimZ) != output_shape.z(),
                                         "Output's depth is invalid.");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(output->tensor_shape().total_size_upper(3) !=
+                                            output_shape.total_size_upper(3),
+                                        "Output's batches are invalid.");
     }
 
     uint32_t       deconv_pad_x   = 0;
     uint32_t       deconv_pad_y   = 0;
     const uint32_t stride_x       = info.stride().first;
     const uint32_t stride_y       = info.stride().second;
+
+    // Strided deconvolutions that can be split in phases do not need the upsampled tensor
+    if (stride_x != 1 || stride_y != 1)
+    {
+        auto output_info = output->clone();
+        auto_init_if_empty(*output_info, compute_deconvolution_output_shape(out_dims, *input, *weights), 1,
+                           input->data_type(), input->quantization_info());
+        output_info->set_data_layout(input->data_layout());
+
+        PhaseAxis phase_x;
+        PhaseAxis phase_y;
+        if (bool(validate_phase_decomposition(input, weights, bias, output_info.get(), info, enable_fast_math,
+                                              weights_info, phase_x, phase_y)))
+        {
+            return Status{};
+        }
+    }
+
     const auto     deconv_padding = compute_deconvolution_padding(*input, *weights, static_cast<int32_t>(stride_x),
                                                                   static_cast<int32_t>(stride_y), out_dims);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(deconv_padding.first < 0 || deconv_padding.second < 0,
@@ -257,9 +454,17 @@ void NEDeconvolutionLayer::configure(ITensor             *input,
     bool          negative_padding;
     std::tie(upsample_info, negative_padding) = compute_upsample_info(info, deconv_pad_x, deconv_pad_y);
 
-    ARM_COMPUTE_ERROR_ON(negative_padding);
-    // Do not perform upsampling when the operation uses unit stride in all dimensions
-    _do_upsampling = stride_x != 1 || stride_y != 1;
+    // Do not perform upsampling when the operation uses unit stride in all dimensions, nor when the strided
+    // deconvolution can be computed as stride x stride convolutions of the original input
+    PhaseAxis phase_x;
+    PhaseAxis phase_y;
+    _do_phase_decomposition = (stride_x != 1 || stride_y != 1) &&
+                              bool(validate_phase_decomposition(input->info(), weights->info(),
+                                                                (bias == nullptr) ? nullptr : bias->info(),
+                                                                output->info(), info, enable_fast_math, weights_info,
+                                                                phase_x, phase_y));
+    _do_upsampling          = !_do_phase_decomposition && (stride_x != 1 || stride_y != 1);
+    ARM_COMPUTE_ERROR_ON(_do_upsampling && negative_padding);
 
     // Setup flip axis data
     _flip_axis.allocator()->allocate();
@@ -268,7 +473,71 @@ void NEDeconvolutionLayer::configure(ITensor             *input,
     axis_data[1]   = static_cast<uint32_t>(height_idx);
 
     // Setup convolution and upsampling, if needed
-    if (_do_upsampling)
+    if (_do_phase_decomposition)
+    {
+        const unsigned int num_phases = stride_x * stride_y;
+
+        // The phases are stacked along the batches, as expected by the batch to space interleaving
+        _memory_group.manage(&_phases);
+        _phases.allocator()->init(output->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(
+            compute_phase_shape(output->info()->tensor_shape(), data_layout, phase_x.phase_size, phase_y.phase_size,
+                                num_phases)));
+
+        const TensorShape  phase_output_shape = compute_phase_shape(output->info()->tensor_shape(), data_layout,
+                                                                    phase_x.phase_size, phase_y.phase_size, 1);
+        const unsigned int batch_idx = get_data_layout_dimension_index(data_layout, DataLayoutDimension::BATCHES);
+
+        _phase_weights_f.clear();
+        _phase_conv_f.clear();
+        _phase_weights.clear();
+        _phase_outputs.clear();
+        for (unsigned int py = 0; py < stride_y; ++py)
+        {
+            for (unsigned int px = 0; px < stride_x; ++px)
+            {
+                TensorShape phase_weights_shape{_weights_flipped.info()->tensor_shape()};
+                phase_weights_shape.set(width_idx, phase_x.kernel_size[px]);
+                phase_weights_shape.set(height_idx, phase_y.kernel_size[py]);
+
+                auto phase_weights = std::make_unique<Tensor>();
+                phase_weights->allocator()->init(
+                    _weights_flipped.info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(
+                        phase_weights_shape));
+
+                Coordinates starts{};
+                Coordinates ends{};
+                BiStrides   strides{};
+                compute_phase_slice(_weights_flipped.info()->tensor_shape(), data_layout, phase_x.first_tap[px],
+                                    phase_y.first_tap[py], stride_x, stride_y, starts, ends, strides);
+                auto slice_f = std::make_unique<NEStridedSlice>();
+                slice_f->configure(&_weights_flipped, phase_weights.get(), starts, ends, strides);
+
+                // Phase outputs are views on the stacked phases, so they follow any padding added to them
+                Coordinates phase_coords{};
+                phase_coords.set(batch_idx, static_cast<int>(_phase_outputs.size() * phase_output_shape[batch_idx]));
+                auto phase_output = std::make_unique<SubTensor>(&_phases, phase_output_shape, phase_coords);
+
+                const PadStrideInfo conv_info(1, 1, phase_x.pad_before[px], phase_x.pad_after, phase_y.pad_before[py],
+                                              phase_y.pad_after, DimensionRoundingType::FLOOR);
+                auto conv_f = std::make_unique<NEConvolutionLayer>(_memory_manager);
+                conv_f->configure(input, phase_weights.get(), bias, phase_output.get(), conv_info, weights_info,
+                                  Size2D(1U, 1U), ActivationLayerInfo(), enable_fast_math);
+
+                _phase_weights_f.emplace_back(std::move(slice_f));
+                _phase_conv_f.emplace_back(std::move(conv_f));
+                _phase_weights.emplace_back(std::move(phase_weights));
+                _phase_outputs.emplace_back(std::move(phase_output));
+            }
+        }
+
+        _interleave_f = std::make_unique<NEBatchToSpaceLayer>();
+        _interleave_f->configure(&_phases, stride_x, stride_y, output,
+                                 CropInfo(phase_x.crop_before, phase_x.crop_after, phase_y.crop_before,
+                                          phase_y.crop_after));
+
+        _phases.allocator()->allocate();
+    }
+    else if (_do_upsampling)
     {
         _memory_group.manage(&_scaled_output);
 
@@ -301,6 +570,16 @@ void NEDeconvolutionLayer::run()
 
     MemoryGroupResourceScope scope_mg(_memory_group);
 
+    if (_do_phase_decomposition)
+    {
+        for (auto &conv_f : _phase_conv_f)
+        {
+            conv_f->run();
+        }
+        _interleave_f->run();
+        return;
+    }
+
     if (_do_upsampling)
     {
         _upsample_f.run();
@@ -320,7 +599,25 @@ void NEDeconvolutionLayer::prepare()
         _original_weights->mark_as_unused();
 
         // Prepare convolution
-        _conv_f.prepare();
+        if (_do_phase_decomposition)
+        {
+            // Extract the weights of every phase and let the convolutions reshape them
+            for (size_t i = 0; i < _phase_conv_f.size(); ++i)
+            {
+                _phase_weights[i]->allocator()->allocate();
+                _phase_weights_f[i]->run();
+                _phase_conv_f[i]->prepare();
+                if (!_phase_weights[i]->is_used())
+                {
+                    _phase_weights[i]->allocator()->free();
+                }
+            }
+            _weights_flipped.allocator()->free();
+        }
+        else
+        {
+            _conv_f.prepare();
+        }
 
         _is_prepared = true;
     }
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEEmbeddingBag.h"
+
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/operators/CpuEmbeddingBag.h"
+
+namespace arm_compute
+{
+struct NEEmbeddingBag::Impl
+{
+    std::unique_ptr<cpu::CpuEmbeddingBag> op{nullptr};
+    experimental::MemoryRequirements      aux_mem_req{};
+    WorkspaceData<Tensor>                 workspace_tensors{};
+    ITensorPack                           run_pack{};
+    MemoryGroup                           memory_group{};
+};
+
+NEEmbeddingBag::NEEmbeddingBag(std::shared_ptr<IMemoryManager> memory_manager) : _impl(std::make_unique<Impl>())
+{
+    _impl->memory_group = MemoryGroup(std::move(memory_manager));
+}
+
+NEEmbeddingBag::~NEEmbeddingBag() = default;
+
+void NEEmbeddingBag::configure(const ITensor          *table,
+                               const ITensor          *row_params,
+                               const ITensor          *indices,
+                               const ITensor          *offsets,
+                               ITensor                *dst,
+                               const EmbeddingBagInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(table, indices, dst);
+    ARM_COMPUTE_LOG_PARAMS(table, row_params, indices, offsets, dst, info);
+
+    _impl->op = std::make_unique<cpu::CpuEmbeddingBag>();
+    _impl->op->configure(table->info(), row_params != nullptr ? row_params->info() : nullptr, indices->info(),
+                         offsets != nullptr ? offsets->info() : nullptr, dst->info(), info);
+
+    _impl->run_pack = {{TensorType::ACL_SRC_0, table},
+                       {TensorType::ACL_SRC_1, row_params},
+                       {TensorType::ACL_SRC_2, indices},
+                       {TensorType::ACL_SRC_3, offsets},
+                       {TensorType::ACL_DST, dst}};
+
+    _impl->aux_mem_req       = _impl->op->workspace();
+    _impl->workspace_tensors = manage_workspace<Tensor>(_impl->aux_mem_req, _impl->memory_group, _impl->run_pack);
+}
+
+Status NEEmbeddingBag::validate(const ITensorInfo      *table,
+                                const ITensorInfo      *row_params,
+                                const ITensorInfo      *indices,
+                                const ITensorInfo      *offsets,
+                                const ITensorInfo      *dst,
+                                const EmbeddingBagInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(table, indices, dst);
+    return cpu::CpuEmbeddingBag::validate(table, row_params, indices, offsets, dst, info);
+}
+
+void NEEmbeddingBag::run()
+{
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    _impl->op->run(_impl->run_pack);
+}
+} // namespace arm_compute
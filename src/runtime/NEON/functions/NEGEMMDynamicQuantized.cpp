@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEGEMMDynamicQuantized.h"
+
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/operators/CpuGemmDynamicQuantized.h"
+
+namespace arm_compute
+{
+struct NEGEMMDynamicQuantized::Impl
+{
+    std::unique_ptr<cpu::CpuGemmDynamicQuantized> op{nullptr};
+    experimental::MemoryRequirements              aux_mem_req{};
+    WorkspaceData<Tensor>                         workspace_tensors{};
+    ITensorPack                                   run_pack{};
+    ITensorPack                                   prep_pack{};
+    MemoryGroup                                   memory_group{};
+    bool                                          is_prepared{false};
+};
+
+NEGEMMDynamicQuantized::NEGEMMDynamicQuantized(std::shared_ptr<IMemoryManager> memory_manager)
+    : _impl(std::make_unique<Impl>())
+{
+    _impl->memory_group = MemoryGroup(std::move(memory_manager));
+}
+
+NEGEMMDynamicQuantized::~NEGEMMDynamicQuantized() = default;
+
+void NEGEMMDynamicQuantized::configure(const ITensor             *a,
+                                       const ITensor             *weights,
+                                       const ITensor             *bias,
+                                       ITensor                   *dst,
+                                       const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, weights, dst);
+    ARM_COMPUTE_LOG_PARAMS(a, weights, bias, dst, act_info);
+
+    _impl->op = std::make_unique<cpu::CpuGemmDynamicQuantized>();
+    _impl->op->configure(a->info(), weights->info(), bias != nullptr ? bias->info() : nullptr, dst->info(), act_info);
+
+    _impl->run_pack  = {{TensorType::ACL_SRC_0, a},
+                        {TensorType::ACL_SRC_1, weights},
+                        {TensorType::ACL_SRC_2, bias},
+                        {TensorType::ACL_DST, dst}};
+    _impl->prep_pack = {{TensorType::ACL_SRC_1, weights}};
+
+    _impl->aux_mem_req       = _impl->op->workspace();
+    _impl->workspace_tensors = manage_workspace<Tensor>(_impl->aux_mem_req, _impl->memory_group, _impl->run_pack,
+                                                        _impl->prep_pack, /* allocate_now */ false);
+    _impl->is_prepared       = false;
+}
+
+Status NEGEMMDynamicQuantized::validate(const ITensorInfo         *a,
+                                        const ITensorInfo         *weights,
+                                        const ITensorInfo         *bias,
+                                        const ITensorInfo         *dst,
+                                        const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(a, weights, dst);
+    return cpu::CpuGemmDynamicQuantized::validate(a, weights, bias, dst, act_info);
+}
+
+void NEGEMMDynamicQuantized::run()
+{
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    _impl->op->run(_impl->run_pack);
+}
+
+void NEGEMMDynamicQuantized::prepare()
+{
+    if (!_impl->is_prepared)
+    {
+        allocate_tensors(_impl->aux_mem_req, _impl->workspace_tensors);
+        _impl->op->prepare(_impl->prep_pack);
+
+        // Release temporary tensors that are only used in prepare stage
+        release_temporaries<Tensor>(_impl->aux_mem_req, _impl->workspace_tensors);
+        _impl->is_prepared = true;
+    }
+}
+} // namespace arm_compute
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEInvertedResidualLayer.h"
+
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/operators/CpuInvertedResidual.h"
+
+namespace arm_compute
+{
+struct NEInvertedResidualLayer::Impl
+{
+    std::unique_ptr<cpu::CpuInvertedResidual> op{nullptr};
+    experimental::MemoryRequirements          aux_mem_req{};
+    WorkspaceData<Tensor>                     workspace_tensors{};
+    ITensorPack                               run_pack{};
+    ITensorPack                               prep_pack{};
+    MemoryGroup                               memory_group{};
+    bool                                      is_prepared{false};
+};
+
+NEInvertedResidualLayer::NEInvertedResidualLayer(std::shared_ptr<IMemoryManager> memory_manager)
+    : _impl(std::make_unique<Impl>())
+{
+    _impl->memory_group = MemoryGroup(std::move(memory_manager));
+}
+
+NEInvertedResidualLayer::~NEInvertedResidualLayer() = default;
+
+void NEInvertedResidualLayer::configure(const ITensor                   *input,
+                                        const ITensor                   *expand_weights,
+                                        const ITensor                   *expand_bias,
+                                        const ITensor                   *dw_weights,
+                                        const ITensor                   *dw_bias,
+                                        const ITensor                   *proj_weights,
+                                        const ITensor                   *proj_bias,
+                                        ITensor                         *output,
+                                        const InvertedResidualLayerInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, expand_weights, dw_weights, proj_weights, output);
+    ARM_COMPUTE_LOG_PARAMS(input, expand_weights, expand_bias, dw_weights, dw_bias, proj_weights, proj_bias, output);
+
+    _impl->op = std::make_unique<cpu::CpuInvertedResidual>();
+    _impl->op->configure(input->info(), expand_weights->info(),
+                         expand_bias != nullptr ? expand_bias->info() : nullptr, dw_weights->info(),
+                         dw_bias != nullptr ? dw_bias->info() : nullptr, proj_weights->info(),
+                         proj_bias != nullptr ? proj_bias->info() : nullptr, output->info(), info);
+
+    _impl->run_pack  = {{TensorType::ACL_SRC_0, input},      {TensorType::ACL_SRC_1, expand_weights},
+                        {TensorType::ACL_SRC_2, expand_bias}, {TensorType::ACL_SRC_3, dw_weights},
+                        {TensorType::ACL_SRC_4, dw_bias},     {TensorType::ACL_SRC_5, proj_weights},
+                        {TensorType::ACL_SRC_6, proj_bias},   {TensorType::ACL_DST, output}};
+    _impl->prep_pack = {{TensorType::ACL_SRC_1, expand_weights}, {TensorType::ACL_SRC_2, expand_bias},
+                        {TensorType::ACL_SRC_3, dw_weights},     {TensorType::ACL_SRC_4, dw_bias},
+                        {TensorType::ACL_SRC_5, proj_weights},   {TensorType::ACL_SRC_6, proj_bias}};
+
+    _impl->aux_mem_req       = _impl->op->workspace();
+    _impl->workspace_tensors = manage_workspace<Tensor>(_impl->aux_mem_req, _impl->memory_group, _impl->run_pack,
+                                                        _impl->prep_pack, /* allocate_now */ false);
+    _impl->is_prepared       = false;
+}
+
+Status NEInvertedResidualLayer::validate(const ITensorInfo               *input,
+                                         const ITensorInfo               *expand_weights,
+                                         const ITensorInfo               *expand_bias,
+                                         const ITensorInfo               *dw_weights,
+                                         const ITensorInfo               *dw_bias,
+                                         const ITensorInfo               *proj_weights,
+                                         const ITensorInfo               *proj_bias,
+                                         const ITensorInfo               *output,
+                                         const InvertedResidualLayerInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, expand_weights, dw_weights, proj_weights, output);
+    return cpu::CpuInvertedResidual::validate(input, expand_weights, expand_bias, dw_weights, dw_bias, proj_weights,
+                                              proj_bias, output, info);
+}
+
+void NEInvertedResidualLayer::run()
+{
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    _impl->op->run(_impl->run_pack);
+}
+
+void NEInvertedResidualLayer::prepare()
+{
+    if (!_impl->is_prepared)
+    {
+        allocate_tensors(_impl->aux_mem_req, _impl->workspace_tensors);
+        _impl->op->prepare(_impl->prep_pack);
+
+        // Release temporary tensors that are only used in prepare stage
+        release_temporaries<Tensor>(_impl->aux_mem_req, _impl->workspace_tensors);
+        _impl->is_prepared = true;
+    }
+}
+} // namespace arm_compute
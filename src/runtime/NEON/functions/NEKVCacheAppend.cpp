@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEKVCacheAppend.h"
+
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/KVCache.h"
+#include "arm_compute/runtime/SubTensor.h"
+
+#include "src/common/utils/Log.h"
+#include "src/cpu/operators/CpuKVCacheAppend.h"
+
+namespace arm_compute
+{
+struct NEKVCacheAppend::Impl
+{
+    const ITensor                          *src{nullptr};
+    KVCache                                *cache{nullptr};
+    std::unique_ptr<cpu::CpuKVCacheAppend> op{nullptr};
+};
+
+NEKVCacheAppend::NEKVCacheAppend() : _impl(std::make_unique<Impl>())
+{
+}
+
+NEKVCacheAppend::~NEKVCacheAppend() = default;
+
+void NEKVCacheAppend::configure(const ITensor *src, KVCache *cache)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, cache);
+    ARM_COMPUTE_LOG_PARAMS(src, cache->tensor());
+
+    _impl->src   = src;
+    _impl->cache = cache;
+    _impl->op    = std::make_unique<cpu::CpuKVCacheAppend>();
+    _impl->op->configure(src->info(), cache->tensor()->info());
+}
+
+Status NEKVCacheAppend::validate(const ITensorInfo *src, const ITensorInfo *cache)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(src, cache);
+    return cpu::CpuKVCacheAppend::validate(src, cache);
+}
+
+void NEKVCacheAppend::run()
+{
+    const size_t length     = _impl->cache->length();
+    const size_t num_tokens = _impl->src->info()->dimension(1);
+    if (length + num_tokens > _impl->cache->capacity())
+    {
+        ARM_COMPUTE_ERROR("KV cache capacity exceeded");
+    }
+
+    // Write the new positions in place, right after the valid part of the cache
+    SubTensor   dst(_impl->cache->tensor(), _impl->src->info()->tensor_shape(), Coordinates(0, length));
+    ITensorPack pack = {{TensorType::ACL_SRC, _impl->src}, {TensorType::ACL_DST, &dst}};
+    _impl->op->run(pack);
+
+    _impl->cache->set_length(length + num_tokens);
+}
+} // namespace arm_compute
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEPagedAttention.h"
+
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/operators/CpuPagedAttention.h"
+
+namespace arm_compute
+{
+struct NEPagedAttention::Impl
+{
+    std::unique_ptr<cpu::CpuPagedAttention> op{nullptr};
+    experimental::MemoryRequirements        aux_mem_req{};
+    WorkspaceData<Tensor>                   workspace_tensors{};
+    ITensorPack                             run_pack{};
+    MemoryGroup                             memory_group{};
+};
+
+NEPagedAttention::NEPagedAttention(std::shared_ptr<IMemoryManager> memory_manager) : _impl(std::make_unique<Impl>())
+{
+    _impl->memory_group = MemoryGroup(std::move(memory_manager));
+}
+
+NEPagedAttention::~NEPagedAttention() = default;
+
+void NEPagedAttention::configure(const ITensor *q,
+                                 const ITensor *k,
+                                 const ITensor *v,
+                                 const ITensor *block_tables,
+                                 const ITensor *seq_lens,
+                                 ITensor       *dst,
+                                 float          scale)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(q, k, v, block_tables, seq_lens, dst);
+    ARM_COMPUTE_LOG_PARAMS(q, k, v, block_tables, seq_lens, dst, scale);
+
+    _impl->op = std::make_unique<cpu::CpuPagedAttention>();
+    _impl->op->configure(q->info(), k->info(), v->info(), block_tables->info(), seq_lens->info(), dst->info(), scale);
+
+    _impl->run_pack = {{TensorType::ACL_SRC_0, q},
+                       {TensorType::ACL_SRC_1, k},
+                       {TensorType::ACL_SRC_2, v},
+                       {TensorType::ACL_SRC_3, block_tables},
+                       {TensorType::ACL_SRC_4, seq_lens},
+                       {TensorType::ACL_DST, dst}};
+
+    _impl->aux_mem_req       = _impl->op->workspace();
+    _impl->workspace_tensors = manage_workspace<Tensor>(_impl->aux_mem_req, _impl->memory_group, _impl->run_pack);
+}
+
+Status NEPagedAttention::validate(const ITensorInfo *q,
+                                  const ITensorInfo *k,
+                                  const ITensorInfo *v,
+                                  const ITensorInfo *block_tables,
+                                  const ITensorInfo *seq_lens,
+                                  const ITensorInfo *dst,
+                                  float              scale)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(q, k, v, block_tables, seq_lens, dst);
+    return cpu::CpuPagedAttention::validate(q, k, v, block_tables, seq_lens, dst, scale);
+}
+
+void NEPagedAttention::run()
+{
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    _impl->op->run(_impl->run_pack);
+}
+} // namespace arm_compute
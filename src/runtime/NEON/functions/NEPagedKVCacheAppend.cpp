@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEPagedKVCacheAppend.h"
+
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/Log.h"
+#include "src/cpu/operators/CpuPagedKVCacheAppend.h"
+
+namespace arm_compute
+{
+struct NEPagedKVCacheAppend::Impl
+{
+    ITensorPack                                 run_pack{};
+    std::unique_ptr<cpu::CpuPagedKVCacheAppend> op{nullptr};
+};
+
+NEPagedKVCacheAppend::NEPagedKVCacheAppend() : _impl(std::make_unique<Impl>())
+{
+}
+
+NEPagedKVCacheAppend::~NEPagedKVCacheAppend() = default;
+
+void NEPagedKVCacheAppend::configure(const ITensor *src, const ITensor *slots, ITensor *pool)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, slots, pool);
+    ARM_COMPUTE_LOG_PARAMS(src, slots, pool);
+
+    _impl->op = std::make_unique<cpu::CpuPagedKVCacheAppend>();
+    _impl->op->configure(src->info(), slots->info(), pool->info());
+
+    _impl->run_pack = {{TensorType::ACL_SRC_0, src}, {TensorType::ACL_SRC_1, slots}, {TensorType::ACL_DST, pool}};
+}
+
+Status NEPagedKVCacheAppend::validate(const ITensorInfo *src, const ITensorInfo *slots, const ITensorInfo *pool)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(src, slots, pool);
+    return cpu::CpuPagedKVCacheAppend::validate(src, slots, pool);
+}
+
+void NEPagedKVCacheAppend::run()
+{
+    _impl->op->run(_impl->run_pack);
+}
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,7 +29,9 @@
 
 #include "src/common/utils/Log.h"
 #include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/MemoryHelpers.h"
 #include "src/core/NEON/kernels/NEReductionOperationKernel.h"
+#include "src/cpu/operators/CpuMultiAxisReduction.h"
 
 namespace arm_compute
 {
@@ -55,12 +57,43 @@ size_t reduction_window_split_dimension(unsigned int axis)
             ARM_COMPUTE_ERROR("Unsupported reduction axis");
     }
 }
+
+/** Check whether the reduction can be computed in a single pass by @ref cpu::CpuMultiAxisReduction
+ *
+ * @param[in] input Source tensor info
+ * @param[in] op    Reduction operation
+ *
+ * @return True if the single-pass reduction supports the configuration
+ */
+bool use_multi_axis_reduction(const ITensorInfo *input, ReductionOperation op)
+{
+    const bool is_supported_op = op == ReductionOperation::SUM || op == ReductionOperation::MEAN_SUM ||
+                                 op == ReductionOperation::MAX || op == ReductionOperation::MIN ||
+                                 op == ReductionOperation::PROD;
+    const DataType dt              = input->data_type();
+    const bool     is_quantized    = dt == DataType::QASYMM8 || dt == DataType::QASYMM8_SIGNED;
+    const bool     is_supported_dt = dt == DataType::F32 || dt == DataType::F16 ||
+                                 (is_quantized && op != ReductionOperation::PROD);
+    return is_supported_op && is_supported_dt && input->num_channels() == 1 && input->num_dimensions() <= 4;
+}
 } // namespace
 
+struct NEReductionOperation::Impl
+{
+    std::unique_ptr<cpu::CpuMultiAxisReduction> op{nullptr};
+    ITensorPack                                 run_pack{};
+    WorkspaceData<Tensor>                       workspace_tensors{};
+};
+
 NEReductionOperation::~NEReductionOperation() = default;
 
+NEReductionOperation::NEReductionOperation(NEReductionOperation &&) = default;
+
+NEReductionOperation &NEReductionOperation::operator=(NEReductionOperation &&) = default;
+
 NEReductionOperation::NEReductionOperation(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(memory_manager),
+    : _impl(std::make_unique<Impl>()),
+      _memory_group(memory_manager),
       _reduction_kernel(),
       _reshape(),
       _output_internal(),
@@ -78,6 +111,11 @@ Status NEReductionOperation::validate(
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(axis > 3, "Unsupported reduction axis");
     ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, output);
 
+    if (use_multi_axis_reduction(input, op))
+    {
+        return cpu::CpuMultiAxisReduction::validate(input, output, Coordinates(axis), op, keep_dims);
+    }
+
     const auto is_reshape_required = !keep_dims;
 
     auto *output_internal = output;
@@ -122,6 +160,22 @@ void NEReductionOperation::configure(
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
     ARM_COMPUTE_LOG_PARAMS(input, output, axis, op, keep_dims);
 
+    if (use_multi_axis_reduction(input->info(), op))
+    {
+        ARM_COMPUTE_ERROR_THROW_ON(NEReductionOperation::validate(input->info(), output->info(), axis, op, keep_dims));
+
+        // The reduced dimension is dropped by the kernel itself, so no reshape is needed
+        _impl->op = std::make_unique<cpu::CpuMultiAxisReduction>();
+        _impl->op->configure(input->info(), output->info(), Coordinates(axis), op, keep_dims);
+
+        _impl->run_pack          = {{TensorType::ACL_SRC, input}, {TensorType::ACL_DST, output}};
+        _impl->workspace_tensors = manage_workspace<Tensor>(_impl->op->workspace(), _memory_group, _impl->run_pack);
+        _reduction_kernel.reset();
+        _is_reshape_required = false;
+        return;
+    }
+
+    _impl->op.reset();
     _is_reshape_required = !keep_dims;
 
     auto      *output_internal = output;
@@ -173,6 +227,11 @@ void NEReductionOperation::configure(
 void NEReductionOperation::run()
 {
     MemoryGroupResourceScope scope_mg(_memory_group);
+    if (_impl->op != nullptr)
+    {
+        _impl->op->run(_impl->run_pack);
+        return;
+    }
     NEScheduler::get().schedule(_reduction_kernel.get(), _window_split);
     if (_is_reshape_required)
     {
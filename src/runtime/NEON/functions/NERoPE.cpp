@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NERoPE.h"
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/KVCache.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/SubTensor.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/operators/CpuRoPE.h"
+
+namespace arm_compute
+{
+struct NERoPE::Impl
+{
+    const ITensor                   *k{nullptr};
+    KVCache                         *k_cache{nullptr};
+    RoPEInfo                         info{};
+    TensorInfo                       k_cache_dst_info{};
+    std::unique_ptr<cpu::CpuRoPE>    op{nullptr};
+    experimental::MemoryRequirements aux_mem_req{};
+    WorkspaceData<Tensor>            workspace_tensors{};
+    ITensorPack                      run_pack{};
+    MemoryGroup                      memory_group{};
+};
+
+NERoPE::NERoPE(std::shared_ptr<IMemoryManager> memory_manager) : _impl(std::make_unique<Impl>())
+{
+    _impl->memory_group = MemoryGroup(std::move(memory_manager));
+}
+
+NERoPE::~NERoPE() = default;
+
+void NERoPE::configure(const ITensor  *q,
+                       const ITensor  *k,
+                       const ITensor  *positions,
+                       ITensor        *q_dst,
+                       ITensor        *k_dst,
+                       const RoPEInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(q, k, q_dst, k_dst);
+    ARM_COMPUTE_LOG_PARAMS(q, k, positions, q_dst, k_dst, info);
+
+    _impl->k       = k;
+    _impl->k_cache = nullptr;
+    _impl->info    = info;
+    _impl->op      = std::make_unique<cpu::CpuRoPE>();
+    _impl->op->configure(q->info(), k->info(), positions != nullptr ? positions->info() : nullptr, q_dst->info(),
+                         k_dst->info(), info);
+
+    _impl->run_pack = {{TensorType::ACL_SRC_0, q},
+                       {TensorType::ACL_SRC_1, k},
+                       {TensorType::ACL_SRC_2, positions},
+                       {TensorType::ACL_DST_0, q_dst},
+                       {TensorType::ACL_DST_1, k_dst}};
+
+    _impl->aux_mem_req       = _impl->op->workspace();
+    _impl->workspace_tensors = manage_workspace<Tensor>(_impl->aux_mem_req, _impl->memory_group, _impl->run_pack);
+}
+
+void NERoPE::configure(const ITensor *q, const ITensor *k, ITensor *q_dst, KVCache *k_cache, const RoPEInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(q, k, q_dst, k_cache);
+    ARM_COMPUTE_LOG_PARAMS(q, k, q_dst, k_cache->tensor(), info);
+    ARM_COMPUTE_ERROR_THROW_ON(NERoPE::validate(q->info(), k->info(), q_dst->info(), k_cache->tensor()->info(), info));
+
+    // The rotated keys go to a view of the cache created at every run, with the strides of the cache
+    _impl->k                = k;
+    _impl->k_cache          = k_cache;
+    _impl->info             = info;
+    _impl->k_cache_dst_info = TensorInfo(k->info()->tensor_shape(), 1, k_cache->tensor()->info()->data_type());
+    _impl->op               = std::make_unique<cpu::CpuRoPE>();
+    _impl->op->configure(q->info(), k->info(), nullptr, q_dst->info(), &_impl->k_cache_dst_info, info);
+
+    _impl->run_pack = {{TensorType::ACL_SRC_0, q}, {TensorType::ACL_SRC_1, k}, {TensorType::ACL_DST_0, q_dst}};
+
+    _impl->aux_mem_req       = _impl->op->workspace();
+    _impl->workspace_tensors = manage_workspace<Tensor>(_impl->aux_mem_req, _impl->memory_group, _impl->run_pack);
+}
+
+Status NERoPE::validate(const ITensorInfo *q,
+                        const ITensorInfo *k,
+                        const ITensorInfo *positions,
+                        const ITensorInfo *q_dst,
+                        const ITensorInfo *k_dst,
+                        const RoPEInfo    &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(q, k, q_dst, k_dst);
+    return cpu::CpuRoPE::validate(q, k, positions, q_dst, k_dst, info);
+}
+
+Status NERoPE::validate(const ITensorInfo *q,
+                        const ITensorInfo *k,
+                        const ITensorInfo *q_dst,
+                        const ITensorInfo *k_cache,
+                        const RoPEInfo    &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(q, k, q_dst, k_cache);
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(q, k, q_dst, k_cache);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(k, k_cache);
+    ARM_COMPUTE_RETURN_ERROR_ON(k->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(k->dimension(0) != k_cache->dimension(0) ||
+                                        k->dimension(2) != k_cache->dimension(2) ||
+                                        k->dimension(3) != k_cache->dimension(3),
+                                    "Keys and cache must have the same head size, number of heads and batches");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(k->dimension(1) > k_cache->dimension(1), "More tokens than the cache capacity");
+
+    const TensorInfo k_dst(k->tensor_shape(), 1, k_cache->data_type());
+    return cpu::CpuRoPE::validate(q, k, nullptr, q_dst, &k_dst, info);
+}
+
+void NERoPE::run()
+{
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+
+    if (_impl->k_cache == nullptr)
+    {
+        _impl->op->run(_impl->run_pack);
+        return;
+    }
+
+    const size_t length     = _impl->k_cache->length();
+    const size_t num_tokens = _impl->k->info()->dimension(1);
+    if (length + num_tokens > _impl->k_cache->capacity())
+    {
+        ARM_COMPUTE_ERROR("KV cache capacity exceeded");
+    }
+
+    // Rotate the keys in place, right after the valid part of the cache
+    SubTensor k_dst(_impl->k_cache->tensor(), _impl->k->info()->tensor_shape(), Coordinates(0, length));
+    _impl->run_pack.add_tensor(TensorType::ACL_DST_1, &k_dst);
+    _impl->op->set_position_offset(_impl->info.position_offset + static_cast<int>(length));
+    _impl->op->run(_impl->run_pack);
+    _impl->run_pack.remove_tensor(TensorType::ACL_DST_1);
+
+    _impl->k_cache->set_length(length + num_tokens);
+}
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2021 Arm Limited.
+ * Copyright (c) 2019, 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,6 +38,11 @@ void RuntimeContext::set_scheduler(IScheduler *scheduler)
     _scheduler = scheduler;
 }
 
+void RuntimeContext::set_workspace_arena(WorkspaceArena *arena)
+{
+    _workspace_arena = arena;
+}
+
 IScheduler *RuntimeContext::scheduler()
 {
     return _scheduler;
@@ -47,4 +52,9 @@ IAssetManager *RuntimeContext::asset_manager()
 {
     return nullptr;
 }
+
+WorkspaceArena *RuntimeContext::workspace_arena()
+{
+    return _workspace_arena;
+}
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020, 2024 Arm Limited.
+ * Copyright (c) 2017-2020, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -53,6 +53,8 @@ std::shared_ptr<IScheduler> Scheduler::_custom_scheduler = nullptr;
 std::shared_ptr<IScheduler> thread_local Scheduler::_custom_scheduler = nullptr;
 #endif // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
 
+thread_local IScheduler *Scheduler::_thread_scheduler = nullptr;
+
 namespace
 {
 std::map<Scheduler::Type, std::unique_ptr<IScheduler>> init()
@@ -97,6 +99,11 @@ Scheduler::Type Scheduler::get_type()
 
 IScheduler &Scheduler::get()
 {
+    if (_thread_scheduler != nullptr)
+    {
+        return *_thread_scheduler;
+    }
+
     if (_scheduler_type == Type::CUSTOM)
     {
         if (_custom_scheduler == nullptr)
@@ -133,3 +140,34 @@ void Scheduler::set(std::shared_ptr<IScheduler> scheduler)
     _custom_scheduler = std::move(scheduler);
     set(Type::CUSTOM);
 }
+
+void Scheduler::set_thread_scheduler(IScheduler *scheduler)
+{
+    _thread_scheduler = scheduler;
+}
+
+IScheduler *Scheduler::get_thread_scheduler()
+{
+    return _thread_scheduler;
+}
+
+SchedulerScope::SchedulerScope(IScheduler *scheduler)
+    : _previous(Scheduler::get_thread_scheduler()), _active(scheduler != nullptr)
+{
+    if (_active)
+    {
+        Scheduler::set_thread_scheduler(scheduler);
+    }
+}
+
+SchedulerScope::SchedulerScope(IRuntimeContext *ctx) : SchedulerScope(ctx != nullptr ? ctx->scheduler() : nullptr)
+{
+}
+
+SchedulerScope::~SchedulerScope()
+{
+    if (_active)
+    {
+        Scheduler::set_thread_scheduler(_previous);
+    }
+}
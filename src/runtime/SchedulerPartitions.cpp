@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/SchedulerPartitions.h"
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/SchedulerFactory.h"
+
+#include <algorithm>
+#include <set>
+
+#if !defined(_WIN64) && !defined(BARE_METAL) && !defined(__APPLE__) && !defined(__OpenBSD__) && !defined(__QNX__)
+#include <sched.h>
+#define ARM_COMPUTE_SCHEDULER_PARTITIONS_CAN_PIN
+#endif /* !defined(_WIN64) && !defined(BARE_METAL) && !defined(__APPLE__) && !defined(__OpenBSD__) && !defined(__QNX__) */
+
+namespace arm_compute
+{
+namespace
+{
+void pin_current_thread(int core_id)
+{
+#if defined(ARM_COMPUTE_SCHEDULER_PARTITIONS_CAN_PIN)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core_id, &set);
+    ARM_COMPUTE_ERROR_ON_MSG(sched_setaffinity(0, sizeof(set), &set) != 0, "Error setting thread affinity");
+#else  /* defined(ARM_COMPUTE_SCHEDULER_PARTITIONS_CAN_PIN) */
+    ARM_COMPUTE_UNUSED(core_id);
+#endif /* defined(ARM_COMPUTE_SCHEDULER_PARTITIONS_CAN_PIN) */
+}
+
+std::unique_ptr<IScheduler> create_partition_scheduler(const SchedulerPartitions::CoreSet &cores)
+{
+#if ARM_COMPUTE_CPP_SCHEDULER
+    auto scheduler = SchedulerFactory::create(SchedulerFactory::Type::CPP);
+    // Worker 0 is the thread calling schedule() and is pinned by bind_current_thread(), not by the thread
+    // creating the partition: returning a negative core id leaves its affinity untouched.
+    scheduler->set_num_threads_with_affinity(static_cast<unsigned int>(cores.size()),
+                                             [cores](int thread_id, int)
+                                             { return thread_id == 0 ? -1 : cores[thread_id % cores.size()]; });
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+    auto scheduler = SchedulerFactory::create();
+    scheduler->set_num_threads(static_cast<unsigned int>(cores.size()));
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+    return scheduler;
+}
+} // namespace
+
+SchedulerPartitions::SchedulerPartitions(const std::vector<CoreSet> &core_sets) : _core_sets(core_sets), _schedulers()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_core_sets.empty(), "At least one partition is required");
+
+    std::set<int> used_cores;
+    for (const auto &cores : _core_sets)
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(cores.empty(), "A partition must contain at least one core");
+        for (const int core : cores)
+        {
+            if (core < 0 || !used_cores.insert(core).second)
+            {
+                ARM_COMPUTE_ERROR("Partitions must use disjoint sets of valid core ids");
+            }
+        }
+        _schedulers.emplace_back(create_partition_scheduler(cores));
+    }
+}
+
+SchedulerPartitions::SchedulerPartitions(unsigned int num_partitions, unsigned int num_cores)
+    : SchedulerPartitions(
+          split_cores(num_partitions, num_cores == 0 ? CPUInfo::get().get_cpu_num() : num_cores))
+{
+}
+
+SchedulerPartitions::~SchedulerPartitions() = default;
+
+std::vector<SchedulerPartitions::CoreSet> SchedulerPartitions::split_cores(unsigned int num_partitions,
+                                                                           unsigned int num_cores)
+{
+    ARM_COMPUTE_ERROR_ON(num_partitions == 0);
+    ARM_COMPUTE_ERROR_ON_MSG(num_cores < num_partitions, "Not enough cores for the requested partitions");
+
+    std::vector<CoreSet> core_sets(num_partitions);
+
+    // The first (num_cores % num_partitions) partitions get one extra core
+    const unsigned int base  = num_cores / num_partitions;
+    const unsigned int extra = num_cores % num_partitions;
+    int                core  = 0;
+    for (unsigned int p = 0; p < num_partitions; ++p)
+    {
+        const unsigned int size = base + (p < extra ? 1 : 0);
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            core_sets[p].push_back(core++);
+        }
+    }
+    return core_sets;
+}
+
+size_t SchedulerPartitions::num_partitions() const
+{
+    return _schedulers.size();
+}
+
+IScheduler &SchedulerPartitions::scheduler(size_t idx)
+{
+    ARM_COMPUTE_ERROR_ON(idx >= _schedulers.size());
+    return *_schedulers[idx];
+}
+
+const SchedulerPartitions::CoreSet &SchedulerPartitions::cores(size_t idx) const
+{
+    ARM_COMPUTE_ERROR_ON(idx >= _core_sets.size());
+    return _core_sets[idx];
+}
+
+void SchedulerPartitions::bind_current_thread(size_t idx, bool pin)
+{
+    ARM_COMPUTE_ERROR_ON(idx >= _schedulers.size());
+    if (pin)
+    {
+        pin_current_thread(_core_sets[idx].front());
+    }
+    Scheduler::set_thread_scheduler(_schedulers[idx].get());
+}
+} // namespace arm_compute
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/TensorAlias.h"
+
+#include "arm_compute/core/Error.h"
+
+using namespace arm_compute;
+
+TensorAlias::TensorAlias() : _parent(nullptr), _info()
+{
+}
+
+TensorAlias::TensorAlias(ITensor *parent, const TensorShape &tensor_shape) : _parent(nullptr), _info()
+{
+    ARM_COMPUTE_ERROR_ON(parent == nullptr);
+    const ITensorInfo *parent_info = parent->info();
+    ARM_COMPUTE_ERROR_ON(parent_info->tensor_shape().total_size() != tensor_shape.total_size());
+    ARM_COMPUTE_ERROR_ON(parent_info->padding() != PaddingSize());
+
+    // The alias starts at the parent's first element, so it does not need to follow later changes of its offset
+    _info = TensorInfo(tensor_shape, 1, parent_info->data_type(), parent_info->quantization_info());
+    _info.set_data_layout(parent_info->data_layout());
+    _info.set_is_resizable(false);
+    _parent = parent;
+}
+
+ITensorInfo *TensorAlias::info() const
+{
+    return &_info;
+}
+
+ITensorInfo *TensorAlias::info()
+{
+    return &_info;
+}
+
+uint8_t *TensorAlias::buffer() const
+{
+    ARM_COMPUTE_ERROR_ON(_parent == nullptr);
+    uint8_t *parent_buffer = _parent->buffer();
+    return parent_buffer == nullptr ? nullptr : parent_buffer + _parent->info()->offset_first_element_in_bytes();
+}
+
+ITensor *TensorAlias::parent()
+{
+    return _parent;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2020, 2024 Arm Limited.
+ * Copyright (c) 2016-2020, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@
 #include "arm_compute/core/Coordinates.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/runtime/IAllocator.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryRegion.h"
 
@@ -65,7 +66,8 @@ bool validate_subtensor_shape(const TensorInfo &parent_info, const TensorInfo &c
 }
 } // namespace
 
-TensorAllocator::TensorAllocator(IMemoryManageable *owner) : _owner(owner), _associated_memory_group(nullptr), _memory()
+TensorAllocator::TensorAllocator(IMemoryManageable *owner)
+    : _owner(owner), _associated_memory_group(nullptr), _backing_allocator(nullptr), _memory()
 {
 }
 
@@ -78,10 +80,12 @@ TensorAllocator::TensorAllocator(TensorAllocator &&o) noexcept
     : ITensorAllocator(std::move(o)),
       _owner(o._owner),
       _associated_memory_group(o._associated_memory_group),
+      _backing_allocator(o._backing_allocator),
       _memory(std::move(o._memory))
 {
     o._owner                   = nullptr;
     o._associated_memory_group = nullptr;
+    o._backing_allocator       = nullptr;
     o._memory                  = Memory();
 }
 
@@ -95,6 +99,9 @@ TensorAllocator &TensorAllocator::operator=(TensorAllocator &&o) noexcept
         _associated_memory_group   = o._associated_memory_group;
         o._associated_memory_group = nullptr;
 
+        _backing_allocator   = o._backing_allocator;
+        o._backing_allocator = nullptr;
+
         _memory   = std::move(o._memory);
         o._memory = Memory();
 
@@ -136,7 +143,14 @@ void TensorAllocator::allocate()
     const size_t alignment_to_use = (alignment() != 0) ? alignment() : 64;
     if (_associated_memory_group == nullptr)
     {
-        _memory.set_owned_region(std::make_unique<MemoryRegion>(info().total_size(), alignment_to_use));
+        if (_backing_allocator != nullptr)
+        {
+            _memory.set_owned_region(_backing_allocator->make_region(info().total_size(), alignment_to_use));
+        }
+        else
+        {
+            _memory.set_owned_region(std::make_unique<MemoryRegion>(info().total_size(), alignment_to_use));
+        }
     }
     else
     {
@@ -177,6 +191,13 @@ void TensorAllocator::set_associated_memory_group(IMemoryGroup *associated_memor
     _associated_memory_group = associated_memory_group;
 }
 
+void TensorAllocator::set_backing_allocator(IAllocator *allocator)
+{
+    ARM_COMPUTE_ERROR_ON(_memory.region() != nullptr && _memory.region()->buffer() != nullptr);
+
+    _backing_allocator = allocator;
+}
+
 uint8_t *TensorAllocator::lock()
 {
     ARM_COMPUTE_ERROR_ON(_memory.region() == nullptr);
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/WorkspaceArena.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/IRuntimeContext.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+namespace arm_compute
+{
+namespace
+{
+// Blocks are page aligned so that the padding of a request only depends on the offset it is carved at
+constexpr size_t block_alignment = 4096;
+
+size_t round_up(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+} // namespace
+
+thread_local WorkspaceArena *WorkspaceArena::_thread_arena = nullptr;
+
+WorkspaceArena::WorkspaceArena(IAllocator *allocator)
+    : _allocator(allocator),
+      _default_allocator(nullptr),
+      _block(nullptr),
+      _overflow(),
+      _offset(0),
+      _usage(0),
+      _peak(0),
+      _requested(0),
+      _live(0),
+      _mtx()
+{
+    if (_allocator == nullptr)
+    {
+        _default_allocator = std::make_unique<Allocator>();
+        _allocator         = _default_allocator.get();
+    }
+}
+
+WorkspaceArena::~WorkspaceArena()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_live != 0, "Workspace arena destroyed while some of its buffers are in use");
+}
+
+void WorkspaceArena::reserve(size_t size)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    _requested = std::max(_requested, size);
+    if (_live == 0)
+    {
+        try_grow(_requested);
+    }
+}
+
+void WorkspaceArena::reserve(const experimental::MemoryRequirements &requirements)
+{
+    size_t size = 0;
+    for (const auto &req : requirements)
+    {
+        if (req.size != 0)
+        {
+            size = round_up(size, std::max<size_t>(req.alignment, 1)) + req.size;
+        }
+    }
+    reserve(size);
+}
+
+void *WorkspaceArena::allocate(size_t size, size_t alignment)
+{
+    ARM_COMPUTE_ERROR_ON(size == 0);
+    alignment = std::max<size_t>(alignment, 1);
+    ARM_COMPUTE_ERROR_ON_MSG((alignment & (alignment - 1)) != 0, "Alignment must be a power of two");
+
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    void *ptr = nullptr;
+
+    uint8_t *base   = nullptr;
+    size_t   offset = 0;
+    if (_block != nullptr)
+    {
+        base                 = static_cast<uint8_t *>(_block->buffer());
+        const uintptr_t addr = reinterpret_cast<uintptr_t>(base);
+        offset               = round_up(addr + _offset, alignment) - addr;
+    }
+
+    if (base != nullptr && offset + size <= _block->size())
+    {
+        ptr     = base + offset;
+        _offset = offset + size;
+    }
+    else
+    {
+        auto region = _allocator->make_region(size, alignment);
+        ptr         = (region != nullptr) ? region->buffer() : nullptr;
+        if (ptr == nullptr)
+        {
+            ARM_COMPUTE_ERROR("Failed to allocate workspace memory");
+        }
+        _overflow.emplace_back(std::move(region));
+    }
+
+    // The usage accounts for the requests as if they were all carved out of a single block
+    _usage = round_up(_usage, alignment) + size;
+    _peak  = std::max(_peak, _usage);
+    ++_live;
+
+    return ptr;
+}
+
+void WorkspaceArena::release(void *ptr)
+{
+    ARM_COMPUTE_UNUSED(ptr);
+
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    ARM_COMPUTE_ERROR_ON_MSG(_live == 0, "No workspace buffer to release");
+    if (--_live == 0)
+    {
+        // Recycle the memory and merge the overflow blocks into the main block
+        _overflow.clear();
+        _offset = 0;
+        _usage  = 0;
+        try_grow(std::max(_requested, _peak));
+    }
+}
+
+size_t WorkspaceArena::capacity() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return (_block != nullptr) ? _block->size() : 0;
+}
+
+size_t WorkspaceArena::usage() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _usage;
+}
+
+size_t WorkspaceArena::peak_usage() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _peak;
+}
+
+void WorkspaceArena::reset_peak_usage()
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    _peak = _usage;
+}
+
+WorkspaceArena *WorkspaceArena::get_thread_arena()
+{
+    return _thread_arena;
+}
+
+void WorkspaceArena::set_thread_arena(WorkspaceArena *arena)
+{
+    _thread_arena = arena;
+}
+
+void WorkspaceArena::try_grow(size_t size)
+{
+    const size_t capacity = (_block != nullptr) ? _block->size() : 0;
+    if (size > capacity)
+    {
+        // Release the old block first to limit the memory footprint
+        _block.reset();
+        _block = _allocator->make_region(round_up(size, block_alignment), block_alignment);
+    }
+}
+
+WorkspaceArenaScope::WorkspaceArenaScope(WorkspaceArena *arena)
+    : _previous(WorkspaceArena::get_thread_arena()), _active(arena != nullptr)
+{
+    if (_active)
+    {
+        WorkspaceArena::set_thread_arena(arena);
+    }
+}
+
+WorkspaceArenaScope::WorkspaceArenaScope(IRuntimeContext *ctx)
+    : WorkspaceArenaScope(ctx != nullptr ? ctx->workspace_arena() : nullptr)
+{
+}
+
+WorkspaceArenaScope::~WorkspaceArenaScope()
+{
+    if (_active)
+    {
+        WorkspaceArena::set_thread_arena(_previous);
+    }
+}
+} // namespace arm_compute
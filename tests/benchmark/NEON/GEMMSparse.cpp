@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMSparse.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/benchmark/fixtures/GEMMSparseFixture.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/NEON/Accessor.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+// Decode-like (M = 1), small batch and prefill-like shapes
+const auto gemm_sparse_shapes = zip(zip(framework::dataset::make("M", {1U, 16U, 128U}),
+                                        framework::dataset::make("N", {4096U, 4096U, 1024U})),
+                                    framework::dataset::make("K", {4096U, 4096U, 1024U}));
+} // namespace
+
+using NEGEMMSparseFixture      = GEMMSparseFixture<Tensor, NEGEMMSparse, Accessor, true>;
+using NEGEMMSparseDenseFixture = GEMMSparseFixture<Tensor, NEGEMM, Accessor, false>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(GEMMSparse)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSparse,
+                                NEGEMMSparseFixture,
+                                framework::DatasetMode::ALL,
+                                combine(gemm_sparse_shapes, framework::dataset::make("DataType", {DataType::F32})));
+// Same shapes and pruned weights through the dense GEMM, as the baseline for RunSparse
+REGISTER_FIXTURE_DATA_TEST_CASE(RunDense,
+                                NEGEMMSparseDenseFixture,
+                                framework::DatasetMode::ALL,
+                                combine(gemm_sparse_shapes, framework::dataset::make("DataType", {DataType::F32})));
+TEST_SUITE_END() // GEMMSparse
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
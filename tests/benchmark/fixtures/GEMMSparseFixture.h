@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_GEMMSPARSEFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_GEMMSPARSEFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/GEMMInfo.h"
+
+#include "tests/framework/Fixture.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+
+#include <cstring>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture running a matrix multiplication by 2:4 sparse weights [N, K]
+ *
+ * The same fixture runs @p Function as the sparse function or as the dense GEMM, so that both paths are measured on
+ * identical shapes and weights.
+ */
+template <typename TensorType, typename Function, typename Accessor, bool sparse>
+class GEMMSparseFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int m, unsigned int n, unsigned int k, DataType data_type)
+    {
+        a       = create_tensor<TensorType>(TensorShape(k, m), data_type);
+        weights = create_tensor<TensorType>(TensorShape(n, k), data_type);
+        dst     = create_tensor<TensorType>(TensorShape(n, m), data_type);
+
+        configure_function();
+
+        a.allocator()->allocate();
+        weights.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        library->fill_tensor_uniform(Accessor(a), 0);
+        library->fill_tensor_uniform(Accessor(weights), 1);
+
+        // Prune the last 2 weights of every group of 4 along K
+        const size_t element_size = weights.info()->element_size();
+        for (unsigned int y = 0; y < k; ++y)
+        {
+            if (y % 4 < 2)
+            {
+                continue;
+            }
+            for (unsigned int x = 0; x < n; ++x)
+            {
+                std::memset(weights.ptr_to_element(Coordinates(x, y)), 0, element_size);
+            }
+        }
+
+        // Pack the weights outside of the measured runs
+        func.prepare();
+    }
+
+    void run()
+    {
+        func.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        a.allocator()->free();
+        weights.allocator()->free();
+        dst.allocator()->free();
+    }
+
+private:
+    template <bool S = sparse>
+    typename std::enable_if<S>::type configure_function()
+    {
+        func.configure(&a, &weights, nullptr, &dst);
+    }
+
+    template <bool S = sparse>
+    typename std::enable_if<!S>::type configure_function()
+    {
+        func.configure(&a, &weights, nullptr, &dst, 1.f, 0.f, GEMMInfo());
+    }
+
+    TensorType a{};
+    TensorType weights{};
+    TensorType dst{};
+    Function   func{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_GEMMSPARSEFIXTURE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -325,6 +325,24 @@ public:
     }
 };
 
+/** Dataset containing optimized, 7x7 and 9x9 depthwise convolution shapes. */
+class SmallOptimizedDepthwiseConvolutionLayerDatasetLargeKernel final : public DepthwiseConvolutionLayerDataset
+{
+public:
+    SmallOptimizedDepthwiseConvolutionLayerDatasetLargeKernel()
+    {
+        // 7x7 stride 1
+        add_config(TensorShape(9U, 9U, 16U), Size2D(7U, 7U), PadStrideInfo(1, 1, 0, 0, DimensionRoundingType::CEIL));
+        add_config(TensorShape(10U, 11U, 19U), Size2D(7U, 7U), PadStrideInfo(1, 1, 3, 3, DimensionRoundingType::CEIL));
+        // 7x7 stride 2
+        add_config(TensorShape(13U, 13U, 16U), Size2D(7U, 7U), PadStrideInfo(2, 2, 0, 0, DimensionRoundingType::CEIL));
+        add_config(TensorShape(14U, 15U, 19U), Size2D(7U, 7U), PadStrideInfo(2, 2, 3, 3, 3, 3, DimensionRoundingType::CEIL));
+        // 9x9 stride 1
+        add_config(TensorShape(11U, 11U, 16U), Size2D(9U, 9U), PadStrideInfo(1, 1, 0, 0, DimensionRoundingType::CEIL));
+        add_config(TensorShape(12U, 13U, 19U), Size2D(9U, 9U), PadStrideInfo(1, 1, 4, 4, DimensionRoundingType::CEIL));
+    }
+};
+
 /** Dataset containing in-place 1x1 depthwise convolution shapes.
  *
  * For a depthwise convolution op to be in-place:
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -108,6 +108,19 @@ public:
     }
 };
 
+/** Skinny GEMMs (M <= 8) with enough weights to be computed as streamed GEMVs, with K splits not multiple of the panels */
+class SmallSkinnyGEMMDataset final : public GEMMDataset
+{
+public:
+    SmallSkinnyGEMMDataset()
+    {
+        add_config(TensorShape(512U, 1U), TensorShape(257U, 512U), TensorShape(257U, 1U), TensorShape(257U, 1U), 1.0f, 0.0f);
+        add_config(TensorShape(1027U, 3U), TensorShape(70U, 1027U), TensorShape(70U, 3U), TensorShape(70U, 3U), 1.0f, 0.0f);
+        add_config(TensorShape(300U, 8U), TensorShape(259U, 300U), TensorShape(259U, 8U), TensorShape(259U, 8U), 1.0f, 1.0f);
+        add_config(TensorShape(2049U, 5U), TensorShape(33U, 2049U), TensorShape(33U, 5U), TensorShape(33U, 5U), 0.5f, 0.0f);
+    }
+};
+
 class SmallGEMMVectorBiasDataset final : public GEMMDataset
 {
 public:
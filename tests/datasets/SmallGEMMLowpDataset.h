@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -52,6 +52,18 @@ public:
         add_config(TensorShape(32U, 72U), TensorShape(17U, 32U), TensorShape(17U, 72U), -9, 1);
     }
 };
+/** Skinny GEMMs (M <= 8) with enough weights to be computed as streamed GEMVs, with K splits not multiple of the panels */
+class SmallSkinnyGEMMLowpDataset final : public GEMMLowpDataset
+{
+public:
+    SmallSkinnyGEMMLowpDataset()
+    {
+        add_config(TensorShape(512U, 1U), TensorShape(257U, 512U), TensorShape(257U, 1U), 0, 0);
+        add_config(TensorShape(1027U, 3U), TensorShape(70U, 1027U), TensorShape(70U, 3U), -2, 13);
+        add_config(TensorShape(300U, 8U), TensorShape(259U, 300U), TensorShape(259U, 8U), 5, -3);
+        add_config(TensorShape(2049U, 5U), TensorShape(33U, 2049U), TensorShape(33U, 5U), 0, 4);
+    }
+};
 class SmallGEMMLowpOutput3DDataset final : public GEMMLowpDataset
 {
 public:
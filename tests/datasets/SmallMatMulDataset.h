@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -58,6 +58,30 @@ public:
     }
 };
 
+/** Shapes where the rhs batches are shared by groups of lhs batches, as in grouped-query and multi-query attention */
+class SmallBroadcastBatchMatMulDataset final : public MatMulDataset
+{
+public:
+    SmallBroadcastBatchMatMulDataset()
+    {
+        add_config(TensorShape(16U, 5U, 8U, 2U), TensorShape(7U, 16U, 2U, 2U), TensorShape(7U, 5U, 8U, 2U));
+        add_config(TensorShape(16U, 5U, 4U), TensorShape(7U, 16U), TensorShape(7U, 5U, 4U));
+        add_config(TensorShape(9U, 6U, 3U, 1U, 2U), TensorShape(5U, 9U, 1U, 1U, 2U), TensorShape(5U, 6U, 3U, 1U, 2U));
+    }
+};
+
+/** Skinny shapes (M <= 8) with enough weights to be computed as streamed GEMVs */
+class SmallSkinnyMatMulDataset final : public MatMulDataset
+{
+public:
+    SmallSkinnyMatMulDataset()
+    {
+        add_config(TensorShape(512U, 1U), TensorShape(257U, 512U), TensorShape(257U, 1U));
+        add_config(TensorShape(1027U, 3U), TensorShape(70U, 1027U), TensorShape(70U, 3U));
+        add_config(TensorShape(300U, 8U), TensorShape(259U, 300U), TensorShape(259U, 8U));
+    }
+};
+
 class TinyMatMulDataset final : public MatMulDataset
 {
 public:
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2024 Arm Limited.
+ * Copyright (c) 2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,7 @@
  */
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/runtime/NEON/functions/NEConv3D.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
@@ -34,6 +35,9 @@
 #include "tests/framework/datasets/Datasets.h"
 #include "tests/validation/Validation.h"
 #include "tests/validation/fixtures/DirectConvolution3DFixture.h"
+#include "tests/validation/reference/Conv3D.h"
+
+#include <memory>
 
 namespace arm_compute
 {
@@ -72,6 +76,26 @@ const auto data_precommit = combine(combine(zip(zip(zip(zip(zip(zip(zip(zip(zip(
                                                 framework::dataset::make("NumKernels", { 2, 3, 8 })),
                                             framework::dataset::make("HasBias", { true, false })),
                                     ActivationFunctionsDataset);
+
+/** Convolutions with enough channels for NEConv3D to select the indirect GEMM */
+const auto data_wide_channels_shapes = zip(zip(zip(zip(zip(zip(zip(zip(zip(zip(zip(
+                                                                                   framework::dataset::make("InputShape", { TensorShape(16U, 9U, 7U, 5U, 2U),
+                                                                                                                            TensorShape(24U, 6U, 6U, 6U),
+                                                                                                                            TensorShape(33U, 5U, 4U, 3U, 1U)
+                                                                                                                          }),
+                                                                                   framework::dataset::make("StrideX", { 1, 2, 1 })),
+                                                                               framework::dataset::make("StrideY", { 1, 1, 2 })),
+                                                                           framework::dataset::make("StrideZ", { 1, 2, 1 })),
+                                                                       framework::dataset::make("PadX", { 1, 0, 2 })),
+                                                                   framework::dataset::make("PadY", { 1, 2, 0 })),
+                                                               framework::dataset::make("PadZ", { 1, 1, 0 })),
+                                                           framework::dataset::make("KernelWidth", { 3, 3, 1 })),
+                                                       framework::dataset::make("KernelHeight", { 3, 2, 1 })),
+                                                   framework::dataset::make("KernelDepth", { 3, 3, 1 })),
+                                               framework::dataset::make("NumKernels", { 16, 7, 40 })),
+                                           framework::dataset::make("HasBias", { true, false, true }));
+
+const auto data_wide_channels = combine(data_wide_channels_shapes, ActivationFunctionsDataset);
 } // namespace
 
 TEST_SUITE(NEON)
@@ -138,6 +162,60 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEDirectConvolution3DFixture<float>, framework:
     // Validate output
     validate(Accessor(_target), _reference, tolerance_fp32);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallWideChannels, NEDirectConvolution3DFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(data_wide_channels,
+                                                                                                                             framework::dataset::make("DataType", DataType::F32)),
+                                                                                                                             framework::dataset::make("DataLayout", { DataLayout::NDHWC })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+
+// The indirect GEMM reads the input through pointers into it, which must follow the buffer imported for each run
+TEST_CASE(RunImportedInputs, framework::DatasetMode::ALL)
+{
+    const TensorShape input_shape(16U, 6U, 5U, 4U, 1U);
+    const TensorShape weights_shape(16U, 16U, 3U, 3U, 3U);
+    const TensorShape bias_shape(16U);
+    const Conv3dInfo  conv3d_info(Size3D(1U, 1U, 1U), Padding3D(1U, 1U, 1U), ActivationLayerInfo(), Size3D(1U, 1U, 1U), DimensionRoundingType::FLOOR, false);
+    const TensorShape output_shape = misc::shape_calculator::compute_conv3d_shape(input_shape, weights_shape, conv3d_info);
+
+    Tensor src     = create_tensor<Tensor>(input_shape, DataType::F32, 1, QuantizationInfo(), DataLayout::NDHWC);
+    Tensor weights = create_tensor<Tensor>(weights_shape, DataType::F32, 1, QuantizationInfo(), DataLayout::NDHWC);
+    Tensor bias    = create_tensor<Tensor>(bias_shape, DataType::F32);
+    Tensor dst     = create_tensor<Tensor>(output_shape, DataType::F32, 1, QuantizationInfo(), DataLayout::NDHWC);
+
+    NEConv3D conv;
+    conv.configure(&src, &weights, &bias, &dst, conv3d_info);
+
+    weights.allocator()->allocate();
+    bias.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    library->fill(Accessor(weights), distribution, 1);
+    library->fill(Accessor(bias), distribution, 2);
+
+    SimpleTensor<float> ref_weights{ weights_shape, DataType::F32 };
+    SimpleTensor<float> ref_bias{ bias_shape, DataType::F32 };
+    library->fill(ref_weights, distribution, 1);
+    library->fill(ref_bias, distribution, 2);
+
+    const size_t               src_size = src.info()->total_size();
+    std::unique_ptr<uint8_t[]> buffers[2]{ std::make_unique<uint8_t[]>(src_size), std::make_unique<uint8_t[]>(src_size) };
+    for(int i = 0; i < 2; ++i)
+    {
+        ARM_COMPUTE_ASSERT(bool(src.allocator()->import_memory(buffers[i].get())));
+        library->fill(Accessor(src), distribution, 3 + i);
+        conv.run();
+
+        SimpleTensor<float> ref_src{ input_shape, DataType::F32 };
+        SimpleTensor<float> ref_dst{ output_shape, DataType::F32 };
+        library->fill(ref_src, distribution, 3 + i);
+
+        // Validate output
+        validate(Accessor(dst), reference::conv3d<float, float, float>(ref_src, ref_weights, ref_bias, ref_dst, conv3d_info), tolerance_fp32);
+    }
+}
 TEST_SUITE_END() // FP32
 
 #ifdef ARM_COMPUTE_ENABLE_FP16
@@ -157,6 +235,21 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEDirectConvolution3DFixture<half>, framework::
         framework::ARM_COMPUTE_PRINT_INFO();
     }
 }
+FIXTURE_DATA_TEST_CASE(RunSmallWideChannels, NEDirectConvolution3DFixture<half>, framework::DatasetMode::PRECOMMIT, combine(combine(data_wide_channels,
+                                                                                                                            framework::dataset::make("DataType", DataType::F16)),
+                                                                                                                    framework::dataset::make("DataLayout", { DataLayout::NDHWC })))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
 TEST_SUITE_END() // FP16
 #endif           /* ARM_COMPUTE_ENABLE_FP16 */
 
@@ -195,6 +288,18 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEDirectConvolution3DQuantizedFixture<uint8_t>,
     validate(Accessor(_target), _reference, tolerance_qasymm8);
 }
 
+FIXTURE_DATA_TEST_CASE(RunSmallWideChannels, NEDirectConvolution3DQuantizedFixture<uint8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(combine(combine(data_wide_channels_shapes,
+                                                                       framework::dataset::make("Activation", ActivationLayerInfo())),
+                                                               framework::dataset::make("DataType", DataType::QASYMM8)),
+                                                       framework::dataset::make("DataLayout", DataLayout::NDHWC)),
+                                               framework::dataset::make("SrcQuantizationInfo", QuantizationInfo(0.1f, 10))),
+                                       framework::dataset::make("WeightsQuantizationInfo", QuantizationInfo(0.3f, 20))),
+                               framework::dataset::make("DstQuantizationInfo", QuantizationInfo(0.2f, 5))))
+{
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+
 TEST_SUITE_END() // QASYMM8
 
 TEST_SUITE(QASYMM8_SIGNED)
@@ -226,6 +331,18 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEDirectConvolution3DQuantizedFixture<int8_t>,
     validate(Accessor(_target), _reference, tolerance_qasymm8);
 }
 
+FIXTURE_DATA_TEST_CASE(RunSmallWideChannels, NEDirectConvolution3DQuantizedFixture<int8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(combine(combine(data_wide_channels_shapes,
+                                                                       framework::dataset::make("Activation", ActivationLayerInfo())),
+                                                               framework::dataset::make("DataType", DataType::QASYMM8_SIGNED)),
+                                                       framework::dataset::make("DataLayout", DataLayout::NDHWC)),
+                                               framework::dataset::make("SrcQuantizationInfo", QuantizationInfo(0.1f, 10))),
+                                       framework::dataset::make("WeightsQuantizationInfo", QuantizationInfo(0.3f, 20))),
+                               framework::dataset::make("DstQuantizationInfo", QuantizationInfo(0.2f, 5))))
+{
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+
 TEST_SUITE_END() // QASYMM8_SIGNED
 TEST_SUITE_END() // Quantized
 
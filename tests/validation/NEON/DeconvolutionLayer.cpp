@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -57,6 +57,12 @@ const auto data4x4 = datasets::SmallDeconvolutionShapes() * framework::dataset::
     3
 });
 
+const auto data4x4_precommit = datasets::SmallDeconvolutionShapes() * framework::dataset::make("StrideX", 2) * framework::dataset::make("StrideY", 2) * framework::dataset::make("PadX", 0, 2)
+                               * framework::dataset::make("PadY", 0, 2) * framework::dataset::make("NumKernels",
+{
+    3
+});
+
 const auto data3x3 = datasets::SmallDeconvolutionShapes() * framework::dataset::make("StrideX", 1, 4) * framework::dataset::make("StrideY", 1, 4) * framework::dataset::make("PadX", 0, 2)
                      * framework::dataset::make("PadY", 0, 2) * framework::dataset::make("NumKernels",
 {
@@ -139,6 +145,9 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(zip(
                                             TensorInfo(TensorShape(2U,2U,1U,1U), 1, DataType::F32),    // Small shape no padding
                                             TensorInfo(TensorShape(3U,26U,26U,1U), 1, DataType::F32),    // Negative padding
                                             TensorInfo(TensorShape(6U,6U,1U,1U), 1, DataType::F32),    // Negative and asymmetric padding
+                                            TensorInfo(TensorShape(8U, 8U, 2U), 1, DataType::F32),     // Strided
+                                            TensorInfo(TensorShape(8U, 8U, 2U), 1, DataType::F32),     // Strided, invalid output batches
+                                            TensorInfo(TensorShape(8U, 8U, 2U), 1, DataType::F32),     // Strided, mismatching output data layout
                                           }),
     framework::dataset::make("WeightsInfo", { TensorInfo(TensorShape(3U, 3U, 2U, 2U), 1, DataType::F16),
                                             TensorInfo(TensorShape(3U, 3U, 2U, 4U), 1, DataType::F32),
@@ -149,6 +158,9 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(zip(
                                             TensorInfo(TensorShape(3U,3U,1U,1U), 1, DataType::F32),
                                             TensorInfo(TensorShape(1U,1U,26U,88U), 1, DataType::F32),
                                             TensorInfo(TensorShape(2U,2U,1U,1U), 1, DataType::F32),    // Negative and asymmetric padding
+                                            TensorInfo(TensorShape(3U, 3U, 2U, 4U), 1, DataType::F32),
+                                            TensorInfo(TensorShape(3U, 3U, 2U, 4U), 1, DataType::F32),
+                                            TensorInfo(TensorShape(3U, 3U, 2U, 4U), 1, DataType::F32),
                                           })),
     framework::dataset::make("BiasInfo",  { TensorInfo(TensorShape(1U), 1, DataType::F16),
                                             TensorInfo(TensorShape(1U), 1, DataType::F32),
@@ -159,6 +171,9 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(zip(
                                             TensorInfo(TensorShape(1U), 1, DataType::F32),
                                             TensorInfo(TensorShape(88U), 1, DataType::F32),
                                             TensorInfo(TensorShape(1U), 1, DataType::F32),
+                                            TensorInfo(TensorShape(4U), 1, DataType::F32),
+                                            TensorInfo(TensorShape(4U), 1, DataType::F32),
+                                            TensorInfo(TensorShape(4U), 1, DataType::F32),
                                           })),
     framework::dataset::make("OutputInfo",{ TensorInfo(TensorShape(25U, 11U, 2U), 1, DataType::F16),
                                             TensorInfo(TensorShape(25U, 10U, 2U), 1, DataType::F32),
@@ -169,6 +184,9 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(zip(
                                             TensorInfo(TensorShape(4U,4U,1U,1U), 1, DataType::F32),
                                             TensorInfo(TensorShape(1U,78U,88U,1U), 1, DataType::F32),
                                             TensorInfo(TensorShape(15U,15U,1U,1U), 1, DataType::F32),
+                                            TensorInfo(TensorShape(15U, 15U, 4U), 1, DataType::F32),
+                                            TensorInfo(TensorShape(15U, 15U, 4U, 2U), 1, DataType::F32),
+                                            TensorInfo(TensorShape(15U, 15U, 4U), 1, DataType::F32, DataLayout::NHWC),
                                           })),
     framework::dataset::make("PadStrideInfo", { PadStrideInfo(1, 1, 0, 0),
                                                 PadStrideInfo(1, 1, 0, 0),
@@ -179,8 +197,11 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(zip(
                                                 PadStrideInfo(1, 1, 0, 0),
                                                 PadStrideInfo(2, 3, 3, 1),
                                                 PadStrideInfo(3, 3, 2, 0, 2, 0, arm_compute::DimensionRoundingType::FLOOR),
+                                                PadStrideInfo(2, 2, 1, 1),
+                                                PadStrideInfo(2, 2, 1, 1),
+                                                PadStrideInfo(2, 2, 1, 1),
                                            })),
-    framework::dataset::make("Expected", { false, false, false, false, false, true,true, false, false })),
+    framework::dataset::make("Expected", { false, false, false, false, false, true,true, false, false, true, false, false })),
     input_info, weights_info, bias_info, output_info, pad_info, expected)
 {
     bool is_valid = bool(NEDeconvolutionLayer::validate(&input_info.clone()->set_is_resizable(false), &weights_info.clone()->set_is_resizable(false), &bias_info.clone()->set_is_resizable(false), &output_info.clone()->set_is_resizable(false), pad_info));
@@ -210,6 +231,14 @@ using NEDeconvolutionLayerFixture5x1 = DeconvolutionValidationFixture<Tensor, Ac
 TEST_SUITE(Float)
 TEST_SUITE(FP32)
 TEST_SUITE(W4x4)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEDeconvolutionLayerFixture4x4<float>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(data4x4_precommit, framework::dataset::make("DataType",
+                                                                                                                   DataType::F32)),
+                                                                                                                   data_layouts_dataset),
+                                                                                                                   add_bias_dataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
 FIXTURE_DATA_TEST_CASE(Run, NEDeconvolutionLayerFixture4x4<float>, framework::DatasetMode::NIGHTLY, combine(combine(combine(data4x4, framework::dataset::make("DataType", DataType::F32)),
                                                                                                                     data_layouts_dataset),
                                                                                                             add_bias_dataset))
@@ -400,6 +429,16 @@ TEST_SUITE(Quantized)
 TEST_SUITE(QASYMM8)
 
 TEST_SUITE(W4x4)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEDeconvolutionLayerQuantizedFixture4x4<uint8_t>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(combine(combine(data4x4_precommit,
+                       framework::dataset::make("DataType", DataType::QASYMM8)),
+                       data_layouts_dataset),
+                       input_qinfo_dataset),
+                       output_qinfo_dataset),
+                       add_bias_dataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_quantized, tolerance_num_quant);
+}
 FIXTURE_DATA_TEST_CASE(Run, NEDeconvolutionLayerQuantizedFixture4x4<uint8_t>, framework::DatasetMode::NIGHTLY, combine(combine(combine(combine(combine(data4x4, framework::dataset::make("DataType",
                                                                                                                        DataType::QASYMM8)),
                                                                                                                        data_layouts_dataset),
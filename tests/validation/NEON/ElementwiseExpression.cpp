@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/ElementwiseExpressionInfo.h"
+#include "arm_compute/runtime/NEON/functions/NEElementwiseExpression.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/ElementwiseExpressionFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+RelativeTolerance<float>            rel_tolerance_f32(0.001f);      /**< Relative tolerance for FP32 types */
+constexpr AbsoluteTolerance<float>  abs_tolerance_f32(0.0001f);     /**< Absolute tolerance for FP32 types */
+RelativeTolerance<half_float::half> rel_tolerance_f16(half(0.01f)); /**< Relative tolerance for FP16 types */
+constexpr float                     abs_tolerance_f16 = 0.01f;      /**< Absolute tolerance for FP16 types */
+
+using Op = ElementwiseExpressionOp;
+
+/** gelu(a * b + c), the tail of a feed-forward block */
+ElementwiseExpressionInfo residual_gelu_expression()
+{
+    ElementwiseExpressionInfo info(3);
+    const auto                mul = info.binary(Op::MUL, info.input(0), info.input(1));
+    const auto                add = info.binary(Op::ADD, mul, info.input(2));
+    info.activation(add, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::GELU));
+    return info;
+}
+
+/** max(exp(-(a - b)^2 / c), c^a), every binary operation once */
+ElementwiseExpressionInfo binary_expression()
+{
+    ElementwiseExpressionInfo info(3);
+    const auto                diff = info.binary(Op::SQUARED_DIFF, info.input(0), info.input(1));
+    const auto                div  = info.binary(Op::DIV, diff, info.input(2));
+    const auto                exp  = info.unary(Op::EXP, info.unary(Op::NEG, div));
+    const auto                pow  = info.binary(Op::POWER, info.input(2), info.input(0));
+    info.binary(Op::MAX, exp, info.binary(Op::SUB, pow, info.input(1)));
+    return info;
+}
+
+/** |sin(tanh(a) * logistic(a) - rsqrt(c) + min(log(c), b))| clamped to 0.5, with operands read more than once */
+ElementwiseExpressionInfo unary_expression()
+{
+    using ActFunction = ActivationLayerInfo::ActivationFunction;
+
+    ElementwiseExpressionInfo info(3);
+    const auto tanh     = info.activation(info.input(0), ActivationLayerInfo(ActFunction::TANH, 1.f, 1.f));
+    const auto logistic = info.activation(info.input(0), ActivationLayerInfo(ActFunction::LOGISTIC));
+    const auto sub      = info.binary(Op::SUB, info.binary(Op::MUL, tanh, logistic), info.unary(Op::RSQRT, info.input(2)));
+    const auto min      = info.binary(Op::MIN, info.unary(Op::LOG, info.input(2)), info.input(1));
+    const auto abs      = info.unary(Op::ABS, info.unary(Op::SIN, info.binary(Op::ADD, sub, min)));
+    info.activation(abs, ActivationLayerInfo(ActFunction::BOUNDED_RELU, 0.5f));
+    return info;
+}
+
+const auto ExpressionDataset = framework::dataset::make("Expression", { residual_gelu_expression(), binary_expression(), unary_expression() });
+
+/** Same shapes with a scalar tail, rows and columns broadcast, scalar inputs and rows spanning several blocks */
+const auto ShapesDataset = zip(framework::dataset::make("Shape0", { TensorShape(27U, 13U, 2U), TensorShape(64U, 8U, 3U), TensorShape(5U, 7U), TensorShape(133U, 2U) }),
+                               framework::dataset::make("Shape1", { TensorShape(27U, 13U, 2U), TensorShape(64U, 1U, 1U), TensorShape(1U), TensorShape(133U, 2U) }),
+                               framework::dataset::make("Shape2", { TensorShape(27U, 13U, 2U), TensorShape(1U, 8U, 3U), TensorShape(5U, 1U), TensorShape(1U, 2U) }));
+
+const auto ElementwiseExpressionDataset = combine(ShapesDataset, ExpressionDataset);
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(ElementwiseExpression)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+    framework::dataset::make("Input0Info", { TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),
+                                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32), // Broadcasting
+                                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32), // Cast
+                                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32), // Mismatching input types
+                                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::S32), // Unsupported type
+                                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32), // Inputs not broadcast compatible
+                                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32), // Wrong output shape
+                                           }),
+    framework::dataset::make("Input1Info", { TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),
+                                             TensorInfo(TensorShape(1U, 13U, 1U), 1, DataType::F32),
+                                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),
+                                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F16),
+                                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::S32),
+                                             TensorInfo(TensorShape(26U, 13U, 2U), 1, DataType::F32),
+                                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),
+                                           }),
+    framework::dataset::make("OutputInfo", { TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),
+                                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),
+                                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F16),
+                                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),
+                                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::S32),
+                                             TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),
+                                             TensorInfo(TensorShape(27U, 13U, 1U), 1, DataType::F32),
+                                           }),
+    framework::dataset::make("Expected", { true, true, true, false, false, false, false })),
+    input0_info, input1_info, output_info, expected)
+{
+    ElementwiseExpressionInfo info(2);
+    info.activation(info.binary(Op::ADD, info.input(0), info.input(1)), ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+
+    TensorInfo in0 = input0_info;
+    TensorInfo in1 = input1_info;
+    TensorInfo out = output_info;
+    in0.set_is_resizable(false);
+    in1.set_is_resizable(false);
+    out.set_is_resizable(false);
+
+    bool is_valid = bool(NEElementwiseExpression::validate({ &in0, &in1 }, &out, info));
+    ARM_COMPUTE_EXPECT(is_valid == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+TEST_CASE(ValidateExpression, framework::DatasetMode::ALL)
+{
+    const TensorInfo src_info(TensorShape(27U, 13U, 2U), 1, DataType::F32);
+    const TensorInfo dst_info(TensorShape(27U, 13U, 2U), 1, DataType::F32);
+
+    // A valid expression
+    ElementwiseExpressionInfo valid(2);
+    valid.binary(Op::MUL, valid.input(0), valid.input(1));
+    ARM_COMPUTE_EXPECT(bool(NEElementwiseExpression::validate({ &src_info, &src_info }, &dst_info, valid)), framework::LogLevel::ERRORS);
+
+    // Number of inputs different from the one of the expression
+    ARM_COMPUTE_EXPECT(!bool(NEElementwiseExpression::validate({ &src_info }, &dst_info, valid)), framework::LogLevel::ERRORS);
+
+    // Empty expression
+    ARM_COMPUTE_EXPECT(!bool(NEElementwiseExpression::validate({ &src_info, &src_info }, &dst_info, ElementwiseExpressionInfo(2))), framework::LogLevel::ERRORS);
+
+    // Operand not computed yet
+    ElementwiseExpressionInfo forward(2);
+    forward.binary(Op::ADD, forward.input(0), 3U);
+    forward.unary(Op::EXP, forward.input(0));
+    ARM_COMPUTE_EXPECT(!bool(NEElementwiseExpression::validate({ &src_info, &src_info }, &dst_info, forward)), framework::LogLevel::ERRORS);
+
+    // Unary operand out of range
+    ElementwiseExpressionInfo unary(2);
+    unary.unary(Op::EXP, 2U);
+    ARM_COMPUTE_EXPECT(!bool(NEElementwiseExpression::validate({ &src_info, &src_info }, &dst_info, unary)), framework::LogLevel::ERRORS);
+
+    // Too many nodes
+    ElementwiseExpressionInfo large(2);
+    auto                      value = large.input(0);
+    for(unsigned int i = 0; i <= elementwise_expression_max_nodes; ++i)
+    {
+        value = large.binary(Op::ADD, value, large.input(1));
+    }
+    ARM_COMPUTE_EXPECT(!bool(NEElementwiseExpression::validate({ &src_info, &src_info }, &dst_info, large)), framework::LogLevel::ERRORS);
+}
+
+template <typename T>
+using NEElementwiseExpressionFixture = ElementwiseExpressionValidationFixture<Tensor, Accessor, NEElementwiseExpression, T, T>;
+#ifdef ARM_COMPUTE_ENABLE_FP16
+using NEElementwiseExpressionToF32Fixture = ElementwiseExpressionValidationFixture<Tensor, Accessor, NEElementwiseExpression, half, float>;
+using NEElementwiseExpressionToF16Fixture = ElementwiseExpressionValidationFixture<Tensor, Accessor, NEElementwiseExpression, float, half>;
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEElementwiseExpressionFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(ElementwiseExpressionDataset,
+                               framework::dataset::make("SrcDataType", DataType::F32),
+                               framework::dataset::make("DstDataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEElementwiseExpressionFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(ElementwiseExpressionDataset,
+                               framework::dataset::make("SrcDataType", DataType::F16),
+                               framework::dataset::make("DstDataType", DataType::F16)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, rel_tolerance_f16, 0.f, abs_tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+FIXTURE_DATA_TEST_CASE(RunCastToF32, NEElementwiseExpressionToF32Fixture, framework::DatasetMode::PRECOMMIT,
+                       combine(ElementwiseExpressionDataset,
+                               framework::dataset::make("SrcDataType", DataType::F16),
+                               framework::dataset::make("DstDataType", DataType::F32)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+FIXTURE_DATA_TEST_CASE(RunCastToF16, NEElementwiseExpressionToF16Fixture, framework::DatasetMode::PRECOMMIT,
+                       combine(ElementwiseExpressionDataset,
+                               framework::dataset::make("SrcDataType", DataType::F32),
+                               framework::dataset::make("DstDataType", DataType::F16)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, rel_tolerance_f16, 0.f, abs_tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           /* ARM_COMPUTE_ENABLE_FP16 */
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // ElementwiseExpression
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
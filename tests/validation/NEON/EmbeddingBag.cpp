@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/EmbeddingBagInfo.h"
+#include "arm_compute/runtime/NEON/functions/NEEmbeddingBag.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/EmbeddingBagFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+RelativeTolerance<float>            rel_tolerance_f32(0.001f);      /**< Relative tolerance for FP32 types */
+constexpr AbsoluteTolerance<float>  abs_tolerance_f32(0.0001f);     /**< Absolute tolerance for FP32 types */
+RelativeTolerance<half_float::half> rel_tolerance_f16(half(0.01f)); /**< Relative tolerance for FP16 types */
+constexpr float                     abs_tolerance_f16 = 0.01f;      /**< Absolute tolerance for FP16 types */
+
+/** Embedding sizes with and without a vector tail, small and large tables, more or fewer bags than indices */
+const auto EmbeddingBagShapesDataset = zip(framework::dataset::make("EmbeddingDim", { 64U, 38U, 130U }),
+                                           framework::dataset::make("NumRows", { 1000U, 50U, 17U }),
+                                           framework::dataset::make("NumIndices", { 40U, 7U, 64U }),
+                                           framework::dataset::make("NumBags", { 8U, 3U, 1U }));
+
+const auto EmbeddingBagDataset = combine(EmbeddingBagShapesDataset,
+                                         framework::dataset::make("Mode", { EmbeddingBagMode::NONE, EmbeddingBagMode::SUM, EmbeddingBagMode::MEAN }));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(EmbeddingBag)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+    framework::dataset::make("TableInfo", { TensorInfo(TensorShape(16U, 100U), 1, DataType::F32),
+                                            TensorInfo(TensorShape(16U, 100U), 1, DataType::S8),
+                                            TensorInfo(TensorShape(8U, 100U), 1, DataType::U8),
+                                            TensorInfo(TensorShape(16U, 100U), 1, DataType::S8),  // Missing row parameters
+                                            TensorInfo(TensorShape(16U, 100U), 1, DataType::F32), // Missing offsets
+                                            TensorInfo(TensorShape(16U, 100U), 1, DataType::F32), // Mismatching output type
+                                            TensorInfo(TensorShape(16U, 100U), 1, DataType::F32), // Mismatching output shape
+                                            TensorInfo(TensorShape(16U, 100U), 1, DataType::S32), // Unsupported type
+                                          }),
+    framework::dataset::make("HasRowParams", { false, true, true, false, false, false, false, false }),
+    framework::dataset::make("HasOffsets", { true, true, true, true, false, true, true, true }),
+    framework::dataset::make("DstInfo", { TensorInfo(TensorShape(16U, 4U), 1, DataType::F32),
+                                          TensorInfo(TensorShape(16U, 4U), 1, DataType::F32),
+                                          TensorInfo(TensorShape(16U, 4U), 1, DataType::F32),
+                                          TensorInfo(TensorShape(16U, 4U), 1, DataType::F32),
+                                          TensorInfo(TensorShape(16U, 4U), 1, DataType::F32),
+                                          TensorInfo(TensorShape(16U, 4U), 1, DataType::F16),
+                                          TensorInfo(TensorShape(16U, 10U), 1, DataType::F32),
+                                          TensorInfo(TensorShape(16U, 4U), 1, DataType::S32),
+                                        }),
+    framework::dataset::make("Expected", { true, true, true, false, false, false, false, false })),
+    table_info, has_row_params, has_offsets, dst_info, expected)
+{
+    const TensorInfo row_params_info(TensorShape(2U, 100U), 1, DataType::F32);
+    const TensorInfo indices_info(TensorShape(10U), 1, DataType::S32);
+    const TensorInfo offsets_info(TensorShape(4U), 1, DataType::S32);
+
+    bool is_valid = bool(NEEmbeddingBag::validate(&table_info.clone()->set_is_resizable(false),
+                                                  has_row_params ? &row_params_info : nullptr,
+                                                  &indices_info,
+                                                  has_offsets ? &offsets_info : nullptr,
+                                                  &dst_info.clone()->set_is_resizable(false),
+                                                  EmbeddingBagInfo(EmbeddingBagMode::SUM)));
+    ARM_COMPUTE_EXPECT(is_valid == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEEmbeddingBagFixture = EmbeddingBagValidationFixture<Tensor, Accessor, NEEmbeddingBag, T, T>;
+template <typename T>
+using NEEmbeddingBagQuantizedFixture = EmbeddingBagValidationFixture<Tensor, Accessor, NEEmbeddingBag, T, float>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEEmbeddingBagFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(EmbeddingBagDataset,
+                               framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEEmbeddingBagFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(EmbeddingBagDataset,
+                               framework::dataset::make("DataType", DataType::F16)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, rel_tolerance_f16, 0.f, abs_tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           /* ARM_COMPUTE_ENABLE_FP16 */
+TEST_SUITE_END() // Float
+
+TEST_SUITE(Quantized)
+TEST_SUITE(Int8)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEEmbeddingBagQuantizedFixture<int8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(EmbeddingBagDataset,
+                               framework::dataset::make("DataType", DataType::S8)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // Int8
+
+TEST_SUITE(Int4)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEEmbeddingBagQuantizedFixture<uint8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(EmbeddingBagDataset,
+                               framework::dataset::make("DataType", DataType::U8)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // Int4
+TEST_SUITE_END() // Quantized
+
+TEST_SUITE_END() // EmbeddingBag
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
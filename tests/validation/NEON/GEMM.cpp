@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -426,6 +426,21 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMFixture<half>, framework::DatasetMode::PR
     }
 
 }
+FIXTURE_DATA_TEST_CASE(RunSkinny, NEGEMMFixture<half>, framework::DatasetMode::PRECOMMIT, combine(combine(datasets::SmallSkinnyGEMMDataset(),
+                                                                                                          make("ReshapeWeights", { true, false })),
+                                                                                                  make("DataType", DataType::F16)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
 FIXTURE_DATA_TEST_CASE(RunLarge, NEGEMMFixture<half>, framework::DatasetMode::NIGHTLY, combine(combine(datasets::LargeGEMMDataset(),
                                                                                                        make("ReshapeWeights", { true, false })),
                                                                                                make("DataType", DataType::F16)))
@@ -471,6 +486,13 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMFixture<float>, framework::DatasetMode::P
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f);
 }
+FIXTURE_DATA_TEST_CASE(RunSkinny, NEGEMMFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(datasets::SmallSkinnyGEMMDataset(),
+                                                                                                           make("ReshapeWeights", { true, false })),
+                                                                                                   make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f);
+}
 FIXTURE_DATA_TEST_CASE(RunLarge, NEGEMMFixture<float>, framework::DatasetMode::NIGHTLY, combine(combine(datasets::LargeGEMMDataset(),
                                                                                                         make("ReshapeWeights", { true, false })),
                                                                                                 make("DataType", DataType::F32)))
@@ -588,6 +610,29 @@ TEST_SUITE_END() // ACCUMULATE
 
 TEST_SUITE_END() // FP32
 
+#ifdef ARM_COMPUTE_ENABLE_BF16
+/* Note : BFLOAT16 inputs are multiplied into a F32 destination */
+constexpr AbsoluteTolerance<float> tolerance_bf16_f32(0.01f); /**< Tolerance value for comparing reference's output against implementation's output for BFLOAT16 inputs */
+TEST_SUITE(BF16)
+using NEGEMMBF16Fixture = GEMMBF16ValidationFixture<Tensor, Accessor, NEGEMM, true>;
+// Run twice with several threads, so that the reduction counters of the K splits are reset between the runs
+FIXTURE_DATA_TEST_CASE(RunSkinny, NEGEMMBF16Fixture, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallSkinnyGEMMDataset(),
+                                                                                               make("NumThreads", { 1U, 4U })))
+{
+    if(CPUInfo::get().has_bf16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_bf16_f32);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support bf16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // BF16
+#endif /* ARM_COMPUTE_ENABLE_BF16 */
+
 TEST_SUITE_END() // Float
 TEST_SUITE_END() // GEMM
 TEST_SUITE_END() // NEON
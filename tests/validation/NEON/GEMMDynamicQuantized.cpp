@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMDynamicQuantized.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/GEMMDynamicQuantizedFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+RelativeTolerance<float>            rel_tolerance_f32(0.001f);      /**< Relative tolerance for FP32 types */
+constexpr AbsoluteTolerance<float>  abs_tolerance_f32(0.0001f);     /**< Absolute tolerance for FP32 types */
+RelativeTolerance<half_float::half> rel_tolerance_f16(half(0.01f)); /**< Relative tolerance for FP16 types */
+constexpr float                     abs_tolerance_f16 = 0.01f;      /**< Absolute tolerance for FP16 types */
+constexpr float                     tolerance_num     = 0.01f;      /**< Tolerance number for FP16 types */
+
+/** K not multiple of the 16-element chunks, row counts not multiple of the row tile, N not multiple of the blocks */
+const auto ShapesDataset = combine(framework::dataset::make("AShape", { TensorShape(7U, 1U), TensorShape(45U, 3U), TensorShape(128U, 5U, 2U) }),
+                                   framework::dataset::make("N", { 1U, 16U, 35U }));
+
+const auto ActivationsDataset = framework::dataset::make("ActivationInfo", { ActivationLayerInfo(),
+                                                                             ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+                                                                             ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 0.5f)
+                                                                           });
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(GEMMDynamicQuantized)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+    framework::dataset::make("AInfo", { TensorInfo(TensorShape(64U, 3U), 1, DataType::F32),
+                                        TensorInfo(TensorShape(64U, 3U), 1, DataType::F32),
+                                        TensorInfo(TensorShape(64U, 3U), 1, DataType::QASYMM8_SIGNED), // Quantized input
+                                        TensorInfo(TensorShape(64U, 3U), 1, DataType::F32),            // Mismatching K
+                                        TensorInfo(TensorShape(64U, 3U), 1, DataType::F32),            // Unsupported weights type
+                                        TensorInfo(TensorShape(64U, 3U), 1, DataType::F32),            // Wrong number of scales
+                                        TensorInfo(TensorShape(64U, 3U), 1, DataType::F32),            // Mismatching output type
+                                      }),
+    framework::dataset::make("WeightsInfo", { TensorInfo(TensorShape(8U, 64U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(0.01f, 3)),
+                                              TensorInfo(TensorShape(8U, 64U), 1, DataType::QSYMM8_PER_CHANNEL, QuantizationInfo(std::vector<float>(8, 0.01f))),
+                                              TensorInfo(TensorShape(8U, 64U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(0.01f, 3)),
+                                              TensorInfo(TensorShape(8U, 32U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(0.01f, 3)),
+                                              TensorInfo(TensorShape(8U, 64U), 1, DataType::QASYMM8, QuantizationInfo(0.01f, 3)),
+                                              TensorInfo(TensorShape(8U, 64U), 1, DataType::QSYMM8_PER_CHANNEL, QuantizationInfo(std::vector<float>(4, 0.01f))),
+                                              TensorInfo(TensorShape(8U, 64U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(0.01f, 3)),
+                                            }),
+    framework::dataset::make("DstInfo", { TensorInfo(TensorShape(8U, 3U), 1, DataType::F32),
+                                          TensorInfo(TensorShape(8U, 3U), 1, DataType::F32),
+                                          TensorInfo(TensorShape(8U, 3U), 1, DataType::F32),
+                                          TensorInfo(TensorShape(8U, 3U), 1, DataType::F32),
+                                          TensorInfo(TensorShape(8U, 3U), 1, DataType::F32),
+                                          TensorInfo(TensorShape(8U, 3U), 1, DataType::F32),
+                                          TensorInfo(TensorShape(8U, 3U), 1, DataType::F16),
+                                        }),
+    framework::dataset::make("Expected", { true, true, false, false, false, false, false })),
+    a_info, weights_info, dst_info, expected)
+{
+    bool is_valid = bool(NEGEMMDynamicQuantized::validate(&a_info.clone()->set_is_resizable(false),
+                                                          &weights_info.clone()->set_is_resizable(false),
+                                                          nullptr,
+                                                          &dst_info.clone()->set_is_resizable(false)));
+    ARM_COMPUTE_EXPECT(is_valid == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEGEMMDynamicQuantizedFixture = GEMMDynamicQuantizedValidationFixture<Tensor, Accessor, NEGEMMDynamicQuantized, T>;
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMDynamicQuantizedFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(ShapesDataset,
+                               framework::dataset::make("PerChannel", { false, true }),
+                               framework::dataset::make("HasBias", { false, true }),
+                               ActivationsDataset,
+                               framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMDynamicQuantizedFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(ShapesDataset,
+                               framework::dataset::make("PerChannel", { false, true }),
+                               framework::dataset::make("HasBias", { false, true }),
+                               ActivationsDataset,
+                               framework::dataset::make("DataType", DataType::F16)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           /* ARM_COMPUTE_ENABLE_FP16 */
+
+TEST_SUITE_END() // GEMMDynamicQuantized
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
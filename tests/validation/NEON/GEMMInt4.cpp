@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMInt4.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/GEMMInt4Fixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+RelativeTolerance<float>            rel_tolerance_f32(0.001f);     /**< Relative tolerance for FP32 types */
+constexpr AbsoluteTolerance<float>  abs_tolerance_f32(0.001f);     /**< Absolute tolerance for FP32 types */
+RelativeTolerance<half_float::half> rel_tolerance_f16(half(0.1f)); /**< Relative tolerance for FP16 types */
+constexpr float                     abs_tolerance_f16 = 0.05f;     /**< Absolute tolerance for FP16 types */
+constexpr float                     tolerance_num     = 0.01f;     /**< Tolerance number for FP16 types */
+
+/** K not multiple of the 32-element chunks, single rows and batched rows, N not multiple of the 4-channel blocks */
+const auto ShapesDataset = combine(framework::dataset::make("AShape", { TensorShape(45U, 1U), TensorShape(100U, 3U), TensorShape(256U, 3U, 2U) }),
+                                   framework::dataset::make("N", { 5U, 16U, 33U }));
+
+const auto GroupsDataset = framework::dataset::make("GroupSize", { 0U, 32U, 64U });
+
+const auto ActivationsDataset = framework::dataset::make("ActivationInfo", { ActivationLayerInfo(),
+                                                                             ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+                                                                             ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 0.5f, -0.5f)
+                                                                           });
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(GEMMInt4)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+    framework::dataset::make("AInfo", { TensorInfo(TensorShape(64U, 3U), 1, DataType::F32),
+                                        TensorInfo(TensorShape(64U, 3U), 1, DataType::F32),            // Group size not multiple of 32
+                                        TensorInfo(TensorShape(64U, 3U), 1, DataType::F32),            // Mismatching packed K
+                                        TensorInfo(TensorShape(64U, 3U), 1, DataType::F32),            // Wrong number of groups
+                                        TensorInfo(TensorShape(64U, 3U), 1, DataType::QASYMM8_SIGNED), // Quantized input with quantized output
+                                        TensorInfo(TensorShape(64U, 3U), 1, DataType::QASYMM8),        // Unsupported input type
+                                      }),
+    framework::dataset::make("WeightsInfo", { TensorInfo(TensorShape(32U, 8U), 1, DataType::U8),
+                                              TensorInfo(TensorShape(32U, 8U), 1, DataType::U8),
+                                              TensorInfo(TensorShape(64U, 8U), 1, DataType::U8),
+                                              TensorInfo(TensorShape(32U, 8U), 1, DataType::U8),
+                                              TensorInfo(TensorShape(32U, 8U), 1, DataType::U8),
+                                              TensorInfo(TensorShape(32U, 8U), 1, DataType::U8),
+                                            }),
+    framework::dataset::make("ScalesInfo", { TensorInfo(TensorShape(2U, 8U), 1, DataType::F32),
+                                             TensorInfo(TensorShape(4U, 8U), 1, DataType::F32),
+                                             TensorInfo(TensorShape(2U, 8U), 1, DataType::F32),
+                                             TensorInfo(TensorShape(1U, 8U), 1, DataType::F32),
+                                             TensorInfo(TensorShape(2U, 8U), 1, DataType::F32),
+                                             TensorInfo(TensorShape(2U, 8U), 1, DataType::F32),
+                                           }),
+    framework::dataset::make("DstInfo", { TensorInfo(TensorShape(8U, 3U), 1, DataType::F32),
+                                          TensorInfo(TensorShape(8U, 3U), 1, DataType::F32),
+                                          TensorInfo(TensorShape(8U, 3U), 1, DataType::F32),
+                                          TensorInfo(TensorShape(8U, 3U), 1, DataType::F32),
+                                          TensorInfo(TensorShape(8U, 3U), 1, DataType::QASYMM8_SIGNED),
+                                          TensorInfo(TensorShape(8U, 3U), 1, DataType::F32),
+                                        }),
+    framework::dataset::make("GroupSize", { 32U, 16U, 32U, 32U, 32U, 32U }),
+    framework::dataset::make("Expected", { true, false, false, false, false, false })),
+    a_info, weights_info, scales_info, dst_info, group_size, expected)
+{
+    bool is_valid = bool(NEGEMMInt4::validate(&a_info.clone()->set_is_resizable(false),
+                                              &weights_info.clone()->set_is_resizable(false),
+                                              &scales_info.clone()->set_is_resizable(false),
+                                              nullptr,
+                                              &dst_info.clone()->set_is_resizable(false),
+                                              GEMMInt4Info(group_size)));
+    ARM_COMPUTE_EXPECT(is_valid == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEGEMMInt4Fixture          = GEMMInt4ValidationFixture<Tensor, Accessor, NEGEMMInt4, T, T>;
+using NEGEMMInt4QuantizedFixture = GEMMInt4ValidationFixture<Tensor, Accessor, NEGEMMInt4, int8_t, float>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMInt4Fixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(ShapesDataset,
+                               GroupsDataset,
+                               framework::dataset::make("HasBias", { false, true }),
+                               ActivationsDataset,
+                               framework::dataset::make("DataType", DataType::F32),
+                               framework::dataset::make("QuantizationInfo", QuantizationInfo())))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMInt4Fixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(ShapesDataset,
+                               GroupsDataset,
+                               framework::dataset::make("HasBias", { false, true }),
+                               ActivationsDataset,
+                               framework::dataset::make("DataType", DataType::F16),
+                               framework::dataset::make("QuantizationInfo", QuantizationInfo())))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           /* ARM_COMPUTE_ENABLE_FP16 */
+TEST_SUITE_END() // Float
+
+TEST_SUITE(Quantized)
+TEST_SUITE(QASYMM8_SIGNED)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMInt4QuantizedFixture, framework::DatasetMode::PRECOMMIT,
+                       combine(ShapesDataset,
+                               GroupsDataset,
+                               framework::dataset::make("HasBias", { false, true }),
+                               ActivationsDataset,
+                               framework::dataset::make("DataType", DataType::QASYMM8_SIGNED),
+                               framework::dataset::make("QuantizationInfo", QuantizationInfo(0.05f, 3))))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // QASYMM8_SIGNED
+TEST_SUITE_END() // Quantized
+
+TEST_SUITE_END() // GEMMInt4
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -298,6 +298,18 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEGEMMLowpMatrixMultiplyCoreFixture, framework:
     validate(Accessor(_target), _reference);
 }
 
+TEST_SUITE(QASYMM8_SIGNED)
+using NEGEMMLowpMatrixMultiplyCoreSignedFixture = GEMMLowpMatrixMultiplyCoreSignedValidationFixture<Tensor, Accessor, NEGEMMLowpMatrixMultiplyCore, true>;
+// Run twice with several threads, so that the reduction counters of the K splits are reset between the runs
+FIXTURE_DATA_TEST_CASE(RunSkinny, NEGEMMLowpMatrixMultiplyCoreSignedFixture, framework::DatasetMode::ALL,
+    combine(datasets::SmallSkinnyGEMMLowpDataset(),
+        make("NumThreads", { 1U, 4U })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+}
+TEST_SUITE_END() // QASYMM8_SIGNED
+
 TEST_SUITE(BatchedMatMul)
 TEST_SUITE(QASYMM8)
 using NEGEMMLowpMatrixMultiplyCoreFusedOffsetOutputFixtureBatchedUnsigned =
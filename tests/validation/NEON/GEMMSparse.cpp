@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMSparse.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/GEMMSparseFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+RelativeTolerance<float>            rel_tolerance_f32(0.001f);      /**< Relative tolerance for FP32 types */
+constexpr AbsoluteTolerance<float>  abs_tolerance_f32(0.0001f);     /**< Absolute tolerance for FP32 types */
+RelativeTolerance<half_float::half> rel_tolerance_f16(half(0.01f)); /**< Relative tolerance for FP16 types */
+constexpr float                     abs_tolerance_f16 = 0.01f;      /**< Absolute tolerance for FP16 types */
+constexpr float                     tolerance_num     = 0.01f;      /**< Tolerance number for FP16 types */
+
+/** K not multiple of the groups of 4 nor of the 32-element chunks, N not multiple of the vector length */
+const auto ShapesDataset = combine(framework::dataset::make("AShape", { TensorShape(7U, 1U), TensorShape(45U, 3U), TensorShape(128U, 5U, 2U) }),
+                                   framework::dataset::make("N", { 1U, 16U, 35U }));
+
+const auto ActivationsDataset = framework::dataset::make("ActivationInfo", { ActivationLayerInfo(),
+                                                                             ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+                                                                             ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 0.5f)
+                                                                           });
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(GEMMSparse)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+    framework::dataset::make("AInfo", { TensorInfo(TensorShape(64U, 3U), 1, DataType::F32),
+                                        TensorInfo(TensorShape(64U, 3U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(0.05f, 3)),
+                                        TensorInfo(TensorShape(64U, 3U), 1, DataType::F32),                                        // Mismatching weights type
+                                        TensorInfo(TensorShape(64U, 3U), 1, DataType::F32),                                        // Mismatching K
+                                        TensorInfo(TensorShape(64U, 3U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(0.05f, 3)), // Asymmetric weights
+                                        TensorInfo(TensorShape(64U, 3U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(0.05f, 3)), // Mismatching output type
+                                        TensorInfo(TensorShape(64U, 3U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(0.05f, 3)), // Unsupported activation
+                                      }),
+    framework::dataset::make("WeightsInfo", { TensorInfo(TensorShape(8U, 64U), 1, DataType::F32),
+                                              TensorInfo(TensorShape(8U, 64U), 1, DataType::QSYMM8_PER_CHANNEL, QuantizationInfo(std::vector<float>(8, 0.01f))),
+                                              TensorInfo(TensorShape(8U, 64U), 1, DataType::F16),
+                                              TensorInfo(TensorShape(8U, 32U), 1, DataType::F32),
+                                              TensorInfo(TensorShape(8U, 64U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(0.01f, 3)),
+                                              TensorInfo(TensorShape(8U, 64U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(0.01f, 0)),
+                                              TensorInfo(TensorShape(8U, 64U), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(0.01f, 0)),
+                                            }),
+    framework::dataset::make("DstInfo", { TensorInfo(TensorShape(8U, 3U), 1, DataType::F32),
+                                          TensorInfo(TensorShape(8U, 3U), 1, DataType::S32),
+                                          TensorInfo(TensorShape(8U, 3U), 1, DataType::F32),
+                                          TensorInfo(TensorShape(8U, 3U), 1, DataType::F32),
+                                          TensorInfo(TensorShape(8U, 3U), 1, DataType::S32),
+                                          TensorInfo(TensorShape(8U, 3U), 1, DataType::QASYMM8_SIGNED),
+                                          TensorInfo(TensorShape(8U, 3U), 1, DataType::S32),
+                                        }),
+    framework::dataset::make("ActivationInfo", { ActivationLayerInfo(),
+                                                 ActivationLayerInfo(),
+                                                 ActivationLayerInfo(),
+                                                 ActivationLayerInfo(),
+                                                 ActivationLayerInfo(),
+                                                 ActivationLayerInfo(),
+                                                 ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+                                               }),
+    framework::dataset::make("Expected", { true, true, false, false, false, false, false })),
+    a_info, weights_info, dst_info, act_info, expected)
+{
+    bool is_valid = bool(NEGEMMSparse::validate(&a_info.clone()->set_is_resizable(false),
+                                                &weights_info.clone()->set_is_resizable(false),
+                                                nullptr,
+                                                &dst_info.clone()->set_is_resizable(false),
+                                                act_info));
+    ARM_COMPUTE_EXPECT(is_valid == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+TEST_CASE(Is24Sparse, framework::DatasetMode::ALL)
+{
+    Tensor weights = create_tensor<Tensor>(TensorShape(3U, 10U), DataType::F32);
+    weights.allocator()->allocate();
+
+    // Dense weights
+    Accessor accessor(weights);
+    for(int k = 0; k < 10; ++k)
+    {
+        for(int x = 0; x < 3; ++x)
+        {
+            *reinterpret_cast<float *>(accessor(Coordinates(x, k))) = 1.f;
+        }
+    }
+    ARM_COMPUTE_EXPECT(!NEGEMMSparse::is_2_4_sparse(&weights), framework::LogLevel::ERRORS);
+
+    // Two non-zeros in every group of 4, including the last partial group
+    for(int k = 0; k < 10; ++k)
+    {
+        for(int x = 0; x < 3; ++x)
+        {
+            *reinterpret_cast<float *>(accessor(Coordinates(x, k))) = ((k + x) % 4 < 2) ? 1.f : 0.f;
+        }
+    }
+    ARM_COMPUTE_EXPECT(NEGEMMSparse::is_2_4_sparse(&weights), framework::LogLevel::ERRORS);
+
+    // Three non-zeros in a single group
+    *reinterpret_cast<float *>(accessor(Coordinates(1, 6))) = 1.f;
+    *reinterpret_cast<float *>(accessor(Coordinates(1, 7))) = 1.f;
+    ARM_COMPUTE_EXPECT(!NEGEMMSparse::is_2_4_sparse(&weights), framework::LogLevel::ERRORS);
+}
+
+template <typename T>
+using NEGEMMSparseFixture = GEMMSparseValidationFixture<Tensor, Accessor, NEGEMMSparse, T, T>;
+using NEGEMMSparseQuantizedFixture = GEMMSparseValidationFixture<Tensor, Accessor, NEGEMMSparse, int8_t, int32_t>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMSparseFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(ShapesDataset,
+                               framework::dataset::make("HasBias", { false, true }),
+                               ActivationsDataset,
+                               framework::dataset::make("DataType", DataType::F32),
+                               framework::dataset::make("WeightsDataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMSparseFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(ShapesDataset,
+                               framework::dataset::make("HasBias", { false, true }),
+                               ActivationsDataset,
+                               framework::dataset::make("DataType", DataType::F16),
+                               framework::dataset::make("WeightsDataType", DataType::F16)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           /* ARM_COMPUTE_ENABLE_FP16 */
+TEST_SUITE_END() // Float
+
+TEST_SUITE(Quantized)
+TEST_SUITE(QASYMM8_SIGNED)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMSparseQuantizedFixture, framework::DatasetMode::PRECOMMIT,
+                       combine(ShapesDataset,
+                               framework::dataset::make("HasBias", { false, true }),
+                               framework::dataset::make("ActivationInfo", ActivationLayerInfo()),
+                               framework::dataset::make("DataType", DataType::QASYMM8_SIGNED),
+                               framework::dataset::make("WeightsDataType", { DataType::QASYMM8_SIGNED, DataType::QSYMM8_PER_CHANNEL })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+}
+TEST_SUITE_END() // QASYMM8_SIGNED
+TEST_SUITE_END() // Quantized
+
+TEST_SUITE_END() // GEMMSparse
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
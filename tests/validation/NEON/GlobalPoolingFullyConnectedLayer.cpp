@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEGlobalPoolingFullyConnectedLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/GlobalPoolingFullyConnectedLayerFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+const RelativeTolerance<float>            rel_tolerance_f32(0.01f);                /**< Relative tolerance for FP32 types */
+constexpr AbsoluteTolerance<float>        abs_tolerance_f32(0.001f);               /**< Absolute tolerance for FP32 types */
+const RelativeTolerance<half_float::half> rel_tolerance_f16(half_float::half(0.02f)); /**< Relative tolerance for FP16 types */
+constexpr float                           tolerance_num_f16 = 0.05f;               /**< Tolerance number for FP16 types */
+
+const auto InputShapes = framework::dataset::make("InputShape", { TensorShape(7U, 7U, 64U, 1U),
+                                                                  TensorShape(1U, 1U, 19U, 1U),
+                                                                  TensorShape(5U, 3U, 33U, 2U)
+                                                                });
+
+/** Output channels covering whole blocks and partial tail blocks */
+const auto NumOutputs = framework::dataset::make("NumOutputs", { 10U, 37U, 64U });
+
+const auto ActivationFunctionsDataset = framework::dataset::make("ActivationInfo",
+{
+    ActivationLayerInfo(),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f)
+});
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(GlobalPoolingFullyConnectedLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+    framework::dataset::make("InputInfo", { TensorInfo(TensorShape(16U, 7U, 7U), 1, DataType::F32, DataLayout::NHWC),
+                                            TensorInfo(TensorShape(7U, 7U, 16U), 1, DataType::F32, DataLayout::NCHW),    // NCHW not supported
+                                            TensorInfo(TensorShape(16U, 7U, 7U), 1, DataType::QASYMM8, DataLayout::NHWC), // Quantized not supported
+                                            TensorInfo(TensorShape(16U, 7U, 7U), 1, DataType::F32, DataLayout::NHWC),    // Mismatching weights
+                                            TensorInfo(TensorShape(16U, 7U, 7U), 1, DataType::F32, DataLayout::NHWC),    // Mismatching output shape
+                                            TensorInfo(TensorShape(16U, 7U, 7U), 1, DataType::F32, DataLayout::NHWC),    // Unsupported activation
+                                          }),
+    framework::dataset::make("WeightsInfo", { TensorInfo(TensorShape(16U, 10U), 1, DataType::F32),
+                                              TensorInfo(TensorShape(16U, 10U), 1, DataType::F32),
+                                              TensorInfo(TensorShape(16U, 10U), 1, DataType::QASYMM8),
+                                              TensorInfo(TensorShape(15U, 10U), 1, DataType::F32),
+                                              TensorInfo(TensorShape(16U, 10U), 1, DataType::F32),
+                                              TensorInfo(TensorShape(16U, 10U), 1, DataType::F32),
+                                            }),
+    framework::dataset::make("OutputInfo", { TensorInfo(TensorShape(10U), 1, DataType::F32),
+                                             TensorInfo(TensorShape(10U), 1, DataType::F32),
+                                             TensorInfo(TensorShape(10U), 1, DataType::QASYMM8),
+                                             TensorInfo(TensorShape(10U), 1, DataType::F32),
+                                             TensorInfo(TensorShape(11U), 1, DataType::F32),
+                                             TensorInfo(TensorShape(10U), 1, DataType::F32),
+                                           }),
+    framework::dataset::make("ActivationInfo", { ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+                                                 ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+                                                 ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+                                                 ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+                                                 ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+                                                 ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH),
+                                               }),
+    framework::dataset::make("Expected", { true, false, false, false, false, false })),
+    input_info, weights_info, output_info, act_info, expected)
+{
+    const TensorInfo bias_info(TensorShape(10U), 1, weights_info.data_type());
+
+    FullyConnectedLayerInfo fc_info;
+    fc_info.activation_info = act_info;
+
+    bool is_valid = bool(NEGlobalPoolingFullyConnectedLayer::validate(&input_info.clone()->set_is_resizable(false), &weights_info.clone()->set_is_resizable(false),
+                                                                      &bias_info, &output_info.clone()->set_is_resizable(false), fc_info));
+    ARM_COMPUTE_EXPECT(is_valid == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEGlobalPoolingFullyConnectedLayerFixture = GlobalPoolingFullyConnectedLayerValidationFixture<Tensor, Accessor, NEGlobalPoolingFullyConnectedLayer, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGlobalPoolingFullyConnectedLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(InputShapes,
+                               NumOutputs,
+                               framework::dataset::make("TransposeWeights", { true, false }),
+                               framework::dataset::make("DataType", DataType::F32),
+                               ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGlobalPoolingFullyConnectedLayerFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(InputShapes,
+                               NumOutputs,
+                               framework::dataset::make("TransposeWeights", { true, false }),
+                               framework::dataset::make("DataType", DataType::F16),
+                               ActivationFunctionsDataset))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           /* ARM_COMPUTE_ENABLE_FP16 */
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // GlobalPoolingFullyConnectedLayer
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEInvertedResidualLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/InvertedResidualLayerFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+const RelativeTolerance<float>            rel_tolerance_f32(0.01f);                /**< Relative tolerance for FP32 types */
+constexpr AbsoluteTolerance<float>        abs_tolerance_f32(0.002f);               /**< Absolute tolerance for FP32 types */
+const RelativeTolerance<half_float::half> rel_tolerance_f16(half_float::half(0.02f)); /**< Relative tolerance for FP16 types */
+constexpr float                           tolerance_num_f16 = 0.05f;               /**< Tolerance number for FP16 types */
+
+const auto InputShapes = framework::dataset::make("InputShape", { TensorShape(9U, 7U, 8U, 1U),
+                                                                  TensorShape(16U, 11U, 13U, 2U)
+                                                                });
+
+const auto ExpandedChannels = framework::dataset::make("ExpandedChannels", { 24U, 37U });
+
+/** Depthwise kernels with their padding and stride, including a strided block */
+const auto DepthwiseDataset = zip(framework::dataset::make("DepthwiseKernel", { Size2D(3U, 3U), Size2D(5U, 5U), Size2D(3U, 3U) }),
+                                  framework::dataset::make("DepthwiseInfo", { PadStrideInfo(1, 1, 1, 1), PadStrideInfo(1, 1, 2, 2), PadStrideInfo(2, 2, 0, 1, 0, 1, DimensionRoundingType::FLOOR) }));
+
+/** Residual blocks preserve the spatial size */
+const auto ResidualDepthwiseDataset = zip(framework::dataset::make("DepthwiseKernel", { Size2D(3U, 3U), Size2D(5U, 5U) }),
+                                          framework::dataset::make("DepthwiseInfo", { PadStrideInfo(1, 1, 1, 1), PadStrideInfo(1, 1, 2, 2) }));
+
+const auto ActivationFunctionsDataset = framework::dataset::make("ActivationInfo",
+{
+    ActivationLayerInfo(),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f)
+});
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(InvertedResidualLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+    framework::dataset::make("InputInfo", { TensorInfo(TensorShape(8U, 9U, 9U), 1, DataType::F32, DataLayout::NHWC),
+                                            TensorInfo(TensorShape(8U, 9U, 9U), 1, DataType::F32, DataLayout::NCHW),    // NCHW not supported
+                                            TensorInfo(TensorShape(8U, 9U, 9U), 1, DataType::QASYMM8, DataLayout::NHWC), // Quantized not supported
+                                            TensorInfo(TensorShape(8U, 9U, 9U), 1, DataType::F32, DataLayout::NHWC),    // Mismatching output shape
+                                            TensorInfo(TensorShape(8U, 9U, 9U), 1, DataType::F32, DataLayout::NHWC),    // Unsupported activation
+                                          }),
+    framework::dataset::make("OutputInfo", { TensorInfo(TensorShape(8U, 9U, 9U), 1, DataType::F32, DataLayout::NHWC),
+                                             TensorInfo(TensorShape(8U, 9U, 9U), 1, DataType::F32, DataLayout::NCHW),
+                                             TensorInfo(TensorShape(8U, 9U, 9U), 1, DataType::QASYMM8, DataLayout::NHWC),
+                                             TensorInfo(TensorShape(8U, 5U, 5U), 1, DataType::F32, DataLayout::NHWC),
+                                             TensorInfo(TensorShape(8U, 9U, 9U), 1, DataType::F32, DataLayout::NHWC),
+                                           }),
+    framework::dataset::make("ExpandActivation", { ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f),
+                                                   ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f),
+                                                   ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f),
+                                                   ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f),
+                                                   ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::HARD_SWISH),
+                                                 }),
+    framework::dataset::make("Expected", { true, false, false, false, false })),
+    input_info, output_info, expand_act, expected)
+{
+    const DataType   data_type = input_info.data_type();
+    const DataLayout layout    = input_info.data_layout();
+
+    const TensorInfo expand_w(TensorShape(8U, 1U, 1U, 24U), 1, data_type, layout);
+    const TensorInfo expand_b(TensorShape(24U), 1, data_type, layout);
+    const TensorInfo dw_w(TensorShape(24U, 3U, 3U), 1, data_type, layout);
+    const TensorInfo dw_b(TensorShape(24U), 1, data_type, layout);
+    const TensorInfo proj_w(TensorShape(24U, 1U, 1U, 8U), 1, data_type, layout);
+    const TensorInfo proj_b(TensorShape(8U), 1, data_type, layout);
+
+    const InvertedResidualLayerInfo info(PadStrideInfo(1, 1, 1, 1), expand_act, expand_act, ActivationLayerInfo(), true);
+
+    bool is_valid = bool(NEInvertedResidualLayer::validate(&input_info.clone()->set_is_resizable(false), &expand_w, &expand_b, &dw_w, &dw_b, &proj_w, &proj_b,
+                                                           &output_info.clone()->set_is_resizable(false), info));
+    ARM_COMPUTE_EXPECT(is_valid == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEInvertedResidualLayerFixture = InvertedResidualLayerValidationFixture<Tensor, Accessor, NEInvertedResidualLayer, T>;
+
+template <typename T>
+using NEInvertedResidualLayerResidualFixture = InvertedResidualLayerResidualValidationFixture<Tensor, Accessor, NEInvertedResidualLayer, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEInvertedResidualLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(InputShapes,
+                               ExpandedChannels,
+                               framework::dataset::make("OutputChannels", { 8U, 19U }),
+                               DepthwiseDataset,
+                               framework::dataset::make("DataType", DataType::F32),
+                               ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunSmallResidual, NEInvertedResidualLayerResidualFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(InputShapes,
+                               ExpandedChannels,
+                               ResidualDepthwiseDataset,
+                               framework::dataset::make("DataType", DataType::F32),
+                               ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEInvertedResidualLayerFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(InputShapes,
+                               ExpandedChannels,
+                               framework::dataset::make("OutputChannels", { 8U, 19U }),
+                               DepthwiseDataset,
+                               framework::dataset::make("DataType", DataType::F16),
+                               ActivationFunctionsDataset))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+FIXTURE_DATA_TEST_CASE(RunSmallResidual, NEInvertedResidualLayerResidualFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(InputShapes,
+                               ExpandedChannels,
+                               ResidualDepthwiseDataset,
+                               framework::dataset::make("DataType", DataType::F16),
+                               ActivationFunctionsDataset))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           /* ARM_COMPUTE_ENABLE_FP16 */
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // InvertedResidualLayer
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/KVCache.h"
+#include "arm_compute/runtime/NEON/functions/NEKVCacheAppend.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/KVCacheAppendFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr AbsoluteTolerance<int8_t> tolerance_qsymm8(1); /**< Tolerance for the rounding of the quantized cache */
+
+/** Head sizes below and above the 16-element vector loop, single and multiple heads and batches */
+const auto PrefillShapesDataset = framework::dataset::make("PrefillShape", { TensorShape(7U, 1U, 1U, 1U), TensorShape(64U, 5U, 3U, 1U), TensorShape(40U, 3U, 2U, 2U) });
+
+const auto CacheDataset = combine(PrefillShapesDataset,
+                                  framework::dataset::make("Capacity", 12U),
+                                  framework::dataset::make("DecodeSteps", { 0U, 4U }));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(KVCacheAppend)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+    framework::dataset::make("SrcInfo", { TensorInfo(TensorShape(64U, 4U, 2U), 1, DataType::F32),
+                                          TensorInfo(TensorShape(64U, 4U, 2U), 1, DataType::F32),
+                                          TensorInfo(TensorShape(64U, 4U, 2U), 1, DataType::F32), // Mismatching cache type
+                                          TensorInfo(TensorShape(64U, 4U, 2U), 1, DataType::F32), // Mismatching head size
+                                          TensorInfo(TensorShape(64U, 4U, 2U), 1, DataType::F32), // Mismatching number of heads
+                                          TensorInfo(TensorShape(64U, 20U, 2U), 1, DataType::F32), // Larger than the cache
+                                          TensorInfo(TensorShape(64U, 4U, 2U), 1, DataType::F32), // One scale for all heads
+                                          TensorInfo(TensorShape(64U, 4U, 2U), 1, DataType::S32), // Unsupported type
+                                        }),
+    framework::dataset::make("CacheInfo", { TensorInfo(TensorShape(64U, 16U, 2U), 1, DataType::F32),
+                                            TensorInfo(TensorShape(64U, 16U, 2U), 1, DataType::QSYMM8_PER_CHANNEL, QuantizationInfo(std::vector<float>{ 0.01f, 0.02f })),
+                                            TensorInfo(TensorShape(64U, 16U, 2U), 1, DataType::F16),
+                                            TensorInfo(TensorShape(32U, 16U, 2U), 1, DataType::F32),
+                                            TensorInfo(TensorShape(64U, 16U, 4U), 1, DataType::F32),
+                                            TensorInfo(TensorShape(64U, 16U, 2U), 1, DataType::F32),
+                                            TensorInfo(TensorShape(64U, 16U, 2U), 1, DataType::QSYMM8_PER_CHANNEL, QuantizationInfo(std::vector<float>{ 0.01f })),
+                                            TensorInfo(TensorShape(64U, 16U, 2U), 1, DataType::S32),
+                                          }),
+    framework::dataset::make("Expected", { true, true, false, false, false, false, false, false })),
+    src_info, cache_info, expected)
+{
+    bool is_valid = bool(NEKVCacheAppend::validate(&src_info.clone()->set_is_resizable(false),
+                                                   &cache_info.clone()->set_is_resizable(false)));
+    ARM_COMPUTE_EXPECT(is_valid == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+TEST_CASE(Views, framework::DatasetMode::ALL)
+{
+    KVCache cache;
+    cache.init(KVCacheInfo(8U, 6U, 2U));
+    cache.allocator()->allocate();
+
+    Tensor src = create_tensor<Tensor>(TensorShape(8U, 4U, 2U), DataType::F32);
+    src.allocator()->allocate();
+
+    NEKVCacheAppend append;
+    append.configure(&src, &cache);
+
+    append.run();
+    ARM_COMPUTE_EXPECT(cache.length() == 4U, framework::LogLevel::ERRORS);
+
+    // Views share the memory and the strides of the cache and are created once per length
+    ITensor *view = cache.view();
+    ARM_COMPUTE_EXPECT(view->info()->tensor_shape() == TensorShape(8U, 4U, 2U), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(view->info()->strides_in_bytes() == cache.tensor()->info()->strides_in_bytes(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(view->buffer() == cache.tensor()->buffer(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cache.view(4U) == view, framework::LogLevel::ERRORS);
+
+    // No room for another 4 tokens
+    ARM_COMPUTE_EXPECT_THROW(append.run(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cache.length() == 4U, framework::LogLevel::ERRORS);
+
+    cache.reset();
+    append.run();
+    ARM_COMPUTE_EXPECT(cache.length() == 4U, framework::LogLevel::ERRORS);
+}
+
+template <typename T>
+using NEKVCacheAppendFixture = KVCacheAppendValidationFixture<Tensor, Accessor, NEKVCacheAppend, T, T>;
+template <typename T>
+using NEKVCacheAppendQuantizedFixture = KVCacheAppendValidationFixture<Tensor, Accessor, NEKVCacheAppend, T, int8_t>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEKVCacheAppendFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(CacheDataset,
+                               framework::dataset::make("DataType", DataType::F32),
+                               framework::dataset::make("CacheDataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(*_cache.view()), _reference);
+}
+FIXTURE_DATA_TEST_CASE(RunQuantized, NEKVCacheAppendQuantizedFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(CacheDataset,
+                               framework::dataset::make("DataType", DataType::F32),
+                               framework::dataset::make("CacheDataType", DataType::QSYMM8_PER_CHANNEL)))
+{
+    // Validate output
+    validate(Accessor(*_cache.view()), _reference, tolerance_qsymm8);
+}
+TEST_SUITE_END() // FP32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEKVCacheAppendFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(CacheDataset,
+                               framework::dataset::make("DataType", DataType::F16),
+                               framework::dataset::make("CacheDataType", DataType::F16)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(*_cache.view()), _reference);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+FIXTURE_DATA_TEST_CASE(RunQuantized, NEKVCacheAppendQuantizedFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(CacheDataset,
+                               framework::dataset::make("DataType", DataType::F16),
+                               framework::dataset::make("CacheDataType", DataType::QSYMM8_PER_CHANNEL)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(*_cache.view()), _reference, tolerance_qsymm8);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           /* ARM_COMPUTE_ENABLE_FP16 */
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // KVCacheAppend
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Arm Limited.
+ * Copyright (c) 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -61,7 +61,7 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL,
         make("InputAInfo", {
             TensorInfo(TensorShape(9U, 6U), 1, DataType::F32),        // Mismatching datatype
             TensorInfo(TensorShape(9U, 6U), 1, DataType::S32),        // Unsupported datatypes
-            TensorInfo(TensorShape(9U, 6U, 2U), 1, DataType::F32),    // Broadcasting in batch dimension not supported
+            TensorInfo(TensorShape(9U, 6U, 2U), 1, DataType::F32),    // Broadcasting rhs in batch dimension
             TensorInfo(TensorShape(9U, 6U), 1, DataType::F32),        // Invalid shape for multiplication
             TensorInfo(TensorShape(9U, 6U), 1, DataType::F32),
             TensorInfo(TensorShape(9U, 6U , 12U) , 1 , DataType::F32),
@@ -69,6 +69,9 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL,
             TensorInfo(TensorShape(9U, 6U), 1, DataType::QASYMM8),
             TensorInfo(TensorShape(9U, 6U), 1, DataType::QASYMM8_SIGNED),
             TensorInfo(TensorShape(9U, 6U), 1, DataType::QASYMM8_SIGNED), // Mismatching data type
+            TensorInfo(TensorShape(9U, 6U, 8U, 2U), 1, DataType::F32),    // Grouped batches sharing rhs
+            TensorInfo(TensorShape(9U, 6U, 4U), 1, DataType::F32),        // Batch dimension of rhs not dividing lhs
+            TensorInfo(TensorShape(9U, 6U, 2U, 3U), 1, DataType::F32),    // Broadcasting in outer batch dimension
         }),
         make("InputBInfo", {
             TensorInfo(TensorShape(5U, 9U), 1, DataType::QASYMM8),
@@ -81,6 +84,9 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL,
             TensorInfo(TensorShape(5U, 9U), 1, DataType::QASYMM8),
             TensorInfo(TensorShape(5U, 9U), 1, DataType::QASYMM8_SIGNED),
             TensorInfo(TensorShape(5U, 9U), 1, DataType::QASYMM8_SIGNED),
+            TensorInfo(TensorShape(5U, 9U, 2U, 2U), 1, DataType::F32),
+            TensorInfo(TensorShape(5U, 9U, 3U), 1, DataType::F32),
+            TensorInfo(TensorShape(5U, 9U, 2U, 1U), 1, DataType::F32),
         }),
         make("OutputInfo", {
             TensorInfo(TensorShape(5U, 6U), 1, DataType::F32),
@@ -93,9 +99,12 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL,
             TensorInfo(TensorShape(5U, 6U), 1, DataType::QASYMM8),
             TensorInfo(TensorShape(5U, 6U), 1, DataType::QASYMM8_SIGNED),
             TensorInfo(TensorShape(5U, 6U), 1, DataType::QASYMM8),
+            TensorInfo(TensorShape(5U, 6U, 8U, 2U), 1, DataType::F32),
+            TensorInfo(TensorShape(5U, 6U, 4U), 1, DataType::F32),
+            TensorInfo(TensorShape(5U, 6U, 2U, 3U), 1, DataType::F32),
         }),
-        make("TensorIsConst", {false, false, false, false, false , false, true, false, false, false}),
-        make("Expected", { false, false, false, false, true, true, false, true, true, false })),
+        make("TensorIsConst", {false, false, false, false, false , false, true, false, false, false, false, false, false}),
+        make("Expected", { false, false, true, false, true, true, false, true, true, false, true, false, false })),
     a_info, b_info, output_info, are_tensors_const, expected)
 {
     TensorInfo a{a_info};
@@ -115,7 +124,7 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL,
         make("InputAInfo", {
             TensorInfo(TensorShape(9U, 6U), 1, DataType::F32),        // Mismatching datatype
             TensorInfo(TensorShape(9U, 6U), 1, DataType::S32),        // Unsupported datatypes
-            TensorInfo(TensorShape(9U, 6U, 2U), 1, DataType::F32),    // Broadcasting in batch dimension not supported
+            TensorInfo(TensorShape(9U, 6U, 2U), 1, DataType::F32),    // Broadcasting rhs in batch dimension
             TensorInfo(TensorShape(9U, 6U), 1, DataType::F32),        // Invalid shape for multiplication
             TensorInfo(TensorShape(9U, 6U), 1, DataType::F32),
             TensorInfo(TensorShape(9U, 6U , 12U) , 1 , DataType::F32),
@@ -123,6 +132,9 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL,
             TensorInfo(TensorShape(9U, 6U), 1, DataType::QASYMM8),
             TensorInfo(TensorShape(9U, 6U), 1, DataType::QASYMM8_SIGNED),
             TensorInfo(TensorShape(9U, 6U), 1, DataType::QASYMM8_SIGNED), // Mismatching data type
+            TensorInfo(TensorShape(9U, 6U, 8U, 2U), 1, DataType::F32),    // Grouped batches sharing rhs
+            TensorInfo(TensorShape(9U, 6U, 4U), 1, DataType::F32),        // Batch dimension of rhs not dividing lhs
+            TensorInfo(TensorShape(9U, 6U, 2U, 3U), 1, DataType::F32),    // Broadcasting in outer batch dimension
         }),
         make("InputBInfo", {
             TensorInfo(TensorShape(5U, 9U), 1, DataType::QASYMM8),
@@ -135,6 +147,9 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL,
             TensorInfo(TensorShape(5U, 9U), 1, DataType::QASYMM8), // MatMul of Qauntized Datatypes Not supported on armv7a
             TensorInfo(TensorShape(5U, 9U), 1, DataType::QASYMM8_SIGNED),
             TensorInfo(TensorShape(5U, 9U), 1, DataType::QASYMM8_SIGNED),
+            TensorInfo(TensorShape(5U, 9U, 2U, 2U), 1, DataType::F32),
+            TensorInfo(TensorShape(5U, 9U, 3U), 1, DataType::F32),
+            TensorInfo(TensorShape(5U, 9U, 2U, 1U), 1, DataType::F32),
         }),
         make("OutputInfo", {
             TensorInfo(TensorShape(5U, 6U), 1, DataType::F32),
@@ -147,9 +162,12 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL,
             TensorInfo(TensorShape(5U, 6U), 1, DataType::QASYMM8),
             TensorInfo(TensorShape(5U, 6U), 1, DataType::QASYMM8_SIGNED),
             TensorInfo(TensorShape(5U, 6U), 1, DataType::QASYMM8),
+            TensorInfo(TensorShape(5U, 6U, 8U, 2U), 1, DataType::F32),
+            TensorInfo(TensorShape(5U, 6U, 4U), 1, DataType::F32),
+            TensorInfo(TensorShape(5U, 6U, 2U, 3U), 1, DataType::F32),
         }),
-        make("TensorIsConst", {false, false, false, false, false , false, true, false, false, false}),
-        make("Expected", { false, false, false, false, true, true, false, false, false, false })),
+        make("TensorIsConst", {false, false, false, false, false , false, true, false, false, false, false, false, false}),
+        make("Expected", { false, false, true, false, true, true, false, false, false, false, true, false, false })),
     a_info, b_info, output_info, are_tensors_const, expected)
 {
     TensorInfo a{a_info};
@@ -253,6 +271,18 @@ make("NumberOfRuns", 5)))
     // Validate output
     validate(Accessor(_target), _reference, tolerance_fp32);
 }
+FIXTURE_DATA_TEST_CASE(RunBroadcastBatches,
+                       NEMatMulFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallBroadcastBatchMatMulDataset(),
+                               make("TransposeA", {false, true}),
+                               make("TransposeB", {false, true}),
+                               make("DataType", DataType::F32),
+                               make("ActivationInfo", ActivationLayerInfo())))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
 TEST_SUITE_END() // FP32
 
 #ifdef ARM_COMPUTE_ENABLE_BF16
@@ -277,6 +307,27 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     validate(Accessor(_target), _reference, tolerance_bf16);
 }
 
+// Long accumulations of BFLOAT16 products: the error grows with K, so it is compared relatively to the result
+const RelativeTolerance<float> rel_tolerance_bf16_skinny(0.02f);
+constexpr float                abs_tolerance_bf16_skinny = 0.2f;
+FIXTURE_DATA_TEST_CASE(RunSkinny,
+                       NEMatMulFastMathFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallSkinnyMatMulDataset(),
+                               make("TransposeA", {false}),
+                               make("TransposeB", {false, true}),
+                               make("DataType", DataType::F32),
+                               make("ActivationInfo", {ActivationLayerInfo()}),
+                               make("RunTimes", {1}),
+                               make("Settings", {CpuMatMulSettings().fast_math(true)}),
+                               make("LhsQInfo", {QuantizationInfo()}),
+                               make("RhsQInfo", {QuantizationInfo()}),
+                               make("OutQInfo", {QuantizationInfo()})))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_bf16_skinny, 0.f, abs_tolerance_bf16_skinny);
+}
+
 #ifdef ARM_COMPUTE_ENABLE_FIXED_FORMAT_KERNELS
 FIXTURE_DATA_TEST_CASE(RunTinyFixedFormat,
                        NEMatMulFixedFormatFixture<bfloat16>,
@@ -395,6 +446,26 @@ make("NumberOfRuns", 5)))
         framework::ARM_COMPUTE_PRINT_INFO();
     }
 }
+FIXTURE_DATA_TEST_CASE(RunBroadcastBatches,
+                       NEMatMulFixture<half>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallBroadcastBatchMatMulDataset(),
+                               make("TransposeA", {false, true}),
+                               make("TransposeB", {false, true}),
+                               make("DataType", DataType::F16),
+                               make("ActivationInfo", ActivationLayerInfo())))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_fp16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
 TEST_SUITE_END() // FP16
 #endif           /* ARM_COMPUTE_ENABLE_FP16 */
 
@@ -535,6 +606,23 @@ make("OutQInfo", {QuantizationInfo(1.f, 1)})))
     validate(Accessor(_target), _reference, tolerance_qasymm8_signed);
 }
 
+FIXTURE_DATA_TEST_CASE(RunBroadcastBatches,
+                       NEQuantizedMatMulFixture<int8_t>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallBroadcastBatchMatMulDataset(),
+                               make("TransposeA", {false, true}),
+                               make("TransposeB", {false, true}),
+                               make("DataType", DataType::QASYMM8_SIGNED),
+                               make("ActivationInfo", ActivationLayerInfo()),
+                               make("NumberOfExtraRuns", {0, 1}),
+                               make("LhsQInfo", {QuantizationInfo(1.f / 40, -2)}),
+                               make("RhsQInfo", {QuantizationInfo(1.f / 50, 1)}),
+                               make("OutQInfo", {QuantizationInfo(1.f, 1)})))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8_signed);
+}
+
 TEST_SUITE_END() // QASYMM8_SIGNED
 
 TEST_SUITE_END() // Quantized
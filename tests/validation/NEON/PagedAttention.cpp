@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/KVBlockPool.h"
+#include "arm_compute/runtime/NEON/functions/NEPagedAttention.h"
+#include "arm_compute/runtime/NEON/functions/NEPagedKVCacheAppend.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/PagedAttentionFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+RelativeTolerance<float>            rel_tolerance_f32(0.001f);      /**< Relative tolerance for FP32 types */
+constexpr AbsoluteTolerance<float>  abs_tolerance_f32(0.0001f);     /**< Absolute tolerance for FP32 types */
+RelativeTolerance<half_float::half> rel_tolerance_f16(half(0.01f)); /**< Relative tolerance for FP16 types */
+constexpr float                     abs_tolerance_f16 = 0.01f;      /**< Absolute tolerance for FP16 types */
+constexpr float                     tolerance_num     = 0.01f;      /**< Tolerance number for FP16 types */
+
+/** Multi-head, grouped-query and multi-query attention */
+const auto HeadsDataset = zip(framework::dataset::make("NumHeads", { 2U, 4U, 4U }),
+                              framework::dataset::make("NumKVHeads", { 2U, 2U, 1U }));
+
+/** Head sizes below and above the vector length, blocks smaller and larger than some sequences */
+const auto PagedAttentionDataset = combine(framework::dataset::make("HeadDim", { 7U, 64U }),
+                                           HeadsDataset,
+                                           framework::dataset::make("BlockSize", { 4U, 16U }),
+                                           framework::dataset::make("NumSeqs", { 1U, 5U }),
+                                           framework::dataset::make("MaxLength", 37U));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(PagedAttention)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+    framework::dataset::make("QInfo", { TensorInfo(TensorShape(64U, 8U, 3U), 1, DataType::F32),
+                                        TensorInfo(TensorShape(64U, 8U, 3U), 1, DataType::F32),
+                                        TensorInfo(TensorShape(64U, 8U, 3U), 1, DataType::F32), // Mismatching head size
+                                        TensorInfo(TensorShape(64U, 6U, 3U), 1, DataType::F32), // Heads not a multiple of KV heads
+                                        TensorInfo(TensorShape(64U, 8U, 3U), 1, DataType::F32), // Mismatching KV type
+                                        TensorInfo(TensorShape(64U, 8U, 2U), 1, DataType::F32), // Mismatching number of sequences
+                                        TensorInfo(TensorShape(64U, 8U, 3U), 1, DataType::S32), // Unsupported type
+                                      }),
+    framework::dataset::make("KVInfo", { TensorInfo(TensorShape(64U, 16U, 8U, 10U), 1, DataType::F32),
+                                         TensorInfo(TensorShape(64U, 16U, 2U, 10U), 1, DataType::F32),
+                                         TensorInfo(TensorShape(32U, 16U, 2U, 10U), 1, DataType::F32),
+                                         TensorInfo(TensorShape(64U, 16U, 4U, 10U), 1, DataType::F32),
+                                         TensorInfo(TensorShape(64U, 16U, 2U, 10U), 1, DataType::F16),
+                                         TensorInfo(TensorShape(64U, 16U, 2U, 10U), 1, DataType::F32),
+                                         TensorInfo(TensorShape(64U, 16U, 2U, 10U), 1, DataType::S32),
+                                       }),
+    framework::dataset::make("Expected", { true, true, false, false, false, false, false })),
+    q_info, kv_info, expected)
+{
+    const TensorInfo block_tables_info(TensorShape(4U, 3U), 1, DataType::S32);
+    const TensorInfo seq_lens_info(TensorShape(3U), 1, DataType::S32);
+
+    bool is_valid = bool(NEPagedAttention::validate(&q_info.clone()->set_is_resizable(false),
+                                                    &kv_info.clone()->set_is_resizable(false),
+                                                    &kv_info.clone()->set_is_resizable(false),
+                                                    &block_tables_info.clone()->set_is_resizable(false),
+                                                    &seq_lens_info.clone()->set_is_resizable(false),
+                                                    &q_info.clone()->set_is_resizable(false),
+                                                    0.125f));
+    ARM_COMPUTE_EXPECT(is_valid == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+TEST_CASE(BlockPool, framework::DatasetMode::ALL)
+{
+    KVBlockPool pool;
+    pool.init(KVBlockPoolInfo(8U, 4U, 2U, 3U));
+
+    const int a = pool.add_sequence();
+    const int b = pool.add_sequence();
+
+    // Slots of positions 0 to 5 of a, spanning two blocks
+    int32_t slots[6];
+    ARM_COMPUTE_EXPECT(pool.append(a, 6, slots), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(pool.length(a) == 6U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(pool.num_free_blocks() == 1U, framework::LogLevel::ERRORS);
+    const std::vector<int32_t> table_a = pool.block_table(a);
+    ARM_COMPUTE_EXPECT(table_a.size() == 2U, framework::LogLevel::ERRORS);
+    for(int p = 0; p < 6; ++p)
+    {
+        ARM_COMPUTE_EXPECT(slots[p] == table_a[p / 4] * 4 + p % 4, framework::LogLevel::ERRORS);
+    }
+
+    // Not enough blocks left for 5 positions: the sequence is left unchanged
+    ARM_COMPUTE_EXPECT(!pool.append(b, 5), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(pool.length(b) == 0U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(pool.num_free_blocks() == 1U, framework::LogLevel::ERRORS);
+
+    // Blocks of removed sequences are recycled
+    pool.remove_sequence(a);
+    ARM_COMPUTE_EXPECT(pool.num_free_blocks() == 3U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(pool.append(b, 9), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(pool.num_free_blocks() == 0U, framework::LogLevel::ERRORS);
+
+    // Removed sequences are unknown
+    ARM_COMPUTE_EXPECT_THROW(pool.length(a), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_THROW(pool.append(a, 1), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_THROW(pool.block_table(a), framework::LogLevel::ERRORS);
+}
+
+template <typename T>
+using NEPagedAttentionFixture = PagedAttentionValidationFixture<Tensor, Accessor, NEPagedAttention, NEPagedKVCacheAppend, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEPagedAttentionFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(PagedAttentionDataset,
+                               framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEPagedAttentionFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(PagedAttentionDataset,
+                               framework::dataset::make("DataType", DataType::F16)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           /* ARM_COMPUTE_ENABLE_FP16 */
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // PagedAttention
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, 2024 Arm Limited.
+ * Copyright (c) 2018-2020, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -70,6 +70,18 @@ const auto PermuteVectors4 = framework::dataset::make("PermutationVector",
 const auto PermuteVectors         = concat(concat(PermuteVectors2, PermuteVectors3), PermuteVectors4);
 const auto PermuteParametersSmall = concat(concat(datasets::Small2DShapes(), datasets::Small3DShapes()), datasets::Small4DShapes()) * PermuteVectors;
 const auto PermuteParametersLarge = datasets::Large4DShapes() * PermuteVectors;
+/** Permutations of rank 5 and 6, on shapes with partial cache blocks and register tiles */
+const auto PermuteParametersHighRank = framework::dataset::make("Shape",
+{
+    TensorShape(67U, 3U, 35U, 2U, 3U),
+    TensorShape(9U, 70U, 2U, 3U, 5U, 2U),
+}) * framework::dataset::make("PermutationVector",
+{
+    PermutationVector(2U, 0U, 1U, 4U, 3U),
+    PermutationVector(4U, 3U, 2U, 1U, 0U),
+    PermutationVector(1U, 0U, 3U, 2U, 4U, 5U),
+    PermutationVector(5U, 1U, 4U, 0U, 2U, 3U),
+});
 } // namespace
 TEST_SUITE(NEON)
 TEST_SUITE(Permute)
@@ -143,6 +155,12 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEPermuteFixture<uint8_t>, framework::DatasetMo
     // Validate output
     validate(Accessor(_target), _reference);
 }
+FIXTURE_DATA_TEST_CASE(RunHighRank, NEPermuteFixture<uint8_t>, framework::DatasetMode::PRECOMMIT,
+                       PermuteParametersHighRank * framework::dataset::make("DataType", DataType::U8))
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+}
 TEST_SUITE_END()
 
 TEST_SUITE(U16)
@@ -158,6 +176,12 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEPermuteFixture<uint16_t>, framework::DatasetM
     // Validate output
     validate(Accessor(_target), _reference);
 }
+FIXTURE_DATA_TEST_CASE(RunHighRank, NEPermuteFixture<uint16_t>, framework::DatasetMode::PRECOMMIT,
+                       PermuteParametersHighRank * framework::dataset::make("DataType", DataType::U16))
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+}
 TEST_SUITE_END()
 
 TEST_SUITE(U32)
@@ -173,6 +197,12 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEPermuteFixture<uint32_t>, framework::DatasetM
     // Validate output
     validate(Accessor(_target), _reference);
 }
+FIXTURE_DATA_TEST_CASE(RunHighRank, NEPermuteFixture<uint32_t>, framework::DatasetMode::PRECOMMIT,
+                       PermuteParametersHighRank * framework::dataset::make("DataType", DataType::U32))
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+}
 TEST_SUITE_END()
 
 #ifdef ARM_COMPUTE_ENABLE_FP16
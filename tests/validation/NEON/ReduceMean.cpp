@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2018-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -64,6 +64,20 @@ constexpr AbsoluteTolerance<int8_t>  zero_tolerance_s8(0);
 const auto axis_keep = combine(framework::dataset::make("Axis", { Coordinates(0), Coordinates(1, 0), Coordinates(1, 2), Coordinates(0, 2), Coordinates(1, 3), Coordinates(2, 3), Coordinates(0, 1, 2, 3) }),
                                framework::dataset::make("KeepDims", { true }));
 const auto axis_drop = combine(framework::dataset::make("Axis", { Coordinates(0), Coordinates(1), Coordinates(3) }), framework::dataset::make("KeepDims", { false }));
+const auto axis_drop_multi = combine(framework::dataset::make("Axis", { Coordinates(1, 2), Coordinates(0, 2, 3), Coordinates(3, 1), Coordinates(0, 1) }),
+                                     framework::dataset::make("KeepDims", { false }));
+
+/** Small outputs reducing at least 2 * 4096 elements: with 4 threads the reduction itself is split into partial results */
+auto partial_reductions(DataType data_type)
+{
+    return combine(zip(zip(framework::dataset::make("Shape", { TensorShape(64U, 32U, 4U, 2U), TensorShape(33U, 3U, 97U), TensorShape(3U, 67U, 61U) }),
+                           framework::dataset::make("DataType", { data_type, data_type, data_type })),
+                       framework::dataset::make("Axis", { Coordinates(0, 1, 2, 3), Coordinates(0, 2), Coordinates(1, 2) })),
+                   framework::dataset::make("KeepDims", { true, false }));
+}
+const auto partial_float_qinfo = combine(framework::dataset::make("QuantizationInfoInput", { QuantizationInfo() }),
+                                         framework::dataset::make("QuantizationInfoOutput", { QuantizationInfo() }));
+const auto partial_threads = framework::dataset::make("NumThreads", { 4U });
 } // namespace
 TEST_SUITE(NEON)
 TEST_SUITE(ReduceMean)
@@ -178,6 +192,8 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(
 
 template <typename T>
 using NEReduceMeanFixture = ReduceMeanFixture<Tensor, Accessor, NEReduceMean, T>;
+template <typename T>
+using NEReduceMeanThreadedFixture = ReduceMeanThreadedFixture<Tensor, Accessor, NEReduceMean, T>;
 
 TEST_SUITE(Float)
 
@@ -216,6 +232,23 @@ FIXTURE_DATA_TEST_CASE(RunLarge,
         framework::ARM_COMPUTE_PRINT_INFO();
     }
 }
+
+FIXTURE_DATA_TEST_CASE(RunPartials,
+                       NEReduceMeanThreadedFixture<half>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(combine(partial_reductions(DataType::F16), partial_float_qinfo), partial_threads))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
 TEST_SUITE_END() // FP16
 #endif           // ARM_COMPUTE_ENABLE_FP16
 TEST_SUITE(FP32)
@@ -228,6 +261,15 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     validate(Accessor(_target), _reference, tolerance_f32);
 }
 
+FIXTURE_DATA_TEST_CASE(RunSmallMultiAxisDrop,
+                       NEReduceMeanFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(combine(datasets::Small4DShapes(), framework::dataset::make("DataType", DataType::F32)), axis_drop_multi))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+
 FIXTURE_DATA_TEST_CASE(RunLarge,
                        NEReduceMeanFixture<float>,
                        framework::DatasetMode::NIGHTLY,
@@ -236,6 +278,15 @@ FIXTURE_DATA_TEST_CASE(RunLarge,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32);
 }
+
+FIXTURE_DATA_TEST_CASE(RunPartials,
+                       NEReduceMeanThreadedFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(combine(partial_reductions(DataType::F32), partial_float_qinfo), partial_threads))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
 TEST_SUITE_END() // FP32
 TEST_SUITE_END() // Float
 
@@ -278,6 +329,17 @@ FIXTURE_DATA_TEST_CASE(RunLarge,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_u8);
 }
+
+FIXTURE_DATA_TEST_CASE(RunPartials,
+                       NEReduceMeanThreadedFixture<uint8_t>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(partial_reductions(DataType::QASYMM8), framework::dataset::make("QuantizationInfoInput", { QuantizationInfo(1.f / 255, 5) })),
+                                       framework::dataset::make("QuantizationInfoOutput", { QuantizationInfo(1.f / 255, 5) })),
+                               partial_threads))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_u8);
+}
 TEST_SUITE_END() // QASYMM8
 
 TEST_SUITE(QASYMM8_SIGNED)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -72,6 +72,34 @@ const auto Axises = framework::dataset::make("Axis",
 
 const auto KeepDims = framework::dataset::make("KeepDims", { true, false });
 
+/** Operations computed in a single pass over all the reduced elements */
+const auto SinglePassOperations = framework::dataset::make("ReductionOperation",
+{
+    ReductionOperation::SUM,
+    ReductionOperation::MEAN_SUM,
+    ReductionOperation::PROD,
+    ReductionOperation::MIN,
+    ReductionOperation::MAX,
+});
+
+const auto SinglePassQuantizedOperations = framework::dataset::make("ReductionOperation",
+{
+    ReductionOperation::SUM,
+    ReductionOperation::MEAN_SUM,
+    ReductionOperation::MIN,
+    ReductionOperation::MAX,
+});
+
+/** Small outputs reducing at least 2 * 4096 elements: with 4 threads the reduction itself is split into partial results */
+auto PartialReductions(DataType data_type)
+{
+    return zip(zip(framework::dataset::make("Shape", { TensorShape(4099U, 3U), TensorShape(3U, 4099U), TensorShape(5U, 2U, 3U, 700U) }),
+                   framework::dataset::make("DataType", { data_type, data_type, data_type })),
+               framework::dataset::make("Axis", { 0, 1, 3 }));
+}
+
+const auto PartialThreads = framework::dataset::make("NumThreads", { 4U });
+
 } // namespace
 
 TEST_SUITE(NEON)
@@ -133,6 +161,8 @@ DATA_TEST_CASE(ValidateNoPadding, framework::DatasetMode::ALL, combine(combine(c
 
 template <typename T>
 using NEReductionOperationFixture = ReductionOperationFixture<Tensor, Accessor, NEReductionOperation, T>;
+template <typename T>
+using NEReductionOperationThreadedFixture = ReductionOperationThreadedFixture<Tensor, Accessor, NEReductionOperation, T>;
 
 TEST_SUITE(FP32)
 FIXTURE_DATA_TEST_CASE(RunSmall, NEReductionOperationFixture<float>, framework::DatasetMode::PRECOMMIT,
@@ -147,6 +177,14 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEReductionOperationFixture<float>, framework::
     // Validate output
     validate(Accessor(_target), _reference, rel_tolerance_f32, 0, tolerance_f32);
 }
+FIXTURE_DATA_TEST_CASE(RunPartials, NEReductionOperationThreadedFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(PartialReductions(DataType::F32), SinglePassOperations), framework::dataset::make("QuantizationInfo", { QuantizationInfo() })),
+                                       KeepDims),
+                               PartialThreads))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0, tolerance_f32);
+}
 TEST_SUITE_END() // FP32
 
 #ifdef ARM_COMPUTE_ENABLE_FP16
@@ -179,6 +217,22 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEReductionOperationFixture<half>, framework::D
         framework::ARM_COMPUTE_PRINT_INFO();
     }
 }
+FIXTURE_DATA_TEST_CASE(RunPartials, NEReductionOperationThreadedFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(PartialReductions(DataType::F16), SinglePassOperations), framework::dataset::make("QuantizationInfo", { QuantizationInfo() })),
+                                       KeepDims),
+                               PartialThreads))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, rel_tolerance_f16, 0, tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
 TEST_SUITE_END() // FP16
 #endif           // ARM_COMPUTE_ENABLE_FP16
 
@@ -195,6 +249,12 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEReductionOperationQuantizedFixture<uint8_t>,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_quantized);
 }
+FIXTURE_DATA_TEST_CASE(RunPartials, NEReductionOperationThreadedFixture<uint8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(PartialReductions(DataType::QASYMM8), SinglePassQuantizedOperations), QuantizationInfos), KeepDims), PartialThreads))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_quantized);
+}
 TEST_SUITE_END() // QASYMM8
 
 TEST_SUITE(QASYMM8_SIGNED)
@@ -207,6 +267,12 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEReductionOperationQuantizedFixture<int8_t>, f
     // Validate output
     validate(Accessor(_target), _reference, tolerance_quantized);
 }
+FIXTURE_DATA_TEST_CASE(RunPartials, NEReductionOperationThreadedFixture<int8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(PartialReductions(DataType::QASYMM8_SIGNED), SinglePassQuantizedOperations), QuantizationInfos), KeepDims), PartialThreads))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_quantized);
+}
 TEST_SUITE_END() // QASYMM8_SIGNED
 
 TEST_SUITE_END() // ReductionOperation
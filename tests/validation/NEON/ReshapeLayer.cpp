@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2018, 2023 Arm Limited.
+ * Copyright (c) 2017-2018, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,7 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/NEON/functions/NEReshapeLayer.h"
 #include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAlias.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "tests/NEON/Accessor.h"
 #include "tests/PaddingCalculator.h"
@@ -80,6 +81,34 @@ using NEReshapeLayerFixture = ReshapeLayerValidationFixture<Tensor, Accessor, NE
 template <typename T>
 using NEReshapeLayerPaddedFixture = ReshapeLayerPaddedValidationFixture<Tensor, Accessor, NEReshapeLayer, T>;
 
+TEST_CASE(AliasedOutput, framework::DatasetMode::ALL)
+{
+    Tensor src{};
+    src.allocator()->init(TensorInfo(TensorShape(8U, 4U, 6U), 1, DataType::F32));
+    src.allocator()->allocate();
+
+    auto *src_ptr = reinterpret_cast<float *>(src.buffer() + src.info()->offset_first_element_in_bytes());
+    for(size_t i = 0; i < src.info()->tensor_shape().total_size(); ++i)
+    {
+        src_ptr[i] = static_cast<float>(i);
+    }
+
+    // The output views the memory of the input, so running the function must leave the data untouched
+    TensorAlias dst(&src, TensorShape(24U, 8U));
+    ARM_COMPUTE_EXPECT(bool(NEReshapeLayer::validate(src.info(), dst.info())), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(dst.buffer() == src.buffer() + src.info()->offset_first_element_in_bytes(), framework::LogLevel::ERRORS);
+
+    NEReshapeLayer reshape;
+    reshape.configure(&src, &dst);
+    reshape.run();
+
+    const auto *dst_ptr = reinterpret_cast<const float *>(dst.buffer() + dst.info()->offset_first_element_in_bytes());
+    for(size_t i = 0; i < dst.info()->tensor_shape().total_size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(dst_ptr[i] == static_cast<float>(i), framework::LogLevel::ERRORS);
+    }
+}
+
 TEST_SUITE(Float)
 TEST_SUITE(F32)
 FIXTURE_DATA_TEST_CASE(RunSmall, NEReshapeLayerFixture<float>, framework::DatasetMode::ALL, combine(datasets::SmallReshapeLayerDataset(), framework::dataset::make("DataType", DataType::F32)))
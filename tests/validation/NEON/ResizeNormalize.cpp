@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEResizeNormalize.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/ResizeNormalizeFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr AbsoluteTolerance<float>   tolerance_f32(0.001f); /**< Absolute tolerance for FP32 types */
+constexpr AbsoluteTolerance<float>   tolerance_f16(0.01f);  /**< Absolute tolerance for FP16 types */
+constexpr AbsoluteTolerance<uint8_t> tolerance_qasymm8(1);  /**< Absolute tolerance for quantized types */
+
+/** Downscaling by integer and non-integer ratios and upscaling, with output rows not multiple of the vector step */
+const auto ShapesDataset = zip(framework::dataset::make("InputShape", { TensorShape(3U, 33U, 27U, 2U),
+                                                                        TensorShape(3U, 7U, 5U, 1U),
+                                                                        TensorShape(3U, 64U, 48U, 1U)
+                                                                      }),
+                               framework::dataset::make("OutputSize", { Size2D(16U, 12U), Size2D(19U, 13U), Size2D(24U, 21U) }));
+
+const auto PoliciesDataset = combine(framework::dataset::make("InterpolationPolicy", { InterpolationPolicy::NEAREST_NEIGHBOR, InterpolationPolicy::BILINEAR, InterpolationPolicy::AREA }),
+                                     framework::dataset::make("SamplingPolicy", { SamplingPolicy::CENTER, SamplingPolicy::TOP_LEFT }),
+                                     framework::dataset::make("SwapChannels", { false, true }));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(ResizeNormalize)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+    framework::dataset::make("InputInfo", { TensorInfo(TensorShape(3U, 32U, 32U, 2U), 1, DataType::U8, DataLayout::NHWC),
+                                            TensorInfo(TensorShape(3U, 32U, 32U, 2U), 1, DataType::F32, DataLayout::NHWC), // Non U8 input
+                                            TensorInfo(TensorShape(4U, 32U, 32U, 2U), 1, DataType::U8, DataLayout::NHWC),  // 4 channels
+                                            TensorInfo(TensorShape(3U, 32U, 32U, 2U), 1, DataType::U8, DataLayout::NHWC),  // Mismatching batches
+                                            TensorInfo(TensorShape(3U, 32U, 32U, 2U), 1, DataType::U8, DataLayout::NHWC),  // Unsupported output type
+                                            TensorInfo(TensorShape(32U, 32U, 3U, 2U), 1, DataType::U8, DataLayout::NCHW),  // NCHW not supported
+                                          }),
+    framework::dataset::make("OutputInfo", { TensorInfo(TensorShape(3U, 16U, 16U, 2U), 1, DataType::F32, DataLayout::NHWC),
+                                             TensorInfo(TensorShape(3U, 16U, 16U, 2U), 1, DataType::F32, DataLayout::NHWC),
+                                             TensorInfo(TensorShape(4U, 16U, 16U, 2U), 1, DataType::F32, DataLayout::NHWC),
+                                             TensorInfo(TensorShape(3U, 16U, 16U, 1U), 1, DataType::F32, DataLayout::NHWC),
+                                             TensorInfo(TensorShape(3U, 16U, 16U, 2U), 1, DataType::S32, DataLayout::NHWC),
+                                             TensorInfo(TensorShape(16U, 16U, 3U, 2U), 1, DataType::F32, DataLayout::NCHW),
+                                           }),
+    framework::dataset::make("Expected", { true, false, false, false, false, false })),
+    input_info, output_info, expected)
+{
+    const ResizeNormalizeInfo info(InterpolationPolicy::BILINEAR, { { 127.5f, 127.5f, 127.5f } }, { { 1.f / 127.5f, 1.f / 127.5f, 1.f / 127.5f } });
+
+    bool is_valid = bool(NEResizeNormalize::validate(&input_info.clone()->set_is_resizable(false), &output_info.clone()->set_is_resizable(false), info));
+    ARM_COMPUTE_EXPECT(is_valid == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEResizeNormalizeFixture = ResizeNormalizeValidationFixture<Tensor, Accessor, NEResizeNormalize, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEResizeNormalizeFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(ShapesDataset,
+                               PoliciesDataset,
+                               framework::dataset::make("DataType", DataType::F32),
+                               framework::dataset::make("QuantizationInfo", QuantizationInfo())))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEResizeNormalizeFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(ShapesDataset,
+                               PoliciesDataset,
+                               framework::dataset::make("DataType", DataType::F16),
+                               framework::dataset::make("QuantizationInfo", QuantizationInfo())))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           /* ARM_COMPUTE_ENABLE_FP16 */
+TEST_SUITE_END() // Float
+
+TEST_SUITE(Quantized)
+TEST_SUITE(QASYMM8)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEResizeNormalizeFixture<uint8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(ShapesDataset,
+                               PoliciesDataset,
+                               framework::dataset::make("DataType", DataType::QASYMM8),
+                               framework::dataset::make("QuantizationInfo", QuantizationInfo(0.02f, 110))))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+TEST_SUITE_END() // QASYMM8
+TEST_SUITE_END() // Quantized
+
+TEST_SUITE_END() // ResizeNormalize
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/RoPEInfo.h"
+#include "arm_compute/runtime/KVCache.h"
+#include "arm_compute/runtime/NEON/functions/NERoPE.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/RoPEFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+RelativeTolerance<float>            rel_tolerance_f32(0.001f);      /**< Relative tolerance for FP32 types */
+constexpr AbsoluteTolerance<float>  abs_tolerance_f32(0.0001f);     /**< Absolute tolerance for FP32 types */
+RelativeTolerance<half_float::half> rel_tolerance_f16(half(0.01f)); /**< Relative tolerance for FP16 types */
+constexpr float                     abs_tolerance_f16 = 0.01f;      /**< Absolute tolerance for FP16 types */
+
+/** Head sizes with and without a scalar tail, multi-head and grouped-query keys, prefill and decode */
+const auto ShapesDataset = zip(framework::dataset::make("QShape", { TensorShape(64U, 5U, 4U, 2U), TensorShape(10U, 3U, 2U, 1U), TensorShape(128U, 1U, 8U, 1U) }),
+                               framework::dataset::make("NumKVHeads", { 2U, 2U, 1U }));
+
+const auto ModesDataset = framework::dataset::make("Mode", { RoPEMode::NEOX, RoPEMode::GPTJ });
+
+/** Positions inside and past the precomputed table */
+const auto RoPEDataset = combine(ShapesDataset,
+                                 ModesDataset,
+                                 framework::dataset::make("RotaryDim", { 0U, 6U }),
+                                 framework::dataset::make("PositionOffset", 3),
+                                 framework::dataset::make("MaxPositions", 16U),
+                                 framework::dataset::make("UsePositions", { false, true }),
+                                 framework::dataset::make("InPlace", false));
+
+/** On-the-fly sines and cosines, rotating the inputs in place */
+const auto RoPEInPlaceDataset = combine(ShapesDataset,
+                                        ModesDataset,
+                                        framework::dataset::make("RotaryDim", 0U),
+                                        framework::dataset::make("PositionOffset", 0),
+                                        framework::dataset::make("MaxPositions", 0U),
+                                        framework::dataset::make("UsePositions", false),
+                                        framework::dataset::make("InPlace", true));
+
+const auto RoPEKVCacheDataset = combine(ShapesDataset,
+                                        ModesDataset,
+                                        framework::dataset::make("DecodeSteps", 3U),
+                                        framework::dataset::make("PositionOffset", 5),
+                                        framework::dataset::make("MaxPositions", { 0U, 8U }));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(RoPE)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+    framework::dataset::make("QInfo", { TensorInfo(TensorShape(64U, 8U, 4U, 2U), 1, DataType::F32),
+                                        TensorInfo(TensorShape(64U, 8U, 4U, 2U), 1, DataType::F32),
+                                        TensorInfo(TensorShape(64U, 8U, 4U, 2U), 1, DataType::F32), // Mismatching head size
+                                        TensorInfo(TensorShape(64U, 8U, 4U, 2U), 1, DataType::F32), // Mismatching tokens
+                                        TensorInfo(TensorShape(64U, 8U, 4U, 2U), 1, DataType::F32), // Odd rotary dimension
+                                        TensorInfo(TensorShape(64U, 8U, 4U, 2U), 1, DataType::F32), // Rotary dimension larger than the head
+                                        TensorInfo(TensorShape(64U, 8U, 4U, 2U), 1, DataType::F32), // Mismatching key type
+                                        TensorInfo(TensorShape(64U, 8U, 4U, 2U), 1, DataType::S32), // Unsupported type
+                                      }),
+    framework::dataset::make("KInfo", { TensorInfo(TensorShape(64U, 8U, 2U, 2U), 1, DataType::F32),
+                                        TensorInfo(TensorShape(64U, 8U, 4U, 2U), 1, DataType::F32),
+                                        TensorInfo(TensorShape(32U, 8U, 2U, 2U), 1, DataType::F32),
+                                        TensorInfo(TensorShape(64U, 4U, 2U, 2U), 1, DataType::F32),
+                                        TensorInfo(TensorShape(64U, 8U, 2U, 2U), 1, DataType::F32),
+                                        TensorInfo(TensorShape(64U, 8U, 2U, 2U), 1, DataType::F32),
+                                        TensorInfo(TensorShape(64U, 8U, 2U, 2U), 1, DataType::F16),
+                                        TensorInfo(TensorShape(64U, 8U, 2U, 2U), 1, DataType::S32),
+                                      }),
+    framework::dataset::make("RotaryDim", { 0U, 32U, 0U, 0U, 31U, 66U, 0U, 0U }),
+    framework::dataset::make("Expected", { true, true, false, false, false, false, false, false })),
+    q_info, k_info, rotary_dim, expected)
+{
+    const TensorInfo positions_info(TensorShape(8U), 1, DataType::S32);
+
+    bool is_valid = bool(NERoPE::validate(&q_info.clone()->set_is_resizable(false),
+                                          &k_info.clone()->set_is_resizable(false),
+                                          &positions_info.clone()->set_is_resizable(false),
+                                          &q_info.clone()->set_is_resizable(false),
+                                          &k_info.clone()->set_is_resizable(false),
+                                          RoPEInfo(RoPEMode::NEOX, 10000.f, rotary_dim)));
+    ARM_COMPUTE_EXPECT(is_valid == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+TEST_CASE(ValidateKVCache, framework::DatasetMode::ALL)
+{
+    const TensorInfo q_info(TensorShape(64U, 8U, 4U, 2U), 1, DataType::F32);
+    const TensorInfo k_info(TensorShape(64U, 8U, 2U, 2U), 1, DataType::F32);
+    const RoPEInfo   info(RoPEMode::NEOX);
+
+    // Keys of the right type and shape fit in the cache
+    KVCache cache;
+    cache.init(KVCacheInfo(64U, 16U, 2U, 2U, DataType::F32));
+    ARM_COMPUTE_EXPECT(bool(NERoPE::validate(&q_info, &k_info, &q_info, cache.tensor()->info(), info)), framework::LogLevel::ERRORS);
+
+    // Quantized caches are not supported
+    KVCache quantized_cache;
+    quantized_cache.init(KVCacheInfo(64U, 16U, 2U, 2U, DataType::QSYMM8_PER_CHANNEL, { 0.1f, 0.1f }));
+    ARM_COMPUTE_EXPECT(!bool(NERoPE::validate(&q_info, &k_info, &q_info, quantized_cache.tensor()->info(), info)), framework::LogLevel::ERRORS);
+
+    // More tokens than the cache can ever hold
+    KVCache small_cache;
+    small_cache.init(KVCacheInfo(64U, 4U, 2U, 2U, DataType::F32));
+    ARM_COMPUTE_EXPECT(!bool(NERoPE::validate(&q_info, &k_info, &q_info, small_cache.tensor()->info(), info)), framework::LogLevel::ERRORS);
+}
+
+template <typename T>
+using NERoPEFixture = RoPEValidationFixture<Tensor, Accessor, NERoPE, T>;
+template <typename T>
+using NERoPEKVCacheFixture = RoPEKVCacheValidationFixture<Tensor, Accessor, NERoPE, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NERoPEFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(RoPEDataset,
+                               framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target_q), _reference_q, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+    validate(Accessor(_target_k), _reference_k, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunInPlace, NERoPEFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(RoPEInPlaceDataset,
+                               framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target_q), _reference_q, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+    validate(Accessor(_target_k), _reference_k, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunKVCache, NERoPEKVCacheFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(RoPEKVCacheDataset,
+                               framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target_q), _reference_q, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+    validate(Accessor(*_cache.view()), _reference_k, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NERoPEFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(RoPEDataset,
+                               framework::dataset::make("DataType", DataType::F16)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target_q), _reference_q, rel_tolerance_f16, 0.f, abs_tolerance_f16);
+        validate(Accessor(_target_k), _reference_k, rel_tolerance_f16, 0.f, abs_tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+FIXTURE_DATA_TEST_CASE(RunKVCache, NERoPEKVCacheFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(RoPEKVCacheDataset,
+                               framework::dataset::make("DataType", DataType::F16)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target_q), _reference_q, rel_tolerance_f16, 0.f, abs_tolerance_f16);
+        validate(Accessor(*_cache.view()), _reference_k, rel_tolerance_f16, 0.f, abs_tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           /* ARM_COMPUTE_ENABLE_FP16 */
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // RoPE
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
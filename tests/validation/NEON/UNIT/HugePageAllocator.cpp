@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/HugePageAllocator.h"
+
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/runtime/BlobLifetimeManager.h"
+#include "arm_compute/runtime/MemoryManagerOnDemand.h"
+#include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
+#include "arm_compute/runtime/NEON/functions/NENormalizationLayer.h"
+#include "arm_compute/runtime/OffsetLifetimeManager.h"
+#include "arm_compute/runtime/PoolManager.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/reference/ActivationLayer.h"
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(HugePageAllocator)
+
+TEST_CASE(AllocateAndFree, framework::DatasetMode::ALL)
+{
+    for (auto policy : {HugePagePolicy::NONE, HugePagePolicy::TRANSPARENT, HugePagePolicy::EXPLICIT})
+    {
+        HugePageAllocatorInfo info{};
+        info.huge_pages = policy;
+        arm_compute::HugePageAllocator allocator(info);
+
+        // Small allocation, below the huge page size
+        void *small = allocator.allocate(100, 64);
+        ARM_COMPUTE_ASSERT(small != nullptr);
+        ARM_COMPUTE_EXPECT(arm_compute::utility::check_aligned(small, 64), framework::LogLevel::ERRORS);
+        std::memset(small, 0x5A, 100);
+
+        // Large allocation with an alignment larger than a page
+        const size_t large_size = 3 * info.huge_page_size + 17;
+        void        *large      = allocator.allocate(large_size, 8192);
+        ARM_COMPUTE_ASSERT(large != nullptr);
+        ARM_COMPUTE_EXPECT(arm_compute::utility::check_aligned(large, 8192), framework::LogLevel::ERRORS);
+        std::memset(large, 0xA5, large_size);
+
+        ARM_COMPUTE_EXPECT(static_cast<uint8_t *>(small)[99] == 0x5A, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(static_cast<uint8_t *>(large)[large_size - 1] == 0xA5, framework::LogLevel::ERRORS);
+
+        allocator.free(small);
+        // The large allocation is released by the allocator destructor
+    }
+}
+
+TEST_CASE(AllocationFailure, framework::DatasetMode::ALL)
+{
+    // Larger than any virtual address space: the failure must be reported whether asserts are enabled or not
+    const size_t too_large = std::numeric_limits<size_t>::max() / 2;
+    for (auto policy : {HugePagePolicy::NONE, HugePagePolicy::TRANSPARENT, HugePagePolicy::EXPLICIT})
+    {
+        HugePageAllocatorInfo info{};
+        info.huge_pages = policy;
+        arm_compute::HugePageAllocator allocator(info);
+
+        bool allocate_failed = false;
+        try
+        {
+            allocator.allocate(too_large, 64);
+        }
+        catch (const std::bad_alloc &)
+        {
+            allocate_failed = true;
+        }
+        ARM_COMPUTE_EXPECT(allocate_failed, framework::LogLevel::ERRORS);
+
+        bool make_region_failed = false;
+        try
+        {
+            allocator.make_region(too_large, 64);
+        }
+        catch (const std::bad_alloc &)
+        {
+            make_region_failed = true;
+        }
+        ARM_COMPUTE_EXPECT(make_region_failed, framework::LogLevel::ERRORS);
+
+        // The allocator is still usable after a failure
+        void *ptr = allocator.allocate(4096, 64);
+        ARM_COMPUTE_EXPECT(ptr != nullptr, framework::LogLevel::ERRORS);
+        allocator.free(ptr);
+    }
+}
+
+TEST_CASE(MakeRegion, framework::DatasetMode::ALL)
+{
+    HugePageAllocatorInfo info{};
+    info.first_touch = true;
+    arm_compute::HugePageAllocator allocator(info);
+
+    auto region = allocator.make_region(10000, 256);
+    ARM_COMPUTE_ASSERT(region != nullptr);
+    ARM_COMPUTE_ASSERT(region->buffer() != nullptr);
+    ARM_COMPUTE_EXPECT(region->size() == 10000, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(arm_compute::utility::check_aligned(region->buffer(), 256), framework::LogLevel::ERRORS);
+
+    // Sub-regions alias the parent memory
+    auto sub_region = region->extract_subregion(128, 512);
+    ARM_COMPUTE_ASSERT(sub_region != nullptr);
+    ARM_COMPUTE_EXPECT(sub_region->buffer() == static_cast<uint8_t *>(region->buffer()) + 128,
+                       framework::LogLevel::ERRORS);
+
+    // Out of bounds sub-regions are rejected
+    ARM_COMPUTE_EXPECT(region->extract_subregion(9000, 2000) == nullptr, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(TensorBackingAllocator, framework::DatasetMode::ALL)
+{
+    const ActivationLayerInfo act_info(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 3.f);
+    const TensorShape         shape(128U, 64U, 32U);
+    const size_t              required_alignment = 4096;
+
+    HugePageAllocatorInfo info{};
+    info.first_touch = true;
+    arm_compute::HugePageAllocator allocator(info);
+
+    Tensor src;
+    Tensor dst;
+    src.allocator()->init(TensorInfo(shape, 1, DataType::F32), required_alignment);
+    dst.allocator()->init(TensorInfo(shape, 1, DataType::F32), required_alignment);
+    src.allocator()->set_backing_allocator(&allocator);
+    dst.allocator()->set_backing_allocator(&allocator);
+
+    NEActivationLayer act_func;
+    act_func.configure(&src, &dst, act_info);
+
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+    ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+    ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+    ARM_COMPUTE_EXPECT(arm_compute::utility::check_aligned(src.buffer(), required_alignment),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(arm_compute::utility::check_aligned(dst.buffer(), required_alignment),
+                       framework::LogLevel::ERRORS);
+
+    SimpleTensor<float> ref_src{shape, DataType::F32};
+    library->fill_tensor_uniform(Accessor(src), 0);
+    library->fill_tensor_uniform(ref_src, 0);
+
+    act_func.run();
+
+    validate(Accessor(dst), reference::activation_layer(ref_src, act_info));
+
+    src.allocator()->free();
+    dst.allocator()->free();
+    ARM_COMPUTE_ASSERT(src.buffer() == nullptr);
+}
+
+TEST_CASE(MemoryManagerPopulate, framework::DatasetMode::ALL)
+{
+    HugePageAllocatorInfo info{};
+    info.first_touch = true;
+    arm_compute::HugePageAllocator allocator(info);
+
+    auto blob_mm   = std::make_shared<MemoryManagerOnDemand>(std::make_shared<BlobLifetimeManager>(),
+                                                             std::make_shared<PoolManager>());
+    auto offset_mm = std::make_shared<MemoryManagerOnDemand>(std::make_shared<OffsetLifetimeManager>(),
+                                                             std::make_shared<PoolManager>());
+
+    for (auto &mm : {blob_mm, offset_mm})
+    {
+        // Create tensors
+        Tensor src = create_tensor<Tensor>(TensorShape(27U, 11U, 3U), DataType::F32, 1);
+        Tensor dst = create_tensor<Tensor>(TensorShape(27U, 11U, 3U), DataType::F32, 1);
+
+        // Create and configure function
+        NENormalizationLayer norm_layer(mm);
+        norm_layer.configure(&src, &dst, NormalizationLayerInfo(NormType::CROSS_MAP, 3));
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        // Finalize memory manager
+        mm->populate(allocator, 2 /* num_pools */);
+        ARM_COMPUTE_EXPECT(mm->pool_manager()->num_pools() == 2, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(mm->lifetime_manager()->are_all_finalized(), framework::LogLevel::ERRORS);
+
+        // Fill tensors and compute function
+        library->fill_tensor_uniform(Accessor(src), 0);
+        norm_layer.run();
+
+        // Clear manager
+        mm->clear();
+        ARM_COMPUTE_EXPECT(mm->pool_manager()->num_pools() == 0, framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_SUITE_END() // HugePageAllocator
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024 Arm Limited.
+ * Copyright (c) 2019-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,8 +23,12 @@
  */
 #include "arm_compute/runtime/RuntimeContext.h"
 
+#include "arm_compute/core/CPP/ICPPKernel.h"
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEBitwiseAnd.h"
+#include "arm_compute/runtime/Scheduler.h"
 #include "arm_compute/runtime/SchedulerFactory.h"
+#include "arm_compute/runtime/SchedulerPartitions.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "tests/Globals.h"
 #include "tests/NEON/Accessor.h"
@@ -46,6 +50,57 @@ namespace test
 {
 namespace validation
 {
+namespace
+{
+/** Single threaded scheduler counting the kernels it runs */
+class CountingScheduler final : public IScheduler
+{
+public:
+    void set_num_threads(unsigned int num_threads) override
+    {
+        ARM_COMPUTE_UNUSED(num_threads);
+    }
+    unsigned int num_threads() const override
+    {
+        return 1;
+    }
+    void schedule(ICPPKernel *kernel, const Hints &hints) override
+    {
+        ARM_COMPUTE_UNUSED(hints);
+        ++_num_scheduled;
+        ThreadInfo info;
+        info.cpu_info = &cpu_info();
+        kernel->run(kernel->window(), info);
+    }
+    void schedule_op(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors) override
+    {
+        ARM_COMPUTE_UNUSED(hints);
+        ++_num_scheduled;
+        ThreadInfo info;
+        info.cpu_info = &cpu_info();
+        kernel->run_op(tensors, window, info);
+    }
+    unsigned int num_scheduled() const
+    {
+        return _num_scheduled;
+    }
+
+protected:
+    void run_workloads(std::vector<Workload> &workloads) override
+    {
+        ThreadInfo info;
+        info.cpu_info = &cpu_info();
+        for (auto &wl : workloads)
+        {
+            wl(info);
+        }
+    }
+
+private:
+    unsigned int _num_scheduled{0};
+};
+} // namespace
+
 TEST_SUITE(NEON)
 TEST_SUITE(UNIT)
 #if defined(ARM_COMPUTE_OPENMP_SCHEDULER) && !defined(_WIN64) && !defined(BARE_METAL) && !defined(__APPLE__) && !defined(__OpenBSD__) && \
@@ -106,6 +161,53 @@ TEST_CASE(Scheduler, framework::DatasetMode::ALL)
     act_layer.run();
 }
 
+// Every function created with a context must run its kernels on the scheduler of that context
+TEST_CASE(FunctionsRunOnContextScheduler, framework::DatasetMode::ALL)
+{
+    CountingScheduler scheduler;
+    RuntimeContext    ctx;
+    ctx.set_scheduler(&scheduler);
+
+    const TensorShape tensor_shape(32, 16);
+    Tensor            act_src  = create_tensor<Tensor>(tensor_shape, DataType::F32, 1);
+    Tensor            act_dst  = create_tensor<Tensor>(tensor_shape, DataType::F32, 1);
+    Tensor            and_src0 = create_tensor<Tensor>(tensor_shape, DataType::U8, 1);
+    Tensor            and_src1 = create_tensor<Tensor>(tensor_shape, DataType::U8, 1);
+    Tensor            and_dst  = create_tensor<Tensor>(tensor_shape, DataType::U8, 1);
+
+    NEActivationLayer act_layer(&ctx);
+    NEBitwiseAnd      and_layer(&ctx);
+    act_layer.configure(&act_src, &act_dst, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    and_layer.configure(&and_src0, &and_src1, &and_dst);
+
+    for (auto *tensor : {&act_src, &act_dst, &and_src0, &and_src1, &and_dst})
+    {
+        tensor->allocator()->allocate();
+    }
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    library->fill(Accessor(act_src), distribution, 0);
+    library->fill_tensor_uniform(Accessor(and_src0), 1);
+    library->fill_tensor_uniform(Accessor(and_src1), 2);
+
+    act_layer.run();
+    ARM_COMPUTE_EXPECT(scheduler.num_scheduled() == 1, framework::LogLevel::ERRORS);
+    and_layer.run();
+    ARM_COMPUTE_EXPECT(scheduler.num_scheduled() == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(arm_compute::Scheduler::get_thread_scheduler() == nullptr, framework::LogLevel::ERRORS);
+
+    Window window;
+    window.use_tensor_dimensions(tensor_shape);
+    Iterator src0_it(&and_src0, window);
+    Iterator src1_it(&and_src1, window);
+    Iterator dst_it(&and_dst, window);
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        const bool match = (*dst_it.ptr() == (*src0_it.ptr() & *src1_it.ptr()));
+        ARM_COMPUTE_EXPECT(match, framework::LogLevel::ERRORS);
+    },
+    src0_it, src1_it, dst_it);
+}
+
 #if !defined(BARE_METAL)
 // This test tries scheduling work concurrently from two independent threads
 TEST_CASE(MultipleThreadedScheduller, framework::DatasetMode::ALL)
@@ -171,6 +273,96 @@ TEST_CASE(MultipleThreadedScheduller, framework::DatasetMode::ALL)
 #endif // !defined(BARE_METAL)
 
 TEST_SUITE_END() // RuntimeContext
+
+TEST_SUITE(SchedulerPartitions)
+
+TEST_CASE(SplitCores, framework::DatasetMode::ALL)
+{
+    const auto core_sets = SchedulerPartitions::split_cores(3, 8);
+
+    ARM_COMPUTE_ASSERT(core_sets.size() == 3);
+    ARM_COMPUTE_EXPECT(core_sets[0] == SchedulerPartitions::CoreSet({0, 1, 2}), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(core_sets[1] == SchedulerPartitions::CoreSet({3, 4, 5}), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(core_sets[2] == SchedulerPartitions::CoreSet({6, 7}), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(ScopedBinding, framework::DatasetMode::ALL)
+{
+    auto        scheduler        = SchedulerFactory::create();
+    IScheduler *global_scheduler = &Scheduler::get();
+    {
+        SchedulerScope scope(scheduler.get());
+        ARM_COMPUTE_EXPECT(&Scheduler::get() == scheduler.get(), framework::LogLevel::ERRORS);
+        {
+            // A null context must not change the current binding
+            SchedulerScope nested(static_cast<IRuntimeContext *>(nullptr));
+            ARM_COMPUTE_EXPECT(&Scheduler::get() == scheduler.get(), framework::LogLevel::ERRORS);
+        }
+    }
+    ARM_COMPUTE_EXPECT(&Scheduler::get() == global_scheduler, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(Scheduler::get_thread_scheduler() == nullptr, framework::LogLevel::ERRORS);
+}
+
+#if !defined(BARE_METAL)
+// Each application thread binds its own partition and runs a function without using the process-wide scheduler
+TEST_CASE(BindPerThread, framework::DatasetMode::ALL)
+{
+    const unsigned int num_cores = Scheduler::get().cpu_info().get_cpu_num();
+    if (num_cores < 2)
+    {
+        return;
+    }
+
+    SchedulerPartitions partitions(2, num_cores);
+    ARM_COMPUTE_ASSERT(partitions.num_partitions() == 2);
+
+    const TensorShape   tensor_shape(128, 128);
+    ActivationLayerInfo activation_info(ActivationLayerInfo::ActivationFunction::LINEAR);
+    Tensor              src[2];
+    Tensor              dst[2];
+    NEActivationLayer   act[2];
+    for (int i = 0; i < 2; ++i)
+    {
+        src[i] = create_tensor<Tensor>(tensor_shape, DataType::F32, 1);
+        dst[i] = create_tensor<Tensor>(tensor_shape, DataType::F32, 1);
+        act[i].configure(&src[i], &dst[i], activation_info);
+        src[i].allocator()->allocate();
+        dst[i].allocator()->allocate();
+        std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+        library->fill(Accessor(src[i]), distribution, 0);
+    }
+
+    bool bound[2] = {false, false};
+    auto worker   = [&](int i)
+    {
+        partitions.bind_current_thread(i, false);
+        bound[i] = &Scheduler::get() == &partitions.scheduler(i);
+        act[i].run();
+        Scheduler::set_thread_scheduler(nullptr);
+    };
+
+    std::thread thread0(worker, 0);
+    std::thread thread1(worker, 1);
+    thread0.join();
+    thread1.join();
+
+    ARM_COMPUTE_EXPECT(bound[0] && bound[1], framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(Scheduler::get_thread_scheduler() == nullptr, framework::LogLevel::ERRORS);
+
+    Window window;
+    window.use_tensor_dimensions(dst[0].info()->tensor_shape());
+    Iterator t0_it(&dst[0], window);
+    Iterator t1_it(&dst[1], window);
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        const bool match = (*reinterpret_cast<float *>(t0_it.ptr()) == *reinterpret_cast<float *>(t1_it.ptr()));
+        ARM_COMPUTE_EXPECT(match, framework::LogLevel::ERRORS);
+    },
+    t0_it, t1_it);
+}
+#endif // !defined(BARE_METAL)
+
+TEST_SUITE_END() // SchedulerPartitions
 TEST_SUITE_END() // UNIT
 TEST_SUITE_END() // Neon
 } // namespace validation
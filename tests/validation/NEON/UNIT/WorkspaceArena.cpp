@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/WorkspaceArena.h"
+
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/runtime/experimental/operators/CpuSoftmax.h"
+#include "arm_compute/runtime/IAllocator.h"
+#include "arm_compute/runtime/RuntimeContext.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(WorkspaceArena)
+
+TEST_CASE(BumpAndRecycle, framework::DatasetMode::ALL)
+{
+    arm_compute::WorkspaceArena arena{};
+    ARM_COMPUTE_EXPECT(arena.capacity() == 0, framework::LogLevel::ERRORS);
+
+    const auto run_workload = [&]()
+    {
+        void *a = arena.allocate(100, 64);
+        void *b = arena.allocate(1000, 128);
+        void *c = arena.allocate(7, 4);
+        ARM_COMPUTE_ASSERT(a != nullptr && b != nullptr && c != nullptr);
+        ARM_COMPUTE_EXPECT(arm_compute::utility::check_aligned(a, 64), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(arm_compute::utility::check_aligned(b, 128), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(arm_compute::utility::check_aligned(c, 4), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(arena.usage() >= 1107, framework::LogLevel::ERRORS);
+
+        arena.release(b);
+        arena.release(a);
+        arena.release(c);
+        ARM_COMPUTE_EXPECT(arena.usage() == 0, framework::LogLevel::ERRORS);
+        return std::vector<void *>{a, b, c};
+    };
+
+    // First run: the requests are served by overflow blocks, merged into the main block once released
+    run_workload();
+    const size_t peak     = arena.peak_usage();
+    const size_t capacity = arena.capacity();
+    ARM_COMPUTE_EXPECT(peak >= 1107, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(capacity >= peak, framework::LogLevel::ERRORS);
+
+    // Following runs are served by the main block, which is not reallocated
+    const auto first  = run_workload();
+    const auto second = run_workload();
+    ARM_COMPUTE_EXPECT(first == second, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(arena.capacity() == capacity, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(arena.peak_usage() == peak, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(AllocationFailure, framework::DatasetMode::ALL)
+{
+    /** Allocator that can not provide any memory */
+    class FailingAllocator final : public IAllocator
+    {
+    public:
+        void *allocate(size_t size, size_t alignment) override
+        {
+            ARM_COMPUTE_UNUSED(size, alignment);
+            return nullptr;
+        }
+        void free(void *ptr) override
+        {
+            ARM_COMPUTE_UNUSED(ptr);
+        }
+        std::unique_ptr<IMemoryRegion> make_region(size_t size, size_t alignment) override
+        {
+            ARM_COMPUTE_UNUSED(size, alignment);
+            return nullptr;
+        }
+    };
+
+    FailingAllocator            allocator{};
+    arm_compute::WorkspaceArena arena(&allocator);
+
+    // The failure must be reported whether asserts are enabled or not
+    bool failed = false;
+    try
+    {
+        arena.allocate(100, 64);
+    }
+    catch (const std::runtime_error &)
+    {
+        failed = true;
+    }
+    ARM_COMPUTE_EXPECT(failed, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(arena.usage() == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(Reserve, framework::DatasetMode::ALL)
+{
+    arm_compute::WorkspaceArena arena{};
+
+    experimental::MemoryRequirements reqs{};
+    reqs.emplace_back(0, experimental::MemoryLifetime::Temporary, 1000, 64);
+    reqs.emplace_back(1, experimental::MemoryLifetime::Temporary, 0, 64);
+    reqs.emplace_back(2, experimental::MemoryLifetime::Prepare, 5000, 256);
+    arena.reserve(reqs);
+    ARM_COMPUTE_EXPECT(arena.capacity() >= 6000, framework::LogLevel::ERRORS);
+
+    // A reserved arena serves the requirements from its main block
+    const size_t capacity = arena.capacity();
+    void        *a        = arena.allocate(1000, 64);
+    void        *b        = arena.allocate(5000, 256);
+    ARM_COMPUTE_EXPECT(a < b, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(static_cast<uint8_t *>(b) + 5000 <= static_cast<uint8_t *>(a) + capacity,
+                       framework::LogLevel::ERRORS);
+    arena.release(a);
+    arena.release(b);
+    ARM_COMPUTE_EXPECT(arena.capacity() == capacity, framework::LogLevel::ERRORS);
+
+    // Requests made while buffers are in use are deferred
+    void *c = arena.allocate(10, 1);
+    arena.reserve(4 * capacity);
+    ARM_COMPUTE_EXPECT(arena.capacity() == capacity, framework::LogLevel::ERRORS);
+    arena.release(c);
+    ARM_COMPUTE_EXPECT(arena.capacity() >= 4 * capacity, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(OperatorWithoutWorkspace, framework::DatasetMode::ALL)
+{
+    const TensorShape      shape(67U, 13U, 2U);
+    const QuantizationInfo src_qinfo(0.5f, 10);
+    const QuantizationInfo dst_qinfo(1.f / 256.f, 0);
+
+    auto src_info = TensorInfo(shape, 1, DataType::QASYMM8, src_qinfo);
+    auto dst_info = TensorInfo(shape, 1, DataType::QASYMM8, dst_qinfo);
+
+    arm_compute::experimental::op::CpuSoftmax softmax;
+    softmax.configure(&src_info, &dst_info);
+
+    size_t workspace_size = 0;
+    for (const auto &req : softmax.workspace())
+    {
+        workspace_size += req.size;
+    }
+    ARM_COMPUTE_ASSERT(workspace_size > 0);
+
+    auto src = create_tensor<Tensor>(src_info);
+    auto ref = create_tensor<Tensor>(dst_info);
+    auto dst = create_tensor<Tensor>(dst_info);
+    src.allocator()->allocate();
+    ref.allocator()->allocate();
+    dst.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(src), 0);
+
+    // Reference run: the workspace is allocated by the operator
+    ITensorPack ref_pack{{TensorType::ACL_SRC, &src}, {TensorType::ACL_DST, &ref}};
+    softmax.run(ref_pack);
+
+    // Runs with an arena bound through a runtime context
+    arm_compute::WorkspaceArena arena{};
+    RuntimeContext              ctx{};
+    ctx.set_workspace_arena(&arena);
+    ARM_COMPUTE_EXPECT(ctx.workspace_arena() == &arena, framework::LogLevel::ERRORS);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        WorkspaceArenaScope scope(&ctx);
+        ARM_COMPUTE_EXPECT(arm_compute::WorkspaceArena::get_thread_arena() == &arena, framework::LogLevel::ERRORS);
+
+        ITensorPack pack{{TensorType::ACL_SRC, &src}, {TensorType::ACL_DST, &dst}};
+        softmax.run(pack);
+        for (size_t j = 0; j < dst.info()->total_size(); ++j)
+        {
+            ARM_COMPUTE_EXPECT(dst.buffer()[j] == ref.buffer()[j], framework::LogLevel::ERRORS);
+        }
+
+        // The workspace is given back after every run and the arena settles to the peak workspace
+        ARM_COMPUTE_EXPECT(arena.usage() == 0, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(arena.peak_usage() == workspace_size, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(arena.capacity() >= workspace_size, framework::LogLevel::ERRORS);
+    }
+    ARM_COMPUTE_EXPECT(arm_compute::WorkspaceArena::get_thread_arena() == nullptr, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // WorkspaceArena
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/mutators/CalibratedQuantizationMutator.h"
+#include "arm_compute/graph/QuantizationCalibrator.h"
+#include "arm_compute/graph/Tensor.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/validation/helpers/GraphHelpers.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using helper::TestGraph;
+using helper::VectorAccessor;
+
+namespace
+{
+const NodeParams   params{"", Target::NEON};
+const TensorShape  src_shape(4U, 6U, 6U);
+const unsigned int num_channels = 4;
+
+/** Values of the input and of the constants of the test graph */
+struct GraphValues
+{
+    explicit GraphValues(std::random_device::result_type seed)
+        : src(helper::uniform_values(src_shape.total_size(), -1.f, 1.f, seed)),
+          weights0(helper::uniform_values(num_channels * num_channels, -1.f, 1.f, seed + 1)),
+          bias0(helper::uniform_values(num_channels, -0.5f, 0.5f, seed + 2)),
+          mean(helper::uniform_values(num_channels, -0.5f, 0.5f, seed + 3)),
+          var(helper::uniform_values(num_channels, 0.5f, 1.5f, seed + 4)),
+          beta(helper::uniform_values(num_channels, -0.5f, 0.5f, seed + 5)),
+          gamma(helper::uniform_values(num_channels, 0.5f, 1.5f, seed + 6)),
+          weights1(helper::uniform_values(num_channels * num_channels, -1.f, 1.f, seed + 7))
+    {
+    }
+
+    std::vector<float> src;
+    std::vector<float> weights0;
+    std::vector<float> bias0;
+    std::vector<float> mean;
+    std::vector<float> var;
+    std::vector<float> beta;
+    std::vector<float> gamma;
+    std::vector<float> weights1;
+};
+
+std::unique_ptr<VectorAccessor> fill(std::vector<float> &values)
+{
+    return std::make_unique<VectorAccessor>(values, true);
+}
+
+/** Builds input -> conv -> batch normalization -> conv -> output and returns the ID of the batch normalization node */
+NodeID add_conv_bn_conv(Graph &g, GraphValues &values, std::vector<float> &dst)
+{
+    const TensorDescriptor desc(src_shape, DataType::F32, QuantizationInfo(), DataLayout::NHWC);
+
+    const NodeID input = GraphBuilder::add_input_node(g, params, desc, fill(values.src));
+    const NodeID conv0 = GraphBuilder::add_convolution_node(
+        g, params, {input, 0}, Size2D(1U, 1U), num_channels, PadStrideInfo(), 1U, graph::ConvolutionMethod::Default,
+        FastMathHint::Disabled, fill(values.weights0), fill(values.bias0));
+    const NodeID bn    = GraphBuilder::add_batch_normalization_node(g, params, {conv0, 0}, 0.001f, fill(values.mean),
+                                                                    fill(values.var), fill(values.beta),
+                                                                    fill(values.gamma));
+    const NodeID conv1 = GraphBuilder::add_convolution_node(
+        g, params, {bn, 0}, Size2D(1U, 1U), num_channels, PadStrideInfo(), 1U, graph::ConvolutionMethod::Default,
+        FastMathHint::Disabled, fill(values.weights1));
+    GraphBuilder::add_output_node(g, params, {conv1, 0}, std::make_unique<VectorAccessor>(dst, false));
+    return bn;
+}
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(Graph)
+TEST_SUITE(CalibratedQuantizationMutator)
+
+TEST_CASE(ConvertAroundBatchNormalization, framework::DatasetMode::ALL)
+{
+    GraphValues            values(library->seed());
+    QuantizationCalibrator calib{};
+
+    // Record the ranges with a FP32 run
+    std::vector<float> ref{};
+    {
+        GraphConfig config{};
+        config.calibrator = &calib;
+
+        TestGraph tg("CalibratedQuantizationReference");
+        add_conv_bn_conv(tg.graph(), values, ref);
+
+        PassManager pm;
+        tg.finalize(pm, config);
+        tg.run();
+    }
+
+    // Build the same graph, so that the tensors have the same IDs, and quantize it with the recorded ranges
+    GraphConfig config{};
+    config.calibrator                  = &calib;
+    config.use_calibrated_quantization = true;
+
+    std::vector<float> dst{};
+    TestGraph          tg("CalibratedQuantization");
+    Graph             &g  = tg.graph();
+    const NodeID       bn = add_conv_bn_conv(g, values, dst);
+
+    auto        mutator     = std::make_unique<CalibratedQuantizationMutator>(calib);
+    const auto *mutator_ptr = mutator.get();
+    PassManager pm;
+    pm.append(std::move(mutator));
+    tg.finalize(pm, config);
+    tg.run();
+
+    // Both convolutions are quantized, the batch normalization isn't supported so it stays in FP32
+    ARM_COMPUTE_EXPECT(mutator_ptr->num_quantized_nodes() == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(g.nodes(NodeType::QuantizationLayer).size() == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(g.nodes(NodeType::DequantizationLayer).size() == 2, framework::LogLevel::ERRORS);
+
+    const INode *bn_node = g.node(bn);
+    ARM_COMPUTE_EXPECT(bn_node->input(0)->desc().data_type == DataType::F32, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(bn_node->output(0)->desc().data_type == DataType::F32, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(bn_node->input_edge(0)->producer()->type() == NodeType::DequantizationLayer,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(bn_node->output_edges().size() == 1, framework::LogLevel::ERRORS);
+    for (const EdgeID &eid : bn_node->output_edges())
+    {
+        const INode *consumer = g.edge(eid)->consumer();
+        ARM_COMPUTE_EXPECT(consumer->type() == NodeType::QuantizationLayer, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(consumer->output(0)->desc().data_type == DataType::QASYMM8_SIGNED,
+                           framework::LogLevel::ERRORS);
+    }
+
+    // The quantized graph approximates the FP32 one within a few quantization steps
+    ARM_COMPUTE_ASSERT(dst.size() == ref.size());
+    float max_abs = 0.f;
+    for (const float v : ref)
+    {
+        max_abs = std::max(max_abs, std::abs(v));
+    }
+    for (size_t i = 0; i < ref.size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(std::abs(dst[i] - ref[i]) <= 0.1f * max_abs, framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_SUITE_END() // CalibratedQuantizationMutator
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
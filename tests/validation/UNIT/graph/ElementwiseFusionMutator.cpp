@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/mutators/ElementwiseFusionMutator.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/validation/helpers/GraphHelpers.h"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using helper::TestGraph;
+using helper::VectorAccessor;
+
+namespace
+{
+const NodeParams  params{"", Target::NEON};
+const TensorShape shape(8U, 4U, 3U);
+
+/** Values of the three inputs of the chain */
+struct ChainValues
+{
+    std::vector<float> a;
+    std::vector<float> b;
+    std::vector<float> c;
+};
+
+NodeID add_input(Graph &g, std::vector<float> &values)
+{
+    return GraphBuilder::add_input_node(g, params, TensorDescriptor(shape, DataType::F32),
+                                        std::make_unique<VectorAccessor>(values, true));
+}
+
+// Builds logistic((a + b) * c)
+void add_chain(Graph &g, ChainValues &values, std::vector<float> &dst)
+{
+    const NodeID a   = add_input(g, values.a);
+    const NodeID b   = add_input(g, values.b);
+    const NodeID c   = add_input(g, values.c);
+    const NodeID add = GraphBuilder::add_elementwise_node(g, params, {a, 0}, {b, 0}, EltwiseOperation::Add);
+    const NodeID mul = GraphBuilder::add_elementwise_node(g, params, {add, 0}, {c, 0}, EltwiseOperation::Mul);
+    const NodeID act = GraphBuilder::add_activation_node(
+        g, params, {mul, 0}, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC));
+    GraphBuilder::add_output_node(g, params, {act, 0}, std::make_unique<VectorAccessor>(dst, false));
+}
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(Graph)
+TEST_SUITE(ElementwiseFusionMutator)
+
+TEST_CASE(FuseAddMulActivation, framework::DatasetMode::ALL)
+{
+    ChainValues values{helper::uniform_values(shape.total_size(), -2.f, 2.f, library->seed()),
+                       helper::uniform_values(shape.total_size(), -2.f, 2.f, library->seed() + 1),
+                       helper::uniform_values(shape.total_size(), -2.f, 2.f, library->seed() + 2)};
+
+    // Reference run of the separate nodes
+    std::vector<float> ref{};
+    TestGraph          ref_graph("ElementwiseFusionReference");
+    add_chain(ref_graph.graph(), values, ref);
+    PassManager ref_pm;
+    ref_graph.finalize(ref_pm);
+    ref_graph.run();
+
+    std::vector<float> dst{};
+    TestGraph          tg("ElementwiseFusion");
+    add_chain(tg.graph(), values, dst);
+    PassManager pm;
+    pm.append(std::make_unique<ElementwiseFusionMutator>());
+    tg.finalize(pm);
+    tg.run();
+
+    Graph &g = tg.graph();
+#ifdef __aarch64__
+    // The add, the mul and the activation are collapsed into a single node reading the three inputs
+    ARM_COMPUTE_ASSERT(g.nodes(NodeType::ElementwiseExpressionLayer).size() == 1);
+    ARM_COMPUTE_EXPECT(g.nodes(NodeType::EltwiseLayer).empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(g.nodes(NodeType::ActivationLayer).empty(), framework::LogLevel::ERRORS);
+
+    const INode *fused = g.node(g.nodes(NodeType::ElementwiseExpressionLayer).front());
+    ARM_COMPUTE_EXPECT(fused->num_inputs() == 3, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(fused->output_edges().size() == 1, framework::LogLevel::ERRORS);
+#else  // __aarch64__
+    // There is no fused kernel, so the nodes are left untouched
+    ARM_COMPUTE_EXPECT(g.nodes(NodeType::ElementwiseExpressionLayer).empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(g.nodes(NodeType::EltwiseLayer).size() == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(g.nodes(NodeType::ActivationLayer).size() == 1, framework::LogLevel::ERRORS);
+#endif // __aarch64__
+
+    ARM_COMPUTE_ASSERT(!ref.empty() && dst.size() == ref.size());
+    for (size_t i = 0; i < ref.size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(std::abs(dst[i] - ref[i]) <= 1e-4f, framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_SUITE_END() // ElementwiseFusionMutator
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/mutators/LayoutPropagationMutator.h"
+#include "arm_compute/graph/Tensor.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/validation/helpers/GraphHelpers.h"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using helper::TestGraph;
+using helper::VectorAccessor;
+
+namespace
+{
+const NodeParams        params{"", Target::NEON};
+const TensorShape       nchw_shape(6U, 5U, 4U);
+const TensorShape       nhwc_shape(4U, 6U, 5U);
+const PermutationVector nchw_to_nhwc(2U, 0U, 1U);
+const PermutationVector nhwc_to_nchw(1U, 2U, 0U);
+
+/** Function building a graph that reads @p src and writes @p dst */
+using BuildGraphFunction = std::function<void(Graph &g, std::vector<float> &src, std::vector<float> &dst)>;
+
+NodeID add_input(Graph &g, const TensorShape &shape, DataLayout layout, std::vector<float> &src)
+{
+    return GraphBuilder::add_input_node(g, params, TensorDescriptor(shape, DataType::F32, QuantizationInfo(), layout),
+                                        std::make_unique<VectorAccessor>(src, true));
+}
+
+void add_output(Graph &g, NodeID producer, std::vector<float> &dst)
+{
+    GraphBuilder::add_output_node(g, params, {producer, 0}, std::make_unique<VectorAccessor>(dst, false));
+}
+
+NodeID add_relu(Graph &g, NodeID producer)
+{
+    return GraphBuilder::add_activation_node(g, params, {producer, 0},
+                                             ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+}
+
+/** Runs the graph without mutation passes, to get the reference output */
+std::vector<float> run_unmutated(const BuildGraphFunction &build, std::vector<float> &src)
+{
+    std::vector<float> dst{};
+    TestGraph          tg("LayoutPropagationReference");
+    build(tg.graph(), src, dst);
+
+    PassManager pm;
+    tg.finalize(pm);
+    tg.run();
+    return dst;
+}
+
+/** Runs the graph with the layout propagation and checks the permutations left, the permutations removed and that
+ * the output matches the unmutated graph
+ *
+ * @param[in] build                 Function building the graph
+ * @param[in] src                   Input values
+ * @param[in] expected_num_permutes Expected number of permutations left
+ * @param[in] expected_num_removed  Expected number of permutations removed
+ * @param[in] check                 (Optional) Additional check of the mutated graph
+ */
+void run_mutated(const BuildGraphFunction           &build,
+                 std::vector<float>                 &src,
+                 size_t                              expected_num_permutes,
+                 unsigned int                        expected_num_removed,
+                 const std::function<void(Graph &)> &check = nullptr)
+{
+    const std::vector<float> ref = run_unmutated(build, src);
+
+    std::vector<float> dst{};
+    TestGraph          tg("LayoutPropagation");
+    build(tg.graph(), src, dst);
+
+    auto        mutator     = std::make_unique<LayoutPropagationMutator>();
+    const auto *mutator_ptr = mutator.get();
+    PassManager pm;
+    pm.append(std::move(mutator));
+    tg.finalize(pm);
+    tg.run();
+
+    ARM_COMPUTE_EXPECT(tg.graph().nodes(NodeType::PermuteLayer).size() == expected_num_permutes,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(mutator_ptr->num_removed_permutes() == expected_num_removed, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!ref.empty() && dst == ref, framework::LogLevel::ERRORS);
+    if (check)
+    {
+        check(tg.graph());
+    }
+}
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(Graph)
+TEST_SUITE(LayoutPropagationMutator)
+
+TEST_CASE(RemoveInversePairThroughActivation, framework::DatasetMode::ALL)
+{
+    std::vector<float> src = helper::uniform_values(nchw_shape.total_size(), -1.f, 1.f, library->seed());
+
+    // The activation runs in NCHW once both permutations are removed
+    const BuildGraphFunction build = [](Graph &g, std::vector<float> &in, std::vector<float> &out)
+    {
+        const NodeID input   = add_input(g, nchw_shape, DataLayout::NCHW, in);
+        const NodeID to_nhwc = GraphBuilder::add_permute_node(g, params, {input, 0}, nchw_to_nhwc, DataLayout::NHWC);
+        const NodeID act     = add_relu(g, to_nhwc);
+        const NodeID to_nchw = GraphBuilder::add_permute_node(g, params, {act, 0}, nhwc_to_nchw, DataLayout::NCHW);
+        add_output(g, to_nchw, out);
+    };
+
+    run_mutated(build, src, 0, 2);
+}
+
+TEST_CASE(MergeConsecutivePermutes, framework::DatasetMode::ALL)
+{
+    std::vector<float> src = helper::uniform_values(nchw_shape.total_size(), -1.f, 1.f, library->seed());
+
+    // Applying NCHW to NHWC twice isn't the identity, so the two permutations become one
+    const BuildGraphFunction build = [](Graph &g, std::vector<float> &in, std::vector<float> &out)
+    {
+        const NodeID input  = add_input(g, nchw_shape, DataLayout::NCHW, in);
+        const NodeID first  = GraphBuilder::add_permute_node(g, params, {input, 0}, nchw_to_nhwc, DataLayout::NHWC);
+        const NodeID second = GraphBuilder::add_permute_node(g, params, {first, 0}, nchw_to_nhwc, DataLayout::NCHW);
+        add_output(g, second, out);
+    };
+
+    run_mutated(build, src, 1, 1);
+}
+
+TEST_CASE(FoldPermutedConstant, framework::DatasetMode::ALL)
+{
+    std::vector<float> src = helper::uniform_values(nhwc_shape.total_size(), -1.f, 1.f, library->seed());
+    std::vector<float> cst = helper::uniform_values(nchw_shape.total_size(), -1.f, 1.f, library->seed() + 1);
+
+    // The NCHW constant is replaced by a NHWC constant, permuted when it is loaded
+    const BuildGraphFunction build = [&](Graph &g, std::vector<float> &in, std::vector<float> &out)
+    {
+        const NodeID input   = add_input(g, nhwc_shape, DataLayout::NHWC, in);
+        const NodeID cst_nid = GraphBuilder::add_const_node(g, params, TensorDescriptor(nchw_shape, DataType::F32),
+                                                            std::make_unique<VectorAccessor>(cst, true));
+        const NodeID to_nhwc = GraphBuilder::add_permute_node(g, params, {cst_nid, 0}, nchw_to_nhwc, DataLayout::NHWC);
+        const NodeID add     = GraphBuilder::add_elementwise_node(g, params, {input, 0}, {to_nhwc, 0},
+                                                                  EltwiseOperation::Add);
+        add_output(g, add, out);
+    };
+
+    run_mutated(build, src, 0, 1,
+                [](Graph &g)
+                {
+                    ARM_COMPUTE_ASSERT(g.nodes(NodeType::Const).size() == 1);
+                    const INode *folded = g.node(g.nodes(NodeType::Const).front());
+                    ARM_COMPUTE_EXPECT(folded->output(0)->desc().shape == nhwc_shape, framework::LogLevel::ERRORS);
+                    ARM_COMPUTE_EXPECT(folded->output(0)->desc().layout == DataLayout::NHWC,
+                                       framework::LogLevel::ERRORS);
+                });
+}
+
+TEST_CASE(KeepBoundaryPermute, framework::DatasetMode::ALL)
+{
+    std::vector<float> src = helper::uniform_values(nchw_shape.total_size(), -1.f, 1.f, library->seed());
+
+    // The conversion of the input has no inverse, so it is left
+    const BuildGraphFunction build = [](Graph &g, std::vector<float> &in, std::vector<float> &out)
+    {
+        const NodeID input   = add_input(g, nchw_shape, DataLayout::NCHW, in);
+        const NodeID to_nhwc = GraphBuilder::add_permute_node(g, params, {input, 0}, nchw_to_nhwc, DataLayout::NHWC);
+        add_output(g, add_relu(g, to_nhwc), out);
+    };
+
+    run_mutated(build, src, 1, 0);
+}
+
+TEST_SUITE_END() // LayoutPropagationMutator
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/mutators/NodeFusionMutator.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/validation/helpers/GraphHelpers.h"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using helper::TestGraph;
+using helper::VectorAccessor;
+
+namespace
+{
+const NodeParams params{"", Target::NEON};
+
+/** Values of the input and of the parameters of a classifier head */
+struct ClassifierValues
+{
+    std::vector<float> src;
+    std::vector<float> weights;
+    std::vector<float> bias;
+};
+
+constexpr unsigned int classifier_channels = 16;
+constexpr unsigned int classifier_outputs  = 10;
+const TensorShape      classifier_shape(classifier_channels, 4U, 4U);
+
+ClassifierValues make_classifier_values(unsigned int num_fc_inputs)
+{
+    return ClassifierValues{
+        helper::uniform_values(classifier_shape.total_size(), -1.f, 1.f, library->seed()),
+        helper::uniform_values(num_fc_inputs * classifier_outputs, -1.f, 1.f, library->seed() + 1),
+        helper::uniform_values(classifier_outputs, -1.f, 1.f, library->seed() + 2)};
+}
+
+// Builds fc(avg_pool(src)) on a NHWC input, optionally copying the pooled tensor to @p pooled
+void add_classifier(Graph                  &g,
+                    ClassifierValues       &values,
+                    const PoolingLayerInfo &pool_info,
+                    std::vector<float>     &dst,
+                    std::vector<float>     *pooled = nullptr)
+{
+    const NodeID src = GraphBuilder::add_input_node(
+        g, params, TensorDescriptor(classifier_shape, DataType::F32, QuantizationInfo(), DataLayout::NHWC),
+        std::make_unique<VectorAccessor>(values.src, true));
+    const NodeID pool = GraphBuilder::add_pooling_node(g, params, {src, 0}, pool_info);
+    const NodeID fc   = GraphBuilder::add_fully_connected_layer(g, params, {pool, 0}, classifier_outputs,
+                                                                std::make_unique<VectorAccessor>(values.weights, true),
+                                                                std::make_unique<VectorAccessor>(values.bias, true));
+    GraphBuilder::add_output_node(g, params, {fc, 0}, std::make_unique<VectorAccessor>(dst, false));
+    if (pooled != nullptr)
+    {
+        GraphBuilder::add_output_node(g, params, {pool, 0}, std::make_unique<VectorAccessor>(*pooled, false));
+    }
+}
+
+/** Values of the input and of the stage parameters of an inverted residual block */
+struct BlockValues
+{
+    std::vector<float> src;
+    std::vector<float> expand_weights;
+    std::vector<float> expand_bias;
+    std::vector<float> dw_weights;
+    std::vector<float> dw_bias;
+    std::vector<float> project_weights;
+    std::vector<float> project_bias;
+};
+
+constexpr unsigned int block_channels          = 8;
+constexpr unsigned int block_expanded_channels = 24;
+const TensorShape      block_shape(block_channels, 6U, 6U);
+
+BlockValues make_block_values()
+{
+    const auto seed = library->seed();
+    return BlockValues{
+        helper::uniform_values(block_shape.total_size(), -1.f, 1.f, seed),
+        helper::uniform_values(block_channels * block_expanded_channels, -0.5f, 0.5f, seed + 1),
+        helper::uniform_values(block_expanded_channels, -0.5f, 0.5f, seed + 2),
+        helper::uniform_values(block_expanded_channels * 9, -0.5f, 0.5f, seed + 3),
+        helper::uniform_values(block_expanded_channels, -0.5f, 0.5f, seed + 4),
+        helper::uniform_values(block_expanded_channels * block_channels, -0.5f, 0.5f, seed + 5),
+        helper::uniform_values(block_channels, -0.5f, 0.5f, seed + 6)};
+}
+
+// Builds project(relu6(dwc3x3(relu6(expand(src))))), plus src if @p shortcut, on a NHWC input.
+// The expanded tensor is also copied to @p expanded if not nullptr.
+void add_inverted_residual_block(Graph              &g,
+                                 BlockValues        &values,
+                                 unsigned int        stride,
+                                 bool                shortcut,
+                                 std::vector<float> &dst,
+                                 std::vector<float> *expanded = nullptr)
+{
+    const ActivationLayerInfo relu6(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f);
+
+    const NodeID src = GraphBuilder::add_input_node(
+        g, params, TensorDescriptor(block_shape, DataType::F32, QuantizationInfo(), DataLayout::NHWC),
+        std::make_unique<VectorAccessor>(values.src, true));
+    const NodeID expand = GraphBuilder::add_convolution_node(
+        g, params, {src, 0}, Size2D(1, 1), block_expanded_channels, PadStrideInfo(1, 1, 0, 0), 1,
+        graph::ConvolutionMethod::Default, FastMathHint::Disabled,
+        std::make_unique<VectorAccessor>(values.expand_weights, true),
+        std::make_unique<VectorAccessor>(values.expand_bias, true));
+    const NodeID expand_act = GraphBuilder::add_activation_node(g, params, {expand, 0}, relu6);
+    const NodeID dwc        = GraphBuilder::add_depthwise_convolution_node(
+        g, params, {expand_act, 0}, Size2D(3, 3), PadStrideInfo(stride, stride, 1, 1), 1,
+        DepthwiseConvolutionMethod::Default, std::make_unique<VectorAccessor>(values.dw_weights, true),
+        std::make_unique<VectorAccessor>(values.dw_bias, true));
+    const NodeID dwc_act = GraphBuilder::add_activation_node(g, params, {dwc, 0}, relu6);
+    NodeID       last    = GraphBuilder::add_convolution_node(
+        g, params, {dwc_act, 0}, Size2D(1, 1), block_channels, PadStrideInfo(1, 1, 0, 0), 1,
+        graph::ConvolutionMethod::Default, FastMathHint::Disabled,
+        std::make_unique<VectorAccessor>(values.project_weights, true),
+        std::make_unique<VectorAccessor>(values.project_bias, true));
+    if (shortcut)
+    {
+        last = GraphBuilder::add_elementwise_node(g, params, {src, 0}, {last, 0}, EltwiseOperation::Add);
+    }
+    GraphBuilder::add_output_node(g, params, {last, 0}, std::make_unique<VectorAccessor>(dst, false));
+    if (expanded != nullptr)
+    {
+        GraphBuilder::add_output_node(g, params, {expand_act, 0},
+                                      std::make_unique<VectorAccessor>(*expanded, false));
+    }
+}
+
+// Runs the block without and with the fusion pass and compares the outputs
+void run_inverted_residual_block(unsigned int stride, bool shortcut)
+{
+    BlockValues values = make_block_values();
+
+    // Reference run of the separate nodes
+    std::vector<float> ref{};
+    TestGraph          ref_graph("InvertedResidualReference");
+    add_inverted_residual_block(ref_graph.graph(), values, stride, shortcut, ref);
+    PassManager ref_pm;
+    ref_graph.finalize(ref_pm);
+    ref_graph.run();
+
+    std::vector<float> dst{};
+    TestGraph          tg("InvertedResidual");
+    add_inverted_residual_block(tg.graph(), values, stride, shortcut, dst);
+    PassManager pm;
+    pm.append(std::make_unique<NodeFusionMutator>());
+    tg.finalize(pm);
+    tg.run();
+
+    // The three stages, their activations and the shortcut addition are replaced by a single node
+    Graph &g = tg.graph();
+    ARM_COMPUTE_ASSERT(g.nodes(NodeType::InvertedResidualLayer).size() == 1);
+    ARM_COMPUTE_EXPECT(g.nodes(NodeType::ConvolutionLayer).empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(g.nodes(NodeType::DepthwiseConvolutionLayer).empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(g.nodes(NodeType::ActivationLayer).empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(g.nodes(NodeType::EltwiseLayer).empty(), framework::LogLevel::ERRORS);
+
+    ARM_COMPUTE_ASSERT(!ref.empty() && dst.size() == ref.size());
+    for (size_t i = 0; i < ref.size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(std::abs(dst[i] - ref[i]) <= 1e-4f, framework::LogLevel::ERRORS);
+    }
+}
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(Graph)
+TEST_SUITE(NodeFusionMutator)
+
+TEST_CASE(FuseGlobalPoolingFullyConnected, framework::DatasetMode::ALL)
+{
+    ClassifierValues       values = make_classifier_values(classifier_channels);
+    const PoolingLayerInfo pool_info(PoolingType::AVG, DataLayout::NHWC);
+
+    // Reference run of the separate nodes
+    std::vector<float> ref{};
+    TestGraph          ref_graph("GlobalPoolingFullyConnectedReference");
+    add_classifier(ref_graph.graph(), values, pool_info, ref);
+    PassManager ref_pm;
+    ref_graph.finalize(ref_pm);
+    ref_graph.run();
+
+    std::vector<float> dst{};
+    TestGraph          tg("GlobalPoolingFullyConnected");
+    add_classifier(tg.graph(), values, pool_info, dst);
+    PassManager pm;
+    pm.append(std::make_unique<NodeFusionMutator>());
+    tg.finalize(pm);
+    tg.run();
+
+    // The pooling and the fully connected layer are replaced by a single node
+    Graph &g = tg.graph();
+    ARM_COMPUTE_ASSERT(g.nodes(NodeType::GlobalPoolingFullyConnectedLayer).size() == 1);
+    ARM_COMPUTE_EXPECT(g.nodes(NodeType::PoolingLayer).empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(g.nodes(NodeType::FullyConnectedLayer).empty(), framework::LogLevel::ERRORS);
+
+    ARM_COMPUTE_ASSERT(ref.size() == classifier_outputs && dst.size() == ref.size());
+    for (size_t i = 0; i < ref.size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(std::abs(dst[i] - ref[i]) <= 1e-4f, framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_CASE(RejectNonGlobalPooling, framework::DatasetMode::ALL)
+{
+    // 2x2 pooling with stride 2 leaves a 2x2 plane per channel
+    ClassifierValues       values = make_classifier_values(classifier_channels * 4);
+    const PoolingLayerInfo pool_info(PoolingType::AVG, 2, DataLayout::NHWC, PadStrideInfo(2, 2, 0, 0));
+
+    std::vector<float> dst{};
+    TestGraph          tg("NonGlobalPoolingFullyConnected");
+    add_classifier(tg.graph(), values, pool_info, dst);
+    PassManager pm;
+    pm.append(std::make_unique<NodeFusionMutator>());
+    tg.finalize(pm);
+
+    Graph &g = tg.graph();
+    ARM_COMPUTE_EXPECT(g.nodes(NodeType::GlobalPoolingFullyConnectedLayer).empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(g.nodes(NodeType::PoolingLayer).size() == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(g.nodes(NodeType::FullyConnectedLayer).size() == 1, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(RejectSharedPooledTensor, framework::DatasetMode::ALL)
+{
+    ClassifierValues       values = make_classifier_values(classifier_channels);
+    const PoolingLayerInfo pool_info(PoolingType::AVG, DataLayout::NHWC);
+
+    // The pooled tensor is also read by an output, so it must still be computed
+    std::vector<float> dst{};
+    std::vector<float> pooled{};
+    TestGraph          tg("SharedPooledTensorFullyConnected");
+    add_classifier(tg.graph(), values, pool_info, dst, &pooled);
+    PassManager pm;
+    pm.append(std::make_unique<NodeFusionMutator>());
+    tg.finalize(pm);
+    tg.run();
+
+    Graph &g = tg.graph();
+    ARM_COMPUTE_EXPECT(g.nodes(NodeType::GlobalPoolingFullyConnectedLayer).empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(g.nodes(NodeType::PoolingLayer).size() == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(g.nodes(NodeType::FullyConnectedLayer).size() == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(pooled.size() == classifier_channels, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(FuseInvertedResidualBlock, framework::DatasetMode::ALL)
+{
+    run_inverted_residual_block(1, true);
+}
+
+TEST_CASE(FuseStridedInvertedResidualBlock, framework::DatasetMode::ALL)
+{
+    // The strided block changes the spatial size, so it has no shortcut addition to absorb
+    run_inverted_residual_block(2, false);
+}
+
+TEST_CASE(RejectSharedExpandedTensor, framework::DatasetMode::ALL)
+{
+    BlockValues values = make_block_values();
+
+    // The expanded tensor is also read by an output, so it must still be computed
+    std::vector<float> dst{};
+    std::vector<float> expanded{};
+    TestGraph          tg("SharedExpandedTensorInvertedResidual");
+    add_inverted_residual_block(tg.graph(), values, 1, true, dst, &expanded);
+    PassManager pm;
+    pm.append(std::make_unique<NodeFusionMutator>());
+    tg.finalize(pm);
+    tg.run();
+
+    Graph &g = tg.graph();
+    ARM_COMPUTE_EXPECT(g.nodes(NodeType::InvertedResidualLayer).empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(g.nodes(NodeType::ConvolutionLayer).size() == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(g.nodes(NodeType::DepthwiseConvolutionLayer).size() == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(g.nodes(NodeType::EltwiseLayer).size() == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(expanded.size() == block_shape.total_size() / block_channels * block_expanded_channels,
+                       framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // NodeFusionMutator
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
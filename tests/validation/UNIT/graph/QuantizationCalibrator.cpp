@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/QuantizationCalibrator.h"
+#include "arm_compute/graph/Tensor.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/validation/helpers/GraphHelpers.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using helper::TestGraph;
+using helper::VectorAccessor;
+
+namespace
+{
+const NodeParams params{"", Target::NEON};
+
+/** Builds input -> relu -> output and returns the IDs of the input and activation output tensors */
+std::pair<TensorID, TensorID> add_relu(Graph &g, std::vector<float> &src, std::vector<float> &dst)
+{
+    const TensorDescriptor desc(TensorShape(src.size()), DataType::F32);
+    const NodeID input = GraphBuilder::add_input_node(g, params, desc, std::make_unique<VectorAccessor>(src, true));
+    const NodeID act   = GraphBuilder::add_activation_node(
+        g, params, {input, 0}, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    GraphBuilder::add_output_node(g, params, {act, 0}, std::make_unique<VectorAccessor>(dst, false));
+    return std::make_pair(g.node(input)->output(0)->id(), g.node(act)->output(0)->id());
+}
+
+/** Evenly spaced values in [-1, 1] followed by an outlier */
+std::vector<float> values_with_outlier(size_t num, float outlier)
+{
+    std::vector<float> values(num);
+    for (size_t i = 0; i < num - 1; ++i)
+    {
+        values[i] = -1.f + 2.f * static_cast<float>(i) / static_cast<float>(num - 2);
+    }
+    values[num - 1] = outlier;
+    return values;
+}
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(Graph)
+TEST_SUITE(QuantizationCalibrator)
+
+TEST_CASE(MinMax, framework::DatasetMode::ALL)
+{
+    std::vector<float> src{-2.f, -1.f, 0.5f, 3.f, 1.5f, -0.25f, 2.f, 1.f};
+    std::vector<float> dst{};
+
+    QuantizationCalibrator calib{};
+    GraphConfig            config{};
+    config.calibrator = &calib;
+
+    TestGraph  tg("CalibratorMinMax");
+    const auto tids = add_relu(tg.graph(), src, dst);
+
+    PassManager pm;
+    tg.finalize(pm, config);
+    tg.run();
+
+    ARM_COMPUTE_EXPECT(calib.has_range(tids.first, TensorShape(src.size())), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(calib.range(tids.first) == TensorRange(-2.f, 3.f), framework::LogLevel::ERRORS);
+
+    // The range always contains zero, so that it is exactly representable
+    ARM_COMPUTE_EXPECT(calib.range(tids.second) == TensorRange(0.f, 3.f), framework::LogLevel::ERRORS);
+
+    // The ranges accumulate over the runs
+    src = {-4.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f};
+    tg.run();
+    ARM_COMPUTE_EXPECT(calib.range(tids.first) == TensorRange(-4.f, 3.f), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(calib.range(tids.second) == TensorRange(0.f, 3.f), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(Percentile, framework::DatasetMode::ALL)
+{
+    std::vector<float> src = values_with_outlier(1000, 100.f);
+    std::vector<float> dst{};
+
+    CalibrationInfo info{};
+    info.method     = CalibrationMethod::PERCENTILE;
+    info.percentile = 99.f;
+
+    QuantizationCalibrator calib(info);
+    GraphConfig            config{};
+    config.calibrator = &calib;
+
+    TestGraph  tg("CalibratorPercentile");
+    const auto tids = add_relu(tg.graph(), src, dst);
+
+    PassManager pm;
+    tg.finalize(pm, config);
+    tg.run();
+
+    // The outlier is discarded, the bulk of the values is kept
+    const TensorRange range = calib.range(tids.first);
+    ARM_COMPUTE_EXPECT(range.first < -0.9f && range.first >= -1.f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(range.second > 0.9f && range.second < 1.5f, framework::LogLevel::ERRORS);
+
+    // The same values keep the outlier with min/max
+    QuantizationCalibrator minmax_calib{};
+    config.calibrator = &minmax_calib;
+
+    TestGraph  minmax_tg("CalibratorPercentileMinMax");
+    const auto minmax_tids = add_relu(minmax_tg.graph(), src, dst);
+    minmax_tg.finalize(pm, config);
+    minmax_tg.run();
+
+    ARM_COMPUTE_EXPECT(minmax_calib.range(minmax_tids.first) == TensorRange(-1.f, 100.f), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(PerChannelWeights, framework::DatasetMode::ALL)
+{
+    // 1x1 weights of 3 input and 2 output channels, with a different range per output channel
+    std::vector<float> weights{-1.f, 0.5f, 2.f, -0.25f, 0.125f, 0.75f};
+    std::vector<float> src = helper::uniform_values(3 * 4 * 4, -1.f, 1.f, library->seed());
+    std::vector<float> dst{};
+
+    QuantizationCalibrator calib{};
+    GraphConfig            config{};
+    config.calibrator = &calib;
+
+    TestGraph    tg("CalibratorPerChannel");
+    Graph       &g     = tg.graph();
+    const NodeID input = GraphBuilder::add_input_node(
+        g, params, TensorDescriptor(TensorShape(3U, 4U, 4U), DataType::F32, QuantizationInfo(), DataLayout::NHWC),
+        std::make_unique<VectorAccessor>(src, true));
+    const NodeID conv  = GraphBuilder::add_convolution_node(
+        g, params, {input, 0}, Size2D(1U, 1U), 2U, PadStrideInfo(), 1U, graph::ConvolutionMethod::Default,
+        FastMathHint::Disabled, std::make_unique<VectorAccessor>(weights, true));
+    GraphBuilder::add_output_node(g, params, {conv, 0}, std::make_unique<VectorAccessor>(dst, false));
+
+    // The constants are observed when the graph is finalized
+    PassManager pm;
+    tg.finalize(pm, config);
+
+    const graph::Tensor *w = g.node(conv)->input(1);
+    ARM_COMPUTE_EXPECT(QuantizationCalibrator::weights_channel_dimension(*g.node(conv)) == 3,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(calib.has_range(w->id(), w->desc().shape), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(calib.range(w->id()) == TensorRange(-1.f, 2.f), framework::LogLevel::ERRORS);
+
+    const std::vector<TensorRange> expected{TensorRange(-1.f, 2.f), TensorRange(-0.25f, 0.75f)};
+    ARM_COMPUTE_EXPECT(calib.channel_ranges(w->id()) == expected, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // QuantizationCalibrator
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/IGraphMutator.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/mutators/ReshapeAliasMutator.h"
+#include "arm_compute/graph/mutators/SplitLayerSubTensorMutator.h"
+#include "arm_compute/graph/nodes/ReshapeLayerNode.h"
+#include "arm_compute/graph/Tensor.h"
+
+#include "support/Cast.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/validation/helpers/GraphHelpers.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using helper::TestGraph;
+using helper::VectorAccessor;
+
+namespace
+{
+const NodeParams  params{"", Target::NEON};
+const TensorShape src_shape(8U, 6U, 2U);
+const TensorShape dst_shape(16U, 6U);
+
+/** Mutator padding the input of the reshape nodes, like a producer needing padding would do when configured */
+class PadReshapeInputMutator final : public IGraphMutator
+{
+public:
+    void mutate(Graph &g) override
+    {
+        for (auto &nid : g.nodes(NodeType::ReshapeLayer))
+        {
+            g.node(nid)->input(0)->handle()->tensor().info()->extend_padding(PaddingSize(1, 3, 1, 0));
+        }
+    }
+    MutationType type() const override
+    {
+        return MutationType::Backend;
+    }
+    const char *name() override
+    {
+        return "PadReshapeInputMutator";
+    }
+};
+
+bool is_reshape_enabled(Graph &g)
+{
+    ARM_COMPUTE_ASSERT(g.nodes(NodeType::ReshapeLayer).size() == 1);
+    const INode *node = g.node(g.nodes(NodeType::ReshapeLayer).front());
+    return arm_compute::utils::cast::polymorphic_downcast<const ReshapeLayerNode *>(node)->is_enabled();
+}
+
+std::vector<float> relu(std::vector<float> values)
+{
+    std::transform(values.begin(), values.end(), values.begin(), [](float v) { return std::max(v, 0.f); });
+    return values;
+}
+
+/** Builds input -> relu -> reshape -> output and returns the ID of the relu node */
+NodeID add_relu_reshape(Graph &g, std::vector<float> &src, std::vector<float> &dst)
+{
+    const NodeID input   = GraphBuilder::add_input_node(g, params, TensorDescriptor(src_shape, DataType::F32),
+                                                        std::make_unique<VectorAccessor>(src, true));
+    const NodeID act     = GraphBuilder::add_activation_node(
+        g, params, {input, 0}, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    const NodeID reshape = GraphBuilder::add_reshape_node(g, params, {act, 0}, dst_shape);
+    GraphBuilder::add_output_node(g, params, {reshape, 0}, std::make_unique<VectorAccessor>(dst, false));
+    return act;
+}
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(Graph)
+TEST_SUITE(ReshapeAliasMutator)
+
+TEST_CASE(AliasProducerOutput, framework::DatasetMode::ALL)
+{
+    std::vector<float> src = helper::uniform_values(src_shape.total_size(), -1.f, 1.f, library->seed());
+    std::vector<float> dst{};
+
+    TestGraph tg("ReshapeAlias");
+    add_relu_reshape(tg.graph(), src, dst);
+
+    PassManager pm;
+    pm.append(std::make_unique<ReshapeAliasMutator>());
+    tg.finalize(pm);
+    tg.run();
+
+    // The reshape is removed and its output views the output of the activation
+    ARM_COMPUTE_EXPECT(!is_reshape_enabled(tg.graph()), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(dst == relu(src), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(PaddedProducerOutput, framework::DatasetMode::ALL)
+{
+    std::vector<float> src = helper::uniform_values(src_shape.total_size(), -1.f, 1.f, library->seed());
+    std::vector<float> dst{};
+
+    TestGraph tg("ReshapeAliasPadded");
+    add_relu_reshape(tg.graph(), src, dst);
+
+    // The input is padded after the alias is created: the reshape must copy it again
+    PassManager pm;
+    pm.append(std::make_unique<ReshapeAliasMutator>());
+    pm.append(std::make_unique<PadReshapeInputMutator>());
+    tg.finalize(pm);
+    tg.run();
+
+    ARM_COMPUTE_EXPECT(is_reshape_enabled(tg.graph()), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(dst == relu(src), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(RejectMultipleReaders, framework::DatasetMode::ALL)
+{
+    std::vector<float> src = helper::uniform_values(src_shape.total_size(), -1.f, 1.f, library->seed());
+    std::vector<float> dst{};
+    std::vector<float> act_dst{};
+
+    TestGraph    tg("ReshapeAliasMultipleReaders");
+    const NodeID act = add_relu_reshape(tg.graph(), src, dst);
+    GraphBuilder::add_output_node(tg.graph(), params, {act, 0}, std::make_unique<VectorAccessor>(act_dst, false));
+
+    PassManager pm;
+    pm.append(std::make_unique<ReshapeAliasMutator>());
+    tg.finalize(pm);
+    tg.run();
+
+    ARM_COMPUTE_EXPECT(is_reshape_enabled(tg.graph()), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(dst == relu(src), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(act_dst == relu(src), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(RejectConstantInput, framework::DatasetMode::ALL)
+{
+    std::vector<float> weights = helper::uniform_values(src_shape.total_size(), -1.f, 1.f, library->seed());
+    std::vector<float> dst{};
+
+    TestGraph    tg("ReshapeAliasConstant");
+    Graph       &g       = tg.graph();
+    const NodeID cst     = GraphBuilder::add_const_node(g, params, TensorDescriptor(src_shape, DataType::F32),
+                                                        std::make_unique<VectorAccessor>(weights, true));
+    const NodeID reshape = GraphBuilder::add_reshape_node(g, params, {cst, 0}, dst_shape);
+    GraphBuilder::add_output_node(g, params, {reshape, 0}, std::make_unique<VectorAccessor>(dst, false));
+
+    PassManager pm;
+    pm.append(std::make_unique<ReshapeAliasMutator>());
+    tg.finalize(pm);
+    tg.run();
+
+    ARM_COMPUTE_EXPECT(is_reshape_enabled(g), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(dst == weights, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(RejectSplitOutput, framework::DatasetMode::ALL)
+{
+    std::vector<float> src = helper::uniform_values(src_shape.total_size(), -1.f, 1.f, library->seed());
+    std::vector<float> dst0{};
+    std::vector<float> dst1{};
+
+    // Split along the channels, so that each split output is a contiguous half of the input
+    TestGraph    tg("ReshapeAliasSplit");
+    Graph       &g       = tg.graph();
+    const NodeID input   = GraphBuilder::add_input_node(g, params, TensorDescriptor(src_shape, DataType::F32),
+                                                        std::make_unique<VectorAccessor>(src, true));
+    const NodeID split   = GraphBuilder::add_split_node(g, params, {input, 0}, 2, 2);
+    const NodeID reshape = GraphBuilder::add_reshape_node(g, params, {split, 0}, TensorShape(48U));
+    GraphBuilder::add_output_node(g, params, {reshape, 0}, std::make_unique<VectorAccessor>(dst0, false));
+    GraphBuilder::add_output_node(g, params, {split, 1}, std::make_unique<VectorAccessor>(dst1, false));
+
+    PassManager pm;
+    pm.append(std::make_unique<ReshapeAliasMutator>());
+    tg.finalize(pm);
+    tg.run();
+
+    ARM_COMPUTE_EXPECT(is_reshape_enabled(g), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(dst0.size() == 48 && std::equal(dst0.begin(), dst0.end(), src.begin()),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(dst1.size() == 48 && std::equal(dst1.begin(), dst1.end(), src.begin() + 48),
+                       framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(RejectSplitConsumer, framework::DatasetMode::ALL)
+{
+    std::vector<float> src = helper::uniform_values(src_shape.total_size(), -1.f, 1.f, library->seed());
+    std::vector<float> dst0{};
+    std::vector<float> dst1{};
+
+    // The split outputs are sub-tensors of the reshape output, so the reshape must keep its own handle
+    TestGraph    tg("ReshapeAliasSplitConsumer");
+    Graph       &g       = tg.graph();
+    const NodeID input   = GraphBuilder::add_input_node(g, params, TensorDescriptor(src_shape, DataType::F32),
+                                                        std::make_unique<VectorAccessor>(src, true));
+    const NodeID act     = GraphBuilder::add_activation_node(
+        g, params, {input, 0}, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    const NodeID reshape = GraphBuilder::add_reshape_node(g, params, {act, 0}, dst_shape);
+    const NodeID split   = GraphBuilder::add_split_node(g, params, {reshape, 0}, 2, 1);
+    GraphBuilder::add_output_node(g, params, {split, 0}, std::make_unique<VectorAccessor>(dst0, false));
+    GraphBuilder::add_output_node(g, params, {split, 1}, std::make_unique<VectorAccessor>(dst1, false));
+
+    PassManager pm;
+    pm.append(std::make_unique<ReshapeAliasMutator>());
+    pm.append(std::make_unique<SplitLayerSubTensorMutator>());
+    tg.finalize(pm);
+    tg.run();
+
+    const std::vector<float> ref = relu(src);
+    ARM_COMPUTE_EXPECT(is_reshape_enabled(g), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(dst0.size() == 48 && std::equal(dst0.begin(), dst0.end(), ref.begin()),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(dst1.size() == 48 && std::equal(dst1.begin(), dst1.end(), ref.begin() + 48),
+                       framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // ReshapeAliasMutator
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/nodes/RoPELayerNode.h"
+#include "arm_compute/graph/Tensor.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/validation/helpers/GraphHelpers.h"
+#include "tests/validation/reference/RoPE.h"
+
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using helper::TestGraph;
+using helper::VectorAccessor;
+
+namespace
+{
+const NodeParams  params{"", Target::NEON};
+const TensorShape q_shape(16U, 5U, 4U); // [head_dim, tokens, num_heads]
+const TensorShape k_shape(16U, 5U, 2U); // [head_dim, tokens, num_kv_heads]
+
+// Builds rope(q, k) with an output for the rotated queries and one for the rotated keys
+NodeID add_rope(Graph              &g,
+                std::vector<float> &q,
+                std::vector<float> &k,
+                std::vector<float> &q_dst,
+                std::vector<float> &k_dst,
+                const RoPEInfo     &info)
+{
+    const NodeID q_id = GraphBuilder::add_input_node(g, params, TensorDescriptor(q_shape, DataType::F32),
+                                                     std::make_unique<VectorAccessor>(q, true));
+    const NodeID k_id = GraphBuilder::add_input_node(g, params, TensorDescriptor(k_shape, DataType::F32),
+                                                     std::make_unique<VectorAccessor>(k, true));
+    const NodeID rope = GraphBuilder::add_rope_node(g, params, {q_id, 0}, {k_id, 0}, info);
+    GraphBuilder::add_output_node(g, params, {rope, 0}, std::make_unique<VectorAccessor>(q_dst, false));
+    GraphBuilder::add_output_node(g, params, {rope, 1}, std::make_unique<VectorAccessor>(k_dst, false));
+    return rope;
+}
+
+std::vector<float> reference_rope(const TensorShape &shape, const std::vector<float> &values, const RoPEInfo &info)
+{
+    SimpleTensor<float> src{shape, DataType::F32};
+    std::memcpy(src.data(), values.data(), values.size() * sizeof(float));
+
+    // The reference expects absolute positions
+    std::vector<int> positions(shape[1]);
+    for (size_t i = 0; i < positions.size(); ++i)
+    {
+        positions[i] = info.position_offset + static_cast<int>(i);
+    }
+
+    const SimpleTensor<float> dst = reference::rope(src, positions, info);
+    return std::vector<float>(dst.data(), dst.data() + dst.num_elements());
+}
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(Graph)
+TEST_SUITE(RoPELayerNode)
+
+TEST_CASE(ShapeInference, framework::DatasetMode::ALL)
+{
+    std::vector<float> q(q_shape.total_size());
+    std::vector<float> k(k_shape.total_size());
+    std::vector<float> q_dst{};
+    std::vector<float> k_dst{};
+    TestGraph          tg("RoPEShapeInference");
+    const NodeID       rope = add_rope(tg.graph(), q, k, q_dst, k_dst, RoPEInfo(RoPEMode::NEOX));
+
+    // Both outputs take the descriptors of their inputs, the positions input is optional
+    const INode *node = tg.graph().node(rope);
+    ARM_COMPUTE_ASSERT(node != nullptr && node->type() == NodeType::RoPELayer);
+    ARM_COMPUTE_EXPECT(node->num_inputs() == 3, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(node->input(2) == nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_ASSERT(node->num_outputs() == 2 && node->output(0) != nullptr && node->output(1) != nullptr);
+    ARM_COMPUTE_EXPECT(node->output(0)->desc().shape == q_shape, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(node->output(1)->desc().shape == k_shape, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(node->output(0)->desc().data_type == DataType::F32, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(node->output(1)->desc().data_type == DataType::F32, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(RunOnNEON, framework::DatasetMode::ALL)
+{
+    const RoPEInfo     info(RoPEMode::NEOX, 10000.f, 0, 3);
+    std::vector<float> q = helper::uniform_values(q_shape.total_size(), -1.f, 1.f, library->seed());
+    std::vector<float> k = helper::uniform_values(k_shape.total_size(), -1.f, 1.f, library->seed() + 1);
+    std::vector<float> q_dst{};
+    std::vector<float> k_dst{};
+
+    TestGraph    tg("RoPERun");
+    const NodeID rope = add_rope(tg.graph(), q, k, q_dst, k_dst, info);
+    PassManager  pm;
+    tg.finalize(pm);
+    tg.run();
+
+    // The node is assigned to and accepted by the CPU backend
+    INode *node = tg.graph().node(rope);
+    ARM_COMPUTE_ASSERT(node != nullptr);
+    ARM_COMPUTE_EXPECT(node->assigned_target() == Target::NEON, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(bool(backends::BackendRegistry::get().get_backend(Target::NEON).validate_node(*node)),
+                       framework::LogLevel::ERRORS);
+
+    const std::vector<float> q_ref = reference_rope(q_shape, q, info);
+    const std::vector<float> k_ref = reference_rope(k_shape, k, info);
+    ARM_COMPUTE_ASSERT(q_dst.size() == q_ref.size() && k_dst.size() == k_ref.size());
+    for (size_t i = 0; i < q_ref.size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(std::abs(q_dst[i] - q_ref[i]) <= 1e-3f, framework::LogLevel::ERRORS);
+    }
+    for (size_t i = 0; i < k_ref.size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(std::abs(k_dst[i] - k_ref[i]) <= 1e-3f, framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_SUITE_END() // RoPELayerNode
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_ELEMENTWISEEXPRESSIONFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_ELEMENTWISEEXPRESSIONFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/ElementwiseExpressionInfo.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ElementwiseExpression.h"
+
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+/** Evaluate an expression of three broadcast inputs of type @p TIn into an output of type @p TOut */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename TIn, typename TOut>
+class ElementwiseExpressionValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape shape0, TensorShape shape1, TensorShape shape2, ElementwiseExpressionInfo info, DataType src_data_type, DataType dst_data_type)
+    {
+        if(std::is_same<TensorType, Tensor>::value && // Cpu
+           (src_data_type == DataType::F16 || dst_data_type == DataType::F16) && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        const std::vector<TensorShape> shapes{ shape0, shape1, shape2 };
+        compute_target(shapes, info, src_data_type, dst_data_type);
+        compute_reference(shapes, info, src_data_type, dst_data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        // The last input is kept positive so that it can be divided by, raised to a power and passed to log and rsqrt
+        const float lo = (i == 2) ? 0.5f : -1.0f;
+        const float hi = (i == 2) ? 1.5f : 1.0f;
+        switch(tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{ lo, hi };
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution(lo, hi);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+                library->fill_tensor_uniform(tensor, i);
+        }
+    }
+
+    void compute_target(const std::vector<TensorShape> &shapes, const ElementwiseExpressionInfo &info, DataType src_data_type, DataType dst_data_type)
+    {
+        // Create tensors
+        std::vector<TensorType>          srcs(shapes.size());
+        std::vector<const ITensor *>     src_ptrs;
+        std::vector<const ITensorInfo *> src_infos;
+        for(size_t i = 0; i < shapes.size(); ++i)
+        {
+            srcs[i] = create_tensor<TensorType>(shapes[i], src_data_type);
+            src_ptrs.push_back(&srcs[i]);
+            src_infos.push_back(srcs[i].info());
+        }
+        TensorType dst;
+        dst.allocator()->init(TensorInfo(1, dst_data_type));
+
+        // Create and configure function
+        FunctionType expression;
+        expression.configure(src_ptrs, &dst, info);
+        ARM_COMPUTE_ERROR_THROW_ON(FunctionType::validate(src_infos, dst.info(), info));
+
+        // Allocate tensors
+        for(auto &src : srcs)
+        {
+            src.allocator()->allocate();
+        }
+        dst.allocator()->allocate();
+
+        // Fill tensors
+        for(size_t i = 0; i < srcs.size(); ++i)
+        {
+            fill(AccessorType(srcs[i]), i);
+        }
+
+        // Compute function
+        expression.run();
+
+        _target = std::move(dst);
+    }
+
+    void compute_reference(const std::vector<TensorShape> &shapes, const ElementwiseExpressionInfo &info, DataType src_data_type, DataType dst_data_type)
+    {
+        // Create reference
+        std::vector<SimpleTensor<TIn>> srcs;
+        for(size_t i = 0; i < shapes.size(); ++i)
+        {
+            srcs.emplace_back(shapes[i], src_data_type);
+
+            // Fill reference
+            fill(srcs.back(), i);
+        }
+
+        _reference = reference::elementwise_expression<TIn, TOut>(srcs, info, dst_data_type);
+    }
+
+    TensorType         _target{};
+    SimpleTensor<TOut> _reference{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_ELEMENTWISEEXPRESSIONFIXTURE_H
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_EMBEDDINGBAGFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_EMBEDDINGBAGFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/EmbeddingBagInfo.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/EmbeddingBag.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T, typename TOut>
+class EmbeddingBagValidationFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int embedding_dim, unsigned int num_rows, unsigned int num_indices, unsigned int num_bags, EmbeddingBagMode mode,
+               DataType data_type)
+    {
+        if(std::is_same<TensorType, Tensor>::value && // Cpu
+           data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        const bool is_quantized = data_type == DataType::S8 || data_type == DataType::U8;
+
+        _table_shape   = TensorShape(data_type == DataType::U8 ? embedding_dim / 2 : embedding_dim, num_rows);
+        _data_type     = data_type;
+        _dst_data_type = is_quantized ? DataType::F32 : data_type;
+        _is_quantized  = is_quantized;
+
+        // Indices just outside the table on both sides check that invalid rows are skipped
+        std::mt19937                       gen(library->seed());
+        std::uniform_int_distribution<int> index_distribution(-1, num_rows);
+        _indices.resize(num_indices);
+        std::generate(_indices.begin(), _indices.end(), [&]() { return index_distribution(gen); });
+
+        // Sorted offsets starting at 0, so some bags can be empty
+        if(mode != EmbeddingBagMode::NONE)
+        {
+            std::uniform_int_distribution<int> offset_distribution(0, num_indices);
+            _offsets.resize(num_bags);
+            std::generate(_offsets.begin(), _offsets.end(), [&]() { return offset_distribution(gen); });
+            std::sort(_offsets.begin(), _offsets.end());
+            _offsets[0] = 0;
+        }
+
+        const EmbeddingBagInfo info(mode);
+
+        _target    = compute_target(info);
+        _reference = compute_reference(info);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i, float lo, float hi)
+    {
+        switch(tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{ lo, hi };
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution(lo, hi);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+                library->fill_tensor_uniform(tensor, i);
+        }
+    }
+
+    TensorType compute_target(const EmbeddingBagInfo &info)
+    {
+        const bool pooling = info.mode != EmbeddingBagMode::NONE;
+
+        // Create tensors
+        TensorType table      = create_tensor<TensorType>(_table_shape, _data_type);
+        TensorType row_params = create_tensor<TensorType>(TensorShape(2U, _table_shape[1]), DataType::F32);
+        TensorType indices    = create_tensor<TensorType>(TensorShape(_indices.size()), DataType::S32);
+        TensorType offsets    = create_tensor<TensorType>(TensorShape(std::max<size_t>(_offsets.size(), 1U)), DataType::S32);
+        TensorType dst;
+
+        TensorType *row_params_ptr = _is_quantized ? &row_params : nullptr;
+        TensorType *offsets_ptr    = pooling ? &offsets : nullptr;
+
+        // Create and configure function
+        FunctionType embedding_bag;
+        embedding_bag.configure(&table, row_params_ptr, &indices, offsets_ptr, &dst, info);
+
+        ARM_COMPUTE_ASSERT(dst.info()->data_type() == _dst_data_type);
+
+        // Allocate tensors
+        table.allocator()->allocate();
+        row_params.allocator()->allocate();
+        indices.allocator()->allocate();
+        offsets.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        // Fill tensors
+        fill(AccessorType(table), 0, -1.f, 1.f);
+        fill(AccessorType(row_params), 1, 0.01f, 0.1f);
+        library->fill_static_values(AccessorType(indices), _indices);
+        if(pooling)
+        {
+            library->fill_static_values(AccessorType(offsets), _offsets);
+        }
+
+        // Compute function
+        embedding_bag.run();
+
+        return dst;
+    }
+
+    SimpleTensor<TOut> compute_reference(const EmbeddingBagInfo &info)
+    {
+        // Create reference
+        SimpleTensor<T>     table{ _table_shape, _data_type };
+        SimpleTensor<float> row_params{ TensorShape(2U, _table_shape[1]), DataType::F32 };
+
+        // Fill reference
+        fill(table, 0, -1.f, 1.f);
+        fill(row_params, 1, 0.01f, 0.1f);
+
+        return reference::embedding_bag<T, TOut>(table, row_params, _indices, _offsets, info);
+    }
+
+    TensorType         _target{};
+    SimpleTensor<TOut> _reference{};
+    TensorShape        _table_shape{};
+    DataType           _data_type{};
+    DataType           _dst_data_type{};
+    bool               _is_quantized{ false };
+    std::vector<int>   _indices{};
+    std::vector<int>   _offsets{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+
+#endif // ACL_TESTS_VALIDATION_FIXTURES_EMBEDDINGBAGFIXTURE_H
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_GEMMDYNAMICQUANTIZEDFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_GEMMDYNAMICQUANTIZEDFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/GEMMDynamicQuantized.h"
+
+#include <random>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class GEMMDynamicQuantizedValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape a_shape, unsigned int n, bool per_channel, bool has_bias, ActivationLayerInfo act_info, DataType data_type)
+    {
+        if(std::is_same<TensorType, Tensor>::value && // Cpu
+           data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        _a_shape       = a_shape;
+        _weights_shape = TensorShape(n, a_shape[0]);
+        _dst_shape     = a_shape;
+        _dst_shape.set(0, n);
+        _data_type = data_type;
+        _has_bias  = has_bias;
+
+        if(per_channel)
+        {
+            std::vector<float> scales(n);
+            for(unsigned int i = 0; i < n; ++i)
+            {
+                scales[i] = 0.002f + 0.001f * (i % 7);
+            }
+            _weights_data_type = DataType::QSYMM8_PER_CHANNEL;
+            _weights_qinfo     = QuantizationInfo(scales);
+        }
+        else
+        {
+            _weights_data_type = DataType::QASYMM8_SIGNED;
+            _weights_qinfo     = QuantizationInfo(0.005f, 7);
+        }
+
+        _target    = compute_target(act_info);
+        _reference = compute_reference(act_info);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        switch(tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{ -1.0f, 1.0f };
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+                library->fill_tensor_uniform(tensor, i);
+        }
+    }
+
+    TensorType compute_target(const ActivationLayerInfo &act_info)
+    {
+        // Create tensors
+        TensorType a       = create_tensor<TensorType>(_a_shape, _data_type);
+        TensorType weights = create_tensor<TensorType>(_weights_shape, _weights_data_type, 1, _weights_qinfo);
+        TensorType bias    = create_tensor<TensorType>(TensorShape(_dst_shape[0]), _data_type);
+        TensorType dst     = create_tensor<TensorType>(_dst_shape, _data_type);
+
+        // Create and configure function
+        FunctionType gemm;
+        ARM_COMPUTE_ERROR_THROW_ON(gemm.validate(a.info(), weights.info(), _has_bias ? bias.info() : nullptr, dst.info(), act_info));
+        gemm.configure(&a, &weights, _has_bias ? &bias : nullptr, &dst, act_info);
+
+        // Allocate tensors
+        a.allocator()->allocate();
+        weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        // Fill tensors
+        fill(AccessorType(a), 0);
+        fill(AccessorType(weights), 1);
+        fill(AccessorType(bias), 2);
+
+        // Compute function
+        gemm.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const ActivationLayerInfo &act_info)
+    {
+        // Create reference
+        SimpleTensor<T>      a{ _a_shape, _data_type };
+        SimpleTensor<int8_t> weights{ _weights_shape, _weights_data_type, 1, _weights_qinfo };
+        SimpleTensor<T>      bias{ TensorShape(_dst_shape[0]), _data_type };
+
+        // Fill reference
+        fill(a, 0);
+        fill(weights, 1);
+        fill(bias, 2);
+
+        return reference::gemm_dynamic_quantized<T>(a, weights, _has_bias ? &bias : nullptr, act_info);
+    }
+
+    TensorType       _target{};
+    SimpleTensor<T>  _reference{};
+    TensorShape      _a_shape{};
+    TensorShape      _weights_shape{};
+    TensorShape      _dst_shape{};
+    DataType         _data_type{};
+    DataType         _weights_data_type{};
+    QuantizationInfo _weights_qinfo{};
+    bool             _has_bias{ false };
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+
+#endif // ACL_TESTS_VALIDATION_FIXTURES_GEMMDYNAMICQUANTIZEDFIXTURE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,7 @@
 #include "arm_compute/core/KernelDescriptors.h"
 #include "arm_compute/core/TensorShape.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Scheduler.h"
 #include "tests/AssetsLibrary.h"
 #include "tests/Globals.h"
 #include "tests/IAccessor.h"
@@ -37,6 +38,7 @@
 #include "tests/validation/reference/ElementwiseOperations.h"
 #include "tests/validation/reference/GEMM.h"
 
+#include <algorithm>
 #include <random>
 
 namespace arm_compute
@@ -339,6 +341,111 @@ public:
     }
 };
 
+/** GEMM of BFLOAT16 matrices to a F32 destination, without C, configured and run with @p num_threads threads
+ *
+ * Some kernels split the work according to the number of threads when configured, e.g. the K splits of the skinny GEMMs.
+ */
+template <typename TensorType, typename AccessorType, typename FunctionType, bool run_twice = false>
+class GEMMBF16ValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape shape_a, TensorShape shape_b, TensorShape shape_c, TensorShape output_shape, float alpha, float beta, unsigned int num_threads)
+    {
+        ARM_COMPUTE_UNUSED(shape_c, beta);
+        if(!CPUInfo::get().has_bf16())
+        {
+            return;
+        }
+
+        const unsigned int scheduler_threads = Scheduler::get().num_threads();
+        Scheduler::get().set_num_threads(num_threads);
+        _target = compute_target(shape_a, shape_b, output_shape, alpha);
+        Scheduler::get().set_num_threads(scheduler_threads);
+
+        _reference = compute_reference(shape_a, shape_b, output_shape, alpha);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        arm_compute::utils::uniform_real_distribution_16bit<bfloat16> distribution{ -1.f, 1.f };
+        library->fill(tensor, distribution, i);
+    }
+
+    TensorType compute_target(const TensorShape &shape_a, const TensorShape &shape_b, const TensorShape &output_shape, float alpha)
+    {
+        // Create tensors
+        TensorType a   = create_tensor<TensorType>(shape_a, DataType::BFLOAT16, 1);
+        TensorType b   = create_tensor<TensorType>(shape_b, DataType::BFLOAT16, 1);
+        TensorType dst = create_tensor<TensorType>(output_shape, DataType::F32, 1);
+
+        // Create and configure function
+        FunctionType gemm;
+        gemm.configure(&a, &b, nullptr, &dst, alpha, 0.f, GEMMInfo(false, false, false /* reshape_b_only_on_first_run */));
+
+        ARM_COMPUTE_ASSERT(a.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(b.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        add_padding_x({ &a, &b, &dst });
+
+        // Allocate tensors
+        a.allocator()->allocate();
+        b.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!a.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!b.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(a), 0);
+        fill(AccessorType(b), 1);
+
+        // Run with variable inputs.
+        if(run_twice)
+        {
+            gemm.run();
+            fill(AccessorType(a), 3); // Fill tensors with new seed after run
+            fill(AccessorType(b), 4);
+        }
+
+        // Compute GEMM function
+        gemm.run();
+
+        return dst;
+    }
+
+    SimpleTensor<float> compute_reference(const TensorShape &shape_a, const TensorShape &shape_b, const TensorShape &output_shape, float alpha)
+    {
+        SimpleTensor<bfloat16> a{ shape_a, DataType::BFLOAT16, 1 };
+        SimpleTensor<bfloat16> b{ shape_b, DataType::BFLOAT16, 1 };
+
+        fill(a, run_twice ? 3 : 0);
+        fill(b, run_twice ? 4 : 1);
+
+        // The products of BFLOAT16 values are exact in F32
+        SimpleTensor<float> a_f32{ shape_a, DataType::F32, 1 };
+        SimpleTensor<float> b_f32{ shape_b, DataType::F32, 1 };
+        SimpleTensor<float> c{ output_shape, DataType::F32, 1 };
+        for(int i = 0; i < a.num_elements(); ++i)
+        {
+            a_f32[i] = static_cast<float>(a[i]);
+        }
+        for(int i = 0; i < b.num_elements(); ++i)
+        {
+            b_f32[i] = static_cast<float>(b[i]);
+        }
+        std::fill_n(c.data(), c.num_elements(), 0.f);
+
+        return reference::gemm<float>(a_f32, b_f32, c, alpha, 0.f);
+    }
+
+    TensorType          _target{};
+    SimpleTensor<float> _reference{};
+};
+
 template <typename TensorType, typename AccessorType, typename T, typename GEMMOperatorType>
 class GEMMMatrixMultiplyValidationFixture : public framework::Fixture
 {
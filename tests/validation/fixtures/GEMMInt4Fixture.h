@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_GEMMINT4FIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_GEMMINT4FIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/function_info/GEMMInt4Info.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/GEMMInt4.h"
+
+#include <random>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename TIn, typename TOut>
+class GEMMInt4ValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape a_shape, unsigned int n, unsigned int group_size, bool has_bias, ActivationLayerInfo act_info, DataType data_type,
+               QuantizationInfo a_qinfo)
+    {
+        if(std::is_same<TensorType, Tensor>::value && // Cpu
+           data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        const unsigned int k          = a_shape[0];
+        const unsigned int num_groups = group_size != 0 ? DIV_CEIL(k, group_size) : 1U;
+
+        _a_shape       = a_shape;
+        _weights_shape = TensorShape(DIV_CEIL(k, 2U), n);
+        _scales_shape  = TensorShape(num_groups, n);
+        _dst_shape     = a_shape;
+        _dst_shape.set(0, n);
+        _data_type     = data_type;
+        _dst_data_type = is_data_type_quantized(data_type) ? DataType::F32 : data_type;
+        _a_qinfo       = a_qinfo;
+        _has_bias      = has_bias;
+
+        const GEMMInt4Info info(group_size, act_info);
+
+        _target    = compute_target(info);
+        _reference = compute_reference(info);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i, float lo, float hi)
+    {
+        switch(tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{ lo, hi };
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution(lo, hi);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+                library->fill_tensor_uniform(tensor, i);
+        }
+    }
+
+    TensorType compute_target(const GEMMInt4Info &info)
+    {
+        // Create tensors
+        TensorType a       = create_tensor<TensorType>(_a_shape, _data_type, 1, _a_qinfo);
+        TensorType weights = create_tensor<TensorType>(_weights_shape, DataType::U8);
+        TensorType scales  = create_tensor<TensorType>(_scales_shape, DataType::F32);
+        TensorType bias    = create_tensor<TensorType>(TensorShape(_dst_shape[0]), _dst_data_type);
+        TensorType dst     = create_tensor<TensorType>(_dst_shape, _dst_data_type);
+
+        TensorType *bias_ptr = _has_bias ? &bias : nullptr;
+
+        // Create and configure function
+        FunctionType gemm;
+        ARM_COMPUTE_ERROR_THROW_ON(gemm.validate(a.info(), weights.info(), scales.info(), _has_bias ? bias.info() : nullptr, dst.info(), info));
+        gemm.configure(&a, &weights, &scales, bias_ptr, &dst, info);
+
+        // Allocate tensors
+        a.allocator()->allocate();
+        weights.allocator()->allocate();
+        scales.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        // Fill tensors
+        fill(AccessorType(a), 0, -1.f, 1.f);
+        fill(AccessorType(weights), 1, 0.f, 0.f);
+        fill(AccessorType(scales), 2, 0.01f, 0.1f);
+        fill(AccessorType(bias), 3, -1.f, 1.f);
+
+        // Compute function
+        gemm.run();
+
+        return dst;
+    }
+
+    SimpleTensor<TOut> compute_reference(const GEMMInt4Info &info)
+    {
+        // Create reference
+        SimpleTensor<TIn>     a{ _a_shape, _data_type, 1, _a_qinfo };
+        SimpleTensor<uint8_t> weights{ _weights_shape, DataType::U8 };
+        SimpleTensor<float>   scales{ _scales_shape, DataType::F32 };
+        SimpleTensor<TOut>    bias{ TensorShape(_dst_shape[0]), _dst_data_type };
+
+        // Fill reference
+        fill(a, 0, -1.f, 1.f);
+        fill(weights, 1, 0.f, 0.f);
+        fill(scales, 2, 0.01f, 0.1f);
+        fill(bias, 3, -1.f, 1.f);
+
+        return reference::gemm_int4<TIn, TOut>(a, weights, scales, _has_bias ? &bias : nullptr, info);
+    }
+
+    TensorType         _target{};
+    SimpleTensor<TOut> _reference{};
+    TensorShape        _a_shape{};
+    TensorShape        _weights_shape{};
+    TensorShape        _scales_shape{};
+    TensorShape        _dst_shape{};
+    DataType           _data_type{};
+    DataType           _dst_data_type{};
+    QuantizationInfo   _a_qinfo{};
+    bool               _has_bias{false};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+
+#endif // ACL_TESTS_VALIDATION_FIXTURES_GEMMINT4FIXTURE_H
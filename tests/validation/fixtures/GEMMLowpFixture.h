@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@
 
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMLowpMatrixMultiplyCore.h"
+#include "arm_compute/runtime/Scheduler.h"
 #include "src/core/utils/quantization/AsymmHelpers.h"
 #include "tests/validation/Helpers.h"
 #include "tests/framework/Fixture.h"
@@ -419,6 +420,34 @@ public:
     }
 };
 
+/** Signed GEMMLowp without output stage, configured and run with @p num_threads threads
+ *
+ * Some kernels split the work according to the number of threads when configured, e.g. the K splits of the skinny GEMMs.
+ */
+template <typename TensorType, typename AccessorType, typename FunctionType, bool run_twice = false>
+class GEMMLowpMatrixMultiplyCoreSignedValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape shape_a, TensorShape shape_b, TensorShape shape_output, int32_t a_offset, int32_t b_offset, unsigned int num_threads)
+    {
+        const auto     a_qinfo = QuantizationInfo(1.0f / 255, a_offset);
+        const auto     b_qinfo = QuantizationInfo(1.0f / 255, b_offset);
+        TensorFillInfo finfo;
+
+        const unsigned int scheduler_threads = Scheduler::get().num_threads();
+        Scheduler::get().set_num_threads(num_threads);
+        _target = compute_gemmlowp_target<TensorType, AccessorType, FunctionType, false, false, int32_t, false, run_twice>(shape_a, shape_b, shape_output, a_qinfo, b_qinfo, QuantizationInfo(),
+                                                                                                                          DataType::QASYMM8_SIGNED, DataType::QASYMM8_SIGNED, GEMMLowpOutputStageInfo(), false, finfo);
+        Scheduler::get().set_num_threads(scheduler_threads);
+
+        _reference = compute_gemmlowp_reference<false, int8_t, int8_t, false, false, run_twice>(shape_a, shape_b, shape_output, a_qinfo, b_qinfo, DataType::QASYMM8_SIGNED, DataType::QASYMM8_SIGNED, finfo);
+    }
+
+protected:
+    TensorType            _target{};
+    SimpleTensor<int32_t> _reference{};
+};
+
 template <typename TensorType, typename AccessorType, typename FunctionType, bool reinterpret_input_as_3d = false, bool reinterpret_output_as_3d = false, typename TI = uint8_t, typename TW = uint8_t, bool run_twice = false>
 class GEMMLowpGenericMatrixMultiplyCoreFusedOffsetOutputValidationFixture : public framework::Fixture
 {
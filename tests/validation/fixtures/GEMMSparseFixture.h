@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_GEMMSPARSEFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_GEMMSPARSEFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/GEMMSparse.h"
+
+#include <cstring>
+#include <random>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename TIn, typename TOut>
+class GEMMSparseValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape a_shape, unsigned int n, bool has_bias, ActivationLayerInfo act_info, DataType data_type, DataType weights_data_type)
+    {
+        if(std::is_same<TensorType, Tensor>::value && // Cpu
+           data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        _a_shape       = a_shape;
+        _weights_shape = TensorShape(n, a_shape[0]);
+        _dst_shape     = a_shape;
+        _dst_shape.set(0, n);
+        _data_type         = data_type;
+        _weights_data_type = weights_data_type;
+        _dst_data_type     = is_data_type_quantized(data_type) ? DataType::S32 : data_type;
+        _has_bias          = has_bias;
+
+        if(is_data_type_quantized(data_type))
+        {
+            _a_qinfo = QuantizationInfo(0.05f, 3);
+            if(weights_data_type == DataType::QSYMM8_PER_CHANNEL)
+            {
+                _weights_qinfo = QuantizationInfo(std::vector<float>(n, 0.01f));
+            }
+            else
+            {
+                _weights_qinfo = QuantizationInfo(0.01f, 0);
+            }
+        }
+
+        _target    = compute_target(act_info);
+        _reference = compute_reference(act_info);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        switch(tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{ -1.0f, 1.0f };
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::S32:
+            {
+                std::uniform_int_distribution<int32_t> distribution(-10000, 10000);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+                library->fill_tensor_uniform(tensor, i);
+        }
+    }
+
+    /** Prune the weights to 2:4 sparsity: two weights of every group of 4 along K are zeroed, three for some channels */
+    template <typename U>
+    void sparsify(U &&tensor)
+    {
+        const size_t element_size = tensor.element_size();
+        for(int k = 0; k < static_cast<int>(_weights_shape[1]); ++k)
+        {
+            for(int x = 0; x < static_cast<int>(_weights_shape[0]); ++x)
+            {
+                const int  rank   = (x * 7 + (k / 4) * 3 + k % 4) % 4;
+                const bool pruned = rank < 2 || (x % 5 == 0 && rank == 2);
+                if(pruned)
+                {
+                    std::memset(tensor(Coordinates(x, k)), 0, element_size);
+                }
+            }
+        }
+    }
+
+    TensorType compute_target(const ActivationLayerInfo &act_info)
+    {
+        // Create tensors
+        TensorType a       = create_tensor<TensorType>(_a_shape, _data_type, 1, _a_qinfo);
+        TensorType weights = create_tensor<TensorType>(_weights_shape, _weights_data_type, 1, _weights_qinfo);
+        TensorType bias    = create_tensor<TensorType>(TensorShape(_dst_shape[0]), _dst_data_type);
+        TensorType dst     = create_tensor<TensorType>(_dst_shape, _dst_data_type);
+
+        // Create and configure function
+        FunctionType gemm;
+        ARM_COMPUTE_ERROR_THROW_ON(gemm.validate(a.info(), weights.info(), _has_bias ? bias.info() : nullptr, dst.info(), act_info));
+        gemm.configure(&a, &weights, _has_bias ? &bias : nullptr, &dst, act_info);
+
+        // Allocate tensors
+        a.allocator()->allocate();
+        weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        // Fill tensors
+        fill(AccessorType(a), 0);
+        fill(AccessorType(weights), 1);
+        fill(AccessorType(bias), 2);
+        sparsify(AccessorType(weights));
+
+        ARM_COMPUTE_ASSERT(FunctionType::is_2_4_sparse(&weights));
+
+        // Compute function
+        gemm.run();
+
+        return dst;
+    }
+
+    SimpleTensor<TOut> compute_reference(const ActivationLayerInfo &act_info)
+    {
+        // Create reference
+        SimpleTensor<TIn>  a{ _a_shape, _data_type, 1, _a_qinfo };
+        SimpleTensor<TIn>  weights{ _weights_shape, _weights_data_type, 1, _weights_qinfo };
+        SimpleTensor<TOut> bias{ TensorShape(_dst_shape[0]), _dst_data_type };
+
+        // Fill reference
+        fill(a, 0);
+        fill(weights, 1);
+        fill(bias, 2);
+        sparsify(weights);
+
+        return reference::gemm_sparse<TIn, TOut>(a, weights, _has_bias ? &bias : nullptr, act_info);
+    }
+
+    TensorType         _target{};
+    SimpleTensor<TOut> _reference{};
+    TensorShape        _a_shape{};
+    TensorShape        _weights_shape{};
+    TensorShape        _dst_shape{};
+    DataType           _data_type{};
+    DataType           _weights_data_type{};
+    DataType           _dst_data_type{};
+    QuantizationInfo   _a_qinfo{};
+    QuantizationInfo   _weights_qinfo{};
+    bool               _has_bias{ false };
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+
+#endif // ACL_TESTS_VALIDATION_FIXTURES_GEMMSPARSEFIXTURE_H
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_GLOBALPOOLINGFULLYCONNECTEDLAYERFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_GLOBALPOOLINGFULLYCONNECTEDLAYERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/function_info/FullyConnectedLayerInfo.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/RawTensor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/FullyConnectedLayer.h"
+#include "tests/validation/reference/PoolingLayer.h"
+#include "tests/validation/reference/Utils.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class GlobalPoolingFullyConnectedLayerValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape input_shape, unsigned int num_outputs, bool transpose_weights, DataType data_type, ActivationLayerInfo act_info)
+    {
+        if(std::is_same<TensorType, Tensor>::value && // Cpu
+           data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        FullyConnectedLayerInfo fc_info;
+        fc_info.transpose_weights = transpose_weights;
+        fc_info.activation_info   = act_info;
+
+        _input_shape   = input_shape;
+        _weights_shape = TensorShape(input_shape[2], num_outputs);
+        _bias_shape    = TensorShape(num_outputs);
+        _output_shape  = TensorShape(num_outputs, input_shape[3]);
+        _data_type     = data_type;
+
+        _target    = compute_target(fc_info);
+        _reference = compute_reference(fc_info);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        switch(tensor.data_type())
+        {
+            case DataType::F32:
+                library->fill_tensor_uniform(tensor, i, -1.f, 1.f);
+                break;
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{ -1.0f, 1.0f };
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+                library->fill_tensor_uniform(tensor, i);
+                break;
+        }
+    }
+
+    TensorType compute_target(const FullyConnectedLayerInfo &fc_info)
+    {
+        TensorShape input_shape   = _input_shape;
+        TensorShape weights_shape = _weights_shape;
+
+        // The fused head only supports NHWC
+        permute(input_shape, PermutationVector(2U, 0U, 1U));
+
+        if(!fc_info.transpose_weights)
+        {
+            weights_shape = TensorShape(_weights_shape[1], _weights_shape[0]);
+        }
+
+        // Create tensors
+        TensorType src     = create_tensor<TensorType>(input_shape, _data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+        TensorType weights = create_tensor<TensorType>(weights_shape, _data_type, 1);
+        TensorType bias    = create_tensor<TensorType>(_bias_shape, _data_type, 1);
+        TensorType dst     = create_tensor<TensorType>(_output_shape, _data_type, 1);
+
+        // Create and configure function
+        FunctionType head;
+        ARM_COMPUTE_ERROR_THROW_ON(head.validate(src.info(), weights.info(), bias.info(), dst.info(), fc_info));
+        head.configure(&src, &weights, &bias, &dst, fc_info);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(src), 0);
+        fill(AccessorType(bias), 2);
+
+        if(!fc_info.transpose_weights)
+        {
+            RawTensor tmp(_weights_shape, _data_type, 1);
+
+            // Fill with the reference shape and transpose elementwise
+            fill(tmp, 1);
+            tmp = transpose(tmp);
+
+            AccessorType weights_accessor(weights);
+
+            for(int i = 0; i < tmp.num_elements(); ++i)
+            {
+                Coordinates coord = index2coord(tmp.shape(), i);
+                std::copy_n(static_cast<const RawTensor::value_type *>(tmp(coord)),
+                            tmp.element_size(),
+                            static_cast<RawTensor::value_type *>(weights_accessor(coord)));
+            }
+        }
+        else
+        {
+            fill(AccessorType(weights), 1);
+        }
+
+        // Compute function
+        head.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const FullyConnectedLayerInfo &fc_info)
+    {
+        // Create reference
+        SimpleTensor<T> src{ _input_shape, _data_type };
+        SimpleTensor<T> weights{ _weights_shape, _data_type };
+        SimpleTensor<T> bias{ _bias_shape, _data_type };
+
+        // Fill reference
+        fill(src, 0);
+        fill(weights, 1);
+        fill(bias, 2);
+
+        const SimpleTensor<T> pooled = reference::pooling_layer<T>(src, PoolingLayerInfo(PoolingType::AVG, DataLayout::NCHW), QuantizationInfo(), nullptr);
+        const SimpleTensor<T> dst    = reference::fully_connected_layer<T>(pooled, weights, bias, _output_shape);
+
+        if(fc_info.activation_info.enabled())
+        {
+            return reference::activation_layer(dst, fc_info.activation_info);
+        }
+        return dst;
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+    TensorShape     _input_shape{};
+    TensorShape     _weights_shape{};
+    TensorShape     _bias_shape{};
+    TensorShape     _output_shape{};
+    DataType        _data_type{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+
+#endif // ACL_TESTS_VALIDATION_FIXTURES_GLOBALPOOLINGFULLYCONNECTEDLAYERFIXTURE_H
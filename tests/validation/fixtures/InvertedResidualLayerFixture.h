@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_INVERTEDRESIDUALLAYERFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_INVERTEDRESIDUALLAYERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/function_info/InvertedResidualLayerInfo.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/ArithmeticOperations.h"
+#include "tests/validation/reference/ConvolutionLayer.h"
+#include "tests/validation/reference/DepthwiseConvolutionLayer.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class InvertedResidualLayerGenericFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape input_shape, unsigned int exp_channels, unsigned int out_channels, Size2D dw_kernel, PadStrideInfo dw_info,
+               bool residual, DataType data_type, ActivationLayerInfo act_info)
+    {
+        if(std::is_same<TensorType, Tensor>::value && // Cpu
+           data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        // Expansion and depthwise stages use the given activation, the projection is linear as in MobileNetV2
+        const InvertedResidualLayerInfo info(dw_info, act_info, act_info, ActivationLayerInfo(), residual);
+
+        const unsigned int in_channels = input_shape[2];
+        const auto         out_dims    = scaled_dimensions(input_shape[0], input_shape[1], dw_kernel.width, dw_kernel.height, dw_info);
+
+        _input_shape     = input_shape;
+        _expand_w_shape  = TensorShape(1U, 1U, in_channels, exp_channels);
+        _dw_w_shape      = TensorShape(dw_kernel.width, dw_kernel.height, exp_channels);
+        _proj_w_shape    = TensorShape(1U, 1U, exp_channels, out_channels);
+        _expand_b_shape  = TensorShape(exp_channels);
+        _proj_b_shape    = TensorShape(out_channels);
+        _expanded_shape  = TensorShape(input_shape[0], input_shape[1], exp_channels, input_shape[3]);
+        _depthwise_shape = TensorShape(out_dims.first, out_dims.second, exp_channels, input_shape[3]);
+        _output_shape    = TensorShape(out_dims.first, out_dims.second, out_channels, input_shape[3]);
+        _data_type       = data_type;
+
+        _target          = compute_target(info);
+        _reference       = compute_reference(info);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        switch(tensor.data_type())
+        {
+            case DataType::F32:
+                library->fill_tensor_uniform(tensor, i, -1.f, 1.f);
+                break;
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{ -1.0f, 1.0f };
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+                library->fill_tensor_uniform(tensor, i);
+                break;
+        }
+    }
+
+    TensorType compute_target(const InvertedResidualLayerInfo &info)
+    {
+        TensorShape input_shape    = _input_shape;
+        TensorShape expand_w_shape = _expand_w_shape;
+        TensorShape dw_w_shape     = _dw_w_shape;
+        TensorShape proj_w_shape   = _proj_w_shape;
+        TensorShape output_shape   = _output_shape;
+
+        // The fused block only supports NHWC
+        permute(input_shape, PermutationVector(2U, 0U, 1U));
+        permute(expand_w_shape, PermutationVector(2U, 0U, 1U));
+        permute(dw_w_shape, PermutationVector(2U, 0U, 1U));
+        permute(proj_w_shape, PermutationVector(2U, 0U, 1U));
+        permute(output_shape, PermutationVector(2U, 0U, 1U));
+
+        // Create tensors
+        TensorType src      = create_tensor<TensorType>(input_shape, _data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+        TensorType expand_w = create_tensor<TensorType>(expand_w_shape, _data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+        TensorType expand_b = create_tensor<TensorType>(_expand_b_shape, _data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+        TensorType dw_w     = create_tensor<TensorType>(dw_w_shape, _data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+        TensorType dw_b     = create_tensor<TensorType>(_expand_b_shape, _data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+        TensorType proj_w   = create_tensor<TensorType>(proj_w_shape, _data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+        TensorType proj_b   = create_tensor<TensorType>(_proj_b_shape, _data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+        TensorType dst      = create_tensor<TensorType>(output_shape, _data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+
+        // Create and configure function
+        FunctionType block;
+        ARM_COMPUTE_ERROR_THROW_ON(block.validate(src.info(), expand_w.info(), expand_b.info(), dw_w.info(), dw_b.info(), proj_w.info(), proj_b.info(), dst.info(), info));
+        block.configure(&src, &expand_w, &expand_b, &dw_w, &dw_b, &proj_w, &proj_b, &dst, info);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        expand_w.allocator()->allocate();
+        expand_b.allocator()->allocate();
+        dw_w.allocator()->allocate();
+        dw_b.allocator()->allocate();
+        proj_w.allocator()->allocate();
+        proj_b.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(src), 0);
+        fill(AccessorType(expand_w), 1);
+        fill(AccessorType(expand_b), 2);
+        fill(AccessorType(dw_w), 3);
+        fill(AccessorType(dw_b), 4);
+        fill(AccessorType(proj_w), 5);
+        fill(AccessorType(proj_b), 6);
+
+        // Compute function
+        block.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> activate(const SimpleTensor<T> &src, const ActivationLayerInfo &act_info)
+    {
+        if(act_info.enabled() && act_info.activation() != ActivationLayerInfo::ActivationFunction::IDENTITY)
+        {
+            return reference::activation_layer(src, act_info);
+        }
+        return src;
+    }
+
+    SimpleTensor<T> compute_reference(const InvertedResidualLayerInfo &info)
+    {
+        // Create reference
+        SimpleTensor<T> src{ _input_shape, _data_type };
+        SimpleTensor<T> expand_w{ _expand_w_shape, _data_type };
+        SimpleTensor<T> expand_b{ _expand_b_shape, _data_type };
+        SimpleTensor<T> dw_w{ _dw_w_shape, _data_type };
+        SimpleTensor<T> dw_b{ _expand_b_shape, _data_type };
+        SimpleTensor<T> proj_w{ _proj_w_shape, _data_type };
+        SimpleTensor<T> proj_b{ _proj_b_shape, _data_type };
+
+        // Fill reference
+        fill(src, 0);
+        fill(expand_w, 1);
+        fill(expand_b, 2);
+        fill(dw_w, 3);
+        fill(dw_b, 4);
+        fill(proj_w, 5);
+        fill(proj_b, 6);
+
+        const PadStrideInfo pointwise_info(1, 1, 0, 0);
+
+        SimpleTensor<T> expanded  = activate(reference::convolution_layer<T>(src, expand_w, expand_b, _expanded_shape, pointwise_info), info.expand_act);
+        SimpleTensor<T> depthwise = activate(reference::depthwise_convolution<T>(expanded, dw_w, dw_b, _depthwise_shape, info.depthwise_info, 1), info.depthwise_act);
+        SimpleTensor<T> projected = activate(reference::convolution_layer<T>(depthwise, proj_w, proj_b, _output_shape, pointwise_info), info.project_act);
+
+        if(info.residual)
+        {
+            SimpleTensor<T> dst{ _output_shape, _data_type };
+            reference::arithmetic_operation<T>(reference::ArithmeticOperation::ADD, projected, src, dst, ConvertPolicy::SATURATE);
+            return dst;
+        }
+        return projected;
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+    TensorShape     _input_shape{};
+    TensorShape     _expand_w_shape{};
+    TensorShape     _dw_w_shape{};
+    TensorShape     _proj_w_shape{};
+    TensorShape     _expand_b_shape{};
+    TensorShape     _proj_b_shape{};
+    TensorShape     _expanded_shape{};
+    TensorShape     _depthwise_shape{};
+    TensorShape     _output_shape{};
+    DataType        _data_type{};
+};
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class InvertedResidualLayerValidationFixture : public InvertedResidualLayerGenericFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    void setup(TensorShape input_shape, unsigned int exp_channels, unsigned int out_channels, Size2D dw_kernel, PadStrideInfo dw_info, DataType data_type, ActivationLayerInfo act_info)
+    {
+        InvertedResidualLayerGenericFixture<TensorType, AccessorType, FunctionType, T>::setup(input_shape, exp_channels, out_channels, dw_kernel, dw_info, false, data_type, act_info);
+    }
+};
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class InvertedResidualLayerResidualValidationFixture : public InvertedResidualLayerGenericFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    void setup(TensorShape input_shape, unsigned int exp_channels, Size2D dw_kernel, PadStrideInfo dw_info, DataType data_type, ActivationLayerInfo act_info)
+    {
+        // The shortcut addition requires the block to preserve the input channels
+        InvertedResidualLayerGenericFixture<TensorType, AccessorType, FunctionType, T>::setup(input_shape, exp_channels, input_shape[2], dw_kernel, dw_info, true, data_type, act_info);
+    }
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+
+#endif // ACL_TESTS_VALIDATION_FIXTURES_INVERTEDRESIDUALLAYERFIXTURE_H
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_KVCACHEAPPENDFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_KVCACHEAPPENDFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/KVCache.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/KVCacheAppend.h"
+
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+/** Fill a cache with a prefill of several tokens followed by decoding steps of one token */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T, typename TCache>
+class KVCacheAppendValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape prefill_shape, unsigned int capacity, unsigned int decode_steps, DataType data_type, DataType cache_data_type)
+    {
+        if(std::is_same<TensorType, Tensor>::value && // Cpu
+           data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        _prefill_shape = prefill_shape;
+        _decode_shape  = prefill_shape;
+        _decode_shape.set(1, 1);
+        _data_type    = data_type;
+        _decode_steps = decode_steps;
+
+        const size_t       num_heads = prefill_shape[2];
+        std::vector<float> head_scales{};
+        if(cache_data_type == DataType::QSYMM8_PER_CHANNEL)
+        {
+            for(size_t h = 0; h < num_heads; ++h)
+            {
+                head_scales.push_back(1.f / 127.f * (1.f + 0.5f * h));
+            }
+        }
+        _cache_info = KVCacheInfo(prefill_shape[0], capacity, num_heads, prefill_shape[3], cache_data_type, head_scales);
+
+        compute_target();
+        _reference = compute_reference();
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        switch(tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{ -1.0f, 1.0f };
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+                library->fill_tensor_uniform(tensor, i);
+        }
+    }
+
+    void compute_target()
+    {
+        ARM_COMPUTE_ERROR_THROW_ON(KVCache::validate(_cache_info));
+        _cache.init(_cache_info);
+
+        // Create tensors
+        TensorType prefill = create_tensor<TensorType>(_prefill_shape, _data_type);
+        TensorType decode  = create_tensor<TensorType>(_decode_shape, _data_type);
+
+        // Create and configure functions
+        FunctionType append_prefill;
+        FunctionType append_decode;
+        ARM_COMPUTE_ERROR_THROW_ON(FunctionType::validate(prefill.info(), _cache.tensor()->info()));
+        ARM_COMPUTE_ERROR_THROW_ON(FunctionType::validate(decode.info(), _cache.tensor()->info()));
+        append_prefill.configure(&prefill, &_cache);
+        append_decode.configure(&decode, &_cache);
+
+        // Allocate tensors
+        prefill.allocator()->allocate();
+        decode.allocator()->allocate();
+        _cache.allocator()->allocate();
+
+        // Compute functions
+        fill(AccessorType(prefill), 0);
+        append_prefill.run();
+        for(unsigned int step = 0; step < _decode_steps; ++step)
+        {
+            fill(AccessorType(decode), 1 + step);
+            append_decode.run();
+        }
+    }
+
+    SimpleTensor<TCache> compute_reference()
+    {
+        const size_t length = _prefill_shape[1] + _decode_steps;
+
+        TensorShape cache_shape = _prefill_shape;
+        cache_shape.set(1, length);
+
+        // Create reference
+        SimpleTensor<TCache> cache{ cache_shape, _cache_info.data_type, 1, _cache.tensor()->info()->quantization_info() };
+        SimpleTensor<T>      prefill{ _prefill_shape, _data_type };
+        SimpleTensor<T>      decode{ _decode_shape, _data_type };
+
+        // Fill reference
+        fill(prefill, 0);
+        cache = reference::kv_cache_append<T, TCache>(cache, prefill, 0);
+        for(unsigned int step = 0; step < _decode_steps; ++step)
+        {
+            fill(decode, 1 + step);
+            cache = reference::kv_cache_append<T, TCache>(cache, decode, _prefill_shape[1] + step);
+        }
+        return cache;
+    }
+
+    KVCache              _cache{};
+    SimpleTensor<TCache> _reference{};
+    KVCacheInfo          _cache_info{};
+    TensorShape          _prefill_shape{};
+    TensorShape          _decode_shape{};
+    DataType             _data_type{};
+    unsigned int         _decode_steps{ 0 };
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+
+#endif // ACL_TESTS_VALIDATION_FIXTURES_KVCACHEAPPENDFIXTURE_H
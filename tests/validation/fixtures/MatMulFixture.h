@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Arm Limited.
+ * Copyright (c) 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,6 +38,7 @@
 #include "tests/validation/reference/ReshapeLayer.h"
 #include "tests/validation/Validation.h"
 
+#include <algorithm>
 #include <limits>
 #include <random>
 #include <type_traits>
@@ -246,6 +247,24 @@ protected:
         return output;
     }
 
+    SimpleTensor<T> broadcast_batches(const SimpleTensor<T> &src, size_t batches)
+    {
+        TensorShape dst_shape{src.shape()};
+        dst_shape.set(2, batches);
+
+        SimpleTensor<T> dst{dst_shape, src.data_type(), 1, src.quantization_info()};
+
+        // Batch i reads the matrix i / group of src
+        const size_t matrix_size = src.shape().x() * src.shape().y();
+        const size_t group       = batches / src.shape().z();
+        for (size_t i = 0; i < batches; ++i)
+        {
+            std::copy_n(src.data() + (i / group) * matrix_size, matrix_size, dst.data() + i * matrix_size);
+        }
+
+        return dst;
+    }
+
     SimpleTensor<T> compute_reference(const TensorShape  &a_shape,
                                       const TensorShape  &b_shape,
                                       const TensorShape  &output_shape,
@@ -272,6 +291,12 @@ protected:
         fill(a, 2);
         fill(b, 3);
 
+        // Replicate the rhs matrices shared by several lhs matrices when broadcasting in batch dimension
+        if (b_shape_collapsed.z() != a_shape_collapsed.z())
+        {
+            b = broadcast_batches(b, a_shape_collapsed.z());
+        }
+
         /* Note: Assuming the usual batch matmul dimensions A = (B x M x K), B = (B x K x N), if transpose_a is set to true, then A is assumed to be (B x K x M),
         therefore, A must be pre-transposed before passing it to the fixture. And, we transpose A again in the fixture to make it (B x M x K)
         in order to be able to call reference implementation that works with (B x M x K) input.
@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_PAGEDATTENTIONFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_PAGEDATTENTIONFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/runtime/KVBlockPool.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/PagedAttention.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+/** Write the keys and values of a batch of sequences of different lengths to a block pool, then decode them */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename AppendFunctionType, typename T>
+class PagedAttentionValidationFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int head_dim, unsigned int num_heads, unsigned int num_kv_heads, unsigned int block_size, unsigned int num_seqs, unsigned int max_length,
+               DataType data_type)
+    {
+        if(std::is_same<TensorType, Tensor>::value && // Cpu
+           data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        _head_dim     = head_dim;
+        _num_heads    = num_heads;
+        _num_kv_heads = num_kv_heads;
+        _block_size   = block_size;
+        _max_blocks   = DIV_CEIL(max_length, block_size);
+        _data_type    = data_type;
+        _scale        = 1.f / std::sqrt(static_cast<float>(head_dim));
+
+        // Lengths below the maximum, the fourth sequence being empty
+        _seq_lens.clear();
+        for(unsigned int s = 0; s < num_seqs; ++s)
+        {
+            _seq_lens.push_back(s == 3 ? 0 : static_cast<int32_t>(max_length - (s * 13) % max_length));
+        }
+
+        compute_target();
+        _reference = compute_reference();
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        switch(tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{ -1.0f, 1.0f };
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+                library->fill_tensor_uniform(tensor, i);
+        }
+    }
+
+    template <typename U>
+    void fill_s32(U &&tensor, const std::vector<int32_t> &values)
+    {
+        for(size_t i = 0; i < values.size(); ++i)
+        {
+            *reinterpret_cast<int32_t *>(tensor(index2coord(tensor.shape(), i))) = values[i];
+        }
+    }
+
+    void compute_target()
+    {
+        const unsigned int num_seqs   = _seq_lens.size();
+        unsigned int       num_blocks = 2;
+        for(int32_t len : _seq_lens)
+        {
+            num_blocks += DIV_CEIL(static_cast<unsigned int>(len), _block_size);
+        }
+
+        KVBlockPool pool;
+        pool.init(KVBlockPoolInfo(_head_dim, _block_size, _num_kv_heads, num_blocks, _data_type));
+
+        std::vector<int> seqs;
+        for(unsigned int s = 0; s < num_seqs; ++s)
+        {
+            seqs.push_back(pool.add_sequence());
+        }
+
+        // Tokens are appended position by position across the sequences, so that their blocks interleave in the pool
+        const int32_t max_length = *std::max_element(_seq_lens.begin(), _seq_lens.end());
+        _slots.clear();
+        for(int32_t t = 0; t < max_length; ++t)
+        {
+            for(unsigned int s = 0; s < num_seqs; ++s)
+            {
+                if(t < _seq_lens[s])
+                {
+                    int32_t slot = 0;
+                    ARM_COMPUTE_ASSERT(pool.append(seqs[s], 1, &slot));
+                    _slots.push_back(slot);
+                }
+            }
+        }
+        ARM_COMPUTE_ASSERT(pool.num_free_blocks() == 2);
+
+        _block_tables.assign(_max_blocks * num_seqs, 0);
+        for(unsigned int s = 0; s < num_seqs; ++s)
+        {
+            const std::vector<int32_t> blocks = pool.block_table(seqs[s]);
+            std::copy(blocks.begin(), blocks.end(), _block_tables.begin() + s * _max_blocks);
+        }
+
+        // Create tensors
+        const unsigned int num_tokens = _slots.size();
+
+        TensorType q            = create_tensor<TensorType>(TensorShape(_head_dim, _num_heads, num_seqs), _data_type);
+        TensorType k            = create_tensor<TensorType>(TensorShape(_head_dim, _num_kv_heads, num_tokens), _data_type);
+        TensorType v            = create_tensor<TensorType>(TensorShape(_head_dim, _num_kv_heads, num_tokens), _data_type);
+        TensorType slots        = create_tensor<TensorType>(TensorShape(num_tokens), DataType::S32);
+        TensorType block_tables = create_tensor<TensorType>(TensorShape(_max_blocks, num_seqs), DataType::S32);
+        TensorType seq_lens     = create_tensor<TensorType>(TensorShape(num_seqs), DataType::S32);
+
+        // Create and configure functions
+        AppendFunctionType append_k;
+        AppendFunctionType append_v;
+        FunctionType       attention;
+        ARM_COMPUTE_ERROR_THROW_ON(AppendFunctionType::validate(k.info(), slots.info(), pool.keys()->info()));
+        ARM_COMPUTE_ERROR_THROW_ON(FunctionType::validate(q.info(), pool.keys()->info(), pool.values()->info(), block_tables.info(), seq_lens.info(), _target.info(), _scale));
+        append_k.configure(&k, &slots, pool.keys());
+        append_v.configure(&v, &slots, pool.values());
+        attention.configure(&q, pool.keys(), pool.values(), &block_tables, &seq_lens, &_target, _scale);
+
+        // Allocate tensors
+        q.allocator()->allocate();
+        k.allocator()->allocate();
+        v.allocator()->allocate();
+        slots.allocator()->allocate();
+        block_tables.allocator()->allocate();
+        seq_lens.allocator()->allocate();
+        _target.allocator()->allocate();
+        pool.allocate();
+
+        // Fill tensors
+        fill(AccessorType(q), 0);
+        fill(AccessorType(k), 1);
+        fill(AccessorType(v), 2);
+        fill_s32(AccessorType(slots), _slots);
+        pool.fill_block_tables(seqs, &block_tables, &seq_lens);
+
+        // Compute functions
+        append_k.run();
+        append_v.run();
+        attention.run();
+    }
+
+    SimpleTensor<T> compute_reference()
+    {
+        const unsigned int num_seqs   = _seq_lens.size();
+        const unsigned int num_tokens = _slots.size();
+        const unsigned int num_blocks = *std::max_element(_block_tables.begin(), _block_tables.end()) + 1;
+        const TensorShape  pool_shape(_head_dim, _block_size, _num_kv_heads, num_blocks);
+
+        // Create reference
+        SimpleTensor<T>       q{ TensorShape(_head_dim, _num_heads, num_seqs), _data_type };
+        SimpleTensor<T>       k{ TensorShape(_head_dim, _num_kv_heads, num_tokens), _data_type };
+        SimpleTensor<T>       v{ TensorShape(_head_dim, _num_kv_heads, num_tokens), _data_type };
+        SimpleTensor<T>       k_pool{ pool_shape, _data_type };
+        SimpleTensor<T>       v_pool{ pool_shape, _data_type };
+        SimpleTensor<int32_t> slots{ TensorShape(num_tokens), DataType::S32 };
+        SimpleTensor<int32_t> block_tables{ TensorShape(_max_blocks, num_seqs), DataType::S32 };
+        SimpleTensor<int32_t> seq_lens{ TensorShape(num_seqs), DataType::S32 };
+
+        // Fill reference
+        fill(q, 0);
+        fill(k, 1);
+        fill(v, 2);
+        std::copy(_slots.begin(), _slots.end(), slots.data());
+        std::copy(_block_tables.begin(), _block_tables.end(), block_tables.data());
+        std::copy(_seq_lens.begin(), _seq_lens.end(), seq_lens.data());
+
+        k_pool = reference::paged_kv_cache_append<T>(k_pool, k, slots);
+        v_pool = reference::paged_kv_cache_append<T>(v_pool, v, slots);
+        return reference::paged_attention<T>(q, k_pool, v_pool, block_tables, seq_lens, _scale);
+    }
+
+    TensorType           _target{};
+    SimpleTensor<T>      _reference{};
+    std::vector<int32_t> _seq_lens{};
+    std::vector<int32_t> _slots{};
+    std::vector<int32_t> _block_tables{};
+    unsigned int         _head_dim{ 0 };
+    unsigned int         _num_heads{ 0 };
+    unsigned int         _num_kv_heads{ 0 };
+    unsigned int         _block_size{ 0 };
+    unsigned int         _max_blocks{ 0 };
+    DataType             _data_type{};
+    float                _scale{ 1.f };
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+
+#endif // ACL_TESTS_VALIDATION_FIXTURES_PAGEDATTENTIONFIXTURE_H
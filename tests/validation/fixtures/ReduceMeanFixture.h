@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2018-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,7 @@
 #include "arm_compute/core/TensorShape.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/runtime/Scheduler.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "tests/AssetsLibrary.h"
 #include "tests/Globals.h"
@@ -175,6 +176,24 @@ public:
         ReduceMeanValidationFixture<TensorType, AccessorType, FunctionType, T>::setup(shape, data_type, axis, keep_dims, QuantizationInfo(), QuantizationInfo());
     }
 };
+
+/** Reduce mean configured and run with @p num_threads threads
+ *
+ * When the output has fewer elements than threads, the reduction itself is split into partial results.
+ */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class ReduceMeanThreadedFixture : public ReduceMeanValidationFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    void setup(TensorShape shape, DataType data_type, Coordinates axis, bool keep_dims, QuantizationInfo quantization_info_input, QuantizationInfo quantization_info_output,
+               unsigned int num_threads)
+    {
+        const unsigned int scheduler_threads = Scheduler::get().num_threads();
+        Scheduler::get().set_num_threads(num_threads);
+        ReduceMeanValidationFixture<TensorType, AccessorType, FunctionType, T>::setup(shape, data_type, axis, keep_dims, quantization_info_input, quantization_info_output);
+        Scheduler::get().set_num_threads(scheduler_threads);
+    }
+};
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_RESIZENORMALIZEFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_RESIZENORMALIZEFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/ResizeNormalizeInfo.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ResizeNormalize.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class ResizeNormalizeValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape input_shape, Size2D output_size, InterpolationPolicy policy, SamplingPolicy sampling_policy, bool swap_channels, DataType data_type,
+               QuantizationInfo output_qinfo)
+    {
+        if(std::is_same<TensorType, Tensor>::value && // Cpu
+           data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        // ImageNet statistics on the 0-255 range
+        const ResizeNormalizeInfo info(policy, { { 123.68f, 116.78f, 103.94f } }, { { 1.f / 58.40f, 1.f / 57.12f, 1.f / 57.38f } }, swap_channels, sampling_policy);
+
+        _input_shape  = input_shape;
+        _output_shape = TensorShape(input_shape[0], output_size.width, output_size.height, input_shape[3]);
+        _data_type    = data_type;
+        _output_qinfo = output_qinfo;
+
+        _target    = compute_target(info);
+        _reference = compute_reference(info);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor)
+    {
+        library->fill_tensor_uniform(tensor, 0);
+    }
+
+    TensorType compute_target(const ResizeNormalizeInfo &info)
+    {
+        // Create tensors
+        TensorType src = create_tensor<TensorType>(_input_shape, DataType::U8, 1, QuantizationInfo(), DataLayout::NHWC);
+        TensorType dst = create_tensor<TensorType>(_output_shape, _data_type, 1, _output_qinfo, DataLayout::NHWC);
+
+        // Create and configure function
+        FunctionType preprocess;
+        ARM_COMPUTE_ERROR_THROW_ON(preprocess.validate(src.info(), dst.info(), info));
+        preprocess.configure(&src, &dst, info);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(src));
+
+        // Compute function
+        preprocess.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const ResizeNormalizeInfo &info)
+    {
+        // Create reference
+        SimpleTensor<uint8_t> src{ _input_shape, DataType::U8 };
+
+        // Fill reference
+        fill(src);
+
+        return reference::resize_normalize<T>(src, _output_shape, _data_type, info, _output_qinfo);
+    }
+
+    TensorType       _target{};
+    SimpleTensor<T>  _reference{};
+    TensorShape      _input_shape{};
+    TensorShape      _output_shape{};
+    DataType         _data_type{};
+    QuantizationInfo _output_qinfo{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+
+#endif // ACL_TESTS_VALIDATION_FIXTURES_RESIZENORMALIZEFIXTURE_H
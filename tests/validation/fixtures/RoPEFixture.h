@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_ROPEFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_ROPEFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/RoPEInfo.h"
+#include "arm_compute/runtime/KVCache.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/KVCacheAppend.h"
+#include "tests/validation/reference/RoPE.h"
+
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+/** Base fixture holding the tensor fill shared by the rotary position embedding fixtures */
+template <typename TensorType, typename T>
+class RoPEFixtureBase : public framework::Fixture
+{
+protected:
+    bool skip(DataType data_type) const
+    {
+        return std::is_same<TensorType, Tensor>::value && // Cpu
+               data_type == DataType::F16 && !CPUInfo::get().has_fp16();
+    }
+
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        switch(tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{ -1.0f, 1.0f };
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+                library->fill_tensor_uniform(tensor, i);
+        }
+    }
+
+    /** Absolute positions of @p num_tokens consecutive tokens starting at @p first */
+    static std::vector<int> consecutive_positions(int first, int num_tokens)
+    {
+        std::vector<int> positions(num_tokens);
+        for(int t = 0; t < num_tokens; ++t)
+        {
+            positions[t] = first + t;
+        }
+        return positions;
+    }
+};
+
+/** Rotate queries and keys, either in place or out of place, with or without explicit token positions */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class RoPEValidationFixture : public RoPEFixtureBase<TensorType, T>
+{
+public:
+    void setup(TensorShape q_shape, unsigned int num_kv_heads, RoPEMode mode, unsigned int rotary_dim, int position_offset, unsigned int max_positions,
+               bool use_positions, bool in_place, DataType data_type)
+    {
+        if(this->skip(data_type))
+        {
+            return;
+        }
+
+        TensorShape k_shape = q_shape;
+        k_shape.set(2, num_kv_heads);
+
+        // Explicit positions are out of order and go past the precomputed table
+        const int num_tokens = q_shape[1];
+        _positions.clear();
+        for(int t = 0; t < num_tokens; ++t)
+        {
+            _positions.push_back(use_positions ? (num_tokens - 1 - t) * 7 % 53 : t);
+        }
+
+        const RoPEInfo info(mode, 10000.f, rotary_dim, position_offset, max_positions);
+        compute_target(q_shape, k_shape, info, use_positions, in_place, data_type);
+        compute_reference(q_shape, k_shape, info, data_type);
+    }
+
+protected:
+    void compute_target(const TensorShape &q_shape, const TensorShape &k_shape, const RoPEInfo &info, bool use_positions, bool in_place, DataType data_type)
+    {
+        // Create tensors
+        TensorType q         = create_tensor<TensorType>(q_shape, data_type);
+        TensorType k         = create_tensor<TensorType>(k_shape, data_type);
+        TensorType positions = create_tensor<TensorType>(TensorShape(q_shape[1]), DataType::S32);
+        TensorType q_dst     = create_tensor<TensorType>(q_shape, data_type);
+        TensorType k_dst     = create_tensor<TensorType>(k_shape, data_type);
+
+        TensorType *positions_ptr = use_positions ? &positions : nullptr;
+        TensorType *q_out         = in_place ? &q : &q_dst;
+        TensorType *k_out         = in_place ? &k : &k_dst;
+
+        // Create and configure function
+        FunctionType rope;
+        ARM_COMPUTE_ERROR_THROW_ON(FunctionType::validate(q.info(), k.info(), use_positions ? positions.info() : nullptr, q_out->info(), k_out->info(), info));
+        rope.configure(&q, &k, positions_ptr, q_out, k_out, info);
+
+        // Allocate tensors
+        q.allocator()->allocate();
+        k.allocator()->allocate();
+        positions.allocator()->allocate();
+        q_dst.allocator()->allocate();
+        k_dst.allocator()->allocate();
+
+        // Fill tensors
+        this->fill(AccessorType(q), 0);
+        this->fill(AccessorType(k), 1);
+        if(use_positions)
+        {
+            library->fill_static_values(AccessorType(positions), std::vector<int32_t>(_positions.begin(), _positions.end()));
+        }
+
+        // Compute function twice to check that the precomputed table is reused
+        rope.run();
+        if(!in_place)
+        {
+            rope.run();
+        }
+
+        _target_q = std::move(*q_out);
+        _target_k = std::move(*k_out);
+    }
+
+    void compute_reference(const TensorShape &q_shape, const TensorShape &k_shape, const RoPEInfo &info, DataType data_type)
+    {
+        // Create reference
+        SimpleTensor<T> q{ q_shape, data_type };
+        SimpleTensor<T> k{ k_shape, data_type };
+
+        // Fill reference
+        this->fill(q, 0);
+        this->fill(k, 1);
+
+        std::vector<int> positions(_positions);
+        for(auto &p : positions)
+        {
+            p += info.position_offset;
+        }
+
+        _reference_q = reference::rope<T>(q, positions, info);
+        _reference_k = reference::rope<T>(k, positions, info);
+    }
+
+    TensorType       _target_q{};
+    TensorType       _target_k{};
+    SimpleTensor<T>  _reference_q{};
+    SimpleTensor<T>  _reference_k{};
+    std::vector<int> _positions{};
+};
+
+/** Rotate the keys of a prefill followed by decoding steps of one token straight into a key cache */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class RoPEKVCacheValidationFixture : public RoPEFixtureBase<TensorType, T>
+{
+public:
+    void setup(TensorShape q_shape, unsigned int num_kv_heads, RoPEMode mode, unsigned int decode_steps, int position_offset, unsigned int max_positions,
+               DataType data_type)
+    {
+        if(this->skip(data_type))
+        {
+            return;
+        }
+
+        _prefill_q_shape = q_shape;
+        _prefill_k_shape = q_shape;
+        _prefill_k_shape.set(2, num_kv_heads);
+        _decode_q_shape = _prefill_q_shape;
+        _decode_q_shape.set(1, 1);
+        _decode_k_shape = _prefill_k_shape;
+        _decode_k_shape.set(1, 1);
+        _data_type    = data_type;
+        _decode_steps = decode_steps;
+        _info         = RoPEInfo(mode, 10000.f, 0, position_offset, max_positions);
+
+        compute_target();
+        compute_reference();
+    }
+
+protected:
+    void compute_target()
+    {
+        _cache.init(KVCacheInfo(_prefill_k_shape[0], _prefill_k_shape[1] + _decode_steps, _prefill_k_shape[2], _prefill_k_shape[3], _data_type));
+
+        // Create tensors
+        TensorType prefill_q = create_tensor<TensorType>(_prefill_q_shape, _data_type);
+        TensorType prefill_k = create_tensor<TensorType>(_prefill_k_shape, _data_type);
+        TensorType decode_q  = create_tensor<TensorType>(_decode_q_shape, _data_type);
+        TensorType decode_k  = create_tensor<TensorType>(_decode_k_shape, _data_type);
+
+        // Create and configure functions, rotating the queries in place
+        FunctionType rope_prefill;
+        FunctionType rope_decode;
+        ARM_COMPUTE_ERROR_THROW_ON(FunctionType::validate(prefill_q.info(), prefill_k.info(), prefill_q.info(), _cache.tensor()->info(), _info));
+        ARM_COMPUTE_ERROR_THROW_ON(FunctionType::validate(decode_q.info(), decode_k.info(), decode_q.info(), _cache.tensor()->info(), _info));
+        rope_prefill.configure(&prefill_q, &prefill_k, &prefill_q, &_cache, _info);
+        rope_decode.configure(&decode_q, &decode_k, &decode_q, &_cache, _info);
+
+        // Allocate tensors
+        prefill_q.allocator()->allocate();
+        prefill_k.allocator()->allocate();
+        decode_q.allocator()->allocate();
+        decode_k.allocator()->allocate();
+        _cache.allocator()->allocate();
+
+        // Compute functions
+        this->fill(AccessorType(prefill_q), 0);
+        this->fill(AccessorType(prefill_k), 1);
+        rope_prefill.run();
+        for(unsigned int step = 0; step < _decode_steps; ++step)
+        {
+            this->fill(AccessorType(decode_q), 2 + 2 * step);
+            this->fill(AccessorType(decode_k), 3 + 2 * step);
+            rope_decode.run();
+        }
+
+        _target_q = std::move(_decode_steps > 0 ? decode_q : prefill_q);
+    }
+
+    void compute_reference()
+    {
+        const int num_prefill = _prefill_k_shape[1];
+
+        TensorShape cache_shape = _prefill_k_shape;
+        cache_shape.set(1, num_prefill + _decode_steps);
+
+        // Create reference
+        SimpleTensor<T> cache{ cache_shape, _data_type };
+        SimpleTensor<T> prefill_q{ _prefill_q_shape, _data_type };
+        SimpleTensor<T> prefill_k{ _prefill_k_shape, _data_type };
+        SimpleTensor<T> decode_q{ _decode_q_shape, _data_type };
+        SimpleTensor<T> decode_k{ _decode_k_shape, _data_type };
+
+        // Fill reference
+        this->fill(prefill_q, 0);
+        this->fill(prefill_k, 1);
+
+        std::vector<int> positions = this->consecutive_positions(_info.position_offset, num_prefill);
+        _reference_q               = reference::rope<T>(prefill_q, positions, _info);
+        cache                      = reference::kv_cache_append<T, T>(cache, reference::rope<T>(prefill_k, positions, _info), 0);
+        for(unsigned int step = 0; step < _decode_steps; ++step)
+        {
+            this->fill(decode_q, 2 + 2 * step);
+            this->fill(decode_k, 3 + 2 * step);
+
+            positions    = this->consecutive_positions(_info.position_offset + num_prefill + step, 1);
+            _reference_q = reference::rope<T>(decode_q, positions, _info);
+            cache        = reference::kv_cache_append<T, T>(cache, reference::rope<T>(decode_k, positions, _info), num_prefill + step);
+        }
+        _reference_k = cache;
+    }
+
+    KVCache         _cache{};
+    TensorType      _target_q{};
+    SimpleTensor<T> _reference_q{};
+    SimpleTensor<T> _reference_k{};
+    RoPEInfo        _info{};
+    TensorShape     _prefill_q_shape{};
+    TensorShape     _prefill_k_shape{};
+    TensorShape     _decode_q_shape{};
+    TensorShape     _decode_k_shape{};
+    DataType        _data_type{};
+    unsigned int    _decode_steps{ 0 };
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+
+#endif // ACL_TESTS_VALIDATION_FIXTURES_ROPEFIXTURE_H
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_HELPERS_GRAPHHELPERS_H
+#define ACL_TESTS_VALIDATION_HELPERS_GRAPHHELPERS_H
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/ITensorAccessor.h"
+#include "arm_compute/graph/PassManager.h"
+
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace helper
+{
+/** Graph accessor that fills a F32 tensor with the values of a vector, or copies the tensor into it
+ *
+ * The elements are visited in the order of the tensor dimensions, so the vector does not depend on the padding.
+ */
+class VectorAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in, out] values Values to fill the tensor with, or vector to copy the tensor to. Must outlive the graph.
+     * @param[in]      fill   True to fill the tensor, false to copy it and stop the execution of the graph.
+     */
+    VectorAccessor(std::vector<float> &values, bool fill) : _values(values), _fill(fill)
+    {
+    }
+
+    // Inherited methods overridden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        const TensorShape &shape = tensor.info()->tensor_shape();
+        if (!_fill)
+        {
+            _values.resize(shape.total_size());
+        }
+        ARM_COMPUTE_ERROR_ON(_values.size() != shape.total_size());
+
+        Window window;
+        window.use_tensor_dimensions(shape);
+
+        size_t i = 0;
+        execute_window_loop(window,
+                            [&](const Coordinates &id)
+                            {
+                                auto *ptr = reinterpret_cast<float *>(tensor.ptr_to_element(id));
+                                if (_fill)
+                                {
+                                    *ptr = _values[i];
+                                }
+                                else
+                                {
+                                    _values[i] = *ptr;
+                                }
+                                ++i;
+                            });
+        return _fill;
+    }
+
+private:
+    std::vector<float> &_values;
+    bool                _fill;
+};
+
+/** Graph with the context and the manager to finalize and run it on the CPU */
+class TestGraph
+{
+public:
+    /** Constructor
+     *
+     * @param[in] name Name of the graph
+     */
+    explicit TestGraph(std::string name) : _ctx(), _manager(), _g(0, std::move(name))
+    {
+    }
+    /** Graph accessor
+     *
+     * @return The graph to build and inspect
+     */
+    graph::Graph &graph()
+    {
+        return _g;
+    }
+    /** Finalizes the graph for the CPU
+     *
+     * @param[in] pm     Mutation passes to apply
+     * @param[in] config (Optional) Graph configuration
+     */
+    void finalize(graph::PassManager &pm, const graph::GraphConfig &config = graph::GraphConfig())
+    {
+        _ctx.set_config(config);
+        _manager.finalize_graph(_g, _ctx, pm, graph::Target::NEON);
+    }
+    /** Runs the graph once, the output accessors must stop the execution */
+    void run()
+    {
+        _manager.execute_graph(_g);
+    }
+
+private:
+    // The context must be destroyed after the manager and the graph, as they use its resources
+    graph::GraphContext _ctx;
+    graph::GraphManager _manager;
+    graph::Graph        _g;
+};
+
+/** Generates uniformly distributed values
+ *
+ * @param[in] num  Number of values
+ * @param[in] low  Lowest value
+ * @param[in] high Highest value
+ * @param[in] seed Seed of the generator
+ *
+ * @return The generated values
+ */
+inline std::vector<float> uniform_values(size_t num, float low, float high, std::random_device::result_type seed)
+{
+    std::mt19937                          gen(seed);
+    std::uniform_real_distribution<float> dist(low, high);
+    std::vector<float>                    values(num);
+    for (auto &v : values)
+    {
+        v = dist(gen);
+    }
+    return values;
+}
+} // namespace helper
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_HELPERS_GRAPHHELPERS_H
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "ElementwiseExpression.h"
+
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ActivationLayer.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+namespace
+{
+float evaluate_node(const ElementwiseExpressionNode &node, float lhs, float rhs)
+{
+    switch (node.op)
+    {
+        case ElementwiseExpressionOp::ADD:
+            return lhs + rhs;
+        case ElementwiseExpressionOp::SUB:
+            return lhs - rhs;
+        case ElementwiseExpressionOp::MUL:
+            return lhs * rhs;
+        case ElementwiseExpressionOp::DIV:
+            return lhs / rhs;
+        case ElementwiseExpressionOp::MAX:
+            return std::max(lhs, rhs);
+        case ElementwiseExpressionOp::MIN:
+            return std::min(lhs, rhs);
+        case ElementwiseExpressionOp::SQUARED_DIFF:
+            return (lhs - rhs) * (lhs - rhs);
+        case ElementwiseExpressionOp::POWER:
+            return std::pow(lhs, rhs);
+        case ElementwiseExpressionOp::NEG:
+            return -lhs;
+        case ElementwiseExpressionOp::ABS:
+            return std::abs(lhs);
+        case ElementwiseExpressionOp::EXP:
+            return std::exp(lhs);
+        case ElementwiseExpressionOp::LOG:
+            return std::log(lhs);
+        case ElementwiseExpressionOp::RSQRT:
+            return 1.f / std::sqrt(lhs);
+        case ElementwiseExpressionOp::SIN:
+            return std::sin(lhs);
+        case ElementwiseExpressionOp::ACTIVATION:
+            return node.act_info.enabled() ? activate_float<float>(lhs, node.act_info.a(), node.act_info.b(),
+                                                                   node.act_info.activation())
+                                           : lhs;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported operation");
+    }
+}
+} // namespace
+
+template <typename TIn, typename TOut>
+SimpleTensor<TOut> elementwise_expression(const std::vector<SimpleTensor<TIn>> &srcs,
+                                          const ElementwiseExpressionInfo      &info,
+                                          DataType                              dst_type)
+{
+    TensorShape dst_shape{};
+    for (const auto &src : srcs)
+    {
+        dst_shape = TensorShape::broadcast_shape(dst_shape, src.shape());
+    }
+
+    SimpleTensor<TOut> dst{dst_shape, dst_type};
+    std::vector<float> values(info.num_inputs() + info.nodes().size());
+
+    for (int i = 0; i < dst.num_elements(); ++i)
+    {
+        const Coordinates id = index2coord(dst_shape, i);
+
+        // Broadcast dimensions of an input read its only element
+        for (unsigned int s = 0; s < srcs.size(); ++s)
+        {
+            Coordinates src_id = id;
+            for (size_t d = 0; d < dst_shape.num_dimensions(); ++d)
+            {
+                if (srcs[s].shape()[d] == 1)
+                {
+                    src_id.set(d, 0);
+                }
+            }
+            values[s] = static_cast<float>(srcs[s][coord2index(srcs[s].shape(), src_id)]);
+        }
+
+        for (unsigned int n = 0; n < info.nodes().size(); ++n)
+        {
+            const ElementwiseExpressionNode &node = info.nodes()[n];
+            values[info.num_inputs() + n]         = evaluate_node(node, values[node.lhs], values[node.rhs]);
+        }
+
+        dst[i] = static_cast<TOut>(values.back());
+    }
+
+    return dst;
+}
+
+template SimpleTensor<float> elementwise_expression(const std::vector<SimpleTensor<float>> &srcs,
+                                                    const ElementwiseExpressionInfo        &info,
+                                                    DataType                                dst_type);
+template SimpleTensor<half>  elementwise_expression(const std::vector<SimpleTensor<half>> &srcs,
+                                                    const ElementwiseExpressionInfo       &info,
+                                                    DataType                               dst_type);
+template SimpleTensor<float> elementwise_expression(const std::vector<SimpleTensor<half>> &srcs,
+                                                    const ElementwiseExpressionInfo       &info,
+                                                    DataType                               dst_type);
+template SimpleTensor<half>  elementwise_expression(const std::vector<SimpleTensor<float>> &srcs,
+                                                    const ElementwiseExpressionInfo        &info,
+                                                    DataType                                dst_type);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "EmbeddingBag.h"
+
+#include "tests/validation/Helpers.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+namespace
+{
+template <typename T>
+float embedding_value(const SimpleTensor<T> &table, const SimpleTensor<float> &row_params, int row, int channel)
+{
+    ARM_COMPUTE_UNUSED(row_params);
+    return static_cast<float>(table[coord2index(table.shape(), Coordinates(channel, row))]);
+}
+
+template <>
+float embedding_value(const SimpleTensor<int8_t> &table, const SimpleTensor<float> &row_params, int row, int channel)
+{
+    const float scale = row_params[coord2index(row_params.shape(), Coordinates(0, row))];
+    const float bias  = row_params[coord2index(row_params.shape(), Coordinates(1, row))];
+    return static_cast<float>(table[coord2index(table.shape(), Coordinates(channel, row))]) * scale + bias;
+}
+
+template <>
+float embedding_value(const SimpleTensor<uint8_t> &table, const SimpleTensor<float> &row_params, int row, int channel)
+{
+    const float   scale  = row_params[coord2index(row_params.shape(), Coordinates(0, row))];
+    const float   bias   = row_params[coord2index(row_params.shape(), Coordinates(1, row))];
+    const uint8_t byte   = table[coord2index(table.shape(), Coordinates(channel / 2, row))];
+    const int32_t nibble = (channel % 2 == 0) ? (byte & 0xF) : (byte >> 4);
+    return static_cast<float>(nibble >= 8 ? nibble - 16 : nibble) * scale + bias;
+}
+} // namespace
+
+template <typename T, typename TOut>
+SimpleTensor<TOut> embedding_bag(const SimpleTensor<T>     &table,
+                                 const SimpleTensor<float> &row_params,
+                                 const std::vector<int>    &indices,
+                                 const std::vector<int>    &offsets,
+                                 const EmbeddingBagInfo    &info)
+{
+    const bool is_packed   = table.data_type() == DataType::U8;
+    const int  dim         = is_packed ? 2 * table.shape()[0] : table.shape()[0];
+    const int  num_rows    = table.shape()[1];
+    const int  num_indices = indices.size();
+    const bool pooling     = info.mode != EmbeddingBagMode::NONE;
+    const int  num_outputs = pooling ? offsets.size() : num_indices;
+
+    const DataType     dst_data_type = std::is_same<TOut, float>::value ? DataType::F32 : table.data_type();
+    SimpleTensor<TOut> dst{TensorShape(dim, num_outputs), dst_data_type};
+
+    for (int o = 0; o < num_outputs; ++o)
+    {
+        int start = o;
+        int end   = o + 1;
+        if (pooling)
+        {
+            start = std::min(std::max(offsets[o], 0), num_indices);
+            end   = o + 1 < num_outputs ? std::min(std::max(offsets[o + 1], 0), num_indices) : num_indices;
+            end   = std::max(start, end);
+        }
+
+        for (int c = 0; c < dim; ++c)
+        {
+            float acc   = 0.f;
+            int   count = 0;
+            for (int i = start; i < end; ++i)
+            {
+                if (indices[i] >= 0 && indices[i] < num_rows)
+                {
+                    acc += embedding_value(table, row_params, indices[i], c);
+                    ++count;
+                }
+            }
+            if (info.mode == EmbeddingBagMode::MEAN && count > 0)
+            {
+                acc /= static_cast<float>(count);
+            }
+            dst[coord2index(dst.shape(), Coordinates(c, o))] = static_cast<TOut>(acc);
+        }
+    }
+
+    return dst;
+}
+
+template SimpleTensor<float> embedding_bag(const SimpleTensor<float> &table,
+                                           const SimpleTensor<float> &row_params,
+                                           const std::vector<int>    &indices,
+                                           const std::vector<int>    &offsets,
+                                           const EmbeddingBagInfo    &info);
+template SimpleTensor<half>  embedding_bag(const SimpleTensor<half>  &table,
+                                           const SimpleTensor<float> &row_params,
+                                           const std::vector<int>    &indices,
+                                           const std::vector<int>    &offsets,
+                                           const EmbeddingBagInfo    &info);
+template SimpleTensor<float> embedding_bag(const SimpleTensor<int8_t> &table,
+                                           const SimpleTensor<float>  &row_params,
+                                           const std::vector<int>     &indices,
+                                           const std::vector<int>     &offsets,
+                                           const EmbeddingBagInfo     &info);
+template SimpleTensor<float> embedding_bag(const SimpleTensor<uint8_t> &table,
+                                           const SimpleTensor<float>   &row_params,
+                                           const std::vector<int>      &indices,
+                                           const std::vector<int>      &offsets,
+                                           const EmbeddingBagInfo      &info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "GEMMDynamicQuantized.h"
+
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "tests/validation/reference/ActivationLayer.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename T>
+SimpleTensor<T> gemm_dynamic_quantized(const SimpleTensor<T> &a, const SimpleTensor<int8_t> &weights, const SimpleTensor<T> *bias,
+                                       const ActivationLayerInfo &act_info)
+{
+    const int k    = a.shape()[0];
+    const int n    = weights.shape()[0];
+    const int rows = a.shape().total_size() / k;
+
+    const QuantizationInfo &w_qinfo = weights.quantization_info();
+
+    TensorShape dst_shape = a.shape();
+    dst_shape.set(0, n);
+    SimpleTensor<T> dst{ dst_shape, a.data_type() };
+
+    std::vector<int32_t> q_row(k);
+    for(int row = 0; row < rows; ++row)
+    {
+        // Symmetric quantization of the row mapping its largest magnitude to 127
+        float max_abs = 0.f;
+        for(int i = 0; i < k; ++i)
+        {
+            max_abs = std::max(max_abs, std::abs(static_cast<float>(a[row * k + i])));
+        }
+        const float scale = max_abs > 0.f ? max_abs / 127.f : 1.f;
+
+        int32_t row_sum = 0;
+        for(int i = 0; i < k; ++i)
+        {
+            q_row[i] = utility::clamp<int32_t>(static_cast<int32_t>(std::nearbyint(static_cast<float>(a[row * k + i]) / scale)), -128, 127);
+            row_sum += q_row[i];
+        }
+
+        for(int x = 0; x < n; ++x)
+        {
+            const float   w_scale  = w_qinfo.scale().size() == 1 ? w_qinfo.scale()[0] : w_qinfo.scale()[x];
+            const int32_t w_offset = w_qinfo.offset().empty() ? 0 : (w_qinfo.offset().size() == 1 ? w_qinfo.offset()[0] : w_qinfo.offset()[x]);
+
+            int32_t dot = 0;
+            for(int i = 0; i < k; ++i)
+            {
+                dot += q_row[i] * weights[x + i * n];
+            }
+            dot -= w_offset * row_sum;
+
+            float out = static_cast<float>(dot) * scale * w_scale;
+            if(bias != nullptr)
+            {
+                out += static_cast<float>((*bias)[x]);
+            }
+            if(act_info.enabled())
+            {
+                out = activate_float<float>(out, act_info.a(), act_info.b(), act_info.activation());
+            }
+
+            dst[row * n + x] = static_cast<T>(out);
+        }
+    }
+
+    return dst;
+}
+
+template SimpleTensor<float> gemm_dynamic_quantized(const SimpleTensor<float> &a, const SimpleTensor<int8_t> &weights, const SimpleTensor<float> *bias,
+                                                    const ActivationLayerInfo &act_info);
+template SimpleTensor<half> gemm_dynamic_quantized(const SimpleTensor<half> &a, const SimpleTensor<int8_t> &weights, const SimpleTensor<half> *bias,
+                                                   const ActivationLayerInfo &act_info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
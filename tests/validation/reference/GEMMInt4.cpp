@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "GEMMInt4.h"
+
+#include "tests/validation/reference/ActivationLayer.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+namespace
+{
+int32_t unpack_int4(const SimpleTensor<uint8_t> &weights, int k, int n)
+{
+    const uint8_t byte   = weights[coord2index(weights.shape(), Coordinates(k / 2, n))];
+    const int32_t nibble = (k % 2 == 0) ? (byte & 0xF) : (byte >> 4);
+    return nibble >= 8 ? nibble - 16 : nibble;
+}
+
+template <typename T>
+float to_float(T value, const QuantizationInfo &qinfo)
+{
+    ARM_COMPUTE_UNUSED(qinfo);
+    return static_cast<float>(value);
+}
+
+template <>
+float to_float(int8_t value, const QuantizationInfo &qinfo)
+{
+    return dequantize_qasymm8_signed(value, qinfo);
+}
+} // namespace
+
+template <typename TIn, typename TOut>
+SimpleTensor<TOut> gemm_int4(const SimpleTensor<TIn> &a, const SimpleTensor<uint8_t> &weights, const SimpleTensor<float> &scales,
+                             const SimpleTensor<TOut> *bias, const GEMMInt4Info &info)
+{
+    const int k          = a.shape()[0];
+    const int n          = weights.shape()[1];
+    const int rows       = a.shape().total_size() / k;
+    const int group_size = info.group_size != 0 ? info.group_size : k;
+
+    TensorShape dst_shape = a.shape();
+    dst_shape.set(0, n);
+
+    const DataType     dst_data_type = std::is_same<TOut, float>::value ? DataType::F32 : a.data_type();
+    SimpleTensor<TOut> dst{ dst_shape, dst_data_type };
+
+    const ActivationLayerInfo &act = info.activation_info;
+
+    for(int row = 0; row < rows; ++row)
+    {
+        for(int x = 0; x < n; ++x)
+        {
+            float acc = 0.f;
+            for(int g = 0; g * group_size < k; ++g)
+            {
+                float group_acc = 0.f;
+                for(int i = g * group_size; i < std::min(k, (g + 1) * group_size); ++i)
+                {
+                    group_acc += to_float(a[row * k + i], a.quantization_info()) * unpack_int4(weights, i, x);
+                }
+                acc += group_acc * scales[coord2index(scales.shape(), Coordinates(g, x))];
+            }
+
+            if(bias != nullptr)
+            {
+                acc += static_cast<float>((*bias)[x]);
+            }
+
+            if(act.enabled())
+            {
+                acc = activate_float<float>(acc, act.a(), act.b(), act.activation());
+            }
+
+            dst[row * n + x] = static_cast<TOut>(acc);
+        }
+    }
+
+    return dst;
+}
+
+template SimpleTensor<float> gemm_int4(const SimpleTensor<float> &a, const SimpleTensor<uint8_t> &weights, const SimpleTensor<float> &scales,
+                                       const SimpleTensor<float> *bias, const GEMMInt4Info &info);
+template SimpleTensor<half> gemm_int4(const SimpleTensor<half> &a, const SimpleTensor<uint8_t> &weights, const SimpleTensor<float> &scales,
+                                      const SimpleTensor<half> *bias, const GEMMInt4Info &info);
+template SimpleTensor<float> gemm_int4(const SimpleTensor<int8_t> &a, const SimpleTensor<uint8_t> &weights, const SimpleTensor<float> &scales,
+                                       const SimpleTensor<float> *bias, const GEMMInt4Info &info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
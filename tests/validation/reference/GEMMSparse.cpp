@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "GEMMSparse.h"
+
+#include "tests/validation/reference/ActivationLayer.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename TIn, typename TOut>
+SimpleTensor<TOut> gemm_sparse(const SimpleTensor<TIn> &a, const SimpleTensor<TIn> &weights, const SimpleTensor<TOut> *bias,
+                               const ActivationLayerInfo &act_info)
+{
+    using TAcc = typename std::conditional<std::is_integral<TIn>::value, int32_t, float>::type;
+
+    const int k    = a.shape()[0];
+    const int n    = weights.shape()[0];
+    const int rows = a.shape().total_size() / k;
+
+    const bool    is_quantized = is_data_type_quantized(a.data_type());
+    const int32_t a_offset     = is_quantized ? a.quantization_info().uniform().offset : 0;
+
+    TensorShape dst_shape = a.shape();
+    dst_shape.set(0, n);
+    SimpleTensor<TOut> dst{ dst_shape, is_quantized ? DataType::S32 : a.data_type() };
+
+    for(int row = 0; row < rows; ++row)
+    {
+        for(int x = 0; x < n; ++x)
+        {
+            TAcc acc = 0;
+            for(int i = 0; i < k; ++i)
+            {
+                acc += (static_cast<TAcc>(a[row * k + i]) - static_cast<TAcc>(a_offset)) * static_cast<TAcc>(weights[x + i * n]);
+            }
+
+            if(bias != nullptr)
+            {
+                acc += static_cast<TAcc>((*bias)[x]);
+            }
+
+            if(act_info.enabled())
+            {
+                acc = activate_float<float>(acc, act_info.a(), act_info.b(), act_info.activation());
+            }
+
+            dst[row * n + x] = static_cast<TOut>(acc);
+        }
+    }
+
+    return dst;
+}
+
+template SimpleTensor<float> gemm_sparse(const SimpleTensor<float> &a, const SimpleTensor<float> &weights, const SimpleTensor<float> *bias,
+                                         const ActivationLayerInfo &act_info);
+template SimpleTensor<half> gemm_sparse(const SimpleTensor<half> &a, const SimpleTensor<half> &weights, const SimpleTensor<half> *bias,
+                                        const ActivationLayerInfo &act_info);
+template SimpleTensor<int32_t> gemm_sparse(const SimpleTensor<int8_t> &a, const SimpleTensor<int8_t> &weights, const SimpleTensor<int32_t> *bias,
+                                           const ActivationLayerInfo &act_info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
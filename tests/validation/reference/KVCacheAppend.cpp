@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "KVCacheAppend.h"
+
+#include "arm_compute/core/QuantizationInfo.h"
+#include "arm_compute/core/Types.h"
+
+#include "tests/validation/Helpers.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+namespace
+{
+template <typename T, typename TCache>
+TCache convert(T value, const QuantizationInfo &qinfo, int head)
+{
+    ARM_COMPUTE_UNUSED(qinfo, head);
+    return static_cast<TCache>(value);
+}
+
+template <>
+int8_t convert(float value, const QuantizationInfo &qinfo, int head)
+{
+    return quantize_qsymm8_per_channel(value, qinfo, head);
+}
+
+template <>
+int8_t convert(half value, const QuantizationInfo &qinfo, int head)
+{
+    return quantize_qsymm8_per_channel(static_cast<float>(value), qinfo, head);
+}
+} // namespace
+
+template <typename T, typename TCache>
+SimpleTensor<TCache> kv_cache_append(const SimpleTensor<TCache> &cache, const SimpleTensor<T> &src, int offset)
+{
+    ARM_COMPUTE_ERROR_ON(offset + src.shape()[1] > cache.shape()[1]);
+
+    SimpleTensor<TCache> dst(cache);
+
+    for(int i = 0; i < src.num_elements(); ++i)
+    {
+        Coordinates coord = index2coord(src.shape(), i);
+        const int   head  = coord[2];
+        coord.set(1, coord[1] + offset);
+
+        dst[coord2index(dst.shape(), coord)] = convert<T, TCache>(src[i], cache.quantization_info(), head);
+    }
+
+    return dst;
+}
+
+template SimpleTensor<float> kv_cache_append(const SimpleTensor<float> &cache, const SimpleTensor<float> &src, int offset);
+template SimpleTensor<half> kv_cache_append(const SimpleTensor<half> &cache, const SimpleTensor<half> &src, int offset);
+template SimpleTensor<int8_t> kv_cache_append(const SimpleTensor<int8_t> &cache, const SimpleTensor<float> &src, int offset);
+template SimpleTensor<int8_t> kv_cache_append(const SimpleTensor<int8_t> &cache, const SimpleTensor<half> &src, int offset);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "PagedAttention.h"
+
+#include "arm_compute/core/Types.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename T>
+SimpleTensor<T> paged_kv_cache_append(const SimpleTensor<T> &pool, const SimpleTensor<T> &src, const SimpleTensor<int32_t> &slots)
+{
+    const int head_dim   = src.shape()[0];
+    const int num_heads  = src.shape()[1];
+    const int num_tokens = src.shape()[2];
+    const int block_size = pool.shape()[1];
+
+    SimpleTensor<T> dst(pool);
+
+    for(int t = 0; t < num_tokens; ++t)
+    {
+        const int slot = slots[t];
+        if(slot < 0)
+        {
+            continue;
+        }
+        for(int h = 0; h < num_heads; ++h)
+        {
+            for(int x = 0; x < head_dim; ++x)
+            {
+                dst[coord2index(dst.shape(), Coordinates(x, slot % block_size, h, slot / block_size))] = src[coord2index(src.shape(), Coordinates(x, h, t))];
+            }
+        }
+    }
+
+    return dst;
+}
+
+template <typename T>
+SimpleTensor<T> paged_attention(const SimpleTensor<T> &q, const SimpleTensor<T> &k, const SimpleTensor<T> &v,
+                                const SimpleTensor<int32_t> &block_tables, const SimpleTensor<int32_t> &seq_lens, float scale)
+{
+    const int head_dim   = q.shape()[0];
+    const int num_heads  = q.shape()[1];
+    const int num_seqs   = q.shape()[2];
+    const int block_size = k.shape()[1];
+    const int group      = num_heads / static_cast<int>(k.shape()[2]);
+
+    SimpleTensor<T> dst(q.shape(), q.data_type());
+
+    for(int s = 0; s < num_seqs; ++s)
+    {
+        const int len = seq_lens[s];
+        for(int h = 0; h < num_heads; ++h)
+        {
+            const auto kv_coord = [&](int x, int p)
+            {
+                const int block = block_tables[coord2index(block_tables.shape(), Coordinates(p / block_size, s))];
+                return Coordinates(x, p % block_size, h / group, block);
+            };
+
+            std::vector<float> scores(len);
+            float              max_score = -std::numeric_limits<float>::infinity();
+            for(int p = 0; p < len; ++p)
+            {
+                float dot = 0.f;
+                for(int x = 0; x < head_dim; ++x)
+                {
+                    dot += static_cast<float>(q[coord2index(q.shape(), Coordinates(x, h, s))]) * static_cast<float>(k[coord2index(k.shape(), kv_coord(x, p))]);
+                }
+                scores[p] = dot * scale;
+                max_score = std::max(max_score, scores[p]);
+            }
+
+            float sum = 0.f;
+            for(int p = 0; p < len; ++p)
+            {
+                scores[p] = std::exp(scores[p] - max_score);
+                sum += scores[p];
+            }
+
+            for(int x = 0; x < head_dim; ++x)
+            {
+                float acc = 0.f;
+                for(int p = 0; p < len; ++p)
+                {
+                    acc += scores[p] * static_cast<float>(v[coord2index(v.shape(), kv_coord(x, p))]);
+                }
+                dst[coord2index(dst.shape(), Coordinates(x, h, s))] = static_cast<T>(len > 0 ? acc / sum : 0.f);
+            }
+        }
+    }
+
+    return dst;
+}
+
+template SimpleTensor<float> paged_kv_cache_append(const SimpleTensor<float> &pool, const SimpleTensor<float> &src, const SimpleTensor<int32_t> &slots);
+template SimpleTensor<half> paged_kv_cache_append(const SimpleTensor<half> &pool, const SimpleTensor<half> &src, const SimpleTensor<int32_t> &slots);
+template SimpleTensor<float> paged_attention(const SimpleTensor<float> &q, const SimpleTensor<float> &k, const SimpleTensor<float> &v,
+                                             const SimpleTensor<int32_t> &block_tables, const SimpleTensor<int32_t> &seq_lens, float scale);
+template SimpleTensor<half> paged_attention(const SimpleTensor<half> &q, const SimpleTensor<half> &k, const SimpleTensor<half> &v,
+                                            const SimpleTensor<int32_t> &block_tables, const SimpleTensor<int32_t> &seq_lens, float scale);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
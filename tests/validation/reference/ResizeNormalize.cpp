@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "ResizeNormalize.h"
+
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "src/core/utils/ScaleUtils.h"
+#include "support/Rounding.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+namespace
+{
+int nearest_index(int out_idx, float ratio, int in_size, SamplingPolicy sampling_policy, bool align_corners)
+{
+    float in_coord = 0.f;
+    if(sampling_policy == SamplingPolicy::CENTER)
+    {
+        in_coord = std::floor((out_idx + 0.5f) * ratio);
+    }
+    else
+    {
+        in_coord = align_corners ? arm_compute::utils::rounding::round_half_away_from_zero(out_idx * ratio) : std::floor(out_idx * ratio);
+    }
+    return utility::clamp<int>(static_cast<int>(in_coord), 0, in_size - 1);
+}
+
+/** Source range [from, to) averaged by area interpolation, which samples the nearest pixel when upsampling */
+std::pair<int, int> area_range(int out_idx, float ratio, int in_size, SamplingPolicy sampling_policy, bool align_corners)
+{
+    if(ratio <= 1.f)
+    {
+        const int idx = nearest_index(out_idx, ratio, in_size, sampling_policy, align_corners);
+        return std::make_pair(idx, idx + 1);
+    }
+    const int from = utility::clamp<int>(static_cast<int>(std::floor(out_idx * ratio)), 0, in_size - 1);
+    const int to   = utility::clamp<int>(static_cast<int>(std::ceil((out_idx + 1) * ratio)), from + 1, in_size);
+    return std::make_pair(from, to);
+}
+
+template <typename T>
+T convert_output(float value, const QuantizationInfo &qinfo)
+{
+    ARM_COMPUTE_UNUSED(qinfo);
+    return static_cast<T>(value);
+}
+
+template <>
+uint8_t convert_output(float value, const QuantizationInfo &qinfo)
+{
+    return quantize_qasymm8(value, qinfo);
+}
+} // namespace
+
+template <typename T>
+SimpleTensor<T> resize_normalize(const SimpleTensor<uint8_t> &src, const TensorShape &dst_shape, DataType dst_data_type,
+                                 const ResizeNormalizeInfo &info, const QuantizationInfo &dst_qinfo)
+{
+    SimpleTensor<T> dst{ dst_shape, dst_data_type, 1, dst_qinfo };
+
+    const int in_w     = src.shape()[1];
+    const int in_h     = src.shape()[2];
+    const int out_w    = dst_shape[1];
+    const int out_h    = dst_shape[2];
+    const int channels = dst_shape[0];
+    const int batches  = dst_shape[3];
+
+    const bool  align_corners = info.align_corners && info.sampling_policy != SamplingPolicy::CENTER;
+    const float wr            = arm_compute::scale_utils::calculate_resize_ratio(in_w, out_w, align_corners);
+    const float hr            = arm_compute::scale_utils::calculate_resize_ratio(in_h, out_h, align_corners);
+
+    for(int b = 0; b < batches; ++b)
+    {
+        for(int yo = 0; yo < out_h; ++yo)
+        {
+            for(int xo = 0; xo < out_w; ++xo)
+            {
+                for(int c = 0; c < channels; ++c)
+                {
+                    const int  src_c = info.swap_channels ? channels - 1 - c : c;
+                    const auto pixel = [&](int x, int y) -> float
+                    {
+                        return src[coord2index(src.shape(), Coordinates(src_c, x, y, b))];
+                    };
+
+                    float value = 0.f;
+                    switch(info.interpolation_policy)
+                    {
+                        case InterpolationPolicy::NEAREST_NEIGHBOR:
+                        {
+                            value = pixel(nearest_index(xo, wr, in_w, info.sampling_policy, align_corners), nearest_index(yo, hr, in_h, info.sampling_policy, align_corners));
+                            break;
+                        }
+                        case InterpolationPolicy::BILINEAR:
+                        {
+                            const bool  is_center = info.sampling_policy == SamplingPolicy::CENTER;
+                            const float x_src     = is_center ? (xo + 0.5f) * wr - 0.5f : xo * wr;
+                            const float y_src     = is_center ? (yo + 0.5f) * hr - 0.5f : yo * hr;
+                            const int   xi        = static_cast<int>(std::floor(x_src));
+                            const int   yi        = static_cast<int>(std::floor(y_src));
+                            const float dx        = x_src - xi;
+                            const float dy        = y_src - yi;
+
+                            // Replicate the border
+                            const int x0 = utility::clamp<int>(xi, 0, in_w - 1);
+                            const int x1 = utility::clamp<int>(xi + 1, 0, in_w - 1);
+                            const int y0 = utility::clamp<int>(yi, 0, in_h - 1);
+                            const int y1 = utility::clamp<int>(yi + 1, 0, in_h - 1);
+
+                            value = pixel(x0, y0) * (1.f - dx) * (1.f - dy) + pixel(x1, y0) * dx * (1.f - dy) + pixel(x0, y1) * (1.f - dx) * dy + pixel(x1, y1) * dx * dy;
+                            break;
+                        }
+                        case InterpolationPolicy::AREA:
+                        {
+                            const auto x_range = area_range(xo, wr, in_w, info.sampling_policy, align_corners);
+                            const auto y_range = area_range(yo, hr, in_h, info.sampling_policy, align_corners);
+
+                            float sum = 0.f;
+                            for(int y = y_range.first; y < y_range.second; ++y)
+                            {
+                                for(int x = x_range.first; x < x_range.second; ++x)
+                                {
+                                    sum += pixel(x, y);
+                                }
+                            }
+                            value = sum / ((x_range.second - x_range.first) * (y_range.second - y_range.first));
+                            break;
+                        }
+                        default:
+                            ARM_COMPUTE_ERROR("Unsupported interpolation policy");
+                    }
+
+                    const float normalized                                 = (value - info.mean[c]) * info.scale[c];
+                    dst[coord2index(dst_shape, Coordinates(c, xo, yo, b))] = convert_output<T>(normalized, dst_qinfo);
+                }
+            }
+        }
+    }
+
+    return dst;
+}
+
+template SimpleTensor<float> resize_normalize(const SimpleTensor<uint8_t> &src, const TensorShape &dst_shape, DataType dst_data_type,
+                                              const ResizeNormalizeInfo &info, const QuantizationInfo &dst_qinfo);
+template SimpleTensor<half> resize_normalize(const SimpleTensor<uint8_t> &src, const TensorShape &dst_shape, DataType dst_data_type,
+                                             const ResizeNormalizeInfo &info, const QuantizationInfo &dst_qinfo);
+template SimpleTensor<uint8_t> resize_normalize(const SimpleTensor<uint8_t> &src, const TensorShape &dst_shape, DataType dst_data_type,
+                                                const ResizeNormalizeInfo &info, const QuantizationInfo &dst_qinfo);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
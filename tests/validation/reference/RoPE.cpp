@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "RoPE.h"
+
+#include "tests/validation/Helpers.h"
+
+#include <cmath>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename T>
+SimpleTensor<T> rope(const SimpleTensor<T> &src, const std::vector<int> &positions, const RoPEInfo &info)
+{
+    const int head_dim   = src.shape()[0];
+    const int num_tokens = src.shape()[1];
+    const int num_rows   = src.num_elements() / head_dim;
+    const int rotary_dim = info.rotary_dim == 0 ? head_dim : static_cast<int>(info.rotary_dim);
+    const int half       = rotary_dim / 2;
+
+    ARM_COMPUTE_ERROR_ON(static_cast<int>(positions.size()) != num_tokens);
+
+    SimpleTensor<T> dst(src);
+
+    for(int r = 0; r < num_rows; ++r)
+    {
+        const T  *in  = src.data() + r * head_dim;
+        T        *out = dst.data() + r * head_dim;
+        const int pos = positions[r % num_tokens];
+
+        for(int i = 0; i < half; ++i)
+        {
+            const double angle = pos * std::pow(static_cast<double>(info.theta_base), -2.0 * i / rotary_dim);
+            const double c     = std::cos(angle);
+            const double s     = std::sin(angle);
+
+            const int    i0 = info.mode == RoPEMode::NEOX ? i : 2 * i;
+            const int    i1 = info.mode == RoPEMode::NEOX ? i + half : 2 * i + 1;
+            const double x0 = static_cast<double>(in[i0]);
+            const double x1 = static_cast<double>(in[i1]);
+
+            out[i0] = static_cast<T>(x0 * c - x1 * s);
+            out[i1] = static_cast<T>(x1 * c + x0 * s);
+        }
+    }
+
+    return dst;
+}
+
+template SimpleTensor<float> rope(const SimpleTensor<float> &src, const std::vector<int> &positions, const RoPEInfo &info);
+template SimpleTensor<half> rope(const SimpleTensor<half> &src, const std::vector<int> &positions, const RoPEInfo &info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,9 +38,12 @@
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/function_info/ConvolutionInfo.h"
+#include "arm_compute/function_info/ElementwiseExpressionInfo.h"
+#include "arm_compute/function_info/EmbeddingBagInfo.h"
 #include "arm_compute/function_info/FullyConnectedLayerInfo.h"
 #include "arm_compute/function_info/GEMMInfo.h"
 #include "arm_compute/function_info/MatMulInfo.h"
+#include "arm_compute/function_info/RoPEInfo.h"
 #include "arm_compute/function_info/ScatterInfo.h"
 #include "arm_compute/runtime/CL/CLTunerTypes.h"
 #include "arm_compute/runtime/CL/CLTypes.h"
@@ -3441,6 +3444,248 @@ inline std::string to_string(const arm_compute::ScatterInfo &info)
     return str.str();
 }
 
+/** Formatted output of the arm_compute::ElementwiseExpressionOp type.
+ *
+ * @param[out] os Output stream.
+ * @param[in]  op arm_compute::ElementwiseExpressionOp type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const ElementwiseExpressionOp &op)
+{
+    switch (op)
+    {
+        case ElementwiseExpressionOp::ADD:
+            os << "ADD";
+            break;
+        case ElementwiseExpressionOp::SUB:
+            os << "SUB";
+            break;
+        case ElementwiseExpressionOp::MUL:
+            os << "MUL";
+            break;
+        case ElementwiseExpressionOp::DIV:
+            os << "DIV";
+            break;
+        case ElementwiseExpressionOp::MAX:
+            os << "MAX";
+            break;
+        case ElementwiseExpressionOp::MIN:
+            os << "MIN";
+            break;
+        case ElementwiseExpressionOp::SQUARED_DIFF:
+            os << "SQUARED_DIFF";
+            break;
+        case ElementwiseExpressionOp::POWER:
+            os << "POWER";
+            break;
+        case ElementwiseExpressionOp::NEG:
+            os << "NEG";
+            break;
+        case ElementwiseExpressionOp::ABS:
+            os << "ABS";
+            break;
+        case ElementwiseExpressionOp::EXP:
+            os << "EXP";
+            break;
+        case ElementwiseExpressionOp::LOG:
+            os << "LOG";
+            break;
+        case ElementwiseExpressionOp::RSQRT:
+            os << "RSQRT";
+            break;
+        case ElementwiseExpressionOp::SIN:
+            os << "SIN";
+            break;
+        case ElementwiseExpressionOp::ACTIVATION:
+            os << "ACTIVATION";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
+    }
+    return os;
+}
+/** Formatted output of the arm_compute::ElementwiseExpressionOp type.
+ *
+ * @param[in] op arm_compute::ElementwiseExpressionOp type to output.
+ *
+ * @return Formatted string.
+ */
+inline std::string to_string(const arm_compute::ElementwiseExpressionOp &op)
+{
+    std::stringstream str;
+    str << op;
+    return str.str();
+}
+/** Formatted output of the arm_compute::ElementwiseExpressionInfo type.
+ *
+ * @param[out] os   Output stream.
+ * @param[in]  info arm_compute::ElementwiseExpressionInfo type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const arm_compute::ElementwiseExpressionInfo &info)
+{
+    os << "{Inputs=" << info.num_inputs() << ", Nodes=[";
+    for (size_t i = 0; i < info.nodes().size(); ++i)
+    {
+        const ElementwiseExpressionNode &node = info.nodes()[i];
+        os << (i == 0 ? "" : ", ");
+        if (node.op == ElementwiseExpressionOp::ACTIVATION)
+        {
+            os << node.act_info.activation() << "(" << node.lhs << ")";
+        }
+        else if (is_binary_elementwise_expression_op(node.op))
+        {
+            os << node.op << "(" << node.lhs << ", " << node.rhs << ")";
+        }
+        else
+        {
+            os << node.op << "(" << node.lhs << ")";
+        }
+    }
+    os << "]}";
+    return os;
+}
+/** Formatted output of the arm_compute::ElementwiseExpressionInfo type.
+ *
+ * @param[in] info arm_compute::ElementwiseExpressionInfo type to output.
+ *
+ * @return Formatted string.
+ */
+inline std::string to_string(const arm_compute::ElementwiseExpressionInfo &info)
+{
+    std::stringstream str;
+    str << info;
+    return str.str();
+}
+
+/** Formatted output of the arm_compute::RoPEMode type.
+ *
+ * @param[out] os   Output stream.
+ * @param[in]  mode arm_compute::RoPEMode type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const RoPEMode &mode)
+{
+    switch (mode)
+    {
+        case RoPEMode::NEOX:
+            os << "NEOX";
+            break;
+        case RoPEMode::GPTJ:
+            os << "GPTJ";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
+    }
+    return os;
+}
+/** Formatted output of the arm_compute::RoPEMode type.
+ *
+ * @param[in] mode arm_compute::RoPEMode type to output.
+ *
+ * @return Formatted string.
+ */
+inline std::string to_string(const arm_compute::RoPEMode &mode)
+{
+    std::stringstream str;
+    str << mode;
+    return str.str();
+}
+/** Formatted output of the arm_compute::RoPEInfo type.
+ *
+ * @param[out] os   Output stream.
+ * @param[in]  info arm_compute::RoPEInfo type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const arm_compute::RoPEInfo &info)
+{
+    os << "{Mode=" << info.mode << ", "
+       << "ThetaBase=" << info.theta_base << ", "
+       << "RotaryDim=" << info.rotary_dim << ", "
+       << "PositionOffset=" << info.position_offset << ", "
+       << "MaxPositions=" << info.max_positions << "}";
+    return os;
+}
+/** Formatted output of the arm_compute::RoPEInfo type.
+ *
+ * @param[in] info arm_compute::RoPEInfo type to output.
+ *
+ * @return Formatted string.
+ */
+inline std::string to_string(const arm_compute::RoPEInfo &info)
+{
+    std::stringstream str;
+    str << info;
+    return str.str();
+}
+
+/** Formatted output of the arm_compute::EmbeddingBagMode type.
+ *
+ * @param[out] os   Output stream.
+ * @param[in]  mode arm_compute::EmbeddingBagMode type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const EmbeddingBagMode &mode)
+{
+    switch (mode)
+    {
+        case EmbeddingBagMode::NONE:
+            os << "NONE";
+            break;
+        case EmbeddingBagMode::SUM:
+            os << "SUM";
+            break;
+        case EmbeddingBagMode::MEAN:
+            os << "MEAN";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
+    }
+    return os;
+}
+/** Formatted output of the arm_compute::EmbeddingBagMode type.
+ *
+ * @param[in] mode arm_compute::EmbeddingBagMode type to output.
+ *
+ * @return Formatted string.
+ */
+inline std::string to_string(const arm_compute::EmbeddingBagMode &mode)
+{
+    std::stringstream str;
+    str << mode;
+    return str.str();
+}
+/** Formatted output of the arm_compute::EmbeddingBagInfo type.
+ *
+ * @param[out] os   Output stream.
+ * @param[in]  info arm_compute::EmbeddingBagInfo type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const arm_compute::EmbeddingBagInfo &info)
+{
+    os << "{Mode=" << info.mode << ", "
+       << "PrefetchDistance=" << info.prefetch_distance << "}";
+    return os;
+}
+/** Formatted output of the arm_compute::EmbeddingBagInfo type.
+ *
+ * @param[in] info arm_compute::EmbeddingBagInfo type to output.
+ *
+ * @return Formatted string.
+ */
+inline std::string to_string(const arm_compute::EmbeddingBagInfo &info)
+{
+    std::stringstream str;
+    str << info;
+    return str.str();
+}
+
 /** Formatted output of the bool data type.
  *
  * @param[in] info bool type to output.